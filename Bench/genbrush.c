@@ -0,0 +1,120 @@
+// Benchmark of the overhead of the vectors in the projection of GBEye
+// GBEyeOrthoProcess is in the prebuilt lib and projects the Shapoid of
+// a GBObjPod into a new Shapoid, with a heap MatFloat product and a
+// heap VecFloat for its position and each of its axes
+// It's timed on 1000 pods of Facoid of dimension 3, and compared with
+// the same projection done in place with a MatFloat3x3 and VecFloat3D
+// on the stack, in nanoseconds per pod, and the results of both are
+// checked to be the same
+
+#include <stdio.h>
+#include <time.h>
+#include "genbrush.h"
+
+// Number of pods
+#define BENCH_NBPOD 1000
+
+// Number of projections of the pods per measurement
+#define BENCH_NBRUN 200
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Project the Shapoid 'shap' of dimension 3 through the GBEyeOrtho
+// 'eye' into the Shapoid 'res', a clone of 'shap'
+// As the lib, the origin of the eye is added to the position and to
+// each axis
+static void BenchProjectShapoid(const GBEyeOrtho* const eye,
+  const Shapoid* const shap, Shapoid* const res) {
+  MatFloat3x3 proj = MatFloatCreateStatic3x3();
+  memcpy(proj._val, ((const GBEye*)eye)->_proj->_val, sizeof(float) * 9);
+  VecFloat3D orig = VecFloatCreateStatic3D();
+  VecSet(&orig, 0, VecGet(&(((const GBEye*)eye)->_orig), 0));
+  VecSet(&orig, 1, VecGet(&(((const GBEye*)eye)->_orig), 1));
+  VecFloat3D v =
+    MatGetProdVec(&proj, (const VecFloat3D*)(shap->_pos));
+  VecOp(&v, 1.0, &orig, 1.0);
+  VecCopy(res->_pos, &v);
+  for (int iAxis = 3; iAxis--;) {
+    v = MatGetProdVec(&proj, (const VecFloat3D*)(shap->_axis[iAxis]));
+    VecOp(&v, 1.0, &orig, 1.0);
+    VecCopy(res->_axis[iAxis], &v);
+  }
+  ShapoidUpdateSysLinEqImport(res);
+}
+
+int main() {
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(&dim, 0, 100);
+  VecSet(&dim, 1, 100);
+  GBLayer* layer = GBLayerCreate(&dim);
+  GBEyeOrtho* eye = GBEyeOrthoCreate(GBEyeOrthoViewTop);
+  GBEyeSetScale(eye, (float)2.0);
+  GBEyeSetRot(eye, 0.3);
+  VecFloat2D orig = VecFloatCreateStatic2D();
+  VecSet(&orig, 0, 5.0);
+  VecSet(&orig, 1, 7.0);
+  GBEyeSetOrig(eye, &orig);
+  GBHandDefault* hand = GBHandDefaultCreate();
+  GBToolPlotter* tool = GBToolPlotterCreate();
+  GBPixel col = GBColorBlack;
+  GBInkSolid* ink = GBInkSolidCreate(&col);
+  // Pods of Facoid at random positions, and the Shapoids in which the
+  // projection is done in place
+  Facoid* facoids[BENCH_NBPOD];
+  GBObjPod* pods[BENCH_NBPOD];
+  Shapoid* projs[BENCH_NBPOD];
+  VecFloat3D axis = VecFloatCreateStatic3D();
+  for (int i = 0; i < 3; ++i)
+    VecSet(&axis, i, 1.0);
+  VecNormalise(&axis);
+  srand(1);
+  for (int iPod = 0; iPod < BENCH_NBPOD; ++iPod) {
+    facoids[iPod] = FacoidCreate(3);
+    VecFloat3D pos = VecFloatCreateStatic3D();
+    for (int i = 0; i < 3; ++i)
+      VecSet(&pos, i, 100.0 * (float)rand() / (float)RAND_MAX);
+    ShapoidTranslate(facoids[iPod], &pos);
+    ShapoidRotAxisCenter(facoids[iPod], &axis,
+      (float)rand() / (float)RAND_MAX * PBMATH_TWOPI);
+    pods[iPod] =
+      GBObjPodCreateShapoid(facoids[iPod], eye, hand, tool, ink, layer);
+    projs[iPod] = (Shapoid*)ShapoidClone(facoids[iPod]);
+  }
+  double start = BenchNow();
+  for (int iRun = BENCH_NBRUN; iRun--;)
+    for (int iPod = 0; iPod < BENCH_NBPOD; ++iPod)
+      GBEyeOrthoProcess(eye, pods[iPod]);
+  double timeLib = BenchNow() - start;
+  start = BenchNow();
+  for (int iRun = BENCH_NBRUN; iRun--;)
+    for (int iPod = 0; iPod < BENCH_NBPOD; ++iPod)
+      BenchProjectShapoid(eye, (Shapoid*)(facoids[iPod]), projs[iPod]);
+  double timeStack = BenchNow() - start;
+  float maxDiff = 0.0;
+  for (int iPod = 0; iPod < BENCH_NBPOD; ++iPod) {
+    const Shapoid* ref = pods[iPod]->_eyeShapoid;
+    float diff = VecDist(ref->_pos, projs[iPod]->_pos);
+    for (int iAxis = 3; iAxis--;)
+      diff = MAX(diff,
+        VecDist(ref->_axis[iAxis], projs[iPod]->_axis[iAxis]));
+    maxDiff = MAX(maxDiff, diff);
+    GBObjPodFree(pods + iPod);
+    ShapoidFree(facoids + iPod);
+    ShapoidFree(projs + iPod);
+  }
+  double nb = (double)BENCH_NBRUN * (double)BENCH_NBPOD;
+  printf("GBEyeOrthoProcess(ns/pod) stack(ns/pod) speedup maxDiff\n");
+  printf("%25.1f %14.1f %7.1f %7.1e\n", timeLib * 1e9 / nb,
+    timeStack * 1e9 / nb, timeLib / timeStack, maxDiff);
+  GBInkSolidFree(&ink);
+  GBToolPlotterFree(&tool);
+  GBHandDefaultFree(&hand);
+  GBEyeOrthoFree(&eye);
+  GBLayerFree(&layer);
+  return 0;
+}
@@ -0,0 +1,249 @@
+// Benchmarks of GSet
+// BenchGSetSort: compare the merge sort of GSetSort with the _GSetSort
+// of the lib on sets of 10^3 to 10^6 elements, with random, sorted and
+// reversed _sortVal
+// _GSetSort is quadratic and recurses once per element on sorted and
+// reversed sets, it is not run on those above BENCH_MAXLIBSORTED 
+// elements (it overflows the stack around 10^5 elements)
+// BenchGSetHeap: compare the GSetHeap with the priority queue made of 
+// a GSet kept sorted by the _GSetAddSort of the lib and emptied with 
+// GSetPop, on 10^3 to 10^6 elements pushed with random, sorted and 
+// reversed sort values, then 1 element out of 10 whose sort value is
+// decreased (GSetHeapSetSortVal, or GSetRemoveFirst and _GSetAddSort),
+// then all the elements popped in increasing order of sort value
+// _GSetAddSort is linear in the number of elements, the sorted GSet is
+// not run above BENCH_MAXLIBQUEUE elements
+
+#include <stdio.h>
+#include <time.h>
+#include "gset.h"
+
+// Maximum number of elements of sorted and reversed sets given to 
+// _GSetSort
+#define BENCH_MAXLIBSORTED 10000
+
+// Maximum number of elements of the priority queue made of a sorted 
+// GSet
+#define BENCH_MAXLIBQUEUE 100000
+
+// Order of the _sortVal of the benchmarked sets
+typedef enum BenchOrder {
+  BenchOrderRandom,
+  BenchOrderSorted,
+  BenchOrderReversed
+} BenchOrder;
+static const char* benchOrderStr[] = {"random", "sorted", "reversed"};
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Empty the GSet 'set' and fill it with 'nb' elements of _sortVal in
+// the order 'order'
+// The random values are the same on every call
+static void BenchFill(GSet* const set, const long nb,
+  const BenchOrder order) {
+  GSetFlush(set);
+  srand(1);
+  for (long i = 0; i < nb; ++i) {
+    GSetAppend(set, NULL);
+    float val = 0.0;
+    if (order == BenchOrderRandom)
+      val = (float)rand() / (float)RAND_MAX;
+    else if (order == BenchOrderSorted)
+      val = (float)i;
+    else
+      val = (float)(nb - i);
+    set->_tail->_sortVal = val;
+  }
+}
+
+// Return the average time in seconds to sort 'nb' elements in the
+// order 'order' with the function 'sort', over 'nbRun' runs
+static double BenchSort(void (*sort)(GSet* const), const long nb,
+  const BenchOrder order, const long nbRun) {
+  GSet set = GSetCreateStatic();
+  double total = 0.0;
+  for (long iRun = 0; iRun < nbRun; ++iRun) {
+    BenchFill(&set, nb, order);
+    double start = BenchNow();
+    sort(&set);
+    total += BenchNow() - start;
+  }
+  GSetFlush(&set);
+  return total / (double)nbRun;
+}
+
+// Time the sort of GSet
+void BenchGSetSort() {
+  printf("nbElem order _GSetSort(ms) GSetSort(ms) speedup\n");
+  for (long nb = 1000; nb <= 1000000; nb *= 10) {
+    long nbRun = (nb < 100000 ? 100000 / nb : 1);
+    if (nbRun > 10)
+      nbRun = 10;
+    for (int order = BenchOrderRandom; order <= BenchOrderReversed;
+      ++order) {
+      double timeMerge = BenchSort(_GSetSortMerge, nb, order, nbRun);
+      if (order != BenchOrderRandom && nb > BENCH_MAXLIBSORTED) {
+        printf("%7ld %8s %12s %12.3f %7s\n", nb, benchOrderStr[order],
+          "n/a", timeMerge * 1000.0, "n/a");
+        continue;
+      }
+      double timeLib = BenchSort(_GSetSort, nb, order, nbRun);
+      printf("%7ld %8s %12.3f %12.3f %7.2f\n", nb, benchOrderStr[order],
+        timeLib * 1000.0, timeMerge * 1000.0, timeLib / timeMerge);
+    }
+  }
+}
+
+// Timings in seconds of the phases of the use of a priority queue
+typedef struct BenchQueueTime {
+  double _push;
+  double _decrease;
+  double _pop;
+} BenchQueueTime;
+
+// Set the 'nb' sort values 'vals' in the order 'order', and the 
+// 'nbDecrease' indices 'decreased' of the elements whose sort value is
+// decreased to the values 'decreasedVals'
+// The random values are the same on every call
+static void BenchInitQueue(float* const vals, const long nb,
+  const BenchOrder order, long* const decreased, 
+  float* const decreasedVals, const long nbDecrease) {
+  srand(1);
+  for (long i = 0; i < nb; ++i) {
+    if (order == BenchOrderRandom)
+      vals[i] = (float)rand() / (float)RAND_MAX;
+    else if (order == BenchOrderSorted)
+      vals[i] = (float)i;
+    else
+      vals[i] = (float)(nb - i);
+  }
+  // Decrease each element at most once, to compare the same sequences
+  // of sort values
+  for (long i = 0; i < nbDecrease; ++i) {
+    decreased[i] = (long)(i * 10 + rand() % 10);
+    decreasedVals[i] = vals[decreased[i]] * 
+      (float)rand() / (float)RAND_MAX;
+  }
+}
+
+// Run the priority queue made of a sorted GSet, memorize the popped 
+// sort values in 'popped' and return the timings
+static BenchQueueTime BenchQueueGSet(const float* const vals,
+  const long nb, const long* const decreased, 
+  const float* const decreasedVals, const long nbDecrease, 
+  float* const popped) {
+  BenchQueueTime time = {0};
+  GSet set = GSetCreateStatic();
+  // The data of the i-th element is i + 1 to be different from null
+  double start = BenchNow();
+  for (long i = 0; i < nb; ++i)
+    _GSetAddSort(&set, (void*)(i + 1), vals[i]);
+  time._push = BenchNow() - start;
+  start = BenchNow();
+  for (long i = 0; i < nbDecrease; ++i) {
+    void* data = (void*)(decreased[i] + 1);
+    _GSetRemoveFirst(&set, data);
+    _GSetAddSort(&set, data, decreasedVals[i]);
+  }
+  time._decrease = BenchNow() - start;
+  start = BenchNow();
+  for (long i = 0; i < nb; ++i) {
+    popped[i] = set._head->_sortVal;
+    (void)_GSetPop(&set);
+  }
+  time._pop = BenchNow() - start;
+  return time;
+}
+
+// Run the priority queue made of a GSetHeap, memorize the popped sort
+// values in 'popped' and return the timings
+static BenchQueueTime BenchQueueGSetHeap(const float* const vals,
+  const long nb, const long* const decreased, 
+  const float* const decreasedVals, const long nbDecrease, 
+  float* const popped) {
+  BenchQueueTime time = {0};
+  GSetHeap heap = GSetHeapCreateStatic(false);
+  long* handles = PBErrMalloc(GSetErr, sizeof(long) * nb);
+  double start = BenchNow();
+  for (long i = 0; i < nb; ++i)
+    handles[i] = GSetHeapPush(&heap, (void*)(i + 1), vals[i]);
+  time._push = BenchNow() - start;
+  start = BenchNow();
+  for (long i = 0; i < nbDecrease; ++i)
+    GSetHeapSetSortVal(&heap, handles[decreased[i]], decreasedVals[i]);
+  time._decrease = BenchNow() - start;
+  start = BenchNow();
+  for (long i = 0; i < nb; ++i) {
+    popped[i] = GSetHeapTopSortVal(&heap);
+    (void)GSetHeapPop(&heap);
+  }
+  time._pop = BenchNow() - start;
+  GSetHeapFlush(&heap);
+  free(handles);
+  return time;
+}
+
+// Time the priority queues
+void BenchGSetHeap() {
+  printf("Priority queue (ms): push, decrease 1/10, pop all\n");
+  printf("%7s %8s %26s %26s %8s\n", "nbElem", "order", 
+    "sorted GSet", "GSetHeap", "speedup");
+  long nbWrong = 0;
+  for (long nb = 1000; nb <= 1000000; nb *= 10) {
+    const long nbDecrease = nb / 10;
+    float* vals = PBErrMalloc(GSetErr, sizeof(float) * nb);
+    float* poppedGSet = PBErrMalloc(GSetErr, sizeof(float) * nb);
+    float* poppedHeap = PBErrMalloc(GSetErr, sizeof(float) * nb);
+    long* decreased = PBErrMalloc(GSetErr, sizeof(long) * nbDecrease);
+    float* decreasedVals = 
+      PBErrMalloc(GSetErr, sizeof(float) * nbDecrease);
+    for (int order = BenchOrderRandom; order <= BenchOrderReversed;
+      ++order) {
+      BenchInitQueue(vals, nb, order, decreased, decreasedVals, 
+        nbDecrease);
+      BenchQueueTime timeHeap = BenchQueueGSetHeap(vals, nb, decreased, 
+        decreasedVals, nbDecrease, poppedHeap);
+      double totalHeap = 
+        timeHeap._push + timeHeap._decrease + timeHeap._pop;
+      double totalGSet = 0.0;
+      printf("%7ld %8s ", nb, benchOrderStr[order]);
+      if (nb > BENCH_MAXLIBQUEUE) {
+        printf("%8s %8s %8s ", "n/a", "n/a", "n/a");
+      } else {
+        BenchQueueTime timeGSet = BenchQueueGSet(vals, nb, decreased, 
+          decreasedVals, nbDecrease, poppedGSet);
+        printf("%8.2f %8.2f %8.2f ", timeGSet._push * 1000.0, 
+          timeGSet._decrease * 1000.0, timeGSet._pop * 1000.0);
+        for (long i = 0; i < nb; ++i)
+          if (poppedGSet[i] != poppedHeap[i])
+            ++nbWrong;
+        totalGSet = timeGSet._push + timeGSet._decrease + timeGSet._pop;
+      }
+      printf("%8.2f %8.2f %8.2f ", timeHeap._push * 1000.0, 
+        timeHeap._decrease * 1000.0, timeHeap._pop * 1000.0);
+      if (totalGSet > 0.0)
+        printf("%8.1f\n", totalGSet / totalHeap);
+      else
+        printf("%8s\n", "n/a");
+    }
+    free(vals);
+    free(poppedGSet);
+    free(poppedHeap);
+    free(decreased);
+    free(decreasedVals);
+  }
+  if (nbWrong > 0)
+    printf("%ld sort values were popped in a different order\n", 
+      nbWrong);
+}
+
+int main() {
+  BenchGSetSort();
+  BenchGSetHeap();
+  return 0;
+}
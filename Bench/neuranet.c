@@ -0,0 +1,186 @@
+// Benchmarks of NeuraNet
+// BenchNNEvalLayer: time the evaluation of fully connected nets
+// W-W-W-W/10 for W from 100 to 1000 with NNEval, with the NNEvalPlan
+// walking its operations link by link (its dense layers hidden), and
+// with the NNEvalPlan evaluating its dense layers with the row kernel,
+// in milliseconds per evaluation, and give the maximum difference
+// between the output values of the plan and those of NNEval (which
+// differ only by the rounding of the float operations)
+// BenchNNEvalConv: time the evaluation of convolution nets on 32x32 
+// inputs with 3x3 cells and 48x48 inputs with 5x5 cells with NNEval, 
+// with the NNEvalPlan walking the links of the convolution cells, and
+// with the NNEvalPlan knowing the structure of convolution (cf 
+// NNEvalPlanSetConvolution) which evaluates them with a sliding window,
+// in microseconds per evaluation, with the maximum difference between
+// the output values of the plans and those of NNEval
+// The time of NeuraNetCreateConvolution is given too, the lib takes 
+// 30 to 45 seconds to create each of these nets
+
+#include <stdio.h>
+#include <time.h>
+#include "neuranet.h"
+
+// Number of links evaluated per measurement
+#define BENCH_NBLINK 50000000L
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Set random parameters to the bases of the NeuraNet 'nn'
+static void BenchSetRandomBases(NeuraNet* const nn) {
+  VecFloat* bases = VecFloatCreate(NNGetNbMaxBases(nn) * NN_NBPARAMBASE);
+  for (long i = VecGetDim(bases); i--;)
+    VecSet(bases, i, (2.0 * rnd() - 1.0) * 0.3);
+  NNSetBases(nn, bases);
+  VecFree(&bases);
+}
+
+// Return the maximum absolute difference between the values of 'a' and
+// 'b'
+static float BenchMaxDiff(const VecFloat* const a, const VecFloat* const b) {
+  float maxDiff = 0.0;
+  for (long i = VecGetDim(a); i--;)
+    maxDiff = MAX(maxDiff, fabs(VecGet(a, i) - VecGet(b, i)));
+  return maxDiff;
+}
+
+// Time the evaluation of fully connected nets
+void BenchNNEvalLayer() {
+  printf("Fully connected W-W-W-W/10 (ms/eval)\n");
+  printf("%5s %8s %7s %10s %10s %10s %8s %10s\n", "W", "nbLink",
+    "nbLayer", "NNEval", "planOps", "planDense", "speedup", "maxDiff");
+  srandom(1);
+  const int widths[] = {100, 200, 300, 500, 1000};
+  const int nbWidth = sizeof(widths) / sizeof(widths[0]);
+  for (int iWidth = 0; iWidth < nbWidth; ++iWidth) {
+    const int width = widths[iWidth];
+    VecLong* hiddenLayers = VecLongCreate(2);
+    VecSet(hiddenLayers, 0, width);
+    VecSet(hiddenLayers, 1, width);
+    NeuraNet* nn =
+      NeuraNetCreateFullyConnected(width, width / 10, hiddenLayers);
+    BenchSetRandomBases(nn);
+    NNEvalPlan* plan = NNEvalPlanCreate(nn);
+    VecFloat* input = VecFloatCreate(width);
+    VecFloat* outputRef = VecFloatCreate(width / 10);
+    VecFloat* output = VecFloatCreate(width / 10);
+    for (long i = width; i--;)
+      VecSet(input, i, 2.0 * rnd() - 1.0);
+    const long nbLink = NNEvalPlanGetNbOp(plan);
+    long nbEval = BENCH_NBLINK / nbLink;
+    if (nbEval < 1)
+      nbEval = 1;
+    double start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEval(nn, input, outputRef);
+    double timeNNEval = (BenchNow() - start) / (double)nbEval;
+    // Hide the dense layers to walk the operations link by link
+    const long nbLayer = plan->_nbLayer;
+    plan->_nbLayer = 0;
+    start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEvalWithPlan(nn, plan, input, output);
+    double timeOps = (BenchNow() - start) / (double)nbEval;
+    float maxDiff = BenchMaxDiff(outputRef, output);
+    plan->_nbLayer = nbLayer;
+    start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEvalWithPlan(nn, plan, input, output);
+    double timeDense = (BenchNow() - start) / (double)nbEval;
+    maxDiff = MAX(maxDiff, BenchMaxDiff(outputRef, output));
+    printf("%5d %8ld %7ld %10.3f %10.3f %10.3f %8.1f %10.2e\n", width,
+      nbLink, nbLayer, timeNNEval * 1000.0, timeOps * 1000.0,
+      timeDense * 1000.0, timeNNEval / timeDense, maxDiff);
+    VecFree(&input);
+    VecFree(&outputRef);
+    VecFree(&output);
+    NNEvalPlanFree(&plan);
+    NeuraNetFree(&nn);
+    VecFree(&hiddenLayers);
+  }
+}
+
+// Structure of a convolution net of the benchmark
+typedef struct BenchConv {
+  // Size of the input and of the cells
+  short _sizeIn;
+  short _sizeCell;
+  // Nb of output values, depth and thickness of the convolution
+  int _nbOut;
+  int _depth;
+  int _thick;
+} BenchConv;
+
+// Time the evaluation of convolution nets
+void BenchNNEvalConv() {
+  printf("Convolution (us/eval)\n");
+  printf("%7s %4s %5s %5s %9s %8s %6s %10s %10s %10s %8s %10s\n",
+    "input", "cell", "depth", "thick", "create(s)", "nbLink", "nbConv",
+    "NNEval", "planOps", "planConv", "speedup", "maxDiff");
+  srandom(1);
+  const BenchConv convs[] = {{32, 3, 10, 2, 4}, {48, 5, 4, 1, 2}};
+  const int nbConv = sizeof(convs) / sizeof(convs[0]);
+  for (int iConv = 0; iConv < nbConv; ++iConv) {
+    const BenchConv* conv = convs + iConv;
+    VecShort2D dimIn = VecShortCreateStatic2D();
+    VecSet(&dimIn, 0, conv->_sizeIn);
+    VecSet(&dimIn, 1, conv->_sizeIn);
+    VecShort2D dimCell = VecShortCreateStatic2D();
+    VecSet(&dimCell, 0, conv->_sizeCell);
+    VecSet(&dimCell, 1, conv->_sizeCell);
+    double startCreate = BenchNow();
+    NeuraNet* nn = NeuraNetCreateConvolution((VecShort*)&dimIn,
+      conv->_nbOut, (VecShort*)&dimCell, conv->_depth, conv->_thick);
+    double timeCreate = BenchNow() - startCreate;
+    BenchSetRandomBases(nn);
+    NNEvalPlan* planOps = NNEvalPlanCreate(nn);
+    NNEvalPlan* planConv = NNEvalPlanCreate(nn);
+    NNEvalPlanSetConvolution(planConv, nn, (VecShort*)&dimIn,
+      (VecShort*)&dimCell, conv->_depth, conv->_thick);
+    const int nbIn = NNGetNbInput(nn);
+    VecFloat* input = VecFloatCreate(nbIn);
+    VecFloat* outputRef = VecFloatCreate(conv->_nbOut);
+    VecFloat* output = VecFloatCreate(conv->_nbOut);
+    for (long i = nbIn; i--;)
+      VecSet(input, i, rnd());
+    const long nbLink = NNEvalPlanGetNbOp(planOps);
+    long nbEval = BENCH_NBLINK / nbLink;
+    if (nbEval < 1)
+      nbEval = 1;
+    double start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEval(nn, input, outputRef);
+    double timeNNEval = (BenchNow() - start) / (double)nbEval;
+    start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEvalWithPlan(nn, planOps, input, output);
+    double timeOps = (BenchNow() - start) / (double)nbEval;
+    float maxDiff = BenchMaxDiff(outputRef, output);
+    start = BenchNow();
+    for (long iEval = nbEval; iEval--;)
+      NNEvalWithPlan(nn, planConv, input, output);
+    double timeConv = (BenchNow() - start) / (double)nbEval;
+    maxDiff = MAX(maxDiff, BenchMaxDiff(outputRef, output));
+    printf("%4dx%-2d %2dx%d %5d %5d %9.1f %8ld %6ld %10.1f %10.1f %10.1f "
+      "%8.1f %10.2e\n", conv->_sizeIn, conv->_sizeIn, conv->_sizeCell,
+      conv->_sizeCell, conv->_depth, conv->_thick, timeCreate, nbLink,
+      NNEvalPlanGetNbConv(planConv), timeNNEval * 1e6, timeOps * 1e6,
+      timeConv * 1e6, timeNNEval / timeConv, maxDiff);
+    VecFree(&input);
+    VecFree(&outputRef);
+    VecFree(&output);
+    NNEvalPlanFree(&planOps);
+    NNEvalPlanFree(&planConv);
+    NeuraNetFree(&nn);
+  }
+}
+
+int main() {
+  BenchNNEvalLayer();
+  BenchNNEvalConv();
+  return 0;
+}
@@ -0,0 +1,267 @@
+// Benchmarks of PBJSON
+// BenchJSONIndex: load an object of 10^3 to 10^5 keys in situ with 
+// JSONDocLoadFromStr and decode all its properties in a random order, 
+// with the linear JSONProperty and with the hashed JSONIndexProperty
+// Above BENCH_MAXLINEARKEY keys JSONProperty is timed on a sample of
+// BENCH_NBSAMPLE keys only and its full decoding time is extrapolated
+// BenchJSONFloat: time the conversion of BENCH_NBFLOAT random floats
+// to strings with JSONFloatToStr, sprintf("%f") and sprintf("%.9g"),
+// and of their JSONFloatToStr strings back to floats with 
+// JSONStrToFloat, strtof and atof, in nanoseconds per float, and give 
+// the number of floats which are not converted back exactly
+// BenchVecFloatJSON: time the encoding and decoding of VecFloat of 
+// 10^3 to 10^6 values with the lib's _VecFloatEncodeAsJSON and
+// _VecFloatDecodeAsJSON, and with VecEncodeAsJSON and VecDecodeAsJSON,
+// in milliseconds, and give the number of values which are not decoded
+// back exactly
+// The decoding of the lib is quadratic in the dimension, it's timed up
+// to BENCH_MAXLIBDECODE values only
+
+#include <stdio.h>
+#include <time.h>
+#include "pbjson.h"
+#include "pbmath.h"
+
+// Maximum number of keys of an object fully decoded with JSONProperty
+#define BENCH_MAXLINEARKEY 10000
+
+// Number of keys decoded with JSONProperty above BENCH_MAXLINEARKEY
+#define BENCH_NBSAMPLE 1000
+
+// Number of floats converted per measurement
+#define BENCH_NBFLOAT 1000000L
+
+// Size of the buffer of the float conversions with sprintf
+#define BENCH_STRLEN 64
+
+// Maximum dimension of a VecFloat decoded with _VecFloatDecodeAsJSON
+#define BENCH_MAXLIBDECODE 100000
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Sink of the results, to keep the compiler from removing the calls
+static volatile float benchSink = 0.0;
+
+// Return a random float of random sign and magnitude between 10^-4
+// and 10^4
+static float BenchRandomFloat(void) {
+  return (2.0 * (float)rand() / (float)RAND_MAX - 1.0) *
+    powf(10.0, (float)(rand() % 9 - 4));
+}
+
+// Return a new string with a JSON object of 'nb' properties
+// "k<i>":"<i>"
+static char* BenchCreateJSON(const long nb) {
+  char* str = PBErrMalloc(JSONErr, (size_t)nb * 32 + 3);
+  long len = 0;
+  str[len++] = '{';
+  for (long i = 0; i < nb; ++i)
+    len += sprintf(str + len, "%s\"k%ld\":\"%ld\"", (i > 0 ? "," : ""),
+      i, i);
+  str[len++] = '}';
+  str[len] = '\0';
+  return str;
+}
+
+// Decode the properties of 'root' whose index are the 'nb' first ones
+// in 'order', with the JSONIndex 'index' if it's not null, else with
+// JSONProperty
+// Return the number of properties whose value is wrong (should be 0)
+static long BenchDecode(const JSONNode* const root, JSONIndex* const index,
+  const long* const order, const long nb) {
+  long nbWrong = 0;
+  char key[32];
+  for (long i = 0; i < nb; ++i) {
+    sprintf(key, "k%ld", order[i]);
+    const JSONNode* prop = (index != NULL ?
+      JSONIndexProperty(index, key) : JSONProperty(root, key));
+    if (prop == NULL || atol(JSONLblVal(prop)) != order[i])
+      ++nbWrong;
+  }
+  return nbWrong;
+}
+
+// Time the decoding of large objects with JSONProperty and JSONIndex
+// Return the number of properties wrongly decoded (should be 0)
+long BenchJSONIndex() {
+  printf("nbKey load(ms) JSONProperty(ms) JSONIndex(ms) speedup\n");
+  srand(1);
+  long nbWrong = 0;
+  for (long nb = 1000; nb <= 100000; nb *= 10) {
+    // Random order of decoding of the keys
+    long* order = PBErrMalloc(JSONErr, sizeof(long) * nb);
+    for (long i = 0; i < nb; ++i)
+      order[i] = i;
+    for (long i = nb - 1; i > 0; --i) {
+      long j = rand() % (i + 1);
+      long tmp = order[i];
+      order[i] = order[j];
+      order[j] = tmp;
+    }
+    char* str = BenchCreateJSON(nb);
+    double start = BenchNow();
+    JSONDoc* doc = JSONDocLoadFromStr(str);
+    double timeLoad = BenchNow() - start;
+    const JSONNode* root = JSONDocRoot(doc);
+    // Linear search, on a sample for the largest objects
+    long nbLinear = (nb > BENCH_MAXLINEARKEY ? BENCH_NBSAMPLE : nb);
+    start = BenchNow();
+    nbWrong += BenchDecode(root, NULL, order, nbLinear);
+    double timeLinear =
+      (BenchNow() - start) * (double)nb / (double)nbLinear;
+    // Hashed index, its lazy construction included
+    start = BenchNow();
+    JSONIndex index = JSONIndexCreateStatic(root);
+    nbWrong += BenchDecode(root, &index, order, nb);
+    JSONIndexFreeStatic(&index);
+    double timeIndex = BenchNow() - start;
+    printf("%6ld %8.3f %14.3f%s %12.3f %9.1f\n", nb, timeLoad * 1000.0,
+      timeLinear * 1000.0, (nbLinear < nb ? "*" : " "),
+      timeIndex * 1000.0, timeLinear / timeIndex);
+    JSONDocFree(&doc);
+    free(str);
+    free(order);
+  }
+  printf("(*: extrapolated from %d keys)\n", BENCH_NBSAMPLE);
+  if (nbWrong > 0)
+    printf("%ld properties were wrongly decoded\n", nbWrong);
+  return nbWrong;
+}
+
+// Time the conversions of floats to strings and back
+void BenchJSONFloat() {
+  printf("Float conversion of %ld floats\n%16s %10s %10s\n", 
+    BENCH_NBFLOAT, "", "ns/float", "inexact");
+  srand(1);
+  float* vals = PBErrMalloc(JSONErr, sizeof(float) * BENCH_NBFLOAT);
+  char* strs = 
+    PBErrMalloc(JSONErr, (size_t)BENCH_NBFLOAT * PBJSON_FLOATSTRLEN);
+  for (long i = 0; i < BENCH_NBFLOAT; ++i)
+    vals[i] = BenchRandomFloat();
+  // Float to string, the floats not converted back exactly are counted
+  // on a separate pass to keep strtof out of the timings
+  const char* formats[] = {NULL, "%f", "%.9g"};
+  const char* names[] = 
+    {"JSONFloatToStr", "sprintf(\"%f\")", "sprintf(\"%.9g\")"};
+  for (int iFormat = 0; iFormat < 3; ++iFormat) {
+    char str[BENCH_STRLEN];
+    long len = 0;
+    double start = BenchNow();
+    if (formats[iFormat] == NULL)
+      for (long i = 0; i < BENCH_NBFLOAT; ++i)
+        len += JSONFloatToStr(vals[i], str);
+    else
+      for (long i = 0; i < BENCH_NBFLOAT; ++i)
+        len += sprintf(str, formats[iFormat], vals[i]);
+    double time = BenchNow() - start;
+    benchSink = (float)len;
+    long nbInexact = 0;
+    for (long i = 0; i < BENCH_NBFLOAT; ++i) {
+      if (formats[iFormat] == NULL)
+        JSONFloatToStr(vals[i], str);
+      else
+        sprintf(str, formats[iFormat], vals[i]);
+      if (strtof(str, NULL) != vals[i])
+        ++nbInexact;
+    }
+    printf("%16s %10.1f %10ld\n", names[iFormat], 
+      time * 1e9 / (double)BENCH_NBFLOAT, nbInexact);
+  }
+  // String to float, on the strings of JSONFloatToStr
+  for (long i = 0; i < BENCH_NBFLOAT; ++i)
+    JSONFloatToStr(vals[i], strs + i * PBJSON_FLOATSTRLEN);
+  float* res = PBErrMalloc(JSONErr, sizeof(float) * BENCH_NBFLOAT);
+  for (int iFun = 0; iFun < 3; ++iFun) {
+    double start = BenchNow();
+    if (iFun == 0)
+      for (long i = 0; i < BENCH_NBFLOAT; ++i)
+        JSONStrToFloat(strs + i * PBJSON_FLOATSTRLEN, res + i);
+    else if (iFun == 1)
+      for (long i = 0; i < BENCH_NBFLOAT; ++i)
+        res[i] = strtof(strs + i * PBJSON_FLOATSTRLEN, NULL);
+    else
+      for (long i = 0; i < BENCH_NBFLOAT; ++i)
+        res[i] = atof(strs + i * PBJSON_FLOATSTRLEN);
+    double time = BenchNow() - start;
+    long nbInexact = 0;
+    for (long i = 0; i < BENCH_NBFLOAT; ++i)
+      if (res[i] != vals[i])
+        ++nbInexact;
+    printf("%16s %10.1f %10ld\n", 
+      (iFun == 0 ? "JSONStrToFloat" : (iFun == 1 ? "strtof" : "atof")),
+      time * 1e9 / (double)BENCH_NBFLOAT, nbInexact);
+  }
+  free(res);
+  free(strs);
+  free(vals);
+}
+
+// Return the number of values of 'that' different from those of 'ref',
+// or the dimension of 'ref' if 'that' is null or of another dimension
+static long BenchNbInexact(const VecFloat* const that, 
+  const VecFloat* const ref) {
+  if (that == NULL || VecGetDim(that) != VecGetDim(ref))
+    return VecGetDim(ref);
+  long nbInexact = 0;
+  for (long i = VecGetDim(ref); i--;)
+    if (VecGet(that, i) != VecGet(ref, i))
+      ++nbInexact;
+  return nbInexact;
+}
+
+// Time the encoding and decoding of VecFloat as JSON
+void BenchVecFloatJSON() {
+  printf("VecFloat JSON (ms): _VecFloat*AsJSON (lib) vs Vec*AsJSON\n");
+  printf("%8s %9s %9s %7s %9s %9s %7s %9s %9s\n", "dim", "encLib", 
+    "enc", "speedup", "decLib", "dec", "speedup", "inexLib", "inex");
+  srand(1);
+  for (long dim = 1000; dim <= 1000000; dim *= 10) {
+    VecFloat* v = VecFloatCreate(dim);
+    for (long i = 0; i < dim; ++i)
+      VecSet(v, i, BenchRandomFloat());
+    double start = BenchNow();
+    JSONNode* jsonLib = _VecFloatEncodeAsJSON(v);
+    double timeEncLib = BenchNow() - start;
+    start = BenchNow();
+    JSONNode* json = VecEncodeAsJSON(v);
+    double timeEnc = BenchNow() - start;
+    VecFloat* dec = NULL;
+    start = BenchNow();
+    bool ret = VecDecodeAsJSON(&dec, json);
+    double timeDec = BenchNow() - start;
+    long nbInexact = (ret ? BenchNbInexact(dec, v) : dim);
+    printf("%8ld %9.2f %9.2f %7.1f ", dim, timeEncLib * 1000.0, 
+      timeEnc * 1000.0, timeEncLib / timeEnc);
+    VecFloat* decLib = NULL;
+    if (dim > BENCH_MAXLIBDECODE) {
+      printf("%9s %9.2f %7s %9s ", "n/a", timeDec * 1000.0, "n/a", "n/a");
+    } else {
+      start = BenchNow();
+      ret = _VecFloatDecodeAsJSON(&decLib, jsonLib);
+      double timeDecLib = BenchNow() - start;
+      printf("%9.2f %9.2f %7.1f %9ld ", timeDecLib * 1000.0, 
+        timeDec * 1000.0, timeDecLib / timeDec,
+        (ret ? BenchNbInexact(decLib, v) : dim));
+    }
+    printf("%9ld\n", nbInexact);
+    JSONFree(&jsonLib);
+    JSONFree(&json);
+    if (decLib != NULL)
+      VecFree(&decLib);
+    if (dec != NULL)
+      VecFree(&dec);
+    VecFree(&v);
+  }
+}
+
+int main() {
+  long nbWrong = BenchJSONIndex();
+  BenchJSONFloat();
+  BenchVecFloatJSON();
+  return (nbWrong > 0 ? 1 : 0);
+}
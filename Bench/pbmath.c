@@ -0,0 +1,314 @@
+// Benchmarks of PBMath
+// BenchVecFloatKernels: time the SIMD kernels of the arithmetic on 
+// VecFloat (dot product, squared distance and linear combination) on
+// dimensions 2 to 4096, with the plain C loop (as optimised by the 
+// compiler), the kernel selected for the CPU, and on x86 the SSE and 
+// AVX2 kernels individually, in nanoseconds per call
+// BenchFixedSizeMath: time the rotation of the position and axes of a
+// Shapoid of dimension 3 with the _VecFloatGetRotAxis of the lib, its
+// inlined _VecFloatGetRotAxisFast and a MatFloat3x3 rotation matrix,
+// and the product of 3x3 and 4x4 matrices by vectors with the heap
+// MatFloat and VecFloat and with the MatFloat3x3/4x4 on the stack, in
+// nanoseconds per rotation or product
+// BenchEigenSolver: time the EigenSolver on covariance matrices of 
+// dimension 50 to 1000, and the _MatFloatGetEigenValues of the lib on
+// the small ones
+
+#include <stdio.h>
+#include <time.h>
+#include "pbmath.h"
+
+// Number of floats processed per measurement of the kernels
+#define BENCH_NBFLOAT 20000000L
+
+// Maximum dimension of the matrices given to _MatFloatGetEigenValues
+// (its time grows by about 20 times when the dimension doubles)
+#define BENCH_MAXLIBEIGENDIM 20
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Plain C loops, as the arithmetic on VecFloat was before the kernels
+static float BenchDotLoop(const float* const a, const float* const b,
+  const long nb) {
+  float res = 0.0;
+  for (long i = nb; i--;)
+    res += a[i] * b[i];
+  return res;
+}
+static float BenchDistSqLoop(const float* const a, const float* const b,
+  const long nb) {
+  float res = 0.0;
+  for (long i = nb; i--;)
+    res += fsquare(a[i] - b[i]);
+  return res;
+}
+static void BenchOpLoop(const float* const a, const float ca,
+  const float* const b, const float cb, float* const res, const long nb) {
+  for (long i = nb; i--;)
+    res[i] = ca * a[i] + cb * b[i];
+}
+
+// One implementation of the kernels
+typedef struct BenchKernels {
+  // Name of the implementation
+  const char* _name;
+  float (*_dot)(const float* const a, const float* const b,
+    const long nb);
+  float (*_distSq)(const float* const a, const float* const b,
+    const long nb);
+  void (*_op)(const float* const a, const float ca, const float* const b,
+    const float cb, float* const res, const long nb);
+} BenchKernels;
+
+// Sink of the results, to keep the compiler from removing the calls
+static volatile float benchSink = 0.0;
+
+// Return the time in nanoseconds of one call of the operation 'iOp' of
+// 'kernels' on vectors of 'dim' floats
+static double BenchKernelsOp(const BenchKernels* const kernels,
+  const int iOp, float* const a, float* const b, float* const res,
+  const long dim) {
+  long nbCall = BENCH_NBFLOAT / dim;
+  float sum = 0.0;
+  double start = BenchNow();
+  for (long iCall = nbCall; iCall--;) {
+    if (iOp == 0) {
+      sum += kernels->_dot(a, b, dim);
+    } else if (iOp == 1) {
+      sum += kernels->_distSq(a, b, dim);
+    } else {
+      kernels->_op(a, 0.5, b, 0.5, res, dim);
+      sum += res[0];
+    }
+  }
+  double time = BenchNow() - start;
+  benchSink = sum;
+  return time * 1e9 / (double)nbCall;
+}
+
+// Time the kernels of VecFloat
+void BenchVecFloatKernels() {
+  BenchKernels kernels[4] = {
+    {"loop", BenchDotLoop, BenchDistSqLoop, BenchOpLoop},
+    {"kernel", VecFloatKernelDot, VecFloatKernelDistSq, VecFloatKernelOp}
+  };
+  int nbKernels = 2;
+#if PBMATH_SIMD_X86
+  kernels[nbKernels++] = (BenchKernels){"SSE", VecFloatKernelDotSSE,
+    VecFloatKernelDistSqSSE, VecFloatKernelOpSSE};
+  if (VecFloatKernelHasAVX2())
+    kernels[nbKernels++] = (BenchKernels){"AVX2", VecFloatKernelDotAVX2,
+      VecFloatKernelDistSqAVX2, VecFloatKernelOpAVX2};
+#endif
+  const long maxDim = 4096;
+  float* a = PBErrMalloc(PBMathErr, sizeof(float) * maxDim);
+  float* b = PBErrMalloc(PBMathErr, sizeof(float) * maxDim);
+  float* res = PBErrMalloc(PBMathErr, sizeof(float) * maxDim);
+  for (long i = 0; i < maxDim; ++i) {
+    a[i] = (float)(i % 17) * 0.1;
+    b[i] = (float)(i % 13) * 0.2;
+  }
+  const char* opNames[3] = {"dot", "distSq", "op"};
+  for (int iOp = 0; iOp < 3; ++iOp) {
+    printf("%s (ns/call)\n%6s", opNames[iOp], "dim");
+    for (int iKernels = 0; iKernels < nbKernels; ++iKernels)
+      printf(" %9s", kernels[iKernels]._name);
+    printf("\n");
+    // Powers of 2 and the dimensions just below them, to show the cost
+    // of the scalar tails
+    for (long dim = 2; dim <= maxDim; dim *= 2) {
+      for (long d = (dim > 2 ? dim - 1 : dim); d <= dim; ++d) {
+        printf("%6ld", d);
+        for (int iKernels = 0; iKernels < nbKernels; ++iKernels)
+          printf(" %9.2f",
+            BenchKernelsOp(kernels + iKernels, iOp, a, b, res, d));
+        printf("\n");
+      }
+    }
+  }
+  free(a);
+  free(b);
+  free(res);
+}
+
+// Number of rotations or products per measurement of the fixed size
+// types
+#define BENCH_NBFIXEDSIZE 2000000L
+
+// Time the rotations and the products of fixed size matrices
+void BenchFixedSizeMath() {
+  // Position and axes of a Shapoid of dimension 3
+  VecFloat3D vecs[4];
+  for (int iVec = 0; iVec < 4; ++iVec) {
+    vecs[iVec] = VecFloatCreateStatic3D();
+    for (int i = 0; i < 3; ++i)
+      VecSet(vecs + iVec, i, (float)(iVec + i) * 0.3 + 0.1);
+  }
+  VecFloat3D axis = VecFloatCreateStatic3D();
+  VecSet(&axis, 0, 0.48);
+  VecSet(&axis, 1, 0.6);
+  VecSet(&axis, 2, 0.64);
+  printf("Rotation of 4 vectors around an axis (ns/rotation)\n");
+  printf("%12s %12s %12s\n", "lib", "fast", "MatFloat3x3");
+  float sum = 0.0;
+  double times[3];
+  for (int iImpl = 0; iImpl < 3; ++iImpl) {
+    double start = BenchNow();
+    for (long iRot = BENCH_NBFIXEDSIZE; iRot--;) {
+      // Vary the angle to keep the compiler from hoisting the rotation
+      // matrix out of the loop
+      float theta = (float)(iRot & 255) * 0.01;
+      if (iImpl == 2) {
+        MatFloat3x3 rot = MatFloatGetRotAxis3x3(&axis, theta);
+        for (int iVec = 0; iVec < 4; ++iVec)
+          sum += MatGetProdVec(&rot, vecs + iVec)._val[0];
+      } else {
+        for (int iVec = 0; iVec < 4; ++iVec)
+          sum += (iImpl == 0 ?
+            _VecFloatGetRotAxis(vecs + iVec, &axis, theta) :
+            _VecFloatGetRotAxisFast(vecs + iVec, &axis, theta))._val[0];
+      }
+    }
+    times[iImpl] = BenchNow() - start;
+  }
+  printf("%12.2f %12.2f %12.2f\n",
+    times[0] * 1e9 / (double)BENCH_NBFIXEDSIZE,
+    times[1] * 1e9 / (double)BENCH_NBFIXEDSIZE,
+    times[2] * 1e9 / (double)BENCH_NBFIXEDSIZE);
+  printf("Product matrix by vector (ns/product)\n");
+  printf("%6s %12s %12s\n", "dim", "MatFloat", "fixed size");
+  for (int dim = 3; dim <= 4; ++dim) {
+    VecShort2D dimMat = VecShortCreateStatic2D();
+    VecSet(&dimMat, 0, dim);
+    VecSet(&dimMat, 1, dim);
+    MatFloat* mat = MatFloatCreate(&dimMat);
+    VecFloat* vec = VecFloatCreate(dim);
+    MatFloat3x3 mat3 = MatFloatCreateStatic3x3();
+    MatFloat4x4 mat4 = MatFloatCreateStatic4x4();
+    VecFloat3D vec3 = VecFloatCreateStatic3D();
+    VecFloat4D vec4 = VecFloatCreateStatic4D();
+    for (int i = 0; i < dim * dim; ++i) {
+      mat->_val[i] = (float)(i % 5) * 0.2 - 0.3;
+      if (dim == 3)
+        mat3._val[i] = mat->_val[i];
+      else
+        mat4._val[i] = mat->_val[i];
+    }
+    for (int i = 0; i < dim; ++i) {
+      VecSet(vec, i, (float)i * 0.1 + 0.5);
+      if (dim == 3)
+        VecSet(&vec3, i, VecGet(vec, i));
+      else
+        VecSet(&vec4, i, VecGet(vec, i));
+    }
+    double start = BenchNow();
+    for (long iProd = BENCH_NBFIXEDSIZE; iProd--;) {
+      vec->_val[0] = (float)(iProd & 255) * 0.01;
+      VecFloat* prod = MatGetProdVec(mat, vec);
+      sum += VecGet(prod, 0);
+      VecFree(&prod);
+    }
+    double timeHeap = BenchNow() - start;
+    start = BenchNow();
+    for (long iProd = BENCH_NBFIXEDSIZE; iProd--;) {
+      if (dim == 3) {
+        vec3._val[0] = (float)(iProd & 255) * 0.01;
+        sum += MatGetProdVec(&mat3, &vec3)._val[0];
+      } else {
+        vec4._val[0] = (float)(iProd & 255) * 0.01;
+        sum += MatGetProdVec(&mat4, &vec4)._val[0];
+      }
+    }
+    double timeStack = BenchNow() - start;
+    printf("%6d %12.2f %12.2f\n", dim,
+      timeHeap * 1e9 / (double)BENCH_NBFIXEDSIZE,
+      timeStack * 1e9 / (double)BENCH_NBFIXEDSIZE);
+    MatFree(&mat);
+    VecFree(&vec);
+  }
+  benchSink = sum;
+}
+
+// Return a new covariance matrix of dimension 'dim', estimated from 
+// 2 * 'dim' samples of independent gaussian variables scaled by 
+// increasing standard deviations
+static MatFloat* BenchCreateCovariance(const long dim, 
+  PBRandom* const rnd) {
+  VecShort2D dimMat = VecShortCreateStatic2D();
+  VecSet(&dimMat, 0, dim);
+  VecSet(&dimMat, 1, dim);
+  MatFloat* cov = MatFloatCreate(&dimMat);
+  const long nbSample = 2 * dim;
+  float* samples = 
+    PBErrMalloc(PBMathErr, sizeof(float) * nbSample * dim);
+  for (long iSample = 0; iSample < nbSample; ++iSample)
+    for (long i = 0; i < dim; ++i)
+      samples[iSample * dim + i] = 
+        PBRandomGetGauss(rnd, 0.0, 1.0 + (float)i / (float)dim);
+  // Samples by variables for the dot products
+  float* vars = 
+    PBErrMalloc(PBMathErr, sizeof(float) * nbSample * dim);
+  for (long iSample = 0; iSample < nbSample; ++iSample)
+    for (long i = 0; i < dim; ++i)
+      vars[i * nbSample + iSample] = samples[iSample * dim + i];
+  for (long i = 0; i < dim; ++i)
+    for (long j = 0; j <= i; ++j) {
+      float c = (float)(VecFloatKernelDotDouble(vars + i * nbSample, 
+        vars + j * nbSample, nbSample) / (double)nbSample);
+      cov->_val[i * dim + j] = c;
+      cov->_val[j * dim + i] = c;
+    }
+  free(samples);
+  free(vars);
+  return cov;
+}
+
+// Time the EigenSolver on covariance matrices
+void BenchEigenSolver() {
+  printf("EigenSolver on covariance matrices\n");
+  printf("%6s %12s %14s %12s %10s\n", "dim", "solver(ms)", 
+    "iter/eigenval", "residual", "lib(ms)");
+  PBRandom rnd = PBRandomCreateStatic(1);
+  const long dims[] = {10, 20, 50, 100, 200, 500, 1000};
+  const int nbDim = sizeof(dims) / sizeof(dims[0]);
+  for (int iDim = 0; iDim < nbDim; ++iDim) {
+    const long dim = dims[iDim];
+    MatFloat* cov = BenchCreateCovariance(dim, &rnd);
+    // The workspace is created once per dimension, out of the timing
+    EigenSolver solver = EigenSolverCreateStatic(dim);
+    double start = BenchNow();
+    bool isOk = EigenSolverSolve(&solver, cov);
+    double timeSolver = BenchNow() - start;
+    printf("%6ld %12.3f %14.2f %12.3e", dim, timeSolver * 1000.0, 
+      (double)EigenSolverGetNbIter(&solver) / (double)dim, 
+      EigenSolverGetResidual(&solver, cov));
+    if (!isOk || !EigenSolverIsConverged(&solver))
+      printf(" (not converged)");
+    if (dim <= BENCH_MAXLIBEIGENDIM) {
+      start = BenchNow();
+      GSetVecFloat lib = _MatFloatGetEigenValues(cov);
+      printf(" %10.3f", (BenchNow() - start) * 1000.0);
+      while (GSetNbElem(&lib) > 0) {
+        VecFloat* v = GSetPop(&lib);
+        VecFree(&v);
+      }
+    } else {
+      printf(" %10s", "n/a");
+    }
+    printf("\n");
+    EigenSolverFreeStatic(&solver);
+    MatFree(&cov);
+  }
+}
+
+int main() {
+  BenchVecFloatKernels();
+  BenchFixedSizeMath();
+  BenchEigenSolver();
+  return 0;
+}
@@ -0,0 +1,198 @@
+// Benchmark of the overhead of the vectors in the steps of PBPhys
+// PBPhysStep is in the prebuilt lib and allocates a VecFloat on the heap
+// for each intermediate vector, it's timed on 10 to 1000 particles in
+// 3D, with the gravity between particles and the downward gravity, in
+// milliseconds per step and nanoseconds per pair of particles
+// BenchParticleGravity times the core of such a step (the gravity
+// between each pair of particles and the integration of speeds and
+// positions) written with heap VecFloat temporaries as in the lib, and
+// with the VecFloat3D on the stack, in nanoseconds per pair of
+// particles, and checks that both give the same positions
+
+#include <stdio.h>
+#include <time.h>
+#include "pbphys.h"
+
+// Number of pairs of particles processed per measurement
+#define BENCH_NBPAIR 20000000L
+
+// Delta t of the steps
+#define BENCH_DELTAT 0.01
+
+// Gravity coefficient between particles
+#define BENCH_GRAVITY 0.1
+
+// Return the current time in seconds
+static double BenchNow(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+// Sink of the results, to keep the compiler from removing the calls
+static volatile float benchSink = 0.0;
+
+// Set the random position, speed and mass of the 'nb' particles, the
+// same on every call
+static void BenchInitParticles(VecFloat3D* const pos,
+  VecFloat3D* const speed, float* const mass, const long nb) {
+  srand(1);
+  for (long i = 0; i < nb; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      VecSet(pos + i, j, 100.0 * (float)rand() / (float)RAND_MAX);
+      VecSet(speed + i, j, (float)rand() / (float)RAND_MAX - 0.5);
+    }
+    mass[i] = 1.0 + (float)rand() / (float)RAND_MAX;
+  }
+}
+
+// Step 'nbStep' times the 'nb' particles whose positions and speeds are
+// the heap VecFloat 'pos' and 'speed', creating a VecFloat for each
+// intermediate vector
+static void BenchStepHeap(VecFloat** const pos, VecFloat** const speed,
+  const float* const mass, const long nb, const long nbStep) {
+  for (long iStep = nbStep; iStep--;) {
+    for (long i = 0; i < nb; ++i) {
+      VecFloat* accel = VecFloatCreate(3);
+      for (long j = 0; j < nb; ++j) {
+        if (j == i)
+          continue;
+        VecFloat* dir = VecGetOp(pos[j], 1.0, pos[i], -1.0);
+        float dist = VecNorm(dir);
+        VecOp(accel, 1.0, dir,
+          BENCH_GRAVITY * mass[j] / (dist * dist * dist));
+        VecFree(&dir);
+      }
+      VecOp(speed[i], 1.0, accel, BENCH_DELTAT);
+      VecFree(&accel);
+    }
+    for (long i = 0; i < nb; ++i) {
+      VecFloat* move = VecGetOp(speed[i], BENCH_DELTAT, speed[i], 0.0);
+      VecOp(pos[i], 1.0, move, 1.0);
+      VecFree(&move);
+    }
+  }
+}
+
+// Step 'nbStep' times the 'nb' particles whose positions and speeds are
+// the VecFloat3D 'pos' and 'speed', with the intermediate vectors on
+// the stack
+static void BenchStepStack(VecFloat3D* const pos,
+  VecFloat3D* const speed, const float* const mass, const long nb,
+  const long nbStep) {
+  for (long iStep = nbStep; iStep--;) {
+    for (long i = 0; i < nb; ++i) {
+      VecFloat3D accel = VecFloatCreateStatic3D();
+      for (long j = 0; j < nb; ++j) {
+        if (j == i)
+          continue;
+        VecFloat3D dir = VecGetOp(pos + j, 1.0, pos + i, -1.0);
+        float dist = VecNorm(&dir);
+        VecOp(&accel, 1.0, &dir,
+          BENCH_GRAVITY * mass[j] / (dist * dist * dist));
+      }
+      VecOp(speed + i, 1.0, &accel, BENCH_DELTAT);
+    }
+    for (long i = 0; i < nb; ++i)
+      VecOp(pos + i, 1.0, speed + i, BENCH_DELTAT);
+  }
+}
+
+// Time PBPhysStep
+void BenchPBPhysStep() {
+  printf("PBPhysStep\n%6s %12s %10s\n", "nbPart", "step(ms)", "ns/pair");
+  for (int nb = 10; nb <= 1000; nb *= 10) {
+    PBPhys* phys = PBPhysCreate(3);
+    PBPhysAddParticles(phys, nb, ShapoidTypeSpheroid);
+    PBPhysSetDeltaT(phys, BENCH_DELTAT);
+    PBPhysSetDownGravity(phys, 1.0);
+    PBPhysSetGravity(phys, BENCH_GRAVITY);
+    VecFloat3D* pos = PBErrMalloc(PBPhysErr, sizeof(VecFloat3D) * nb);
+    VecFloat3D* speed = PBErrMalloc(PBPhysErr, sizeof(VecFloat3D) * nb);
+    float* mass = PBErrMalloc(PBPhysErr, sizeof(float) * nb);
+    for (int i = 0; i < nb; ++i) {
+      pos[i] = VecFloatCreateStatic3D();
+      speed[i] = VecFloatCreateStatic3D();
+    }
+    BenchInitParticles(pos, speed, mass, nb);
+    // Small particles far from each other, to time the steps without
+    // collision
+    for (int i = 0; i < nb; ++i) {
+      PBPhysParticle* part = PBPhysPart(phys, i);
+      PBPhysParticleSetSize(part, (float)0.001);
+      PBPhysParticleSetPos(part, pos + i);
+      PBPhysParticleSetSpeed(part, speed + i);
+      PBPhysParticleSetMass(part, mass[i]);
+    }
+    long nbStep = BENCH_NBPAIR / 10 / ((long)nb * (long)nb);
+    if (nbStep < 1)
+      nbStep = 1;
+    double start = BenchNow();
+    for (long iStep = nbStep; iStep--;)
+      PBPhysStep(phys);
+    double time = (BenchNow() - start) / (double)nbStep;
+    printf("%6d %12.3f %10.2f\n", nb, time * 1000.0,
+      time * 1e9 / ((double)nb * (double)nb));
+    free(pos);
+    free(speed);
+    free(mass);
+    PBPhysFree(&phys);
+  }
+}
+
+// Time the gravity between particles and the integration of their
+// speeds and positions with heap and stack vectors
+void BenchParticleGravity() {
+  printf("Gravity and integration (ns/pair)\n%6s %10s %10s %8s %10s\n",
+    "nbPart", "heap", "stack", "speedup", "maxDiff");
+  for (long nb = 10; nb <= 1000; nb *= 10) {
+    VecFloat3D* pos = PBErrMalloc(PBPhysErr, sizeof(VecFloat3D) * nb);
+    VecFloat3D* speed = PBErrMalloc(PBPhysErr, sizeof(VecFloat3D) * nb);
+    float* mass = PBErrMalloc(PBPhysErr, sizeof(float) * nb);
+    VecFloat** posHeap = PBErrMalloc(PBPhysErr, sizeof(VecFloat*) * nb);
+    VecFloat** speedHeap =
+      PBErrMalloc(PBPhysErr, sizeof(VecFloat*) * nb);
+    for (long i = 0; i < nb; ++i) {
+      pos[i] = VecFloatCreateStatic3D();
+      speed[i] = VecFloatCreateStatic3D();
+    }
+    BenchInitParticles(pos, speed, mass, nb);
+    for (long i = 0; i < nb; ++i) {
+      posHeap[i] = VecFloatCreate(3);
+      VecCopy(posHeap[i], pos + i);
+      speedHeap[i] = VecFloatCreate(3);
+      VecCopy(speedHeap[i], speed + i);
+    }
+    long nbStep = BENCH_NBPAIR / (nb * nb);
+    double start = BenchNow();
+    BenchStepHeap(posHeap, speedHeap, mass, nb, nbStep);
+    double timeHeap = BenchNow() - start;
+    start = BenchNow();
+    BenchStepStack(pos, speed, mass, nb, nbStep);
+    double timeStack = BenchNow() - start;
+    float maxDiff = 0.0;
+    for (long i = 0; i < nb; ++i) {
+      float diff = VecDist(posHeap[i], (VecFloat*)(pos + i));
+      if (diff > maxDiff)
+        maxDiff = diff;
+      VecFree(posHeap + i);
+      VecFree(speedHeap + i);
+    }
+    benchSink = maxDiff;
+    double nbPair = (double)nbStep * (double)nb * (double)nb;
+    printf("%6ld %10.2f %10.2f %8.1f %10.2e\n", nb,
+      timeHeap * 1e9 / nbPair, timeStack * 1e9 / nbPair,
+      timeHeap / timeStack, maxDiff);
+    free(pos);
+    free(speed);
+    free(mass);
+    free(posHeap);
+    free(speedHeap);
+  }
+}
+
+int main() {
+  BenchPBPhysStep();
+  BenchParticleGravity();
+  return 0;
+}
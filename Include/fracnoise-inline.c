@@ -1,5 +1,41 @@
 // ============ FRACNOISE-static inline.C ================
 
+// -------------- PerlinNoise
+
+// ================ Functions implementation ====================
+
+// Set the permutations of the PerlinNoise 'that' to a random 
+// permutation drawn from the PBRandom 'rng', to get a different noise
+// for each seed of 'rng'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PerlinNoiseSetPermutWith(PerlinNoise* const that, 
+  PBRandom* const rng) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    FracNoiseErr->_type = PBErrTypeNullPointer;
+    sprintf(FracNoiseErr->_msg, "'that' is null");
+    PBErrCatch(FracNoiseErr);
+  }
+  if (rng == NULL) {
+    FracNoiseErr->_type = PBErrTypeNullPointer;
+    sprintf(FracNoiseErr->_msg, "'rng' is null");
+    PBErrCatch(FracNoiseErr);
+  }
+#endif
+  int permut[256];
+  for (int i = 256; i--;)
+    permut[i] = i;
+  for (int i = 255; i > 0; --i) {
+    const int j = PBRandomGetLong(rng, i + 1);
+    const int swap = permut[i];
+    permut[i] = permut[j];
+    permut[j] = swap;
+  }
+  PerlinNoiseSetPermut(that, permut);
+}
+
 // -------------- PerlinNoisePod
 
 // ================ Functions implementation ====================
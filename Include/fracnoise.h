@@ -59,6 +59,15 @@ float _PerlinNoiseGet3D(const PerlinNoise* const that,
 void PerlinNoiseSetPermut(PerlinNoise* const that, 
   const int* const permut);
 
+// Set the permutations of the PerlinNoise 'that' to a random 
+// permutation drawn from the PBRandom 'rng', to get a different noise
+// for each seed of 'rng'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PerlinNoiseSetPermutWith(PerlinNoise* const that, 
+  PBRandom* const rng);
+
 // -------------- PerlinNoisePod
 
 typedef struct PerlinNoisePod {
@@ -506,3 +506,580 @@ void _GDSSetNbOutputs(GDataSet* const that, const short nb) {
   that->_nbOutputs = nb;
 }
 
+
+// Properties of the JSON encoding of a GDataSet
+typedef enum GDSLoadKey {
+  GDSLoadKey_Other, GDSLoadKey_Type, GDSLoadKey_Name, GDSLoadKey_Desc, 
+  GDSLoadKey_Dim, GDSLoadKey_NbSample, GDSLoadKey_Samples, 
+  GDSLoadKey_VecDim, GDSLoadKey_VecVal
+} GDSLoadKey;
+
+// Context of the streaming loader of GDataSetVecFloat
+typedef struct GDSLoadCtx {
+  // Loaded data set
+  GDataSet* _that;
+  // Number of opened objects and arrays
+  int _depth;
+  // Current property at the top level
+  GDSLoadKey _key;
+  // Current property in the vectors (dim and samples)
+  GDSLoadKey _subKey;
+  // Dimension announced by the current vector
+  long _vecDim;
+  // Values of the current vector
+  float* _vals;
+  // Number of values of the current vector
+  long _nbVal;
+  // Allocated size of _vals
+  long _capVal;
+  // Number of samples announced by the data set
+  long _nbSample;
+  // Flag for the type of the data set
+  bool _isTypeOk;
+} GDSLoadCtx;
+
+static inline bool GDSLoadObjStart(void* const param) {
+  GDSLoadCtx* ctx = (GDSLoadCtx*)param;
+  ++(ctx->_depth);
+  // Start of the dimensions or of a sample
+  if ((ctx->_key == GDSLoadKey_Dim && ctx->_depth == 2) || 
+    (ctx->_key == GDSLoadKey_Samples && ctx->_depth == 3)) {
+    ctx->_nbVal = 0;
+    ctx->_vecDim = -1;
+    ctx->_subKey = GDSLoadKey_Other;
+  }
+  return true;
+}
+
+static inline bool GDSLoadObjEnd(void* const param) {
+  GDSLoadCtx* ctx = (GDSLoadCtx*)param;
+  bool ret = true;
+  if ((ctx->_key == GDSLoadKey_Dim && ctx->_depth == 2) || 
+    (ctx->_key == GDSLoadKey_Samples && ctx->_depth == 3)) {
+    // The vector must have the announced dimension
+    if (ctx->_nbVal != ctx->_vecDim || ctx->_nbVal == 0) {
+      ret = false;
+    } else if (ctx->_key == GDSLoadKey_Dim) {
+      // Replace the dimensions of the samples
+      if (ctx->_that->_sampleDim != NULL)
+        VecFree(&(ctx->_that->_sampleDim));
+      ctx->_that->_sampleDim = VecShortCreate(ctx->_nbVal);
+      for (long iVal = ctx->_nbVal; iVal--;)
+        ctx->_that->_sampleDim->_val[iVal] = (short)(ctx->_vals[iVal]);
+    } else {
+      // The samples must match the dimensions of the data set
+      if (ctx->_that->_sampleDim == NULL || 
+        ctx->_nbVal != VecGet(ctx->_that->_sampleDim, 0)) {
+        ret = false;
+      } else {
+        // Add the decoded sample to the data set
+        VecFloat* sample = VecFloatCreate(ctx->_nbVal);
+        memcpy(sample->_val, ctx->_vals, sizeof(float) * ctx->_nbVal);
+        GSetAppend(&(ctx->_that->_samples), sample);
+        ++(ctx->_that->_nbSample);
+      }
+    }
+  }
+  --(ctx->_depth);
+  return ret;
+}
+
+static inline bool GDSLoadArrStart(void* const param) {
+  ++(((GDSLoadCtx*)param)->_depth);
+  return true;
+}
+
+static inline bool GDSLoadArrEnd(void* const param) {
+  --(((GDSLoadCtx*)param)->_depth);
+  return true;
+}
+
+static inline bool GDSLoadKeyFound(const char* const key, 
+  void* const param) {
+  GDSLoadCtx* ctx = (GDSLoadCtx*)param;
+  if (ctx->_depth == 1) {
+    if (strcmp(key, "dataSetType") == 0)
+      ctx->_key = GDSLoadKey_Type;
+    else if (strcmp(key, "dataSet") == 0)
+      ctx->_key = GDSLoadKey_Name;
+    else if (strcmp(key, "desc") == 0)
+      ctx->_key = GDSLoadKey_Desc;
+    else if (strcmp(key, "dim") == 0)
+      ctx->_key = GDSLoadKey_Dim;
+    else if (strcmp(key, "nbSample") == 0)
+      ctx->_key = GDSLoadKey_NbSample;
+    else if (strcmp(key, "samples") == 0)
+      ctx->_key = GDSLoadKey_Samples;
+    else
+      ctx->_key = GDSLoadKey_Other;
+  } else {
+    if (strcmp(key, "_dim") == 0)
+      ctx->_subKey = GDSLoadKey_VecDim;
+    else if (strcmp(key, "_val") == 0)
+      ctx->_subKey = GDSLoadKey_VecVal;
+    else
+      ctx->_subKey = GDSLoadKey_Other;
+  }
+  return true;
+}
+
+static inline bool GDSLoadVal(const char* const val, void* const param) {
+  GDSLoadCtx* ctx = (GDSLoadCtx*)param;
+  GDataSet* that = ctx->_that;
+  if (ctx->_depth == 1) {
+    switch (ctx->_key) {
+      case GDSLoadKey_Type:
+        ctx->_isTypeOk = (atoi(val) == (int)(that->_type));
+        return ctx->_isTypeOk;
+      case GDSLoadKey_Name:
+        free(that->_name);
+        that->_name = PBErrMalloc(GDataSetErr, strlen(val) + 1);
+        strcpy(that->_name, val);
+        break;
+      case GDSLoadKey_Desc:
+        free(that->_desc);
+        that->_desc = PBErrMalloc(GDataSetErr, strlen(val) + 1);
+        strcpy(that->_desc, val);
+        break;
+      case GDSLoadKey_NbSample:
+        ctx->_nbSample = atol(val);
+        break;
+      default:
+        break;
+    }
+  } else if (ctx->_key == GDSLoadKey_Dim || 
+    ctx->_key == GDSLoadKey_Samples) {
+    // Values of the dimensions or of a sample, the array of values may 
+    // be saved as a single value if it has only one element
+    if (ctx->_subKey == GDSLoadKey_VecDim) {
+      ctx->_vecDim = atol(val);
+    } else if (ctx->_subKey == GDSLoadKey_VecVal) {
+      if (ctx->_nbVal == ctx->_capVal) {
+        ctx->_capVal *= 2;
+        float* vals = PBErrMalloc(GDataSetErr, 
+          sizeof(float) * ctx->_capVal);
+        memcpy(vals, ctx->_vals, sizeof(float) * ctx->_nbVal);
+        free(ctx->_vals);
+        ctx->_vals = vals;
+      }
+      if (!JSONStrToFloat(val, ctx->_vals + ctx->_nbVal))
+        return false;
+      ++(ctx->_nbVal);
+    }
+  }
+  return true;
+}
+
+// Load the GDataSetVecFloat 'that' from the stream 'stream'
+// The JSON is read with the streaming parser and the samples are 
+// decoded as they are read, without building the JSONNode tree of the 
+// whole file
+// Return true if the GDataSet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool _GDSVecFloatLoad(GDataSet* that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (stream == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'stream' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  // Remove the current samples
+  _GDSVecFloatRemoveAllSample((GDataSetVecFloat*)that);
+  // Parse the stream
+  GDSLoadCtx ctx = {._that = that, ._depth = 0, 
+    ._key = GDSLoadKey_Other, ._subKey = GDSLoadKey_Other, 
+    ._vecDim = -1, ._nbVal = 0, ._capVal = 16, ._nbSample = -1, 
+    ._isTypeOk = false};
+  ctx._vals = PBErrMalloc(GDataSetErr, sizeof(float) * ctx._capVal);
+  JSONSAXHandler handler = {._objStart = GDSLoadObjStart, 
+    ._objEnd = GDSLoadObjEnd, ._arrStart = GDSLoadArrStart, 
+    ._arrEnd = GDSLoadArrEnd, ._key = GDSLoadKeyFound, 
+    ._val = GDSLoadVal, ._param = &ctx};
+  bool ret = JSONParse(stream, &handler);
+  free(ctx._vals);
+  // Check the consistency of the loaded data set
+  if (ret && (!ctx._isTypeOk || that->_sampleDim == NULL || 
+    (ctx._nbSample >= 0 && ctx._nbSample != that->_nbSample)))
+    ret = false;
+  if (ret)
+    GDSResetCategories(that);
+  else
+    _GDSVecFloatRemoveAllSample((GDataSetVecFloat*)that);
+  return ret;
+}
+
+// Save the GDataSetVecFloat 'that' to the stream 'stream' in binary 
+// format (see PBBin)
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true upon success else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatSaveBin(const GDataSetVecFloat* const that, 
+  FILE* const stream, const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (stream == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'stream' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (that->_dataSet._sampleDim == NULL) {
+    GDataSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GDataSetErr->_msg, "'that' has no sample dimension");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "GDSV", checksum);
+  PBBinWriteStr(&bin, that->_dataSet._name);
+  PBBinWriteStr(&bin, that->_dataSet._desc);
+  _VecShortEncodeAsBin(that->_dataSet._sampleDim, &bin);
+  PBBinWriteI64(&bin, that->_dataSet._nbSample);
+  // The samples are written without their dimension, which is given 
+  // by the sample dimension of the data set
+  long dim = VecGet(that->_dataSet._sampleDim, 0);
+  if (that->_dataSet._nbSample > 0) {
+    GSetIterForward iter = 
+      GSetIterForwardCreateStatic(&(that->_dataSet._samples));
+    do {
+      VecFloat* sample = GSetIterGet(&iter);
+      PBBinWriteFloats(&bin, sample->_val, dim);
+    } while (GSetIterStep(&iter));
+  }
+  return PBBinWriteFooter(&bin);
+}
+
+// Load the GDataSetVecFloat 'that' from the stream 'stream' in binary 
+// format, the current samples of 'that' are removed before loading
+// Return true if the GDataSet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatLoadBin(GDataSetVecFloat* const that, 
+  FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (stream == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'stream' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  // Remove the current samples
+  _GDSVecFloatRemoveAllSample(that);
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "GDSV"))
+    return false;
+  char* name = PBBinReadStr(&bin);
+  char* desc = PBBinReadStr(&bin);
+  VecShort* sampleDim = NULL;
+  bool ret = _VecShortDecodeAsBin(&sampleDim, &bin);
+  long nbSample = (long)PBBinReadI64(&bin);
+  ret = ret && PBBinIsOk(&bin) && VecGetDim(sampleDim) == 1 && 
+    VecGet(sampleDim, 0) > 0 && nbSample >= 0;
+  if (ret) {
+    long dim = VecGet(sampleDim, 0);
+    for (long iSample = 0; 
+      iSample < nbSample && PBBinIsOk(&bin); ++iSample) {
+      VecFloat* sample = VecFloatCreate(dim);
+      PBBinReadFloats(&bin, sample->_val, dim);
+      GSetAppend(&(that->_dataSet._samples), sample);
+      ++(that->_dataSet._nbSample);
+    }
+    ret = PBBinReadFooter(&bin);
+  }
+  if (ret) {
+    free(that->_dataSet._name);
+    that->_dataSet._name = name;
+    free(that->_dataSet._desc);
+    that->_dataSet._desc = desc;
+    that->_dataSet._type = GDataSetType_VecFloat;
+    if (that->_dataSet._sampleDim != NULL)
+      VecFree(&(that->_dataSet._sampleDim));
+    that->_dataSet._sampleDim = sampleDim;
+    GDSResetCategories((GDataSet*)that);
+  } else {
+    free(name);
+    free(desc);
+    if (sampleDim != NULL)
+      VecFree(&sampleDim);
+    _GDSVecFloatRemoveAllSample(that);
+  }
+  return ret;
+}
+
+// Write the JSON encoding of the GDataSetVecFloat 'that' with the 
+// JSONWriter 'writer', as the value of the last key, an element of the 
+// current array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSVecFloatEncodeAsJSONStream(const GDataSetVecFloat* const that, 
+  JSONWriter* const writer) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (writer == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'writer' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  const GDataSet* dataSet = &(that->_dataSet);
+  JSONWriterObjStart(writer);
+  JSONWriterPropStr(writer, "dataSet", 
+    (dataSet->_name != NULL ? dataSet->_name : ""));
+  JSONWriterPropLong(writer, "dataSetType", dataSet->_type);
+  JSONWriterPropStr(writer, "desc", 
+    (dataSet->_desc != NULL ? dataSet->_desc : ""));
+  JSONWriterPropLong(writer, "nbSample", dataSet->_nbSample);
+  if (dataSet->_sampleDim != NULL) {
+    JSONWriterKey(writer, "dim");
+    VecEncodeAsJSONStream(dataSet->_sampleDim, writer);
+  }
+  JSONWriterKey(writer, "samples");
+  JSONWriterArrStart(writer);
+  for (const GSetElem* elem = dataSet->_samples._head; elem != NULL; 
+    elem = elem->_next)
+    VecEncodeAsJSONStream((const VecFloat*)(elem->_data), writer);
+  JSONWriterArrEnd(writer);
+  JSONWriterObjEnd(writer);
+}
+
+// Save the GDataSetVecFloat to the stream with a JSONWriter, without 
+// building the JSONNode tree
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true upon success else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatSaveFast(const GDataSetVecFloat* const that, 
+  FILE* const stream, const bool compact) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (stream == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'stream' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  JSONWriter writer = JSONWriterCreateStatic(stream, compact);
+  GDSVecFloatEncodeAsJSONStream(that, &writer);
+  return JSONWriterFlush(&writer);
+}
+
+// Center the GDataSet 'that' on its mean, processing all the samples
+// at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSMeanCenterFast(GDataSetVecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  GSetVecFloat* samples = (GSetVecFloat*)GDSSamples(that);
+  if (GSetNbElem(samples) == 0)
+    return;
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(samples);
+  VecFloatBatchMeanCenter(batch);
+  VecFloatBatchCopyToGSet(batch, samples);
+  VecFloatBatchFree(&batch);
+}
+
+// Normalize the GDataSet 'that', ie normalize each of its vectors,
+// processing all the samples at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSNormalizeFast(GDataSetVecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  GSetVecFloat* samples = (GSetVecFloat*)GDSSamples(that);
+  if (GSetNbElem(samples) == 0)
+    return;
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(samples);
+  VecFloatBatchNormalise(batch);
+  VecFloatBatchCopyToGSet(batch, samples);
+  VecFloatBatchFree(&batch);
+}
+
+// Get the covariance matrix of the GDataSetVecFloat 'that', 
+// processing all the samples at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+MatFloat* GDSGetCovarianceMatrixFast(const GDataSetVecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (GDSGetSize(that) == 0) {
+    GDataSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GDataSetErr->_msg, "'that' is empty");
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(GDSSamples(that));
+  MatFloat* cov = VecFloatBatchGetCovarianceMatrix(batch);
+  VecFloatBatchFree(&batch);
+  return cov;
+}
+
+// Same as GDataSetVecFloatEvaluateNN but the samples are evaluated by
+// blocks of up to GDS_EVALUATENNBLOCK samples with NNEvalBatch, the 
+// threshold is checked sample by sample so the result is the same
+// The hidden values of 'nn' are left unchanged
+#if BUILDMODE != 0
+static inline
+#endif
+float GDataSetVecFloatEvaluateNNFast(
+  const GDataSetVecFloat* const that, 
+  const NeuraNet* const nn, 
+  const int iCat, 
+  const VecShort* const iInputs,
+  const VecShort* const iOutputs,
+  const float threshold) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'that' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (nn == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'nn' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (iInputs == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'iInputs' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (iOutputs == NULL) {
+    GDataSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GDataSetErr->_msg, "'iOutputs' is null");
+    PBErrCatch(GDataSetErr);
+  }
+  if (iCat < 0 || iCat >= GDSGetNbCat(that)) {
+    GDataSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GDataSetErr->_msg, "'iCat' is invalid (0<=%d<%ld)", 
+      iCat, GDSGetNbCat(that));
+    PBErrCatch(GDataSetErr);
+  }
+  if (VecGetDim(iInputs) != NNGetNbInput(nn)) {
+    GDataSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GDataSetErr->_msg, 
+      "'iInputs' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(iInputs), NNGetNbInput(nn));
+    PBErrCatch(GDataSetErr);
+  }
+  if (VecGetDim(iOutputs) != NNGetNbOutput(nn)) {
+    GDataSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GDataSetErr->_msg, 
+      "'iOutputs' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(iOutputs), NNGetNbOutput(nn));
+    PBErrCatch(GDataSetErr);
+  }
+#endif
+  GSet* cat = that->_dataSet._categories + iCat;
+  const long nbSample = GSetNbElem(cat);
+  if (nbSample == 0)
+    return 0.0;
+  const long nbIn = NNGetNbInput(nn);
+  const long nbOut = NNGetNbOutput(nn);
+  const double sizeCat = (double)GDSGetSizeCat(that, iCat);
+  NNEvalPlan* plan = NNEvalPlanCreate(nn);
+  const VecFloat** samples = PBErrMalloc(GDataSetErr, 
+    sizeof(VecFloat*) * (nbSample < GDS_EVALUATENNBLOCK ? 
+    nbSample : GDS_EVALUATENNBLOCK));
+  VecFloatBatch* inputs = NULL;
+  VecFloatBatch* outputs = NULL;
+  // The first blocks are smaller to waste less evaluations when the
+  // threshold is reached early, then their size doubles up to 
+  // GDS_EVALUATENNBLOCK
+  long sizeBlock = (NN_EVALBATCHCHUNK < GDS_EVALUATENNBLOCK ? 
+    NN_EVALBATCHCHUNK : GDS_EVALUATENNBLOCK);
+  long nbBlock = 0;
+  GSetIterForward iter = GSetIterForwardCreateStatic(cat);
+  // Declare variables to memorize the sum of errors and the nb of 
+  // evaluated samples
+  float value = 0.0;
+  long nbEval = 0;
+  bool flagStop = false;
+  while (!flagStop && nbEval < nbSample) {
+    const long nb = (nbSample - nbEval < sizeBlock ? 
+      nbSample - nbEval : sizeBlock);
+    if (nb != nbBlock) {
+      nbBlock = nb;
+      VecFloatBatchFree(&inputs);
+      VecFloatBatchFree(&outputs);
+      inputs = VecFloatBatchCreate(nbBlock, nbIn);
+      outputs = VecFloatBatchCreate(nbBlock, nbOut);
+    }
+    sizeBlock = (2 * sizeBlock < GDS_EVALUATENNBLOCK ? 
+      2 * sizeBlock : GDS_EVALUATENNBLOCK);
+    // Gather the inputs of the samples of the block
+    for (long iSample = 0; iSample < nbBlock; ++iSample) {
+      samples[iSample] = GSetIterGet(&iter);
+      for (long iIn = nbIn; iIn--;)
+        inputs->_val[iIn * inputs->_stride + iSample] = 
+          VecGet(samples[iSample], VecGet(iInputs, iIn));
+      GSetIterStep(&iter);
+    }
+    NNEvalBatch(nn, plan, inputs, outputs, 0);
+    // Add the errors sample by sample and stop as soon as the result
+    // can't get better than the threshold
+    for (long iSample = 0; iSample < nbBlock && !flagStop; ++iSample) {
+      float err = 0.0;
+      for (long iOut = nbOut; iOut--;)
+        err += fsquare(
+          outputs->_val[iOut * outputs->_stride + iSample] - 
+          VecGet(samples[iSample], VecGet(iOutputs, iOut)));
+      value += sqrt(err);
+      ++nbEval;
+      if (threshold >= (float)(-value / sizeCat))
+        flagStop = true;
+    }
+  }
+  free(samples);
+  VecFloatBatchFree(&inputs);
+  VecFloatBatchFree(&outputs);
+  NNEvalPlanFree(&plan);
+  return -1.0 * value / (float)nbEval;
+}
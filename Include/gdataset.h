@@ -35,6 +35,10 @@ void _GDSGenBrushPairAddSample();
 
 // ================= Define ==================
 
+// Maximum number of samples evaluated at once by 
+// GDataSetVecFloatEvaluateNNFast
+#define GDS_EVALUATENNBLOCK 4096
+
 typedef enum GDataSetType {
   GDataSetType_VecFloat, GDataSetType_GenBrushPair
 } GDataSetType;
@@ -124,6 +128,35 @@ void GDataSetFreeStatic(GDataSet* const that);
 bool GDataSetLoad(GDataSet* that, FILE* const stream);
 bool _GDSLoad(GDataSet* that, FILE* const stream);
 
+// Load the GDataSetVecFloat 'that' from the stream 'stream'
+// The JSON is read with the streaming parser and the samples are 
+// decoded as they are read, without building the JSONNode tree of the 
+// whole file
+// Return true if the GDataSet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool _GDSVecFloatLoad(GDataSet* that, FILE* const stream);
+
+// Save the GDataSetVecFloat 'that' to the stream 'stream' in binary 
+// format (see PBBin)
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true upon success else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatSaveBin(const GDataSetVecFloat* const that, 
+  FILE* const stream, const bool checksum);
+
+// Load the GDataSetVecFloat 'that' from the stream 'stream' in binary 
+// format, the current samples of 'that' are removed before loading
+// Return true if the GDataSet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatLoadBin(GDataSetVecFloat* const that, 
+  FILE* const stream);
+
 // Function which decode from JSON encoding 'json' to 'that'
 bool GDataSetDecodeAsJSON(GDataSet* that, const JSONNode* const json);
 
@@ -352,6 +385,20 @@ void GDSNormalize(GDataSetVecFloat* const that);
 // input vectors
 void GDSNormalizeInputs(GDataSetVecFloat* const that);
 
+// Center the GDataSet 'that' on its mean, processing all the samples
+// at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSMeanCenterFast(GDataSetVecFloat* const that);
+
+// Normalize the GDataSet 'that', ie normalize each of its vectors,
+// processing all the samples at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSNormalizeFast(GDataSetVecFloat* const that);
+
 // Get the mean of the GDataSet 'that'
 VecFloat* GDSGetMean(const GDataSetVecFloat* const that);
 
@@ -366,6 +413,13 @@ GDataSetVecFloat GDSClone(const GDataSetVecFloat* const that);
 // Get the covariance matrix of the GDataSetVecFloat 'that'
 MatFloat* GDSGetCovarianceMatrix(const GDataSetVecFloat* const that);
 
+// Get the covariance matrix of the GDataSetVecFloat 'that', 
+// processing all the samples at once through a VecFloatBatch
+#if BUILDMODE != 0
+static inline
+#endif
+MatFloat* GDSGetCovarianceMatrixFast(const GDataSetVecFloat* const that);
+
 // Get the covariance matrix of inputs of the GDataSetVecFloat 'that'
 MatFloat* GDSGetInpCovarianceMatrix(const GDataSetVecFloat* const that);
 
@@ -401,6 +455,26 @@ bool GDSVecFloatSave(
                     FILE* const stream, 
                      const bool compact);
 
+// Write the JSON encoding of the GDataSetVecFloat 'that' with the 
+// JSONWriter 'writer', as the value of the last key, an element of the 
+// current array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void GDSVecFloatEncodeAsJSONStream(const GDataSetVecFloat* const that, 
+  JSONWriter* const writer);
+
+// Save the GDataSetVecFloat to the stream with a JSONWriter, without 
+// building the JSONNode tree
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true upon success else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GDSVecFloatSaveFast(const GDataSetVecFloat* const that, 
+  FILE* const stream, const bool compact);
+
 // Save the category 'iCat' of the GDataSetVecFloat to the stream
 // If 'compact' equals true it saves in compact form, else it saves in 
 // readable form
@@ -427,6 +501,21 @@ float GDataSetVecFloatEvaluateNN(
   const VecShort* const iOutputs,
   const float threshold);
 
+// Same as GDataSetVecFloatEvaluateNN but the samples are evaluated by
+// blocks of up to GDS_EVALUATENNBLOCK samples with NNEvalBatch, the 
+// threshold is checked sample by sample so the result is the same
+// The hidden values of 'nn' are left unchanged
+#if BUILDMODE != 0
+static inline
+#endif
+float GDataSetVecFloatEvaluateNNFast(
+  const GDataSetVecFloat* const that, 
+  const NeuraNet* const nn, 
+  const int iCat, 
+  const VecShort* const iInputs,
+  const VecShort* const iOutputs,
+  const float threshold);
+
 // Create a new GDataSetVecFloat
 GDataSetVecFloat GDataSetVecFloatCreateStatic(void);
 
@@ -662,20 +751,20 @@ VecFloat* GDSVecFloatNearestNeighbourBrute(
   default: PBErrInvalidPolymorphism)(DataSet)
 
 #define GDSSave(DataSet, Stream, Compact) _Generic(DataSet, \
-  GDataSetVecFloat*: GDSVecFloatSave, \
-  const GDataSetVecFloat*: GDSVecFloatSave, \
+  GDataSetVecFloat*: GDSVecFloatSaveFast, \
+  const GDataSetVecFloat*: GDSVecFloatSaveFast, \
   default: PBErrInvalidPolymorphism)(DataSet, Stream, Compact)
 
 #define GDSEvaluateNN(GDS, NN, Cat, Inputs, Outputs, Threshold) \
   _Generic(GDS, \
-  GDataSetVecFloat*: GDataSetVecFloatEvaluateNN, \
-  const GDataSetVecFloat*: GDataSetVecFloatEvaluateNN, \
+  GDataSetVecFloat*: GDataSetVecFloatEvaluateNNFast, \
+  const GDataSetVecFloat*: GDataSetVecFloatEvaluateNNFast, \
   default: PBErrInvalidPolymorphism)( \
     GDS, NN, Cat, Inputs, Outputs, Threshold)
 
 #define GDSLoad(DataSet, FP) _Generic(DataSet, \
   GDataSet*: GDataSetLoad, \
-  GDataSetVecFloat*: _GDSLoad, \
+  GDataSetVecFloat*: _GDSVecFloatLoad, \
   GDataSetGenBrushPair*: _GDSLoad, \
   default: PBErrInvalidPolymorphism)((GDataSet*)DataSet, FP)
 
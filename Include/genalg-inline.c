@@ -993,5 +993,261 @@ unsigned long GAGetMaxAge(GenAlg* const that) {
   return that->_maxAge;
 }
 
+// Write the binary encoding of the GenAlgAdn 'that' with genes 
+// of length 'lengthAdnF' and 'lengthAdnI' with the PBBin 'bin'
+static inline void GAAdnEncodeAsBin(const GenAlgAdn* const that, 
+  const long lengthAdnF, const long lengthAdnI, PBBin* const bin) {
+  PBBinWriteI64(bin, (int64_t)(that->_id));
+  PBBinWriteI64(bin, (int64_t)(that->_idParents[0]));
+  PBBinWriteI64(bin, (int64_t)(that->_idParents[1]));
+  PBBinWriteI64(bin, (int64_t)(that->_age));
+  PBBinWriteFloat(bin, that->_val);
+  if (lengthAdnF > 0) {
+    PBBinWriteFloats(bin, that->_adnF->_val, lengthAdnF);
+    PBBinWriteFloats(bin, that->_deltaAdnF->_val, lengthAdnF);
+  }
+  if (lengthAdnI > 0)
+    PBBinWriteLongs(bin, that->_adnI->_val, lengthAdnI);
+}
+
+// Read the binary encoding of a GenAlgAdn with genes of length 
+// 'lengthAdnF' and 'lengthAdnI' with the PBBin 'bin' into 'that'
+static inline void GAAdnDecodeAsBin(GenAlgAdn* const that, 
+  const long lengthAdnF, const long lengthAdnI, PBBin* const bin) {
+  that->_id = (unsigned long)PBBinReadI64(bin);
+  that->_idParents[0] = (unsigned long)PBBinReadI64(bin);
+  that->_idParents[1] = (unsigned long)PBBinReadI64(bin);
+  that->_age = (unsigned long)PBBinReadI64(bin);
+  that->_val = PBBinReadFloat(bin);
+  if (lengthAdnF > 0) {
+    PBBinReadFloats(bin, that->_adnF->_val, lengthAdnF);
+    PBBinReadFloats(bin, that->_deltaAdnF->_val, lengthAdnF);
+  }
+  if (lengthAdnI > 0)
+    PBBinReadLongs(bin, that->_adnI->_val, lengthAdnI);
+}
+
+// Save the GenAlg 'that' to the stream 'stream' in binary format
+// (see PBBin)
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GASaveBin(const GenAlg* const that, FILE* const stream, 
+  const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "GALG", checksum);
+  long lengthAdnF = GAGetLengthAdnFloat(that);
+  long lengthAdnI = GAGetLengthAdnInt(that);
+  PBBinWriteU32(&bin, (uint32_t)(that->_type));
+  PBBinWriteI64(&bin, GAGetNbAdns(that));
+  PBBinWriteI64(&bin, GAGetNbElites(that));
+  PBBinWriteI64(&bin, lengthAdnF);
+  PBBinWriteI64(&bin, lengthAdnI);
+  PBBinWriteI64(&bin, (int64_t)(that->_curEpoch));
+  PBBinWriteI64(&bin, (int64_t)(that->_nextId));
+  PBBinWriteI64(&bin, that->_NNdata._nbIn);
+  PBBinWriteI64(&bin, that->_NNdata._nbHid);
+  PBBinWriteI64(&bin, that->_NNdata._nbOut);
+  PBBinWriteI64(&bin, that->_NNdata._nbBaseConv);
+  PBBinWriteI64(&bin, that->_NNdata._nbBaseCellConv);
+  PBBinWriteI64(&bin, that->_NNdata._nbLink);
+  PBBinWriteU16(&bin, that->_NNdata._flagMutableLink);
+  // Bounds, as (min, max) pairs
+  for (long iGene = 0; iGene < lengthAdnF; ++iGene)
+    PBBinWriteFloats(&bin, that->_boundsF[iGene]._val, 2);
+  for (long iGene = 0; iGene < lengthAdnI; ++iGene)
+    PBBinWriteLongs(&bin, that->_boundsI[iGene]._val, 2);
+  // Adns, in the order of the GSet (from the worst to the best)
+  GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+  do {
+    GenAlgAdn* adn = GSetIterGet(&iter);
+    GAAdnEncodeAsBin(adn, lengthAdnF, lengthAdnI, &bin);
+  } while (GSetIterStep(&iter));
+  GAAdnEncodeAsBin(that->_bestAdn, lengthAdnF, lengthAdnI, &bin);
+  return PBBinWriteFooter(&bin);
+}
+
+// Load the GenAlg 'that' from the stream 'stream' in binary format
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GALoadBin(GenAlg** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (*that != NULL)
+    GenAlgFree(that);
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "GALG"))
+    return false;
+  uint32_t type = PBBinReadU32(&bin);
+  long nbAdns = (long)PBBinReadI64(&bin);
+  long nbElites = (long)PBBinReadI64(&bin);
+  long lengthAdnF = (long)PBBinReadI64(&bin);
+  long lengthAdnI = (long)PBBinReadI64(&bin);
+  if (!PBBinIsOk(&bin) || type > genAlgTypeMorpheus || nbAdns <= 2 || 
+    nbElites <= 1 || nbElites >= nbAdns || lengthAdnF < 0 || 
+    lengthAdnI < 0)
+    return false;
+  *that = GenAlgCreate(nbAdns, nbElites, lengthAdnF, lengthAdnI);
+  (*that)->_type = (GenAlgType)type;
+  (*that)->_curEpoch = (unsigned long)PBBinReadI64(&bin);
+  (*that)->_nextId = (unsigned long)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbIn = (int)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbHid = (int)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbOut = (int)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbBaseConv = (long)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbBaseCellConv = (long)PBBinReadI64(&bin);
+  (*that)->_NNdata._nbLink = (long)PBBinReadI64(&bin);
+  (*that)->_NNdata._flagMutableLink = (PBBinReadU16(&bin) != 0);
+  for (long iGene = 0; iGene < lengthAdnF; ++iGene)
+    PBBinReadFloats(&bin, (*that)->_boundsF[iGene]._val, 2);
+  for (long iGene = 0; iGene < lengthAdnI; ++iGene)
+    PBBinReadLongs(&bin, (*that)->_boundsI[iGene]._val, 2);
+  GAUpdateNormRange(*that);
+  GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(*that));
+  do {
+    GenAlgAdn* adn = GSetIterGet(&iter);
+    GAAdnDecodeAsBin(adn, lengthAdnF, lengthAdnI, &bin);
+    GSetIterSetSortVal(&iter, adn->_val);
+  } while (GSetIterStep(&iter));
+  GAAdnDecodeAsBin((*that)->_bestAdn, lengthAdnF, lengthAdnI, &bin);
+  if (!PBBinReadFooter(&bin)) {
+    GenAlgFree(that);
+    return false;
+  }
+  return true;
+}
 
+// Write the JSON encoding of the GAHistory 'that' with the JSONWriter 
+// 'writer', as the value of the last key, an element of the current 
+// array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void GAHistoryEncodeAsJSONStream(const GAHistory* const that, 
+  JSONWriter* const writer) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (writer == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'writer' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  JSONWriterObjStart(writer);
+  JSONWriterKey(writer, "_genealogy");
+  JSONWriterArrStart(writer);
+  for (const GSetElem* elem = that->_genealogy._head; elem != NULL; 
+    elem = elem->_next) {
+    const GAHistoryBirth* birth = elem->_data;
+    JSONWriterObjStart(writer);
+    JSONWriterPropLong(writer, "_epoch", (long)(birth->_epoch));
+    JSONWriterPropLong(writer, "_father", (long)(birth->_idParents[0]));
+    JSONWriterPropLong(writer, "_mother", (long)(birth->_idParents[1]));
+    JSONWriterPropLong(writer, "_id", (long)(birth->_idChild));
+    JSONWriterObjEnd(writer);
+  }
+  JSONWriterArrEnd(writer);
+  JSONWriterObjEnd(writer);
+}
 
+// Save the history of the GenAlg 'that' with a JSONWriter, without 
+// building the JSONNode tree
+// Return true if we could save the history, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool GASaveHistoryFast(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (that->_history._path == NULL)
+    return false;
+  FILE* stream = fopen(that->_history._path, "w");
+  if (stream == NULL)
+    return false;
+  JSONWriter writer = JSONWriterCreateStatic(stream, true);
+  GAHistoryEncodeAsJSONStream(&(that->_history), &writer);
+  bool ret = JSONWriterFlush(&writer);
+  if (fclose(stream) != 0)
+    ret = false;
+  return ret;
+}
+
+// Same as GAInit but the random values are drawn from a sequence 
+// determined by the PBRandom 'rng'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAInitWith(GenAlg* const that, PBRandom* const rng) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (rng == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'rng' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  PBRandomSeedGlobal(rng);
+  GAInit(that);
+}
+
+// Same as GAStep but the random values are drawn from a sequence 
+// determined by the PBRandom 'rng'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAStepWith(GenAlg* const that, PBRandom* const rng) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (rng == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'rng' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  PBRandomSeedGlobal(rng);
+  GAStep(that);
+}
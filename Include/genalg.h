@@ -477,6 +477,20 @@ void GAInit(GenAlg* const that);
 // GenAlgAdn
 void GAStep(GenAlg* const that); 
 
+// Same as GAInit and GAStep but the random values are drawn from a 
+// sequence determined by the PBRandom 'rng', so that the runs are 
+// reproducible from the seed of 'rng'
+// The library still draws them with rand(), seeded from 'rng', hence
+// these functions must not be called concurrently
+#if BUILDMODE != 0
+static inline
+#endif
+void GAInitWith(GenAlg* const that, PBRandom* const rng);
+#if BUILDMODE != 0
+static inline
+#endif
+void GAStepWith(GenAlg* const that, PBRandom* const rng);
+
 // Print the information about the GenAlg 'that' on the stream 'stream'
 void GAPrintln(const GenAlg* const that, FILE* const stream);
 
@@ -509,6 +523,24 @@ bool GALoad(GenAlg** that, FILE* const stream);
 bool GASave(const GenAlg* const that, FILE* const stream, 
   const bool compact);
 
+// Save the GenAlg 'that' to the stream 'stream' in binary format
+// (see PBBin)
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GASaveBin(const GenAlg* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the GenAlg 'that' from the stream 'stream' in binary format
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool GALoadBin(GenAlg** that, FILE* const stream);
+
 // Set the value of the GenAlgAdn 'adn' of the GenAlg 'that' to 'val'
 #if BUILDMODE != 0
 static inline
@@ -605,6 +637,23 @@ bool GASaveHistory(const GenAlg* const that);
 // Function which return the JSON encoding of the GAHistory 'that' 
 JSONNode* GAHistoryEncodeAsJSON(const GAHistory* const that);
 
+// Write the JSON encoding of the GAHistory 'that' with the JSONWriter 
+// 'writer', as the value of the last key, an element of the current 
+// array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void GAHistoryEncodeAsJSONStream(const GAHistory* const that, 
+  JSONWriter* const writer);
+
+// Save the history of the GenAlg 'that' with a JSONWriter, without 
+// building the JSONNode tree
+// Return true if we could save the history, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool GASaveHistoryFast(const GenAlg* const that);
+
 // Flush the content of the GAHistory 'that'
 void GAHistoryFlush(GAHistory* that);
 
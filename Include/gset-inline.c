@@ -1551,3 +1551,2836 @@ void GSetIterBackwardSetSortVal(GSetIterBackward* const that, float val) {
   GSetElemSetSortVal(that->_curElem, val);
 }
 
+
+// ================ GSetArr functions implementation ====================
+
+// Return the element at the 'iElem'-th position of the GSetArr 'that'
+// without checking 'iElem'
+static inline GSetArrElem* GSetArrSlot(const GSetArr* const that, 
+  const long iElem) {
+  return that->_elems + 
+    ((that->_first + iElem) & (that->_capacity - 1));
+}
+
+// Reallocate the buffer of the GSetArr 'that' to be able to store at 
+// least 'nb' elements
+// The elements are moved at the beginning of the new buffer
+static inline void GSetArrRealloc(GSetArr* const that, const long nb) {
+  // Get the new capacity, the smallest power of 2 greater than 'nb'
+  long capacity = GSETARR_INITCAPACITY;
+  while (capacity < nb)
+    capacity <<= 1;
+  // Allocate the new buffer
+  GSetArrElem* elems = 
+    PBErrMalloc(GSetErr, sizeof(GSetArrElem) * capacity);
+  // Copy the current elements in order
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem)
+    elems[iElem] = *GSetArrSlot(that, iElem);
+  // Replace the old buffer
+  free(that->_elems);
+  that->_elems = elems;
+  that->_capacity = capacity;
+  that->_first = 0;
+}
+
+// Function to create a new GSetArr,
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* GSetArrCreate(void) {
+  // Allocate memory for the GSetArr
+  GSetArr* that = PBErrMalloc(GSetErr, sizeof(GSetArr));
+  // Set the properties
+  *that = GSetArrCreateStatic();
+  // Return the new GSetArr
+  return that;
+}
+
+// Static constructors for GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr GSetArrCreateStatic(void) {
+  // Declare a GSetArr and set the properties
+  GSetArr s = {._elems = NULL, ._capacity = 0, ._first = 0, 
+    ._nbElem = 0};
+  // Return the GSetArr
+  return s;
+}
+
+// Function to clone a GSetArr,
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* GSetArrClone(const GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Create the clone
+  GSetArr* clone = GSetArrCreate();
+  // Copy the elements
+  _GSetArrAppendSet(clone, that);
+  // Return the clone
+  return clone;
+}
+
+// Function to create a new GSetArr with the same elements (data and 
+// sort values) and in the same order as the GSet 'set'
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* _GSetArrCreateFromGSet(const GSet* const set) {
+#if BUILDMODE == 0
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Create the GSetArr
+  GSetArr* that = GSetArrCreate();
+  // Copy the elements
+  _GSetArrAppendGSet(that, set);
+  // Return the new GSetArr
+  return that;
+}
+
+// Function to free the memory used by the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrFree(GSetArr** that) {
+  if (that == NULL || *that == NULL) return;
+  // Free the buffer
+  _GSetArrFlush(*that);
+  // Free the memory
+  free(*that);
+  *that = NULL;
+}
+
+// Function to empty the GSetArr and release its buffer
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrFlush(GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  free(that->_elems);
+  *that = GSetArrCreateStatic();
+}
+
+// Return the number of element in the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrNbElem(const GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_nbElem;
+}
+
+// Ensure the GSetArr has room for at least 'nb' elements without 
+// reallocation
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrReserve(GSetArr* const that, const long nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (nb > that->_capacity)
+    GSetArrRealloc(that, nb);
+}
+
+// Function to print a GSetArr
+// Use the function 'printData' to print the data pointed to by 
+// the elements, and print 'sep' between each element
+// If printData is null, print the pointer value instead
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrPrint(const GSetArr* const that, FILE* const stream, 
+  void(*printData)(const void* const data, FILE* const stream), 
+  const char* const sep) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (stream == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'stream' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (sep == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'sep' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem) {
+    void* data = GSetArrSlot(that, iElem)->_data;
+    if (printData != NULL)
+      printData(data, stream);
+    else
+      fprintf(stream, "%p", data);
+    if (iElem < that->_nbElem - 1)
+      fprintf(stream, "%s", sep);
+  }
+}
+
+// Function to insert an element pointing toward 'data' at the 
+// head of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrPush(GSetArr* const that, void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Make room for the new element if necessary
+  if (that->_nbElem == that->_capacity)
+    GSetArrRealloc(that, that->_nbElem + 1);
+  // Move the head backward and set the new element
+  that->_first = (that->_first - 1) & (that->_capacity - 1);
+  GSetArrElem* e = that->_elems + that->_first;
+  e->_data = data;
+  e->_sortVal = 0.0;
+  ++(that->_nbElem);
+}
+
+// Function to insert an element pointing toward 'data' at the 
+// tail of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppend(GSetArr* const that, void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Make room for the new element if necessary
+  if (that->_nbElem == that->_capacity)
+    GSetArrRealloc(that, that->_nbElem + 1);
+  // Set the new element after the tail
+  GSetArrElem* e = GSetArrSlot(that, that->_nbElem);
+  e->_data = data;
+  e->_sortVal = 0.0;
+  ++(that->_nbElem);
+}
+
+// Function to insert an element pointing toward 'data' at the 
+// position defined by 'v' sorting the set in increasing order
+// The position is found by binary search, elements with the same 
+// sort value keep their order of insertion
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAddSort(GSetArr* const that, void* const data, 
+  const double v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Search the first element with a sort value strictly greater 
+  // than 'v'
+  long low = 0;
+  long high = that->_nbElem;
+  while (low < high) {
+    long mid = low + (high - low) / 2;
+    if (GSetArrSlot(that, mid)->_sortVal <= (float)v)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  // Insert the new element before it
+  _GSetArrInsert(that, data, low);
+  GSetArrSlot(that, low)->_sortVal = v;
+}
+
+// Function to insert an element pointing toward 'data' at the 
+// 'iElem'-th position 
+// If 'iElem' is greater than or equal to the number of element
+// in the GSetArr, elements pointing toward null data are added
+// If the data is inserted inside the set, the current elements from
+// the iElem-th elem are pushed 
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrInsert(GSetArr* const that, void* const data, 
+  const long iElem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (iElem < 0) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'iElem' is invalid (0<=%ld)", iElem);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // If the position is after the tail, pad with null data
+  if (iElem >= that->_nbElem) {
+    _GSetArrReserve(that, iElem + 1);
+    while (that->_nbElem < iElem)
+      _GSetArrAppend(that, NULL);
+    _GSetArrAppend(that, data);
+  // Else, the position is inside the set
+  } else {
+    if (that->_nbElem == that->_capacity)
+      GSetArrRealloc(that, that->_nbElem + 1);
+    // Shift the shortest side of the set to make room for the new 
+    // element
+    if (iElem < that->_nbElem / 2) {
+      that->_first = (that->_first - 1) & (that->_capacity - 1);
+      for (long jElem = 0; jElem < iElem; ++jElem)
+        *GSetArrSlot(that, jElem) = *GSetArrSlot(that, jElem + 1);
+    } else {
+      for (long jElem = that->_nbElem; jElem > iElem; --jElem)
+        *GSetArrSlot(that, jElem) = *GSetArrSlot(that, jElem - 1);
+    }
+    GSetArrElem* e = GSetArrSlot(that, iElem);
+    e->_data = data;
+    e->_sortVal = 0.0;
+    ++(that->_nbElem);
+  }
+}
+
+// Function to remove the element at the head of the GSetArr
+// Return the data pointed to by the removed element, or null if the 
+// GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrPop(GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  void* ret = that->_elems[that->_first]._data;
+  that->_first = (that->_first + 1) & (that->_capacity - 1);
+  --(that->_nbElem);
+  return ret;
+}
+
+// Function to remove the element at the tail of the GSetArr
+// Return the data pointed to by the removed element, or null if the 
+// GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrDrop(GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  --(that->_nbElem);
+  return GSetArrSlot(that, that->_nbElem)->_data;
+}
+
+// Function to remove the element at the 'iElem'-th position of the 
+// GSetArr
+// Return the data pointed to by the removed element
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrRemove(GSetArr* const that, const long iElem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (iElem < 0 || iElem >= that->_nbElem) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'iElem' is invalid (0<=%ld<%ld)", 
+      iElem, that->_nbElem);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Memorize the removed data
+  void* ret = GSetArrSlot(that, iElem)->_data;
+  // Close the gap by shifting the shortest side of the set
+  if (iElem < that->_nbElem / 2) {
+    for (long jElem = iElem; jElem > 0; --jElem)
+      *GSetArrSlot(that, jElem) = *GSetArrSlot(that, jElem - 1);
+    that->_first = (that->_first + 1) & (that->_capacity - 1);
+  } else {
+    for (long jElem = iElem; jElem < that->_nbElem - 1; ++jElem)
+      *GSetArrSlot(that, jElem) = *GSetArrSlot(that, jElem + 1);
+  }
+  --(that->_nbElem);
+  // Return the data
+  return ret;
+}
+
+// Function to remove the first element of the GSetArr pointing to 
+// 'data'
+// If there is no element pointing to 'data' do nothing
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveFirst(GSetArr* const that, const void* const data) {
+  long iElem = _GSetArrGetIndexFirst(that, data);
+  if (iElem != -1)
+    _GSetArrRemove(that, iElem);
+}
+
+// Function to remove the last element of the GSetArr pointing to 
+// 'data'
+// If there is no element pointing to 'data' do nothing
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveLast(GSetArr* const that, const void* const data) {
+  long iElem = _GSetArrGetIndexLast(that, data);
+  if (iElem != -1)
+    _GSetArrRemove(that, iElem);
+}
+
+// Function to remove all the element of the GSetArr pointing to 'data'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveAll(GSetArr* const that, const void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Compact in one pass the elements not pointing to 'data'
+  long nbKept = 0;
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem) {
+    GSetArrElem* e = GSetArrSlot(that, iElem);
+    if (e->_data != data) {
+      if (nbKept != iElem)
+        *GSetArrSlot(that, nbKept) = *e;
+      ++nbKept;
+    }
+  }
+  that->_nbElem = nbKept;
+}
+
+// Function to get the element at the 'iElem'-th position of the 
+// GSetArr
+// The returned pointer is invalidated by any insertion or removal
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrElem* _GSetArrElement(const GSetArr* const that, 
+  const long iElem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (iElem < 0 || iElem >= that->_nbElem) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'iElem' is invalid (0<=%ld<%ld)", 
+      iElem, that->_nbElem);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return GSetArrSlot(that, iElem);
+}
+
+// Function to get the data at the 'iElem'-th position of the GSetArr
+// without removing it
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrGet(const GSetArr* const that, const long iElem) {
+  return _GSetArrElement(that, iElem)->_data;
+}
+
+// Function to get the data at first position of the GSetArr
+// without removing it
+// Return null if the GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrHead(const GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  return GSetArrSlot(that, 0)->_data;
+}
+
+// Function to get the data at last position of the GSetArr
+// without removing it
+// Return null if the GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrTail(const GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  return GSetArrSlot(that, that->_nbElem - 1)->_data;
+}
+
+// Function to set the data at the 'iElem'-th position of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSet(GSetArr* const that, const long iElem, 
+  void* const data) {
+  _GSetArrElement(that, iElem)->_data = data;
+}
+
+// Function to get the sort value of the 'iElem'-th element of the 
+// GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+float _GSetArrGetSortVal(const GSetArr* const that, const long iElem) {
+  return _GSetArrElement(that, iElem)->_sortVal;
+}
+
+// Function to set the sort value of the 'iElem'-th element of the 
+// GSetArr
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSetSortVal(GSetArr* const that, const long iElem, 
+  const float v) {
+  _GSetArrElement(that, iElem)->_sortVal = v;
+}
+
+// Function to get the index of the first element of the GSetArr
+// which point to 'data'
+// Return -1 if cannot find the data
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrGetIndexFirst(const GSetArr* const that, 
+  const void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem)
+    if (GSetArrSlot(that, iElem)->_data == data)
+      return iElem;
+  return -1;
+}
+
+// Function to get the index of the last element of the GSetArr
+// which point to 'data'
+// Return -1 if cannot find the data
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrGetIndexLast(const GSetArr* const that, 
+  const void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  for (long iElem = that->_nbElem - 1; iElem >= 0; --iElem)
+    if (GSetArrSlot(that, iElem)->_data == data)
+      return iElem;
+  return -1;
+}
+
+// Return the number of (GSetArrElem._data=='data') in the GSetArr 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrCount(const GSetArr* const that, const void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  long nb = 0;
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem)
+    if (GSetArrSlot(that, iElem)->_data == data)
+      ++nb;
+  return nb;
+}
+
+// Function to sort the element of the GSetArr in increasing order of 
+// _sortVal
+// The sort is stable (merge sort, O(n.log(n)))
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSort(GSetArr* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  long nb = that->_nbElem;
+  if (nb < 2)
+    return;
+  // Allocate the working buffers and copy the elements in order
+  GSetArrElem* buffer = 
+    PBErrMalloc(GSetErr, sizeof(GSetArrElem) * 2 * nb);
+  GSetArrElem* src = buffer;
+  GSetArrElem* dst = buffer + nb;
+  for (long iElem = 0; iElem < nb; ++iElem)
+    src[iElem] = *GSetArrSlot(that, iElem);
+  // Bottom-up merge sort
+  for (long width = 1; width < nb; width <<= 1) {
+    for (long left = 0; left < nb; left += 2 * width) {
+      long mid = (left + width < nb ? left + width : nb);
+      long right = (left + 2 * width < nb ? left + 2 * width : nb);
+      long i = left;
+      long j = mid;
+      long k = left;
+      while (i < mid && j < right) {
+        if (src[i]._sortVal <= src[j]._sortVal)
+          dst[k++] = src[i++];
+        else
+          dst[k++] = src[j++];
+      }
+      while (i < mid)
+        dst[k++] = src[i++];
+      while (j < right)
+        dst[k++] = src[j++];
+    }
+    GSetArrElem* swap = src;
+    src = dst;
+    dst = swap;
+  }
+  // Copy back the sorted elements
+  memcpy(that->_elems, src, sizeof(GSetArrElem) * nb);
+  that->_first = 0;
+  free(buffer);
+}
+
+// Switch the 'iElem'-th and 'jElem'-th element of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSwitch(GSetArr* const that, const long iElem, 
+  const long jElem) {
+  GSetArrElem* a = _GSetArrElement(that, iElem);
+  GSetArrElem* b = _GSetArrElement(that, jElem);
+  GSetArrElem swap = *a;
+  *a = *b;
+  *b = swap;
+}
+
+// Append the element of the GSetArr 'set' at the end of the GSetArr 
+// 'that'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppendSet(GSetArr* const that, const GSetArr* const set) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Memorize the number of element in 'set' in case set == that
+  long nb = set->_nbElem;
+  _GSetArrReserve(that, that->_nbElem + nb);
+  for (long iElem = 0; iElem < nb; ++iElem) {
+    *GSetArrSlot(that, that->_nbElem) = *GSetArrSlot(set, iElem);
+    ++(that->_nbElem);
+  }
+}
+
+// Append the element of the GSet 'set' at the end of the GSetArr 
+// 'that'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppendGSet(GSetArr* const that, const GSet* const set) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  _GSetArrReserve(that, that->_nbElem + set->_nbElem);
+  const GSetElem* elem = set->_head;
+  while (elem != NULL) {
+    GSetArrElem* e = GSetArrSlot(that, that->_nbElem);
+    e->_data = elem->_data;
+    e->_sortVal = elem->_sortVal;
+    ++(that->_nbElem);
+    elem = elem->_next;
+  }
+}
+
+// Append the element of the GSetArr 'that' at the end of the GSet 
+// 'set'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrToGSet(const GSetArr* const that, GSet* const set) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  for (long iElem = 0; iElem < that->_nbElem; ++iElem) {
+    GSetArrElem* e = GSetArrSlot(that, iElem);
+    GSetAppend(set, e->_data);
+    GSetElemSetSortVal((GSetElem*)GSetTailElem(set), e->_sortVal);
+  }
+}
+
+// Create a new GSetArrIterForward for the GSetArr 'set'
+// The iterator is reset upon creation
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterForward* _GSetArrIterForwardCreate(GSetArr* const set) {
+  GSetArrIterForward* that = 
+    PBErrMalloc(GSetErr, sizeof(GSetArrIterForward));
+  *that = _GSetArrIterForwardCreateStatic(set);
+  return that;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterForward _GSetArrIterForwardCreateStatic(GSetArr* const set) {
+#if BUILDMODE == 0
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetArrIterForward that = {._set = set, ._curIndex = -1};
+  GSetArrIterForwardReset(&that);
+  return that;
+}
+
+// Create a new GSetArrIterBackward for the GSetArr 'set'
+// The iterator is reset upon creation
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterBackward* _GSetArrIterBackwardCreate(GSetArr* const set) {
+  GSetArrIterBackward* that = 
+    PBErrMalloc(GSetErr, sizeof(GSetArrIterBackward));
+  *that = _GSetArrIterBackwardCreateStatic(set);
+  return that;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterBackward _GSetArrIterBackwardCreateStatic(
+  GSetArr* const set) {
+#if BUILDMODE == 0
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetArrIterBackward that = {._set = set, ._curIndex = -1};
+  GSetArrIterBackwardReset(&that);
+  return that;
+}
+
+// Free the memory used by a GSetArrIterForward (not by its attached 
+// GSetArr)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardFree(GSetArrIterForward** that) {
+  if (that == NULL || *that == NULL) return;
+  free(*that);
+  *that = NULL;
+}
+
+// Free the memory used by a GSetArrIterBackward (not by its attached 
+// GSetArr)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardFree(GSetArrIterBackward** that) {
+  if (that == NULL || *that == NULL) return;
+  free(*that);
+  *that = NULL;
+}
+
+// Reset the GSetArrIterForward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardReset(GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  that->_curIndex = (that->_set->_nbElem > 0 ? 0 : -1);
+}
+
+// Reset the GSetArrIterBackward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardReset(GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  that->_curIndex = that->_set->_nbElem - 1;
+}
+
+// Step the GSetArrIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardStep(GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex < 0 || that->_curIndex >= that->_set->_nbElem - 1)
+    return false;
+  ++(that->_curIndex);
+  return true;
+}
+
+// Step the GSetArrIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardStep(GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex <= 0)
+    return false;
+  --(that->_curIndex);
+  return true;
+}
+
+// Step back the GSetArrIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardStepBack(GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex <= 0)
+    return false;
+  --(that->_curIndex);
+  return true;
+}
+
+// Step back the GSetArrIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardStepBack(GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex < 0 || that->_curIndex >= that->_set->_nbElem - 1)
+    return false;
+  ++(that->_curIndex);
+  return true;
+}
+
+// Apply a function to all elements of the GSetArr of the 
+// GSetArrIterForward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the nodes, 'param' is a hook to allow the user to pass
+// parameters to the function through a user-defined structure
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardApply(GSetArrIterForward* const that, 
+  void(*fun)(void* data, void* param), void* param) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Reset the iterator
+  GSetArrIterForwardReset(that);
+  // If the set is not empty
+  if (that->_curIndex >= 0)
+    // Loop on element
+    do {
+      // Apply the user function
+      fun(GSetArrIterForwardGet(that), param);
+    } while (GSetArrIterForwardStep(that));
+}
+
+// Apply a function to all elements of the GSetArr of the 
+// GSetArrIterBackward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardApply(GSetArrIterBackward* const that, 
+  void(*fun)(void* data, void* param), void* param) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Reset the iterator
+  GSetArrIterBackwardReset(that);
+  // If the set is not empty
+  if (that->_curIndex >= 0)
+    // Loop on element
+    do {
+      // Apply the user function
+      fun(GSetArrIterBackwardGet(that), param);
+    } while (GSetArrIterBackwardStep(that));
+}
+
+// Return true if the iterator is at the start of the elements (from
+// its point of view, not the order in the GSetArr)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardIsFirst(const GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return (that->_curIndex <= 0);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardIsFirst(const GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return (that->_curIndex == that->_set->_nbElem - 1);
+}
+
+// Return true if the iterator is at the end of the elements (from
+// its point of view, not the order in the GSetArr)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardIsLast(const GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return (that->_curIndex == that->_set->_nbElem - 1);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardIsLast(const GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return (that->_curIndex <= 0);
+}
+
+// Return the data currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetArrIterForwardGet(const GSetArrIterForward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex < 0)
+    return NULL;
+  return GSetArrSlot(that->_set, that->_curIndex)->_data;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetArrIterBackwardGet(const GSetArrIterBackward* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_curIndex < 0)
+    return NULL;
+  return GSetArrSlot(that->_set, that->_curIndex)->_data;
+}
+
+// Set the data of the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardSetData(const GSetArrIterForward* const that, 
+  void* data) {
+  _GSetArrElement(that->_set, that->_curIndex)->_data = data;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardSetData(const GSetArrIterBackward* const that, 
+  void* data) {
+  _GSetArrElement(that->_set, that->_curIndex)->_data = data;
+}
+
+// Return the sort value of the element currently pointed to by the 
+// iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetArrIterForwardGetSortVal(
+  const GSetArrIterForward* const that) {
+  return _GSetArrElement(that->_set, that->_curIndex)->_sortVal;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetArrIterBackwardGetSortVal(
+  const GSetArrIterBackward* const that) {
+  return _GSetArrElement(that->_set, that->_curIndex)->_sortVal;
+}
+
+// Set the sort value of the element currently pointed to by the 
+// iterator
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardSetSortVal(GSetArrIterForward* const that, 
+  float val) {
+  _GSetArrElement(that->_set, that->_curIndex)->_sortVal = val;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardSetSortVal(GSetArrIterBackward* const that, 
+  float val) {
+  _GSetArrElement(that->_set, that->_curIndex)->_sortVal = val;
+}
+
+// ================ GSetPool functions implementation ====================
+
+// Function to create a new GSetPool delivering blocks of 'blockSize' 
+// bytes
+// Return a pointer toward the new GSetPool
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetPool* GSetPoolCreate(const size_t blockSize) {
+  // Allocate memory for the GSetPool
+  GSetPool* that = PBErrMalloc(GSetErr, sizeof(GSetPool));
+  // Set the properties
+  *that = GSetPoolCreateStatic(blockSize);
+  // Return the new GSetPool
+  return that;
+}
+
+// Static constructor for GSetPool
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetPool GSetPoolCreateStatic(const size_t blockSize) {
+#if BUILDMODE == 0
+  if (blockSize == 0) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'blockSize' is invalid (0<%lu)", 
+      (unsigned long)blockSize);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetPool that = GSETPOOL_INIT(blockSize);
+  return that;
+}
+
+// Function to free the memory used by the GSetPool 'that'
+// All the blocks allocated from the pool are released
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolFree(GSetPool** that) {
+  if (that == NULL || *that == NULL) return;
+  GSetPoolFlush(*that);
+  free(*that);
+  *that = NULL;
+}
+
+// Function to release in one call all the blocks allocated from the 
+// GSetPool 'that'
+// The sets and trees using blocks of this pool must not be used 
+// anymore (or reset with their static constructor) after this call
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolFlush(GSetPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Free the slabs
+  while (that->_slabs != NULL) {
+    void* prev = *(void**)(that->_slabs);
+    free(that->_slabs);
+    that->_slabs = prev;
+  }
+  that->_freeBlocks = NULL;
+  that->_cursor = NULL;
+  that->_cursorEnd = NULL;
+  that->_nbUsed = 0;
+}
+
+// Function to get a block of memory from the GSetPool 'that'
+// The content of the block is undefined
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetPoolAlloc(GSetPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  void* block = NULL;
+  // If there are released blocks, reuse the last one
+  if (that->_freeBlocks != NULL) {
+    block = that->_freeBlocks;
+    that->_freeBlocks = *(void**)block;
+  // Else, carve the block from the current slab
+  } else {
+    // If the current slab is full, allocate a new one
+    // The first block of the slab is used to chain the slabs
+    if (that->_cursor == that->_cursorEnd) {
+      size_t size = that->_blockSize * (that->_nbBlockPerSlab + 1);
+      char* slab = PBErrMalloc(GSetErr, size);
+      *(void**)slab = that->_slabs;
+      that->_slabs = slab;
+      that->_cursor = slab + that->_blockSize;
+      that->_cursorEnd = slab + size;
+    }
+    block = that->_cursor;
+    that->_cursor += that->_blockSize;
+  }
+  ++(that->_nbUsed);
+  return block;
+}
+
+// Function to give back the block 'block' to the GSetPool 'that'
+// 'block' must have been allocated from 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolRelease(GSetPool* const that, void* const block) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (block == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'block' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  *(void**)block = that->_freeBlocks;
+  that->_freeBlocks = block;
+  --(that->_nbUsed);
+}
+
+// Return the number of blocks currently in use in the GSetPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetPoolGetNbUsed(const GSetPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_nbUsed;
+}
+
+// Return the size in bytes of the blocks of the GSetPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+size_t GSetPoolGetBlockSize(const GSetPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_blockSize;
+}
+
+// Get a new GSetElem pointing to 'data' from the GSetPool 'pool'
+static inline GSetElem* GSetPoolAllocElem(GSetPool* const pool, 
+  void* const data) {
+#if BUILDMODE == 0
+  if (pool == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'pool' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (pool->_blockSize < sizeof(GSetElem)) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'pool' blocks are too small (%lu<%lu)", 
+      (unsigned long)(pool->_blockSize), 
+      (unsigned long)sizeof(GSetElem));
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetElem* e = GSetPoolAlloc(pool);
+  e->_data = data;
+  e->_next = NULL;
+  e->_prev = NULL;
+  e->_sortVal = 0.0;
+  return e;
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetPushPool(GSet* const that, void* const data, 
+  GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetElem* e = GSetPoolAllocElem(pool, data);
+  e->_next = that->_head;
+  if (that->_head != NULL) 
+    that->_head->_prev = e;
+  that->_head = e;
+  if (that->_tail == NULL) 
+    that->_tail = e;
+  ++(that->_nbElem);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetAppendPool(GSet* const that, void* const data, 
+  GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetElem* e = GSetPoolAllocElem(pool, data);
+  e->_prev = that->_tail;
+  if (that->_tail != NULL) 
+    that->_tail->_next = e;
+  that->_tail = e;
+  if (that->_head == NULL) 
+    that->_head = e;
+  ++(that->_nbElem);
+}
+
+// Elements with the same sort value keep their order of insertion
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetAddSortPool(GSet* const that, void* const data, 
+  const double v, GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Search the first element with a sort value strictly greater 
+  // than 'v'
+  GSetElem* next = that->_head;
+  while (next != NULL && next->_sortVal <= (float)v)
+    next = next->_next;
+  // If there is none, append the element
+  if (next == NULL) {
+    _GSetAppendPool(that, data, pool);
+    that->_tail->_sortVal = v;
+  // Else, insert the element before it
+  } else {
+    GSetElem* e = GSetPoolAllocElem(pool, data);
+    e->_sortVal = v;
+    e->_next = next;
+    e->_prev = next->_prev;
+    if (next->_prev != NULL)
+      next->_prev->_next = e;
+    else
+      that->_head = e;
+    next->_prev = e;
+    ++(that->_nbElem);
+  }
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetPopPool(GSet* const that, GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_head == NULL)
+    return NULL;
+  GSetElem* e = that->_head;
+  return _GSetRemoveElemPool(that, &e, pool);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetDropPool(GSet* const that, GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_tail == NULL)
+    return NULL;
+  GSetElem* e = that->_tail;
+  return _GSetRemoveElemPool(that, &e, pool);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetRemoveElemPool(GSet* const that, GSetElem** elem, 
+  GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (elem == NULL || *elem == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'elem' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetElem* e = *elem;
+  void* ret = e->_data;
+  // Unlink the element
+  if (e->_next != NULL) 
+    e->_next->_prev = e->_prev;
+  else
+    that->_tail = e->_prev;
+  if (e->_prev != NULL) 
+    e->_prev->_next = e->_next;
+  else
+    that->_head = e->_next;
+  // The last got element may be the removed one
+  that->_lastGot = NULL;
+  that->_indexLastGot = 0;
+  // Give back the element to the pool
+  GSetPoolRelease(pool, e);
+  *elem = NULL;
+  --(that->_nbElem);
+  return ret;
+}
+
+// Empty the GSet 'that'
+// If all the blocks in use in 'pool' belong to 'that', the pool is 
+// flushed in one call, else the elements are given back one by one 
+// to the pool
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetFlushPool(GSet* const that, GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (pool == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'pool' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (GSetPoolGetNbUsed(pool) == that->_nbElem) {
+    GSetPoolFlush(pool);
+  } else {
+    GSetElem* e = that->_head;
+    while (e != NULL) {
+      GSetElem* next = e->_next;
+      GSetPoolRelease(pool, e);
+      e = next;
+    }
+  }
+  *that = GSetCreateStatic();
+}
+
+// ================ GSetHeap functions implementation ====================
+
+// Return true if the element 'a' must be above the element 'b' in the
+// GSetHeap 'that'
+static inline bool GSetHeapIsAbove(const GSetHeap* const that, 
+  const GSetHeapElem* const a, const GSetHeapElem* const b) {
+  if (that->_isMax)
+    return a->_sortVal > b->_sortVal;
+  else
+    return a->_sortVal < b->_sortVal;
+}
+
+// Set the element at position 'iElem' of the GSetHeap 'that' to 'elem'
+// and update the position of its handle
+static inline void GSetHeapPlace(GSetHeap* const that, const long iElem, 
+  const GSetHeapElem elem) {
+  that->_elems[iElem] = elem;
+  that->_pos[elem._handle] = iElem;
+}
+
+// Move up the element at position 'iElem' of the GSetHeap 'that'
+// until the heap order is restored
+static inline void GSetHeapSiftUp(GSetHeap* const that, long iElem) {
+  GSetHeapElem elem = that->_elems[iElem];
+  while (iElem > 0) {
+    long iParent = (iElem - 1) / 2;
+    if (!GSetHeapIsAbove(that, &elem, that->_elems + iParent))
+      break;
+    GSetHeapPlace(that, iElem, that->_elems[iParent]);
+    iElem = iParent;
+  }
+  GSetHeapPlace(that, iElem, elem);
+}
+
+// Move down the element at position 'iElem' of the GSetHeap 'that'
+// until the heap order is restored
+static inline void GSetHeapSiftDown(GSetHeap* const that, long iElem) {
+  GSetHeapElem elem = that->_elems[iElem];
+  while (true) {
+    long iChild = 2 * iElem + 1;
+    if (iChild >= that->_nbElem)
+      break;
+    if (iChild + 1 < that->_nbElem && GSetHeapIsAbove(that, 
+      that->_elems + iChild + 1, that->_elems + iChild))
+      ++iChild;
+    if (!GSetHeapIsAbove(that, that->_elems + iChild, &elem))
+      break;
+    GSetHeapPlace(that, iElem, that->_elems[iChild]);
+    iElem = iChild;
+  }
+  GSetHeapPlace(that, iElem, elem);
+}
+
+// Function to create a new GSetHeap
+// If 'isMax' is true the element with the highest sort value is at 
+// the top of the heap, else the one with the lowest sort value
+// Return a pointer toward the new GSetHeap
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetHeap* GSetHeapCreate(const bool isMax) {
+  GSetHeap* that = PBErrMalloc(GSetErr, sizeof(GSetHeap));
+  *that = GSetHeapCreateStatic(isMax);
+  return that;
+}
+
+// Static constructor for GSetHeap
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetHeap GSetHeapCreateStatic(const bool isMax) {
+  GSetHeap that = {._elems = NULL, ._nbElem = 0, ._capacity = 0, 
+    ._pos = NULL, ._freeHandle = -1, ._nbHandle = 0, ._isMax = isMax};
+  return that;
+}
+
+// Function to free the memory used by the GSetHeap 'that'
+// The data pointed to by the elements are not freed
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetHeapFree(GSetHeap** that) {
+  if (that == NULL || *that == NULL) return;
+  GSetHeapFlush(*that);
+  free(*that);
+  *that = NULL;
+}
+
+// Function to empty the GSetHeap 'that' and release its memory
+// The data pointed to by the elements are not freed
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetHeapFlush(GSetHeap* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  free(that->_elems);
+  free(that->_pos);
+  *that = GSetHeapCreateStatic(that->_isMax);
+}
+
+// Return the number of element in the GSetHeap 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetHeapNbElem(const GSetHeap* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_nbElem;
+}
+
+// Function to insert an element pointing toward 'data' with sort 
+// value 'v' in the GSetHeap 'that'
+// Return the handle of the element, which stays valid until the 
+// element is removed from the heap
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetHeapPush(GSetHeap* const that, void* const data, 
+  const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  // Get a handle, reusing a released one if possible
+  long handle = that->_freeHandle;
+  if (handle != -1) {
+    that->_freeHandle = that->_pos[handle];
+  } else {
+    // Make room for the new handle if necessary
+    // There are never more elements than handles
+    if (that->_nbHandle == that->_capacity) {
+      long capacity = (that->_capacity == 0 ? 
+        GSETHEAP_INITCAPACITY : 2 * that->_capacity);
+      GSetHeapElem* elems = 
+        PBErrMalloc(GSetErr, sizeof(GSetHeapElem) * capacity);
+      long* pos = PBErrMalloc(GSetErr, sizeof(long) * capacity);
+      if (that->_capacity > 0) {
+        memcpy(elems, that->_elems, sizeof(GSetHeapElem) * that->_nbElem);
+        memcpy(pos, that->_pos, sizeof(long) * that->_nbHandle);
+      }
+      free(that->_elems);
+      free(that->_pos);
+      that->_elems = elems;
+      that->_pos = pos;
+      that->_capacity = capacity;
+    }
+    handle = that->_nbHandle;
+    ++(that->_nbHandle);
+  }
+  // Add the element at the bottom of the heap and move it up
+  GSetHeapElem elem = {._data = data, ._sortVal = v, ._handle = handle};
+  GSetHeapPlace(that, that->_nbElem, elem);
+  ++(that->_nbElem);
+  GSetHeapSiftUp(that, that->_nbElem - 1);
+  return handle;
+}
+
+// Function to remove the element at the top of the GSetHeap 'that' 
+// (lowest sort value, or highest if the heap was created with 
+// isMax == true)
+// Return the data pointed to by the removed element, or null if the 
+// GSetHeap is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetHeapPop(GSetHeap* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  return GSetHeapRemove(that, that->_elems[0]._handle);
+}
+
+// Function to get the data of the element at the top of the GSetHeap 
+// 'that' without removing it
+// Return null if the GSetHeap is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetHeapTop(const GSetHeap* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem == 0)
+    return NULL;
+  return that->_elems[0]._data;
+}
+
+// Function to get the sort value of the element at the top of the 
+// GSetHeap 'that' 
+// The GSetHeap must not be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetHeapTopSortVal(const GSetHeap* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (that->_nbElem == 0) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'that' is empty");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_elems[0]._sortVal;
+}
+
+// Return the element with handle 'handle' in the GSetHeap 'that'
+static inline GSetHeapElem* GSetHeapElement(const GSetHeap* const that, 
+  const long handle) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (handle < 0 || handle >= that->_nbHandle) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'handle' is invalid (0<=%ld<%ld)", 
+      handle, that->_nbHandle);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_elems + that->_pos[handle];
+}
+
+// Function to get the data of the element with handle 'handle' in 
+// the GSetHeap 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetHeapGet(const GSetHeap* const that, const long handle) {
+  return GSetHeapElement(that, handle)->_data;
+}
+
+// Function to get the sort value of the element with handle 'handle' 
+// in the GSetHeap 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetHeapGetSortVal(const GSetHeap* const that, const long handle) {
+  return GSetHeapElement(that, handle)->_sortVal;
+}
+
+// Function to change the sort value of the element with handle 
+// 'handle' in the GSetHeap 'that' to 'v' (decrease-key, or 
+// increase-key)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetHeapSetSortVal(GSetHeap* const that, const long handle, 
+  const float v) {
+  GSetHeapElem* elem = GSetHeapElement(that, handle);
+  elem->_sortVal = v;
+  GSetHeapSiftUp(that, that->_pos[handle]);
+  GSetHeapSiftDown(that, that->_pos[handle]);
+}
+
+// Function to remove the element with handle 'handle' from the 
+// GSetHeap 'that'
+// Return the data pointed to by the removed element
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetHeapRemove(GSetHeap* const that, const long handle) {
+  GSetHeapElem* elem = GSetHeapElement(that, handle);
+  void* ret = elem->_data;
+  long iElem = that->_pos[handle];
+  // Move the last element in place of the removed one and restore 
+  // the heap order
+  --(that->_nbElem);
+  if (iElem != that->_nbElem) {
+    GSetHeapPlace(that, iElem, that->_elems[that->_nbElem]);
+    GSetHeapSiftUp(that, iElem);
+    GSetHeapSiftDown(that, that->_pos[that->_elems[iElem]._handle]);
+  }
+  // Release the handle
+  that->_pos[handle] = that->_freeHandle;
+  that->_freeHandle = handle;
+  return ret;
+}
+
+// Merge the sorted lists of elements 'left' and 'right' (linked by
+// their _next only) and return the head of the merged list
+// On ties the element of 'left' comes first to keep the sort stable
+static inline GSetElem* GSetMergeSortedElem(GSetElem* left, 
+  GSetElem* right) {
+  GSetElem head;
+  GSetElem* tail = &head;
+  while (left != NULL && right != NULL) {
+    if (left->_sortVal <= right->_sortVal) {
+      tail->_next = left;
+      tail = left;
+      left = left->_next;
+    } else {
+      tail->_next = right;
+      tail = right;
+      right = right->_next;
+    }
+  }
+  tail->_next = (left != NULL ? left : right);
+  return head._next;
+}
+
+// Function to sort the element of the GSet 'that' in increasing order 
+// of _sortVal
+// Stable merge sort of the linked elements, O(n.log(n)) and without 
+// allocation (the elements are relinked, not reallocated)
+// The elements are taken in one pass and merged into bins of 2^i 
+// elements, which keeps the merged lists hot in cache instead of 
+// walking the whole list at each width
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetSortMerge(GSet* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  if (that->_nbElem < 2)
+    return;
+  // bins[i] is NULL or a sorted list of 2^i elements, all of them 
+  // before the ones of bins[i - 1] in the set
+  GSetElem* bins[sizeof(long) * 8] = {NULL};
+  int nbBin = 0;
+  GSetElem* elem = that->_head;
+  while (elem != NULL) {
+    GSetElem* carry = elem;
+    elem = elem->_next;
+    carry->_next = NULL;
+    int iBin = 0;
+    for (; bins[iBin] != NULL; ++iBin) {
+      carry = GSetMergeSortedElem(bins[iBin], carry);
+      bins[iBin] = NULL;
+    }
+    bins[iBin] = carry;
+    if (iBin >= nbBin)
+      nbBin = iBin + 1;
+  }
+  GSetElem* list = NULL;
+  for (int iBin = 0; iBin < nbBin; ++iBin)
+    if (bins[iBin] != NULL)
+      list = GSetMergeSortedElem(bins[iBin], list);
+  // Rebuild the _prev links, the head and the tail
+  GSetElem* prev = NULL;
+  for (GSetElem* e = list; e != NULL; e = e->_next) {
+    e->_prev = prev;
+    prev = e;
+  }
+  that->_head = list;
+  that->_tail = prev;
+  that->_lastGot = NULL;
+  that->_indexLastGot = 0;
+}
+
+// ================ GSetIndex functions implementation ====================
+
+// Return a random number of levels for a new node of the GSetIndex 
+// 'that' (each level has a probability 1/4 to be promoted)
+static inline int GSetIndexRandomLevel(GSetIndex* const that) {
+  // xorshift64
+  that->_seed ^= that->_seed << 13;
+  that->_seed ^= that->_seed >> 7;
+  that->_seed ^= that->_seed << 17;
+  unsigned long r = that->_seed;
+  int level = 1;
+  while ((r & 3UL) == 0 && level < GSETINDEX_MAXLEVEL) {
+    ++level;
+    r >>= 2;
+  }
+  return level;
+}
+
+// Return a new node of the GSetIndex for the element 'elem' with 
+// 'nbLevel' levels
+static inline GSetIndexNode* GSetIndexNodeCreate(GSetElem* const elem, 
+  const int nbLevel) {
+  GSetIndexNode* node = PBErrMalloc(GSetErr, 
+    sizeof(GSetIndexNode) + sizeof(GSetIndexLink) * nbLevel);
+  node->_elem = elem;
+  node->_nbLevel = nbLevel;
+  for (int iLevel = nbLevel; iLevel--;) {
+    node->_links[iLevel]._next = NULL;
+    node->_links[iLevel]._width = 0;
+  }
+  return node;
+}
+
+// Free the nodes of the GSetIndex 'that' except its head
+static inline void GSetIndexFreeNodes(GSetIndex* const that) {
+  GSetIndexNode* node = that->_head->_links[0]._next;
+  while (node != NULL) {
+    GSetIndexNode* next = node->_links[0]._next;
+    free(node);
+    node = next;
+  }
+  for (int iLevel = GSETINDEX_MAXLEVEL; iLevel--;) {
+    that->_head->_links[iLevel]._next = NULL;
+    that->_head->_links[iLevel]._width = 0;
+  }
+  that->_level = 1;
+}
+
+// Build the nodes of the GSetIndex 'that' from its GSet, which must 
+// be sorted, O(n)
+static inline void GSetIndexBuild(GSetIndex* const that) {
+  // Last node and its rank at each level
+  GSetIndexNode* update[GSETINDEX_MAXLEVEL];
+  long rank[GSETINDEX_MAXLEVEL];
+  for (int iLevel = GSETINDEX_MAXLEVEL; iLevel--;) {
+    update[iLevel] = that->_head;
+    rank[iLevel] = 0;
+  }
+  long r = 0;
+  for (GSetElem* elem = that->_set->_head; elem != NULL; 
+    elem = elem->_next) {
+    ++r;
+    GSetIndexNode* node = 
+      GSetIndexNodeCreate(elem, GSetIndexRandomLevel(that));
+    if (node->_nbLevel > that->_level)
+      that->_level = node->_nbLevel;
+    for (int iLevel = node->_nbLevel; iLevel--;) {
+      update[iLevel]->_links[iLevel]._next = node;
+      update[iLevel]->_links[iLevel]._width = r - rank[iLevel];
+      update[iLevel] = node;
+      rank[iLevel] = r;
+    }
+  }
+  // The width of the last link at each level is the distance to the 
+  // end of the list
+  for (int iLevel = that->_level; iLevel--;)
+    update[iLevel]->_links[iLevel]._width = r - rank[iLevel];
+}
+
+// Search the node of the element 'elem' in the GSetIndex 'that'
+// Return the rank (starting at 1) of the node, or 0 if 'elem' is not 
+// in the GSetIndex
+static inline long GSetIndexSearchRank(const GSetIndex* const that, 
+  const GSetElem* const elem) {
+  // Search the last node with a sort value lower than the one of 'elem'
+  GSetIndexNode* node = that->_head;
+  long rank = 0;
+  for (int iLevel = that->_level; iLevel--;) {
+    while (node->_links[iLevel]._next != NULL && 
+      node->_links[iLevel]._next->_elem->_sortVal < elem->_sortVal) {
+      rank += node->_links[iLevel]._width;
+      node = node->_links[iLevel]._next;
+    }
+  }
+  // Walk through the nodes with the same sort value
+  for (node = node->_links[0]._next; node != NULL && 
+    node->_elem->_sortVal == elem->_sortVal; 
+    node = node->_links[0]._next) {
+    ++rank;
+    if (node->_elem == elem)
+      return rank;
+  }
+  return 0;
+}
+
+// Set 'update' to the last node at each level before the node of 
+// rank 'rank' (starting at 1) in the GSetIndex 'that'
+static inline void GSetIndexSearchUpdate(const GSetIndex* const that, 
+  const long rank, GSetIndexNode** const update) {
+  GSetIndexNode* node = that->_head;
+  long traversed = 0;
+  for (int iLevel = that->_level; iLevel--;) {
+    while (node->_links[iLevel]._next != NULL && 
+      traversed + node->_links[iLevel]._width < rank) {
+      traversed += node->_links[iLevel]._width;
+      node = node->_links[iLevel]._next;
+    }
+    update[iLevel] = node;
+  }
+}
+
+// Insert the node 'node' in the GSetIndex 'that' and its element in 
+// the indexed GSet, after the elements with a lower or equal sort value
+static inline void GSetIndexLinkNode(GSetIndex* const that, 
+  GSetIndexNode* const node) {
+  GSetIndexNode* update[GSETINDEX_MAXLEVEL];
+  long rank[GSETINDEX_MAXLEVEL];
+  float v = node->_elem->_sortVal;
+  // Search the position of the node at each level
+  GSetIndexNode* cur = that->_head;
+  for (int iLevel = that->_level; iLevel--;) {
+    rank[iLevel] = (iLevel == that->_level - 1 ? 0 : rank[iLevel + 1]);
+    while (cur->_links[iLevel]._next != NULL && 
+      cur->_links[iLevel]._next->_elem->_sortVal <= v) {
+      rank[iLevel] += cur->_links[iLevel]._width;
+      cur = cur->_links[iLevel]._next;
+    }
+    update[iLevel] = cur;
+  }
+  if (node->_nbLevel > that->_level) {
+    for (int iLevel = that->_level; iLevel < node->_nbLevel; ++iLevel) {
+      rank[iLevel] = 0;
+      update[iLevel] = that->_head;
+      update[iLevel]->_links[iLevel]._width = that->_set->_nbElem;
+    }
+    that->_level = node->_nbLevel;
+  }
+  // Insert the node in the skip list
+  for (int iLevel = 0; iLevel < node->_nbLevel; ++iLevel) {
+    GSetIndexLink* link = update[iLevel]->_links + iLevel;
+    node->_links[iLevel]._next = link->_next;
+    link->_next = node;
+    node->_links[iLevel]._width = 
+      link->_width - (rank[0] - rank[iLevel]);
+    link->_width = rank[0] - rank[iLevel] + 1;
+  }
+  for (int iLevel = node->_nbLevel; iLevel < that->_level; ++iLevel)
+    ++(update[iLevel]->_links[iLevel]._width);
+  // Insert the element in the GSet after the element of the previous 
+  // node
+  GSet* set = that->_set;
+  GSetElem* elem = node->_elem;
+  elem->_prev = (update[0] == that->_head ? NULL : update[0]->_elem);
+  elem->_next = (elem->_prev == NULL ? set->_head : elem->_prev->_next);
+  if (elem->_prev != NULL)
+    elem->_prev->_next = elem;
+  else
+    set->_head = elem;
+  if (elem->_next != NULL)
+    elem->_next->_prev = elem;
+  else
+    set->_tail = elem;
+  ++(set->_nbElem);
+  set->_lastGot = NULL;
+  set->_indexLastGot = 0;
+}
+
+// Remove the node of the element 'elem' from the GSetIndex 'that' and 
+// the element from the indexed GSet
+// Return the removed node
+static inline GSetIndexNode* GSetIndexUnlinkNode(GSetIndex* const that,
+  GSetElem* const elem) {
+  long rank = GSetIndexSearchRank(that, elem);
+#if BUILDMODE == 0
+  if (rank == 0) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'elem' is not in the GSetIndex");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexNode* update[GSETINDEX_MAXLEVEL] = {NULL};
+  GSetIndexSearchUpdate(that, rank, update);
+  GSetIndexNode* node = update[0]->_links[0]._next;
+  // Remove the node from the skip list
+  for (int iLevel = 0; iLevel < that->_level; ++iLevel) {
+    GSetIndexLink* link = update[iLevel]->_links + iLevel;
+    if (link->_next == node) {
+      link->_width += node->_links[iLevel]._width - 1;
+      link->_next = node->_links[iLevel]._next;
+    } else {
+      --(link->_width);
+    }
+  }
+  while (that->_level > 1 && 
+    that->_head->_links[that->_level - 1]._next == NULL)
+    --(that->_level);
+  // Remove the element from the GSet
+  GSet* set = that->_set;
+  if (elem->_next != NULL) 
+    elem->_next->_prev = elem->_prev;
+  else
+    set->_tail = elem->_prev;
+  if (elem->_prev != NULL) 
+    elem->_prev->_next = elem->_next;
+  else
+    set->_head = elem->_next;
+  elem->_next = NULL;
+  elem->_prev = NULL;
+  --(set->_nbElem);
+  set->_lastGot = NULL;
+  set->_indexLastGot = 0;
+  return node;
+}
+
+// Function to create a new GSetIndex over the GSet 'set'
+// The GSet is sorted (stable) by increasing _sortVal 
+// Return a pointer toward the new GSetIndex
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetIndex* GSetIndexCreate(GSet* const set) {
+  GSetIndex* that = PBErrMalloc(GSetErr, sizeof(GSetIndex));
+  *that = GSetIndexCreateStatic(set);
+  return that;
+}
+
+// Static constructor for GSetIndex
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetIndex GSetIndexCreateStatic(GSet* const set) {
+#if BUILDMODE == 0
+  if (set == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'set' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndex that = {._set = set, ._head = NULL, ._level = 1, 
+    ._seed = 0x9E3779B97F4A7C15UL};
+  that._head = GSetIndexNodeCreate(NULL, GSETINDEX_MAXLEVEL);
+  _GSetSortMerge(set);
+  GSetIndexBuild(&that);
+  return that;
+}
+
+// Function to free the memory used by the GSetIndex 'that'
+// The indexed GSet is not freed
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIndexFree(GSetIndex** that) {
+  if (that == NULL || *that == NULL) return;
+  GSetIndexFreeStatic(*that);
+  free(*that);
+  *that = NULL;
+}
+
+// Function to free the memory used by the static GSetIndex 'that'
+// The indexed GSet is not freed
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIndexFreeStatic(GSetIndex* const that) {
+  if (that == NULL || that->_head == NULL) return;
+  GSetIndexFreeNodes(that);
+  free(that->_head);
+  that->_head = NULL;
+}
+
+// Function to rebuild the GSetIndex 'that' after its GSet has been 
+// modified without using the GSetIndex, O(n.log(n))
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIndexRebuild(GSetIndex* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexFreeNodes(that);
+  _GSetSortMerge(that->_set);
+  GSetIndexBuild(that);
+}
+
+// Return the GSet indexed by the GSetIndex 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+GSet* GSetIndexSet(const GSetIndex* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_set;
+}
+
+// Return the number of element in the GSetIndex 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetIndexNbElem(const GSetIndex* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_set->_nbElem;
+}
+
+// Function to insert an element pointing toward 'data' with sort 
+// value 'v' in the GSet indexed by 'that', after the elements with 
+// a lower or equal sort value, O(log(n))
+// Return the new element
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetElem* GSetIndexAddSort(GSetIndex* const that, void* const data, 
+  const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetElem* elem = PBErrMalloc(GSetErr, sizeof(GSetElem));
+  elem->_data = data;
+  elem->_sortVal = v;
+  GSetIndexLinkNode(that, 
+    GSetIndexNodeCreate(elem, GSetIndexRandomLevel(that)));
+  return elem;
+}
+
+// Function to remove the element 'elem' from the GSet indexed by 
+// 'that', O(log(n) + number of elements with the same sort value)
+// 'elem' is freed and set to null
+// Return the data pointed to by the removed element
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetIndexRemoveElem(GSetIndex* const that, GSetElem** elem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (elem == NULL || *elem == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'elem' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexNode* node = GSetIndexUnlinkNode(that, *elem);
+  void* ret = (*elem)->_data;
+  free(node);
+  free(*elem);
+  *elem = NULL;
+  return ret;
+}
+
+// Function to change the sort value of the element 'elem' of the 
+// GSet indexed by 'that' to 'v' and move it accordingly, 
+// O(log(n) + number of elements with the same sort value)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIndexSetSortVal(GSetIndex* const that, GSetElem* const elem, 
+  const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (elem == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'elem' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexNode* node = GSetIndexUnlinkNode(that, elem);
+  elem->_sortVal = v;
+  GSetIndexLinkNode(that, node);
+}
+
+// Return the index of the element 'elem' in the GSet indexed by 'that'
+// O(log(n) + number of elements with the same sort value)
+// Return -1 if 'elem' is not in the GSet
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetIndexGetRank(const GSetIndex* const that, 
+  const GSetElem* const elem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (elem == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'elem' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return GSetIndexSearchRank(that, elem) - 1;
+}
+
+// Return the element at index 'iElem' in the GSet indexed by 'that', 
+// O(log(n))
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetElem* GSetIndexElement(const GSetIndex* const that, 
+  const long iElem) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (iElem < 0 || iElem >= that->_set->_nbElem) {
+    GSetErr->_type = PBErrTypeInvalidArg;
+    sprintf(GSetErr->_msg, "'iElem' is invalid (0<=%ld<%ld)", 
+      iElem, that->_set->_nbElem);
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexNode* update[GSETINDEX_MAXLEVEL] = {NULL};
+  GSetIndexSearchUpdate(that, iElem + 1, update);
+  return update[0]->_links[0]._next->_elem;
+}
+
+// Return the data of the element at index 'iElem' in the GSet 
+// indexed by 'that', O(log(n))
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetIndexGet(const GSetIndex* const that, const long iElem) {
+  return GSetIndexElement(that, iElem)->_data;
+}
+
+// Return the index of the first element with a sort value greater 
+// or equal to 'v' in the GSet indexed by 'that', O(log(n))
+// Return the number of elements if there is no such element
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetIndexLowerBound(const GSetIndex* const that, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetIndexNode* node = that->_head;
+  long rank = 0;
+  for (int iLevel = that->_level; iLevel--;) {
+    while (node->_links[iLevel]._next != NULL && 
+      node->_links[iLevel]._next->_elem->_sortVal < v) {
+      rank += node->_links[iLevel]._width;
+      node = node->_links[iLevel]._next;
+    }
+  }
+  return rank;
+}
+
+// ================ GSet parallel functions implementation ==============
+
+// Process the ranges of the GSetParallelJob 'job' until they have all 
+// been processed
+static inline void* GSetParallelWorker(void* job) {
+  GSetParallelJob* that = (GSetParallelJob*)job;
+  while (true) {
+    // Get the next range to process
+    pthread_mutex_lock(&(that->_mutex));
+    long iRange = that->_nextRange;
+    ++(that->_nextRange);
+    pthread_mutex_unlock(&(that->_mutex));
+    if (iRange >= that->_nbRange)
+      break;
+    // Process the elements of the range
+    GSetElem* elem = that->_ranges[iRange];
+    long nb = that->_nbElem - iRange * that->_rangeSize;
+    if (nb > that->_rangeSize)
+      nb = that->_rangeSize;
+    if (that->_apply != NULL) {
+      for (long iElem = nb; iElem--; elem = elem->_next)
+        that->_apply(elem->_data, that->_param);
+    } else {
+      void* acc = that->_accs + iRange * that->_accSize;
+      for (long iElem = nb; iElem--; elem = elem->_next)
+        that->_reduce(elem->_data, acc, that->_param);
+    }
+  }
+  return NULL;
+}
+
+// Split the GSet 'that' in ranges for 'nbThread' threads and set up 
+// the GSetParallelJob 'job' accordingly
+// Return the number of threads to use
+static inline int GSetParallelSplit(const GSet* const that, 
+  int nbThread, GSetParallelJob* const job) {
+  if (nbThread <= 0) {
+    nbThread = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThread <= 0)
+      nbThread = 1;
+  }
+  long nbRange = (long)nbThread * GSETPARALLEL_NBCHUNKPERTHREAD;
+  if (nbRange > that->_nbElem)
+    nbRange = that->_nbElem;
+  job->_nbElem = that->_nbElem;
+  job->_rangeSize = (that->_nbElem + nbRange - 1) / nbRange;
+  job->_nbRange = (that->_nbElem + job->_rangeSize - 1) / job->_rangeSize;
+  job->_nextRange = 0;
+  job->_ranges = PBErrMalloc(GSetErr, sizeof(GSetElem*) * job->_nbRange);
+  GSetElem* elem = that->_head;
+  for (long iRange = 0; iRange < job->_nbRange; ++iRange) {
+    job->_ranges[iRange] = elem;
+    for (long iElem = job->_rangeSize; iElem-- && elem != NULL;)
+      elem = elem->_next;
+  }
+  if (nbThread > job->_nbRange)
+    nbThread = (int)(job->_nbRange);
+  return nbThread;
+}
+
+// Run the GSetParallelJob 'job' on 'nbThread' new threads (the calling 
+// thread included)
+static inline void GSetParallelRunForkJoin(GSetParallelJob* const job, 
+  const int nbThread) {
+  pthread_t* threads = NULL;
+  int nbStarted = 0;
+  if (nbThread > 1) {
+    threads = PBErrMalloc(GSetErr, sizeof(pthread_t) * (nbThread - 1));
+    // If a thread can't be created the remaining ranges are simply 
+    // processed by the other ones
+    while (nbStarted < nbThread - 1 && pthread_create(threads + 
+      nbStarted, NULL, GSetParallelWorker, job) == 0)
+      ++nbStarted;
+  }
+  GSetParallelWorker(job);
+  for (int iThread = 0; iThread < nbStarted; ++iThread)
+    pthread_join(threads[iThread], NULL);
+  free(threads);
+}
+
+// Loop of the worker threads of a GSetThreadPool: wait for a job, 
+// process its ranges, signal the end of its part, until the pool stops
+static inline void* GSetThreadPoolWorker(void* pool) {
+  GSetThreadPool* that = (GSetThreadPool*)pool;
+  unsigned long nbJobDone = 0;
+  pthread_mutex_lock(&(that->_mutex));
+  while (true) {
+    while (!(that->_isStopping) && that->_nbJob == nbJobDone)
+      pthread_cond_wait(&(that->_condStart), &(that->_mutex));
+    if (that->_isStopping)
+      break;
+    nbJobDone = that->_nbJob;
+    GSetParallelJob* job = that->_job;
+    pthread_mutex_unlock(&(that->_mutex));
+    GSetParallelWorker(job);
+    pthread_mutex_lock(&(that->_mutex));
+    --(that->_nbBusy);
+    if (that->_nbBusy == 0)
+      pthread_cond_signal(&(that->_condDone));
+  }
+  pthread_mutex_unlock(&(that->_mutex));
+  return NULL;
+}
+
+// Run the GSetParallelJob 'job' on the threads of the GSetThreadPool 
+// 'that' (the calling thread included) and wait for its end
+static inline void GSetThreadPoolRun(GSetThreadPool* const that, 
+  GSetParallelJob* const job) {
+  pthread_mutex_lock(&(that->_mutex));
+  that->_job = job;
+  that->_nbBusy = that->_nbThread - 1;
+  ++(that->_nbJob);
+  pthread_cond_broadcast(&(that->_condStart));
+  pthread_mutex_unlock(&(that->_mutex));
+  GSetParallelWorker(job);
+  pthread_mutex_lock(&(that->_mutex));
+  while (that->_nbBusy > 0)
+    pthread_cond_wait(&(that->_condDone), &(that->_mutex));
+  that->_job = NULL;
+  pthread_mutex_unlock(&(that->_mutex));
+}
+
+// Run the GSetParallelJob 'job' on the GSetThreadPool 'pool' if it's 
+// not null, else on 'nbThread' new threads
+static inline void GSetParallelRun(GSetParallelJob* const job, 
+  const int nbThread, GSetThreadPool* const pool) {
+  pthread_mutex_init(&(job->_mutex), NULL);
+  if (pool != NULL)
+    GSetThreadPoolRun(pool, job);
+  else
+    GSetParallelRunForkJoin(job, nbThread);
+  pthread_mutex_destroy(&(job->_mutex));
+}
+
+// Apply the function 'fun' to all elements of the GSet 'that' on the 
+// GSetThreadPool 'pool' if it's not null, else on 'nbThread' new 
+// threads
+static inline void GSetParallelApply(const GSet* const that, 
+  void(*fun)(void* data, void* param), void* param, int nbThread, 
+  GSetThreadPool* const pool) {
+  if (that->_nbElem == 0)
+    return;
+  GSetParallelJob job = {._apply = fun, ._reduce = NULL, ._accs = NULL, 
+    ._accSize = 0, ._param = param};
+  if (pool != NULL)
+    nbThread = pool->_nbThread;
+  nbThread = GSetParallelSplit(that, nbThread, &job);
+  GSetParallelRun(&job, nbThread, pool);
+  free(job._ranges);
+}
+
+// Reduce the GSet 'that' on the GSetThreadPool 'pool' if it's not 
+// null, else on 'nbThread' new threads
+static inline void GSetParallelReduce(const GSet* const that, 
+  void(*fun)(void* data, void* acc, void* param), 
+  void(*merge)(void* acc, const void* accRange, void* param), 
+  void* const acc, const size_t accSize, void* param, int nbThread, 
+  GSetThreadPool* const pool) {
+  if (that->_nbElem == 0)
+    return;
+  GSetParallelJob job = {._apply = NULL, ._reduce = fun, 
+    ._accSize = accSize, ._param = param};
+  if (pool != NULL)
+    nbThread = pool->_nbThread;
+  nbThread = GSetParallelSplit(that, nbThread, &job);
+  // Initialise the accumulator of each range with the identity value
+  job._accs = PBErrMalloc(GSetErr, accSize * job._nbRange);
+  for (long iRange = 0; iRange < job._nbRange; ++iRange)
+    memcpy(job._accs + iRange * accSize, acc, accSize);
+  GSetParallelRun(&job, nbThread, pool);
+  // Merge the partial results in order
+  for (long iRange = 0; iRange < job._nbRange; ++iRange)
+    merge(acc, job._accs + iRange * accSize, param);
+  free(job._accs);
+  free(job._ranges);
+}
+
+// Function to create a new GSetThreadPool of 'nbThread' threads, the 
+// calling thread included (if 'nbThread' <= 0, one per online core)
+// The 'nbThread' - 1 worker threads are created here and wait for the 
+// jobs of _GSetApplyThreadPool and _GSetReduceThreadPool
+// Return a pointer toward the new GSetThreadPool
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetThreadPool* GSetThreadPoolCreate(int nbThread) {
+  if (nbThread <= 0) {
+    nbThread = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThread <= 0)
+      nbThread = 1;
+  }
+  // Allocate memory for the GSetThreadPool
+  GSetThreadPool* that = PBErrMalloc(GSetErr, sizeof(GSetThreadPool));
+  // Set the properties
+  that->_threads = NULL;
+  that->_nbThread = 1;
+  that->_job = NULL;
+  that->_nbJob = 0;
+  that->_nbBusy = 0;
+  that->_isStopping = false;
+  pthread_mutex_init(&(that->_mutex), NULL);
+  pthread_cond_init(&(that->_condStart), NULL);
+  pthread_cond_init(&(that->_condDone), NULL);
+  // Create the worker threads
+  // If a thread can't be created the pool simply has less threads
+  if (nbThread > 1) {
+    that->_threads = 
+      PBErrMalloc(GSetErr, sizeof(pthread_t) * (nbThread - 1));
+    while (that->_nbThread < nbThread && pthread_create(that->_threads + 
+      that->_nbThread - 1, NULL, GSetThreadPoolWorker, that) == 0)
+      ++(that->_nbThread);
+  }
+  // Return the new GSetThreadPool
+  return that;
+}
+
+// Function to stop and join the threads of the GSetThreadPool 'that' 
+// and free its memory
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetThreadPoolFree(GSetThreadPool** that) {
+  if (that == NULL || *that == NULL) return;
+  pthread_mutex_lock(&((*that)->_mutex));
+  (*that)->_isStopping = true;
+  pthread_cond_broadcast(&((*that)->_condStart));
+  pthread_mutex_unlock(&((*that)->_mutex));
+  for (int iThread = 0; iThread < (*that)->_nbThread - 1; ++iThread)
+    pthread_join((*that)->_threads[iThread], NULL);
+  free((*that)->_threads);
+  pthread_cond_destroy(&((*that)->_condDone));
+  pthread_cond_destroy(&((*that)->_condStart));
+  pthread_mutex_destroy(&((*that)->_mutex));
+  free(*that);
+  *that = NULL;
+}
+
+// Return the number of threads of the GSetThreadPool 'that', the 
+// calling thread included
+#if BUILDMODE != 0
+static inline
+#endif 
+int GSetThreadPoolGetNbThread(const GSetThreadPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  return that->_nbThread;
+}
+
+// Apply the function 'fun' to all elements of the GSet 'that' using 
+// 'nbThread' threads (if 'nbThread' <= 0, one per online core)
+// The threads are created and joined at each call (fork/join), use 
+// _GSetApplyThreadPool to reuse them across calls
+// The GSet is split into ranges of consecutive elements before 
+// processing, the threads (the calling one included) pick the ranges 
+// one after the other until all have been processed
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the elements, 'param' is a hook to allow the user to 
+// pass parameters to the function through a user-defined structure
+// 'fun' is called concurrently and must be thread safe
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetApplyParallel(const GSet* const that, 
+  void(*fun)(void* data, void* param), void* param, int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetParallelApply(that, fun, param, nbThread, NULL);
+}
+
+// Reduce the GSet 'that' using 'nbThread' threads (if 'nbThread' <= 0, 
+// one per online core)
+// The threads are created and joined at each call (fork/join), use 
+// _GSetReduceThreadPool to reuse them across calls
+// 'acc' points to the accumulator of 'accSize' bytes, which must be 
+// initialised with the identity value of the reduction. Each range of 
+// elements is accumulated in a copy of this initial value with 
+// 'fun', then the partial results are merged into 'acc' with 'merge', 
+// in the order of the ranges (then the result doesn't depend on the 
+// scheduling of the threads)
+// 'fun' is called concurrently and must be thread safe
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetReduceParallel(const GSet* const that, 
+  void(*fun)(void* data, void* acc, void* param), 
+  void(*merge)(void* acc, const void* accRange, void* param), 
+  void* const acc, const size_t accSize, void* param, int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (merge == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'merge' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (acc == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'acc' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetParallelReduce(that, fun, merge, acc, accSize, param, nbThread, 
+    NULL);
+}
+
+// Apply the function 'fun' to all elements of the GSet 'that' with the
+// threads of the GSetThreadPool 'pool', see _GSetApplyParallel
+// The calling thread waits until all elements have been processed
+// 'pool' must not be used by several threads at the same time
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetApplyThreadPool(const GSet* const that, 
+  void(*fun)(void* data, void* param), void* param, 
+  GSetThreadPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (pool == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'pool' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetParallelApply(that, fun, param, 0, pool);
+}
+
+// Reduce the GSet 'that' with the threads of the GSetThreadPool 'pool',
+// see _GSetReduceParallel
+// 'pool' must not be used by several threads at the same time
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetReduceThreadPool(const GSet* const that, 
+  void(*fun)(void* data, void* acc, void* param), 
+  void(*merge)(void* acc, const void* accRange, void* param), 
+  void* const acc, const size_t accSize, void* param, 
+  GSetThreadPool* const pool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (fun == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'fun' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (merge == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'merge' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (acc == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'acc' is null");
+    PBErrCatch(GSetErr);
+  }
+  if (pool == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'pool' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  GSetParallelReduce(that, fun, merge, acc, accSize, param, 0, pool);
+}
+
+// Apply a function to all elements of the GSet of the GSetIterForward
+// using 'nbThread' threads, see _GSetApplyParallel
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardApplyParallel(GSetIterForward* const that, 
+  void(*fun)(void* data, void* param), void* param, int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GSetErr->_type = PBErrTypeNullPointer;
+    sprintf(GSetErr->_msg, "'that' is null");
+    PBErrCatch(GSetErr);
+  }
+#endif
+  _GSetApplyParallel(that->_set, fun, param, nbThread);
+}
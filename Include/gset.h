@@ -8,6 +8,8 @@
 #include <stdbool.h>
 #include <string.h>
 #include <math.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "pberr.h"
 #include "pbcextension.h"
 
@@ -16,6 +18,34 @@
 // Precision used when sorting a GSet
 #define GSET_EPSILON 0.00001
 
+// Default number of elements allocated by a GSetArr at its first 
+// insertion
+#define GSETARR_INITCAPACITY 16
+
+// Default number of blocks per slab in a GSetPool
+#define GSETPOOL_NBBLOCKPERSLAB 1024
+
+// Default number of elements allocated by a GSetHeap at its first 
+// insertion
+#define GSETHEAP_INITCAPACITY 16
+
+// Maximum number of levels in a GSetIndex
+#define GSETINDEX_MAXLEVEL 32
+
+// Number of chunks per thread in the parallel functions over GSet
+// (several chunks per thread to balance the load when the processing 
+// time varies between elements)
+#define GSETPARALLEL_NBCHUNKPERTHREAD 4
+
+// Constant initializer of a GSetPool delivering blocks of 'BlockSize' 
+// bytes. Can be used to declare a thread-local pool, e.g.:
+// static _Thread_local GSetPool pool = GSETPOOL_INIT(sizeof(GSetElem));
+#define GSETPOOL_INIT(BlockSize) {._blockSize = \
+  (((BlockSize) + sizeof(void*) - 1) / sizeof(void*)) * sizeof(void*), \
+  ._nbBlockPerSlab = GSETPOOL_NBBLOCKPERSLAB, ._slabs = NULL, \
+  ._freeBlocks = NULL, ._cursor = NULL, ._cursorEnd = NULL, \
+  ._nbUsed = 0}
+
 // ================= Data structures ===================
 
 // Structure of one element of the GSet
@@ -61,6 +91,193 @@ typedef struct GSetIterBackward {
   GSetElem* _curElem;
 } GSetIterBackward;
 
+// Structure of one element of the GSetArr
+typedef struct GSetArrElem {
+  // Pointer toward the data
+  void* _data;
+  // Value to sort element in the GSetArr, 0.0 by default
+  // Sorting in increasing value of _sortVal
+  float _sortVal;
+} GSetArrElem;
+
+// Structure of the GSetArr
+// Array-backed variant of the GSet: elements are stored by value in a 
+// contiguous circular buffer, giving O(1) access by index and 
+// amortized O(1) insertion/removal at the head and tail
+// The generic GSet macros (GSetPush, GSetSort, GSetIterStep, ...) 
+// accept the GSetArr types too, the iterators being GSetArrIterForward
+// and GSetArrIterBackward
+typedef struct GSetArr {
+  // Circular buffer of elements
+  GSetArrElem* _elems;
+  // Number of allocated elements in _elems (0 or a power of 2)
+  long _capacity;
+  // Index in _elems of the element at the head of the GSetArr
+  long _first;
+  // Number of element in the GSetArr
+  long _nbElem;
+} GSetArr;
+
+// Structures of the GSetArr iterators
+typedef struct GSetArrIterForward {
+  // GSetArr attached to the iterator
+  GSetArr* _set;
+  // Index of the current element, -1 if the set is empty
+  long _curIndex;
+} GSetArrIterForward;
+
+typedef struct GSetArrIterBackward {
+  // GSetArr attached to the iterator
+  GSetArr* _set;
+  // Index of the current element, -1 if the set is empty
+  long _curIndex;
+} GSetArrIterBackward;
+
+// Structure of the GSetPool
+// Slab allocator of fixed size blocks, used to allocate the GSetElem 
+// (or any other fixed size nodes, e.g. GenTree) of one or several sets
+// without calling malloc/free per element
+// A GSetPool is not thread safe, use one pool per thread (see 
+// GSETPOOL_INIT) if several threads allocate elements
+typedef struct GSetPool {
+  // Size in bytes of one block
+  size_t _blockSize;
+  // Number of blocks per slab
+  long _nbBlockPerSlab;
+  // Linked list of the allocated slabs (the first bytes of a slab 
+  // point to the previous slab)
+  void* _slabs;
+  // Linked list of the released blocks (the first bytes of a released 
+  // block point to the next released block)
+  void* _freeBlocks;
+  // Next never used block in the current slab
+  char* _cursor;
+  // End of the current slab
+  char* _cursorEnd;
+  // Number of blocks currently in use
+  long _nbUsed;
+} GSetPool;
+
+// Structure of one element of the GSetHeap
+typedef struct GSetHeapElem {
+  // Pointer toward the data
+  void* _data;
+  // Priority of the element
+  float _sortVal;
+  // Handle of the element, as returned by GSetHeapPush
+  long _handle;
+} GSetHeapElem;
+
+// Structure of the GSetHeap
+// Binary heap based priority queue keyed on a float sort value, with 
+// O(log(n)) push, pop and update of the sort value of an element
+typedef struct GSetHeap {
+  // Elements of the heap, in heap order
+  GSetHeapElem* _elems;
+  // Number of elements in the heap
+  long _nbElem;
+  // Number of allocated elements in _elems and _pos
+  long _capacity;
+  // Position in _elems of the element of each handle, or index of the 
+  // next free handle for the released handles
+  long* _pos;
+  // Head of the list of released handles (-1 if none)
+  long _freeHandle;
+  // Number of handles given so far
+  long _nbHandle;
+  // If true the element with the highest sort value is at the top of 
+  // the heap, else the one with the lowest sort value
+  bool _isMax;
+} GSetHeap;
+
+// Structure of one link of a node of a GSetIndex
+typedef struct GSetIndexLink {
+  // Next node at this level
+  struct GSetIndexNode* _next;
+  // Number of elements of the GSet skipped by following _next
+  long _width;
+} GSetIndexLink;
+
+// Structure of one node of a GSetIndex
+typedef struct GSetIndexNode {
+  // Indexed element of the GSet
+  GSetElem* _elem;
+  // Number of levels of the node
+  int _nbLevel;
+  // Links of the node, one per level
+  GSetIndexLink _links[];
+} GSetIndexNode;
+
+// Structure of the GSetIndex
+// Indexable skip list over the elements of a GSet sorted in increasing 
+// order of _sortVal (elements with equal _sortVal stay in their order 
+// of insertion). Sorted insertion, rank of an element and access to 
+// the k-th element are O(log(n)). The GSet keeps its elements and can 
+// still be iterated with GSetIterForward, but must be modified only 
+// through the GSetIndex (or GSetIndexRebuild must be called after)
+typedef struct GSetIndex {
+  // Indexed GSet
+  GSet* _set;
+  // Head of the skip list (sentinel node with GSETINDEX_MAXLEVEL 
+  // levels)
+  GSetIndexNode* _head;
+  // Current number of levels in use
+  int _level;
+  // State of the generator of random levels
+  unsigned long _seed;
+} GSetIndex;
+
+// Structure of the job shared by the threads of the parallel functions 
+// over GSet
+typedef struct GSetParallelJob {
+  // First element of each range
+  GSetElem** _ranges;
+  // Number of ranges
+  long _nbRange;
+  // Number of elements per range (except the last one)
+  long _rangeSize;
+  // Number of elements in the GSet
+  long _nbElem;
+  // Index of the next range to be processed
+  long _nextRange;
+  // Mutex protecting _nextRange
+  pthread_mutex_t _mutex;
+  // Function applied to the elements (apply)
+  void(*_apply)(void* data, void* param);
+  // Function accumulating the elements (reduce)
+  void(*_reduce)(void* data, void* acc, void* param);
+  // Accumulators of each range (reduce)
+  char* _accs;
+  // Size in bytes of one accumulator (reduce)
+  size_t _accSize;
+  // Parameters of the applied function
+  void* _param;
+} GSetParallelJob;
+
+// Structure of a pool of threads reused by the parallel functions over 
+// GSet, to avoid creating and joining threads at each call
+// The calling thread is one of the workers of each job
+typedef struct GSetThreadPool {
+  // Worker threads (_nbThread - 1 of them)
+  pthread_t* _threads;
+  // Number of threads processing a job, the calling one included
+  int _nbThread;
+  // Mutex protecting the properties below
+  pthread_mutex_t _mutex;
+  // Signaled when a job is submitted or the pool is stopping
+  pthread_cond_t _condStart;
+  // Signaled when the last worker has finished its part of the job
+  pthread_cond_t _condDone;
+  // Current job
+  GSetParallelJob* _job;
+  // Incremented at each submitted job
+  unsigned long _nbJob;
+  // Number of worker threads still processing the current job
+  int _nbBusy;
+  // Flag to stop the worker threads
+  bool _isStopping;
+} GSetThreadPool;
+
 // ================ Functions declaration ====================
 
 // Function to create a new GSet,
@@ -323,306 +540,1180 @@ void _GSetAppendSortedSet(GSet* const that, const GSet* const set);
 #if BUILDMODE != 0
 static inline
 #endif 
-void _GSetSwitch(GSet* const that, const long iElem, const long jElem);
+void _GSetSwitch(GSet* const that, const long iElem, const long jElem);
+
+// Return the number of (GSetElem._data=='data') in the GSet 'that'
+long _GSetCount(const GSet* const that, const void* const data);
+
+// Set the sort value of the GSetElem 'that' to 'v'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetElemSetSortVal(GSetElem* const that, const float v);
+
+// Set the data of the GSetElem 'that' to 'd'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetElemSetData(GSetElem* const that, void* const d);
+
+// Set the previous element of the GSetElem 'that' to 'e'
+// Do not set the link back in 'e'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetElemSetPrev(GSetElem* const that, GSetElem* const e);
+
+// Set the next element of the GSetElem 'that' to 'e'
+// Do not set the link back in 'e'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetElemSetNext(GSetElem* const that, GSetElem* const e);
+
+// Move the 'iElem'-th element to the 'pos' index in the GSet
+void _GSetMoveElem(GSet* const that, const long iElem, const long pos);
+
+// Create a new GSetIterForward for the GSet 'set'
+// The iterator is reset upon creation
+GSetIterForward* _GSetIterForwardCreate(GSet* const set);
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetIterForward _GSetIterForwardCreateStatic(GSet* const set);
+
+// Create a new GSetIterBackward for the GSet 'set'
+// The iterator is reset upon creation
+GSetIterBackward* _GSetIterBackwardCreate(GSet* const set);
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetIterBackward _GSetIterBackwardCreateStatic(GSet* const set);
+
+// Free the memory used by a GSetIterForward (not by its attached GSet)
+// Do nothing if arguments are invalid
+void GSetIterForwardFree(GSetIterForward** that);
+
+// Free the memory used by a GSetIterBackward (not by its attached GSet)
+// Do nothing if arguments are invalid
+void GSetIterBackwardFree(GSetIterBackward** that);
+
+// Clone a GSetIterForward
+GSetIterForward* GSetIterForwardClone(
+  const GSetIterForward* const that);
+
+// Clone a GSetIterBackward
+GSetIterBackward* GSetIterBackwardClone(
+  const GSetIterBackward* const that);
+
+// Reset the GSetIterForward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardReset(GSetIterForward* const that);
+
+// Reset the GSetIterBackward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterBackwardReset(GSetIterBackward* const that);
+
+// Step the GSetIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterForwardStep(GSetIterForward* const that);
+
+// Step the GSetIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterBackwardStep(GSetIterBackward* const that);
+
+// Step back the GSetIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterForwardStepBack(GSetIterForward* const that);
+
+// Step back the GSetIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterBackwardStepBack(GSetIterBackward* const that);
+
+// Apply a function to all elements of the GSet of the GSetIterForward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the nodes, 'param' is a hook to allow the user to pass
+// parameters to the function through a user-defined structure
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardApply(GSetIterForward* const that, 
+  void(*fun)(void* data, void* param), void* param);
+
+// Apply a function to all elements of the GSet of the GSetIterBackward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the nodes, 'param' is a hook to allow the user to pass
+// parameters to the function through a user-defined structure
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterBackwardApply(GSetIterBackward* const that, 
+  void(*fun)(void* data, void* param), void* param);
+
+// Return true if the iterator is at the start of the elements (from
+// its point of view, not the order in the GSet)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterForwardIsFirst(const GSetIterForward* const that);
+
+// Return true if the iterator is at the start of the elements (from
+// its point of view, not the order in the GSet)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterBackwardIsFirst(const GSetIterBackward* const that);
+
+// Return true if the iterator is at the end of the elements (from
+// its point of view, not the order in the GSet)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterForwardIsLast(const GSetIterForward* const that);
+
+// Return true if the iterator is at the end of the elements (from
+// its point of view, not the order in the GSet)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterBackwardIsLast(const GSetIterBackward* const that);
+
+// Change the attached set of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardSetGSet(GSetIterForward* const that, 
+  GSet* const set);
+
+// Change the attached set of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterBackwardSetGSet(GSetIterBackward* const that, 
+  GSet* const set);
+
+// Return the data currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetIterForwardGet(const GSetIterForward* const that);
+
+// Return the data currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetIterBackwardGet(const GSetIterBackward* const that);
+
+// Return the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+const GSetElem* GSetIterForwardGetElem(
+  const GSetIterForward* const that);
+
+// Return the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+const GSetElem* GSetIterBackwardGetElem(
+  const GSetIterBackward* const that);
+
+// Return the sort value of the element currently pointed to by the 
+// iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetIterForwardGetSortVal(const GSetIterForward* const that);
+
+// Return the sort value of the element currently pointed to by the 
+// iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetIterBackwardGetSortVal(const GSetIterBackward* const that);
+
+// Set the sort value of the element currently pointed to by the 
+// iterator
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardSetSortVal(GSetIterForward* const that, float val);
+
+// Set the sort value of the element currently pointed to by the 
+// iterator
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterBackwardSetSortVal(GSetIterBackward* const that, float val);
+
+// Set the data of the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardSetData(const GSetIterForward* const that, 
+  void* data);
+
+// Set the data of the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterBackwardSetData(const GSetIterBackward* const that,
+  void* data);
+
+// Remove the element currently pointed to by the iterator
+// The iterator is moved forward to the next element
+// Return false if we couldn't move
+// Return true else
+// It's the responsibility of the user to delete the content of the 
+// element prior to calling this function
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterForwardRemoveElem(GSetIterForward* const that);
+
+// Remove the element currently pointed to by the iterator
+// The iterator is moved backward to the next element
+// Return false if we couldn't move
+// Return true else
+// It's the responsibility of the user to delete the content of the 
+// element prior to calling this function
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetIterBackwardRemoveElem(GSetIterBackward* const that);
+
+// Return the sort value of GSetElem 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetElemGetSortVal(const GSetElem* const that);
+
+// Return the next element of GSetElem 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+const GSetElem* GSetElemNext(const GSetElem* const that);
+
+// Return the previous element of GSetElem 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+const GSetElem* GSetElemPrev(const GSetElem* const that);
+
+// Shuffle the GSet 'that'
+// The random generator must have been initialized before calling 
+// this function
+// This function modifies the _sortVal of each elements in 'that'
+// Use different algorithm according to the number of elements for
+// speed performance
+void GSetShuffle(GSet* const that);
+void GSetShuffleA(GSet* const that);
+void GSetShuffleB(GSet* const that);
+void GSetShuffleC(GSet* const that);
+
+// ================ GSetArr functions declaration ====================
+
+// Function to create a new GSetArr,
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* GSetArrCreate(void);
+
+// Static constructors for GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr GSetArrCreateStatic(void);
+
+// Function to clone a GSetArr,
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* GSetArrClone(const GSetArr* const that);
+
+// Function to create a new GSetArr with the same elements (data and 
+// sort values) and in the same order as the GSet 'set'
+// Return a pointer toward the new GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArr* _GSetArrCreateFromGSet(const GSet* const set);
+
+// Function to free the memory used by the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrFree(GSetArr** that);
+
+// Function to empty the GSetArr and release its buffer
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrFlush(GSetArr* const that);
+
+// Return the number of element in the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrNbElem(const GSetArr* const that);
+
+// Ensure the GSetArr has room for at least 'nb' elements without 
+// reallocation
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrReserve(GSetArr* const that, const long nb);
+
+// Function to print a GSetArr
+// Use the function 'printData' to print the data pointed to by 
+// the elements, and print 'sep' between each element
+// If printData is null, print the pointer value instead
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrPrint(const GSetArr* const that, FILE* const stream, 
+  void(*printData)(const void* const data, FILE* const stream), 
+  const char* const sep);
+
+// Function to insert an element pointing toward 'data' at the 
+// head of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrPush(GSetArr* const that, void* const data);
+
+// Function to insert an element pointing toward 'data' at the 
+// tail of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppend(GSetArr* const that, void* const data);
+
+// Function to insert an element pointing toward 'data' at the 
+// position defined by 'v' sorting the set in increasing order
+// The position is found by binary search, elements with the same 
+// sort value keep their order of insertion
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAddSort(GSetArr* const that, void* const data, 
+  const double v);
+
+// Function to insert an element pointing toward 'data' at the 
+// 'iElem'-th position 
+// If 'iElem' is greater than or equal to the number of element
+// in the GSetArr, elements pointing toward null data are added
+// If the data is inserted inside the set, the current elements from
+// the iElem-th elem are pushed 
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrInsert(GSetArr* const that, void* const data, 
+  const long iElem);
+
+// Function to remove the element at the head of the GSetArr
+// Return the data pointed to by the removed element, or null if the 
+// GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrPop(GSetArr* const that);
+
+// Function to remove the element at the tail of the GSetArr
+// Return the data pointed to by the removed element, or null if the 
+// GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrDrop(GSetArr* const that);
+
+// Function to remove the element at the 'iElem'-th position of the 
+// GSetArr
+// Return the data pointed to by the removed element
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrRemove(GSetArr* const that, const long iElem);
+
+// Function to remove the first element of the GSetArr pointing to 
+// 'data'
+// If there is no element pointing to 'data' do nothing
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveFirst(GSetArr* const that, const void* const data);
+
+// Function to remove the last element of the GSetArr pointing to 
+// 'data'
+// If there is no element pointing to 'data' do nothing
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveLast(GSetArr* const that, const void* const data);
+
+// Function to remove all the element of the GSetArr pointing to 'data'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrRemoveAll(GSetArr* const that, const void* const data);
+
+// Function to get the element at the 'iElem'-th position of the 
+// GSetArr
+// The returned pointer is invalidated by any insertion or removal
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrElem* _GSetArrElement(const GSetArr* const that, 
+  const long iElem);
+
+// Function to get the data at the 'iElem'-th position of the GSetArr
+// without removing it
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrGet(const GSetArr* const that, const long iElem);
+
+// Function to get the data at first position of the GSetArr
+// without removing it
+// Return null if the GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrHead(const GSetArr* const that);
+
+// Function to get the data at last position of the GSetArr
+// without removing it
+// Return null if the GSetArr is empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetArrTail(const GSetArr* const that);
+
+// Function to set the data at the 'iElem'-th position of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSet(GSetArr* const that, const long iElem, 
+  void* const data);
+
+// Function to get the sort value of the 'iElem'-th element of the 
+// GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+float _GSetArrGetSortVal(const GSetArr* const that, const long iElem);
+
+// Function to set the sort value of the 'iElem'-th element of the 
+// GSetArr
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSetSortVal(GSetArr* const that, const long iElem, 
+  const float v);
+
+// Function to get the index of the first element of the GSetArr
+// which point to 'data'
+// Return -1 if cannot find the data
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrGetIndexFirst(const GSetArr* const that, 
+  const void* const data);
+
+// Function to get the index of the last element of the GSetArr
+// which point to 'data'
+// Return -1 if cannot find the data
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrGetIndexLast(const GSetArr* const that, 
+  const void* const data);
+
+// Return the number of (GSetArrElem._data=='data') in the GSetArr 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long _GSetArrCount(const GSetArr* const that, const void* const data);
+
+// Function to sort the element of the GSetArr in increasing order of 
+// _sortVal
+// The sort is stable (merge sort, O(n.log(n)))
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSort(GSetArr* const that);
+
+// Switch the 'iElem'-th and 'jElem'-th element of the GSetArr
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrSwitch(GSetArr* const that, const long iElem, 
+  const long jElem);
+
+// Append the element of the GSetArr 'set' at the end of the GSetArr 
+// 'that'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppendSet(GSetArr* const that, const GSetArr* const set);
+
+// Append the element of the GSet 'set' at the end of the GSetArr 
+// 'that'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrAppendGSet(GSetArr* const that, const GSet* const set);
+
+// Append the element of the GSetArr 'that' at the end of the GSet 
+// 'set'
+// 'that' and 'set' can be empty
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetArrToGSet(const GSetArr* const that, GSet* const set);
+
+// Create a new GSetArrIterForward for the GSetArr 'set'
+// The iterator is reset upon creation
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterForward* _GSetArrIterForwardCreate(GSetArr* const set);
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterForward _GSetArrIterForwardCreateStatic(GSetArr* const set);
+
+// Create a new GSetArrIterBackward for the GSetArr 'set'
+// The iterator is reset upon creation
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterBackward* _GSetArrIterBackwardCreate(GSetArr* const set);
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetArrIterBackward _GSetArrIterBackwardCreateStatic(
+  GSetArr* const set);
+
+// Free the memory used by a GSetArrIterForward (not by its attached 
+// GSetArr)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardFree(GSetArrIterForward** that);
+
+// Free the memory used by a GSetArrIterBackward (not by its attached 
+// GSetArr)
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardFree(GSetArrIterBackward** that);
+
+// Reset the GSetArrIterForward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardReset(GSetArrIterForward* const that);
+
+// Reset the GSetArrIterBackward to its starting position
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardReset(GSetArrIterBackward* const that);
+
+// Step the GSetArrIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardStep(GSetArrIterForward* const that);
+
+// Step the GSetArrIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardStep(GSetArrIterBackward* const that);
+
+// Step back the GSetArrIterForward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardStepBack(GSetArrIterForward* const that);
+
+// Step back the GSetArrIterBackward
+// Return false if we couldn't step
+// Return true else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardStepBack(GSetArrIterBackward* const that);
+
+// Apply a function to all elements of the GSetArr of the 
+// GSetArrIterForward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the nodes, 'param' is a hook to allow the user to pass
+// parameters to the function through a user-defined structure
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardApply(GSetArrIterForward* const that, 
+  void(*fun)(void* data, void* param), void* param);
+
+// Apply a function to all elements of the GSetArr of the 
+// GSetArrIterBackward
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardApply(GSetArrIterBackward* const that, 
+  void(*fun)(void* data, void* param), void* param);
+
+// Return true if the iterator is at the start of the elements (from
+// its point of view, not the order in the GSetArr)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardIsFirst(const GSetArrIterForward* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardIsFirst(const GSetArrIterBackward* const that);
+
+// Return true if the iterator is at the end of the elements (from
+// its point of view, not the order in the GSetArr)
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterForwardIsLast(const GSetArrIterForward* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GSetArrIterBackwardIsLast(const GSetArrIterBackward* const that);
+
+// Return the data currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetArrIterForwardGet(const GSetArrIterForward* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetArrIterBackwardGet(const GSetArrIterBackward* const that);
+
+// Set the data of the element currently pointed to by the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardSetData(const GSetArrIterForward* const that, 
+  void* data);
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardSetData(const GSetArrIterBackward* const that, 
+  void* data);
+
+// Return the sort value of the element currently pointed to by the 
+// iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetArrIterForwardGetSortVal(const GSetArrIterForward* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+float GSetArrIterBackwardGetSortVal(
+  const GSetArrIterBackward* const that);
+
+// Set the sort value of the element currently pointed to by the 
+// iterator
+// The user must sort the set himself after calling this method
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterForwardSetSortVal(GSetArrIterForward* const that, 
+  float val);
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetArrIterBackwardSetSortVal(GSetArrIterBackward* const that, 
+  float val);
+
+// ================ GSetPool functions declaration ====================
+
+// Function to create a new GSetPool delivering blocks of 'blockSize' 
+// bytes
+// Return a pointer toward the new GSetPool
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetPool* GSetPoolCreate(const size_t blockSize);
+
+// Static constructor for GSetPool
+#if BUILDMODE != 0
+static inline
+#endif 
+GSetPool GSetPoolCreateStatic(const size_t blockSize);
+
+// Function to free the memory used by the GSetPool 'that'
+// All the blocks allocated from the pool are released
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolFree(GSetPool** that);
+
+// Function to release in one call all the blocks allocated from the 
+// GSetPool 'that'
+// The sets and trees using blocks of this pool must not be used 
+// anymore (or reset with their static constructor) after this call
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolFlush(GSetPool* const that);
+
+// Function to get a block of memory from the GSetPool 'that'
+// The content of the block is undefined
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GSetPoolAlloc(GSetPool* const that);
+
+// Function to give back the block 'block' to the GSetPool 'that'
+// 'block' must have been allocated from 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetPoolRelease(GSetPool* const that, void* const block);
+
+// Return the number of blocks currently in use in the GSetPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+long GSetPoolGetNbUsed(const GSetPool* const that);
+
+// Return the size in bytes of the blocks of the GSetPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+size_t GSetPoolGetBlockSize(const GSetPool* const that);
+
+// The following functions are the equivalent of the GSet functions 
+// of same name, except that the GSetElem are allocated from and 
+// released to the GSetPool 'pool' (which must deliver blocks of at 
+// least sizeof(GSetElem) bytes)
+// A GSet whose elements come from a pool must only be modified with 
+// these functions (the other GSet functions modifying the set would 
+// free() the elements), read-only GSet functions and iterators can be 
+// used as usual
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetPushPool(GSet* const that, void* const data, 
+  GSetPool* const pool);
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetAppendPool(GSet* const that, void* const data, 
+  GSetPool* const pool);
+
+// Elements with the same sort value keep their order of insertion
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetAddSortPool(GSet* const that, void* const data, 
+  const double v, GSetPool* const pool);
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetPopPool(GSet* const that, GSetPool* const pool);
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetDropPool(GSet* const that, GSetPool* const pool);
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void* _GSetRemoveElemPool(GSet* const that, GSetElem** elem, 
+  GSetPool* const pool);
+
+// Empty the GSet 'that'
+// If all the blocks in use in 'pool' belong to 'that', the pool is 
+// flushed in one call, else the elements are given back one by one 
+// to the pool
+#if BUILDMODE != 0
+static inline
+#endif 
+void _GSetFlushPool(GSet* const that, GSetPool* const pool);
 
-// Return the number of (GSetElem._data=='data') in the GSet 'that'
-long _GSetCount(const GSet* const that, const void* const data);
+// ================ GSetHeap functions declaration ====================
 
-// Set the sort value of the GSetElem 'that' to 'v'
+// Function to create a new GSetHeap
+// If 'isMax' is true the element with the highest sort value is at 
+// the top of the heap, else the one with the lowest sort value
+// Return a pointer toward the new GSetHeap
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetElemSetSortVal(GSetElem* const that, const float v);
+GSetHeap* GSetHeapCreate(const bool isMax);
 
-// Set the data of the GSetElem 'that' to 'd'
+// Static constructor for GSetHeap
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetElemSetData(GSetElem* const that, void* const d);
+GSetHeap GSetHeapCreateStatic(const bool isMax);
 
-// Set the previous element of the GSetElem 'that' to 'e'
-// Do not set the link back in 'e'
+// Function to free the memory used by the GSetHeap 'that'
+// The data pointed to by the elements are not freed
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetElemSetPrev(GSetElem* const that, GSetElem* const e);
+void GSetHeapFree(GSetHeap** that);
 
-// Set the next element of the GSetElem 'that' to 'e'
-// Do not set the link back in 'e'
+// Function to empty the GSetHeap 'that' and release its memory
+// The data pointed to by the elements are not freed
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetElemSetNext(GSetElem* const that, GSetElem* const e);
-
-// Move the 'iElem'-th element to the 'pos' index in the GSet
-void _GSetMoveElem(GSet* const that, const long iElem, const long pos);
+void GSetHeapFlush(GSetHeap* const that);
 
-// Create a new GSetIterForward for the GSet 'set'
-// The iterator is reset upon creation
-GSetIterForward* _GSetIterForwardCreate(GSet* const set);
+// Return the number of element in the GSetHeap 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-GSetIterForward _GSetIterForwardCreateStatic(GSet* const set);
+long GSetHeapNbElem(const GSetHeap* const that);
 
-// Create a new GSetIterBackward for the GSet 'set'
-// The iterator is reset upon creation
-GSetIterBackward* _GSetIterBackwardCreate(GSet* const set);
+// Function to insert an element pointing toward 'data' with sort 
+// value 'v' in the GSetHeap 'that'
+// Return the handle of the element, which stays valid until the 
+// element is removed from the heap
 #if BUILDMODE != 0
 static inline
 #endif 
-GSetIterBackward _GSetIterBackwardCreateStatic(GSet* const set);
-
-// Free the memory used by a GSetIterForward (not by its attached GSet)
-// Do nothing if arguments are invalid
-void GSetIterForwardFree(GSetIterForward** that);
-
-// Free the memory used by a GSetIterBackward (not by its attached GSet)
-// Do nothing if arguments are invalid
-void GSetIterBackwardFree(GSetIterBackward** that);
+long GSetHeapPush(GSetHeap* const that, void* const data, 
+  const float v);
 
-// Clone a GSetIterForward
-GSetIterForward* GSetIterForwardClone(
-  const GSetIterForward* const that);
-
-// Clone a GSetIterBackward
-GSetIterBackward* GSetIterBackwardClone(
-  const GSetIterBackward* const that);
-
-// Reset the GSetIterForward to its starting position
+// Function to remove the element at the top of the GSetHeap 'that' 
+// (lowest sort value, or highest if the heap was created with 
+// isMax == true)
+// Return the data pointed to by the removed element, or null if the 
+// GSetHeap is empty
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterForwardReset(GSetIterForward* const that);
+void* GSetHeapPop(GSetHeap* const that);
 
-// Reset the GSetIterBackward to its starting position
+// Function to get the data of the element at the top of the GSetHeap 
+// 'that' without removing it
+// Return null if the GSetHeap is empty
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterBackwardReset(GSetIterBackward* const that);
+void* GSetHeapTop(const GSetHeap* const that);
 
-// Step the GSetIterForward
-// Return false if we couldn't step
-// Return true else
+// Function to get the sort value of the element at the top of the 
+// GSetHeap 'that' 
+// The GSetHeap must not be empty
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterForwardStep(GSetIterForward* const that);
+float GSetHeapTopSortVal(const GSetHeap* const that);
 
-// Step the GSetIterBackward
-// Return false if we couldn't step
-// Return true else
+// Function to get the data of the element with handle 'handle' in 
+// the GSetHeap 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterBackwardStep(GSetIterBackward* const that);
+void* GSetHeapGet(const GSetHeap* const that, const long handle);
 
-// Step back the GSetIterForward
-// Return false if we couldn't step
-// Return true else
+// Function to get the sort value of the element with handle 'handle' 
+// in the GSetHeap 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterForwardStepBack(GSetIterForward* const that);
+float GSetHeapGetSortVal(const GSetHeap* const that, const long handle);
 
-// Step back the GSetIterBackward
-// Return false if we couldn't step
-// Return true else
+// Function to change the sort value of the element with handle 
+// 'handle' in the GSetHeap 'that' to 'v' (decrease-key, or 
+// increase-key)
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterBackwardStepBack(GSetIterBackward* const that);
+void GSetHeapSetSortVal(GSetHeap* const that, const long handle, 
+  const float v);
 
-// Apply a function to all elements of the GSet of the GSetIterForward
-// The iterator is first reset, then the function is apply sequencially
-// using the Step function of the iterator
-// The applied function takes to void* arguments: 'data' is the _data
-// property of the nodes, 'param' is a hook to allow the user to pass
-// parameters to the function through a user-defined structure
+// Function to remove the element with handle 'handle' from the 
+// GSetHeap 'that'
+// Return the data pointed to by the removed element
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterForwardApply(GSetIterForward* const that, 
-  void(*fun)(void* data, void* param), void* param);
-
-// Apply a function to all elements of the GSet of the GSetIterBackward
-// The iterator is first reset, then the function is apply sequencially
-// using the Step function of the iterator
-// The applied function takes to void* arguments: 'data' is the _data
-// property of the nodes, 'param' is a hook to allow the user to pass
-// parameters to the function through a user-defined structure
+void* GSetHeapRemove(GSetHeap* const that, const long handle);
+
+// Function to sort the element of the GSet 'that' in increasing order 
+// of _sortVal
+// Stable merge sort of the linked elements, O(n.log(n)) and without 
+// allocation (the elements are relinked, not reallocated)
+// Elements with equal _sortVal keep their order, but unlike _GSetSort
+// values closer than GSET_EPSILON are not considered equal: such 
+// elements are ordered by their exact _sortVal and may come out in a 
+// different order than with _GSetSort
+// Unlike _GSetSort it stays O(n.log(n)) on sorted and reversed sets
+// (see Bench/gset.c)
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterBackwardApply(GSetIterBackward* const that, 
-  void(*fun)(void* data, void* param), void* param);
+void _GSetSortMerge(GSet* const that);
 
-// Return true if the iterator is at the start of the elements (from
-// its point of view, not the order in the GSet)
-// Return false else
+// ================ GSetIndex functions declaration ====================
+
+// Function to create a new GSetIndex over the GSet 'set'
+// The GSet is sorted (stable) by increasing _sortVal 
+// Return a pointer toward the new GSetIndex
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterForwardIsFirst(const GSetIterForward* const that);
+GSetIndex* GSetIndexCreate(GSet* const set);
 
-// Return true if the iterator is at the start of the elements (from
-// its point of view, not the order in the GSet)
-// Return false else
+// Static constructor for GSetIndex
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterBackwardIsFirst(const GSetIterBackward* const that);
+GSetIndex GSetIndexCreateStatic(GSet* const set);
 
-// Return true if the iterator is at the end of the elements (from
-// its point of view, not the order in the GSet)
-// Return false else
+// Function to free the memory used by the GSetIndex 'that'
+// The indexed GSet is not freed
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterForwardIsLast(const GSetIterForward* const that);
+void GSetIndexFree(GSetIndex** that);
 
-// Return true if the iterator is at the end of the elements (from
-// its point of view, not the order in the GSet)
-// Return false else
+// Function to free the memory used by the static GSetIndex 'that'
+// The indexed GSet is not freed
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterBackwardIsLast(const GSetIterBackward* const that);
+void GSetIndexFreeStatic(GSetIndex* const that);
 
-// Change the attached set of the iterator, and reset it
+// Function to rebuild the GSetIndex 'that' after its GSet has been 
+// modified without using the GSetIndex, O(n.log(n))
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterForwardSetGSet(GSetIterForward* const that, 
-  GSet* const set);
+void GSetIndexRebuild(GSetIndex* const that);
 
-// Change the attached set of the iterator, and reset it
+// Return the GSet indexed by the GSetIndex 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterBackwardSetGSet(GSetIterBackward* const that, 
-  GSet* const set);
+GSet* GSetIndexSet(const GSetIndex* const that);
 
-// Return the data currently pointed to by the iterator
+// Return the number of element in the GSetIndex 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-void* GSetIterForwardGet(const GSetIterForward* const that);
+long GSetIndexNbElem(const GSetIndex* const that);
 
-// Return the data currently pointed to by the iterator
+// Function to insert an element pointing toward 'data' with sort 
+// value 'v' in the GSet indexed by 'that', after the elements with 
+// a lower or equal sort value, O(log(n))
+// Return the new element
 #if BUILDMODE != 0
 static inline
 #endif 
-void* GSetIterBackwardGet(const GSetIterBackward* const that);
+GSetElem* GSetIndexAddSort(GSetIndex* const that, void* const data, 
+  const float v);
 
-// Return the element currently pointed to by the iterator
+// Function to remove the element 'elem' from the GSet indexed by 
+// 'that', O(log(n) + number of elements with the same sort value)
+// 'elem' is freed and set to null
+// Return the data pointed to by the removed element
 #if BUILDMODE != 0
 static inline
 #endif 
-const GSetElem* GSetIterForwardGetElem(
-  const GSetIterForward* const that);
+void* GSetIndexRemoveElem(GSetIndex* const that, GSetElem** elem);
 
-// Return the element currently pointed to by the iterator
+// Function to change the sort value of the element 'elem' of the 
+// GSet indexed by 'that' to 'v' and move it accordingly, 
+// O(log(n) + number of elements with the same sort value)
 #if BUILDMODE != 0
 static inline
 #endif 
-const GSetElem* GSetIterBackwardGetElem(
-  const GSetIterBackward* const that);
+void GSetIndexSetSortVal(GSetIndex* const that, GSetElem* const elem, 
+  const float v);
 
-// Return the sort value of the element currently pointed to by the 
-// iterator
+// Return the index of the element 'elem' in the GSet indexed by 'that'
+// O(log(n) + number of elements with the same sort value)
+// Return -1 if 'elem' is not in the GSet
 #if BUILDMODE != 0
 static inline
 #endif 
-float GSetIterForwardGetSortVal(const GSetIterForward* const that);
+long GSetIndexGetRank(const GSetIndex* const that, 
+  const GSetElem* const elem);
 
-// Return the sort value of the element currently pointed to by the 
-// iterator
+// Return the element at index 'iElem' in the GSet indexed by 'that', 
+// O(log(n))
 #if BUILDMODE != 0
 static inline
 #endif 
-float GSetIterBackwardGetSortVal(const GSetIterBackward* const that);
+GSetElem* GSetIndexElement(const GSetIndex* const that, 
+  const long iElem);
 
-// Set the sort value of the element currently pointed to by the 
-// iterator
-// The user must sort the set himself after calling this method
+// Return the data of the element at index 'iElem' in the GSet 
+// indexed by 'that', O(log(n))
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterForwardSetSortVal(GSetIterForward* const that, float val);
+void* GSetIndexGet(const GSetIndex* const that, const long iElem);
 
-// Set the sort value of the element currently pointed to by the 
-// iterator
-// The user must sort the set himself after calling this method
+// Return the index of the first element with a sort value greater 
+// or equal to 'v' in the GSet indexed by 'that', O(log(n))
+// Return the number of elements if there is no such element
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterBackwardSetSortVal(GSetIterBackward* const that, float val);
+long GSetIndexLowerBound(const GSetIndex* const that, const float v);
 
-// Set the data of the element currently pointed to by the iterator
+// ================ GSet parallel functions declaration ================
+
+// Function to create a new GSetThreadPool of 'nbThread' threads, the 
+// calling thread included (if 'nbThread' <= 0, one per online core)
+// The 'nbThread' - 1 worker threads are created here and wait for the 
+// jobs of _GSetApplyThreadPool and _GSetReduceThreadPool
+// Return a pointer toward the new GSetThreadPool
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterForwardSetData(const GSetIterForward* const that, 
-  void* data);
+GSetThreadPool* GSetThreadPoolCreate(int nbThread);
 
-// Set the data of the element currently pointed to by the iterator
+// Function to stop and join the threads of the GSetThreadPool 'that' 
+// and free its memory
 #if BUILDMODE != 0
 static inline
 #endif 
-void GSetIterBackwardSetData(const GSetIterBackward* const that,
-  void* data);
+void GSetThreadPoolFree(GSetThreadPool** that);
 
-// Remove the element currently pointed to by the iterator
-// The iterator is moved forward to the next element
-// Return false if we couldn't move
-// Return true else
-// It's the responsibility of the user to delete the content of the 
-// element prior to calling this function
+// Return the number of threads of the GSetThreadPool 'that', the 
+// calling thread included
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterForwardRemoveElem(GSetIterForward* const that);
-
-// Remove the element currently pointed to by the iterator
-// The iterator is moved backward to the next element
-// Return false if we couldn't move
-// Return true else
-// It's the responsibility of the user to delete the content of the 
-// element prior to calling this function
+int GSetThreadPoolGetNbThread(const GSetThreadPool* const that);
+
+// Apply the function 'fun' to all elements of the GSet 'that' using 
+// 'nbThread' threads (if 'nbThread' <= 0, one per online core)
+// The threads are created and joined at each call (fork/join), use 
+// _GSetApplyThreadPool to reuse them across calls
+// The GSet is split into ranges of consecutive elements before 
+// processing, the threads (the calling one included) pick the ranges 
+// one after the other until all have been processed
+// The applied function takes to void* arguments: 'data' is the _data
+// property of the elements, 'param' is a hook to allow the user to 
+// pass parameters to the function through a user-defined structure
+// 'fun' is called concurrently and must be thread safe
 #if BUILDMODE != 0
 static inline
 #endif 
-bool GSetIterBackwardRemoveElem(GSetIterBackward* const that);
-
-// Return the sort value of GSetElem 'that'
+void _GSetApplyParallel(const GSet* const that, 
+  void(*fun)(void* data, void* param), void* param, int nbThread);
+
+// Reduce the GSet 'that' using 'nbThread' threads (if 'nbThread' <= 0, 
+// one per online core)
+// The threads are created and joined at each call (fork/join), use 
+// _GSetReduceThreadPool to reuse them across calls
+// 'acc' points to the accumulator of 'accSize' bytes, which must be 
+// initialised with the identity value of the reduction. Each range of 
+// elements is accumulated in a copy of this initial value with 
+// 'fun', then the partial results are merged into 'acc' with 'merge', 
+// in the order of the ranges (then the result doesn't depend on the 
+// scheduling of the threads)
+// 'fun' is called concurrently and must be thread safe
 #if BUILDMODE != 0
 static inline
 #endif 
-float GSetElemGetSortVal(const GSetElem* const that);
-
-// Return the next element of GSetElem 'that'
+void _GSetReduceParallel(const GSet* const that, 
+  void(*fun)(void* data, void* acc, void* param), 
+  void(*merge)(void* acc, const void* accRange, void* param), 
+  void* const acc, const size_t accSize, void* param, int nbThread);
+
+// Apply the function 'fun' to all elements of the GSet 'that' with the
+// threads of the GSetThreadPool 'pool', see _GSetApplyParallel
+// The calling thread waits until all elements have been processed
+// 'pool' must not be used by several threads at the same time
 #if BUILDMODE != 0
 static inline
 #endif 
-const GSetElem* GSetElemNext(const GSetElem* const that);
+void _GSetApplyThreadPool(const GSet* const that, 
+  void(*fun)(void* data, void* param), void* param, 
+  GSetThreadPool* const pool);
 
-// Return the previous element of GSetElem 'that'
+// Reduce the GSet 'that' with the threads of the GSetThreadPool 'pool',
+// see _GSetReduceParallel
+// 'pool' must not be used by several threads at the same time
 #if BUILDMODE != 0
 static inline
 #endif 
-const GSetElem* GSetElemPrev(const GSetElem* const that);
+void _GSetReduceThreadPool(const GSet* const that, 
+  void(*fun)(void* data, void* acc, void* param), 
+  void(*merge)(void* acc, const void* accRange, void* param), 
+  void* const acc, const size_t accSize, void* param, 
+  GSetThreadPool* const pool);
 
-// Shuffle the GSet 'that'
-// The random generator must have been initialized before calling 
-// this function
-// This function modifies the _sortVal of each elements in 'that'
-// Use different algorithm according to the number of elements for
-// speed performance
-void GSetShuffle(GSet* const that);
-void GSetShuffleA(GSet* const that);
-void GSetShuffleB(GSet* const that);
-void GSetShuffleC(GSet* const that);
+// Apply a function to all elements of the GSet of the GSetIterForward
+// using 'nbThread' threads, see _GSetApplyParallel
+#if BUILDMODE != 0
+static inline
+#endif 
+void GSetIterForwardApplyParallel(GSetIterForward* const that, 
+  void(*fun)(void* data, void* param), void* param, int nbThread);
 
 // ================= Typed GSet ==================
 
@@ -1037,6 +2128,113 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask* const that, GSetElem** elem)
   {return (SquadRunningTask*)_GSetRemoveElem((GSet* const)that, elem);}
 
+// ================= Typed GSetArr ==================
+
+typedef struct GSetArrVecFloat {GSetArr _set;} GSetArrVecFloat;
+#define GSetArrVecFloatCreate() ((GSetArrVecFloat*)GSetArrCreate())
+static inline GSetArrVecFloat GSetArrVecFloatCreateStatic(void) 
+  {GSetArrVecFloat ret = {._set=GSetArrCreateStatic()}; return ret;}
+static inline GSetArrVecFloat* GSetArrVecFloatClone(const GSetArrVecFloat* const that)
+  {return (GSetArrVecFloat*)GSetArrClone((const GSetArr* const)that);}
+static inline VecFloat* _GSetArrVecFloatGet(const GSetArrVecFloat* const that, 
+  const long iElem)
+  {return (VecFloat*)_GSetArrGet((const GSetArr* const)that, iElem);}
+static inline VecFloat* _GSetArrVecFloatGetHead(const GSetArrVecFloat* const that)
+  {return (VecFloat*)_GSetArrHead((const GSetArr* const)that);}
+static inline VecFloat* _GSetArrVecFloatGetTail(const GSetArrVecFloat* const that)
+  {return (VecFloat*)_GSetArrTail((const GSetArr* const)that);}
+static inline VecFloat* _GSetArrVecFloatPop(GSetArrVecFloat* const that)
+  {return (VecFloat*)_GSetArrPop((GSetArr* const)that);}
+static inline VecFloat* _GSetArrVecFloatDrop(GSetArrVecFloat* const that)
+  {return (VecFloat*)_GSetArrDrop((GSetArr* const)that);}
+static inline VecFloat* _GSetArrVecFloatRemove(GSetArrVecFloat* const that, 
+  const long iElem)
+  {return (VecFloat*)_GSetArrRemove((GSetArr* const)that, iElem);}
+
+typedef struct GSetArrVecShort {GSetArr _set;} GSetArrVecShort;
+#define GSetArrVecShortCreate() ((GSetArrVecShort*)GSetArrCreate())
+static inline GSetArrVecShort GSetArrVecShortCreateStatic(void) 
+  {GSetArrVecShort ret = {._set=GSetArrCreateStatic()}; return ret;}
+static inline GSetArrVecShort* GSetArrVecShortClone(const GSetArrVecShort* const that)
+  {return (GSetArrVecShort*)GSetArrClone((const GSetArr* const)that);}
+static inline VecShort* _GSetArrVecShortGet(const GSetArrVecShort* const that, 
+  const long iElem)
+  {return (VecShort*)_GSetArrGet((const GSetArr* const)that, iElem);}
+static inline VecShort* _GSetArrVecShortGetHead(const GSetArrVecShort* const that)
+  {return (VecShort*)_GSetArrHead((const GSetArr* const)that);}
+static inline VecShort* _GSetArrVecShortGetTail(const GSetArrVecShort* const that)
+  {return (VecShort*)_GSetArrTail((const GSetArr* const)that);}
+static inline VecShort* _GSetArrVecShortPop(GSetArrVecShort* const that)
+  {return (VecShort*)_GSetArrPop((GSetArr* const)that);}
+static inline VecShort* _GSetArrVecShortDrop(GSetArrVecShort* const that)
+  {return (VecShort*)_GSetArrDrop((GSetArr* const)that);}
+static inline VecShort* _GSetArrVecShortRemove(GSetArrVecShort* const that, 
+  const long iElem)
+  {return (VecShort*)_GSetArrRemove((GSetArr* const)that, iElem);}
+
+typedef struct GSetArrPBPhysParticle {GSetArr _set;} GSetArrPBPhysParticle;
+#define GSetArrPBPhysParticleCreate() ((GSetArrPBPhysParticle*)GSetArrCreate())
+static inline GSetArrPBPhysParticle GSetArrPBPhysParticleCreateStatic(void) 
+  {GSetArrPBPhysParticle ret = {._set=GSetArrCreateStatic()}; return ret;}
+static inline GSetArrPBPhysParticle* GSetArrPBPhysParticleClone(const GSetArrPBPhysParticle* const that)
+  {return (GSetArrPBPhysParticle*)GSetArrClone((const GSetArr* const)that);}
+static inline PBPhysParticle* _GSetArrPBPhysParticleGet(const GSetArrPBPhysParticle* const that, 
+  const long iElem)
+  {return (PBPhysParticle*)_GSetArrGet((const GSetArr* const)that, iElem);}
+static inline PBPhysParticle* _GSetArrPBPhysParticleGetHead(const GSetArrPBPhysParticle* const that)
+  {return (PBPhysParticle*)_GSetArrHead((const GSetArr* const)that);}
+static inline PBPhysParticle* _GSetArrPBPhysParticleGetTail(const GSetArrPBPhysParticle* const that)
+  {return (PBPhysParticle*)_GSetArrTail((const GSetArr* const)that);}
+static inline PBPhysParticle* _GSetArrPBPhysParticlePop(GSetArrPBPhysParticle* const that)
+  {return (PBPhysParticle*)_GSetArrPop((GSetArr* const)that);}
+static inline PBPhysParticle* _GSetArrPBPhysParticleDrop(GSetArrPBPhysParticle* const that)
+  {return (PBPhysParticle*)_GSetArrDrop((GSetArr* const)that);}
+static inline PBPhysParticle* _GSetArrPBPhysParticleRemove(GSetArrPBPhysParticle* const that, 
+  const long iElem)
+  {return (PBPhysParticle*)_GSetArrRemove((GSetArr* const)that, iElem);}
+
+typedef struct GSetArrGenTree {GSetArr _set;} GSetArrGenTree;
+#define GSetArrGenTreeCreate() ((GSetArrGenTree*)GSetArrCreate())
+static inline GSetArrGenTree GSetArrGenTreeCreateStatic(void) 
+  {GSetArrGenTree ret = {._set=GSetArrCreateStatic()}; return ret;}
+static inline GSetArrGenTree* GSetArrGenTreeClone(const GSetArrGenTree* const that)
+  {return (GSetArrGenTree*)GSetArrClone((const GSetArr* const)that);}
+static inline GenTree* _GSetArrGenTreeGet(const GSetArrGenTree* const that, 
+  const long iElem)
+  {return (GenTree*)_GSetArrGet((const GSetArr* const)that, iElem);}
+static inline GenTree* _GSetArrGenTreeGetHead(const GSetArrGenTree* const that)
+  {return (GenTree*)_GSetArrHead((const GSetArr* const)that);}
+static inline GenTree* _GSetArrGenTreeGetTail(const GSetArrGenTree* const that)
+  {return (GenTree*)_GSetArrTail((const GSetArr* const)that);}
+static inline GenTree* _GSetArrGenTreePop(GSetArrGenTree* const that)
+  {return (GenTree*)_GSetArrPop((GSetArr* const)that);}
+static inline GenTree* _GSetArrGenTreeDrop(GSetArrGenTree* const that)
+  {return (GenTree*)_GSetArrDrop((GSetArr* const)that);}
+static inline GenTree* _GSetArrGenTreeRemove(GSetArrGenTree* const that, 
+  const long iElem)
+  {return (GenTree*)_GSetArrRemove((GSetArr* const)that, iElem);}
+
+typedef struct GSetArrStr {GSetArr _set;} GSetArrStr;
+#define GSetArrStrCreate() ((GSetArrStr*)GSetArrCreate())
+static inline GSetArrStr GSetArrStrCreateStatic(void) 
+  {GSetArrStr ret = {._set=GSetArrCreateStatic()}; return ret;}
+static inline GSetArrStr* GSetArrStrClone(const GSetArrStr* const that)
+  {return (GSetArrStr*)GSetArrClone((const GSetArr* const)that);}
+static inline char* _GSetArrStrGet(const GSetArrStr* const that, 
+  const long iElem)
+  {return (char*)_GSetArrGet((const GSetArr* const)that, iElem);}
+static inline char* _GSetArrStrGetHead(const GSetArrStr* const that)
+  {return (char*)_GSetArrHead((const GSetArr* const)that);}
+static inline char* _GSetArrStrGetTail(const GSetArrStr* const that)
+  {return (char*)_GSetArrTail((const GSetArr* const)that);}
+static inline char* _GSetArrStrPop(GSetArrStr* const that)
+  {return (char*)_GSetArrPop((GSetArr* const)that);}
+static inline char* _GSetArrStrDrop(GSetArrStr* const that)
+  {return (char*)_GSetArrDrop((GSetArr* const)that);}
+static inline char* _GSetArrStrRemove(GSetArrStr* const that, 
+  const long iElem)
+  {return (char*)_GSetArrRemove((GSetArr* const)that, iElem);}
+
 // ================= Generic functions ==================
 
 #define GSetFree(Set) _Generic(Set, \
@@ -1054,7 +2252,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo**: _GSetFree, \
   GSetSquidletTaskRequest**: _GSetFree, \
   GSetSquadRunningTask**: _GSetFree, \
-  default: PBErrInvalidPolymorphism)((GSet**)(Set))
+  GSetArr**: _GSetArrFree, \
+  GSetArrVecFloat**: _GSetArrFree, \
+  GSetArrVecShort**: _GSetArrFree, \
+  GSetArrPBPhysParticle**: _GSetArrFree, \
+  GSetArrGenTree**: _GSetArrFree, \
+  GSetArrStr**: _GSetArrFree, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
 
 #define GSetPush(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1107,7 +2311,29 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetPush, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrPush), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrPush, \
+    VecFloat2D*: _GSetArrPush, \
+    VecFloat3D*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrPush, \
+    VecShort2D*: _GSetArrPush, \
+    VecShort3D*: _GSetArrPush, \
+    VecShort4D*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetAddSort(Set, Data, Value) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1159,7 +2385,29 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetAddSort, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data), Value)
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrAddSort), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrAddSort, \
+    VecFloat2D*: _GSetArrAddSort, \
+    VecFloat3D*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrAddSort, \
+    VecShort2D*: _GSetArrAddSort, \
+    VecShort3D*: _GSetArrAddSort, \
+    VecShort4D*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data), Value)
 
 #define GSetInsert(Set, Data, Pos) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1211,7 +2459,29 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetInsert, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data), Pos)
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrInsert), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrInsert, \
+    VecFloat2D*: _GSetArrInsert, \
+    VecFloat3D*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrInsert, \
+    VecShort2D*: _GSetArrInsert, \
+    VecShort3D*: _GSetArrInsert, \
+    VecShort4D*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data), Pos)
 
 #define GSetAppend(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1263,7 +2533,29 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetAppend, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrAppend), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrAppend, \
+    VecFloat2D*: _GSetArrAppend, \
+    VecFloat3D*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrAppend, \
+    VecShort2D*: _GSetArrAppend, \
+    VecShort3D*: _GSetArrAppend, \
+    VecShort4D*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetRemoveFirst(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1315,7 +2607,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetRemoveFirst, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _GSetArrRemoveFirst, \
+  GSetArrVecFloat*: _GSetArrRemoveFirst, \
+  GSetArrVecShort*: _GSetArrRemoveFirst, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveFirst, \
+  GSetArrGenTree*: _GSetArrRemoveFirst, \
+  GSetArrStr*: _GSetArrRemoveFirst, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetRemoveLast(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1367,7 +2665,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetRemoveLast, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _GSetArrRemoveLast, \
+  GSetArrVecFloat*: _GSetArrRemoveLast, \
+  GSetArrVecShort*: _GSetArrRemoveLast, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveLast, \
+  GSetArrGenTree*: _GSetArrRemoveLast, \
+  GSetArrStr*: _GSetArrRemoveLast, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetRemoveAll(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1419,7 +2723,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetRemoveAll, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _GSetArrRemoveAll, \
+  GSetArrVecFloat*: _GSetArrRemoveAll, \
+  GSetArrVecShort*: _GSetArrRemoveAll, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveAll, \
+  GSetArrGenTree*: _GSetArrRemoveAll, \
+  GSetArrStr*: _GSetArrRemoveAll, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetGetIndexFirst(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1511,7 +2821,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetGetIndexFirst, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _GSetArrGetIndexFirst, \
+  const GSetArr*: _GSetArrGetIndexFirst, \
+  GSetArrVecFloat*: _GSetArrGetIndexFirst, \
+  const GSetArrVecFloat*: _GSetArrGetIndexFirst, \
+  GSetArrVecShort*: _GSetArrGetIndexFirst, \
+  const GSetArrVecShort*: _GSetArrGetIndexFirst, \
+  GSetArrPBPhysParticle*: _GSetArrGetIndexFirst, \
+  const GSetArrPBPhysParticle*: _GSetArrGetIndexFirst, \
+  GSetArrGenTree*: _GSetArrGetIndexFirst, \
+  const GSetArrGenTree*: _GSetArrGetIndexFirst, \
+  GSetArrStr*: _GSetArrGetIndexFirst, \
+  const GSetArrStr*: _GSetArrGetIndexFirst, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetGetIndexLast(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1603,7 +2925,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquadRunningTask*: _Generic(Data, \
     SquadRunningTask*: _GSetGetIndexLast, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), (void*)(Data))
+  GSetArr*: _GSetArrGetIndexLast, \
+  const GSetArr*: _GSetArrGetIndexLast, \
+  GSetArrVecFloat*: _GSetArrGetIndexLast, \
+  const GSetArrVecFloat*: _GSetArrGetIndexLast, \
+  GSetArrVecShort*: _GSetArrGetIndexLast, \
+  const GSetArrVecShort*: _GSetArrGetIndexLast, \
+  GSetArrPBPhysParticle*: _GSetArrGetIndexLast, \
+  const GSetArrPBPhysParticle*: _GSetArrGetIndexLast, \
+  GSetArrGenTree*: _GSetArrGetIndexLast, \
+  const GSetArrGenTree*: _GSetArrGetIndexLast, \
+  GSetArrStr*: _GSetArrGetIndexLast, \
+  const GSetArrStr*: _GSetArrGetIndexLast, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data))
 
 #define GSetFirstElem(Set, Data) _Generic(Set, \
   GSet*: _Generic(Data, \
@@ -1818,7 +3152,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetPrint, \
   GSetSquadRunningTask*: _GSetPrint, \
   const GSetSquadRunningTask*: _GSetPrint, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), Stream, Fun, Sep)
+  GSetArr*: _GSetArrPrint, \
+  const GSetArr*: _GSetArrPrint, \
+  GSetArrVecFloat*: _GSetArrPrint, \
+  const GSetArrVecFloat*: _GSetArrPrint, \
+  GSetArrVecShort*: _GSetArrPrint, \
+  const GSetArrVecShort*: _GSetArrPrint, \
+  GSetArrPBPhysParticle*: _GSetArrPrint, \
+  const GSetArrPBPhysParticle*: _GSetArrPrint, \
+  GSetArrGenTree*: _GSetArrPrint, \
+  const GSetArrGenTree*: _GSetArrPrint, \
+  GSetArrStr*: _GSetArrPrint, \
+  const GSetArrStr*: _GSetArrPrint, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Stream, Fun, Sep)
 
 #define GSetFlush(Set) _Generic(Set, \
   GSet*: _GSetFlush, \
@@ -1835,7 +3181,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo*: _GSetFlush, \
   GSetSquidletTaskRequest*: _GSetFlush, \
   GSetSquadRunningTask*: _GSetFlush, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrFlush, \
+  GSetArrVecFloat*: _GSetArrFlush, \
+  GSetArrVecShort*: _GSetArrFlush, \
+  GSetArrPBPhysParticle*: _GSetArrFlush, \
+  GSetArrGenTree*: _GSetArrFlush, \
+  GSetArrStr*: _GSetArrFlush, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
 
 #define GSetNbElem(Set) _Generic(Set, \
   GSet*: _GSetNbElem, \
@@ -1866,7 +3218,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetNbElem, \
   GSetSquadRunningTask*: _GSetNbElem, \
   const GSetSquadRunningTask*: _GSetNbElem, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrNbElem, \
+  const GSetArr*: _GSetArrNbElem, \
+  GSetArrVecFloat*: _GSetArrNbElem, \
+  const GSetArrVecFloat*: _GSetArrNbElem, \
+  GSetArrVecShort*: _GSetArrNbElem, \
+  const GSetArrVecShort*: _GSetArrNbElem, \
+  GSetArrPBPhysParticle*: _GSetArrNbElem, \
+  const GSetArrPBPhysParticle*: _GSetArrNbElem, \
+  GSetArrGenTree*: _GSetArrNbElem, \
+  const GSetArrGenTree*: _GSetArrNbElem, \
+  GSetArrStr*: _GSetArrNbElem, \
+  const GSetArrStr*: _GSetArrNbElem, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
 
 #define GSetPop(Set) _Generic(Set, \
   GSet*: _GSetPop, \
@@ -1883,6 +3247,12 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo*: _GSetSquidletInfoPop, \
   GSetSquidletTaskRequest*: _GSetSquidletTaskRequestPop, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskPop, \
+  GSetArr*: _GSetArrPop, \
+  GSetArrVecFloat*: _GSetArrVecFloatPop, \
+  GSetArrVecShort*: _GSetArrVecShortPop, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticlePop, \
+  GSetArrGenTree*: _GSetArrGenTreePop, \
+  GSetArrStr*: _GSetArrStrPop, \
   default: PBErrInvalidPolymorphism)(Set)
 
 #define GSetDrop(Set) _Generic(Set, \
@@ -1900,6 +3270,12 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo*: _GSetSquidletInfoDrop, \
   GSetSquidletTaskRequest*: _GSetSquidletTaskRequestDrop, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskDrop, \
+  GSetArr*: _GSetArrDrop, \
+  GSetArrVecFloat*: _GSetArrVecFloatDrop, \
+  GSetArrVecShort*: _GSetArrVecShortDrop, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleDrop, \
+  GSetArrGenTree*: _GSetArrGenTreeDrop, \
+  GSetArrStr*: _GSetArrStrDrop, \
   default: PBErrInvalidPolymorphism)(Set)
 
 #define GSetRemove(Set, Pos) _Generic(Set, \
@@ -1917,6 +3293,12 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo*: _GSetSquidletInfoRemove, \
   GSetSquidletTaskRequest*: _GSetSquidletTaskRequestRemove, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskRemove, \
+  GSetArr*: _GSetArrRemove, \
+  GSetArrVecFloat*: _GSetArrVecFloatRemove, \
+  GSetArrVecShort*: _GSetArrVecShortRemove, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleRemove, \
+  GSetArrGenTree*: _GSetArrGenTreeRemove, \
+  GSetArrStr*: _GSetArrStrRemove, \
   default: PBErrInvalidPolymorphism)(Set, Pos)
 
 #define GSetRemoveElem(Set, Elem) _Generic(Set, \
@@ -1965,6 +3347,18 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetSquidletTaskRequestGet, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskGet, \
   const GSetSquadRunningTask*: _GSetSquadRunningTaskGet, \
+  GSetArr*: _GSetArrGet, \
+  const GSetArr*: _GSetArrGet, \
+  GSetArrVecFloat*: _GSetArrVecFloatGet, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGet, \
+  GSetArrVecShort*: _GSetArrVecShortGet, \
+  const GSetArrVecShort*: _GSetArrVecShortGet, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGet, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGet, \
+  GSetArrGenTree*: _GSetArrGenTreeGet, \
+  const GSetArrGenTree*: _GSetArrGenTreeGet, \
+  GSetArrStr*: _GSetArrStrGet, \
+  const GSetArrStr*: _GSetArrStrGet, \
   default: PBErrInvalidPolymorphism)(Set, Pos)
 
 #define GSetGetJump(Set, Pos) _Generic(Set, \
@@ -2027,6 +3421,18 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetSquidletTaskRequestGetHead, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskGetHead, \
   const GSetSquadRunningTask*: _GSetSquadRunningTaskGetHead, \
+  GSetArr*: _GSetArrHead, \
+  const GSetArr*: _GSetArrHead, \
+  GSetArrVecFloat*: _GSetArrVecFloatGetHead, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGetHead, \
+  GSetArrVecShort*: _GSetArrVecShortGetHead, \
+  const GSetArrVecShort*: _GSetArrVecShortGetHead, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetHead, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetHead, \
+  GSetArrGenTree*: _GSetArrGenTreeGetHead, \
+  const GSetArrGenTree*: _GSetArrGenTreeGetHead, \
+  GSetArrStr*: _GSetArrStrGetHead, \
+  const GSetArrStr*: _GSetArrStrGetHead, \
   default: PBErrInvalidPolymorphism)(Set)
 
 #define GSetTail(Set) _Generic(Set, \
@@ -2058,6 +3464,18 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetSquidletTaskRequestGetTail, \
   GSetSquadRunningTask*: _GSetSquadRunningTaskGetTail, \
   const GSetSquadRunningTask*: _GSetSquadRunningTaskGetTail, \
+  GSetArr*: _GSetArrTail, \
+  const GSetArr*: _GSetArrTail, \
+  GSetArrVecFloat*: _GSetArrVecFloatGetTail, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGetTail, \
+  GSetArrVecShort*: _GSetArrVecShortGetTail, \
+  const GSetArrVecShort*: _GSetArrVecShortGetTail, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetTail, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetTail, \
+  GSetArrGenTree*: _GSetArrGenTreeGetTail, \
+  const GSetArrGenTree*: _GSetArrGenTreeGetTail, \
+  GSetArrStr*: _GSetArrStrGetTail, \
+  const GSetArrStr*: _GSetArrStrGetTail, \
   default: PBErrInvalidPolymorphism)(Set)
 
 #define GSetHeadElem(Set) _Generic(Set, \
@@ -2151,7 +3569,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetElement, \
   GSetSquadRunningTask*: _GSetElement, \
   const GSetSquadRunningTask*: _GSetElement, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), Pos)
+  GSetArr*: _GSetArrElement, \
+  const GSetArr*: _GSetArrElement, \
+  GSetArrVecFloat*: _GSetArrElement, \
+  const GSetArrVecFloat*: _GSetArrElement, \
+  GSetArrVecShort*: _GSetArrElement, \
+  const GSetArrVecShort*: _GSetArrElement, \
+  GSetArrPBPhysParticle*: _GSetArrElement, \
+  const GSetArrPBPhysParticle*: _GSetArrElement, \
+  GSetArrGenTree*: _GSetArrElement, \
+  const GSetArrGenTree*: _GSetArrElement, \
+  GSetArrStr*: _GSetArrElement, \
+  const GSetArrStr*: _GSetArrElement, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Pos)
 
 #define GSetElementJump(Set, Pos) _Generic(Set, \
   GSet*: _GSetElementJump, \
@@ -2185,21 +3615,27 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   default: PBErrInvalidPolymorphism)((GSet*)(Set), Pos)
 
 #define GSetSort(Set) _Generic(Set, \
-  GSet*: _GSetSort, \
-  GSetVecFloat*: _GSetSort, \
-  GSetVecShort*: _GSetSort, \
-  GSetBCurve*: _GSetSort, \
-  GSetSCurve*: _GSetSort, \
-  GSetShapoid*: _GSetSort, \
-  GSetKnapSackPod*: _GSetSort, \
-  GSetPBPhysParticle*: _GSetSort, \
-  GSetGenTree*: _GSetSort, \
-  GSetStr*: _GSetSort, \
-  GSetGenTreeStr*: _GSetSort, \
-  GSetSquidletInfo*: _GSetSort, \
-  GSetSquidletTaskRequest*: _GSetSort, \
-  GSetSquadRunningTask*: _GSetSort, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSet*: _GSetSortMerge, \
+  GSetVecFloat*: _GSetSortMerge, \
+  GSetVecShort*: _GSetSortMerge, \
+  GSetBCurve*: _GSetSortMerge, \
+  GSetSCurve*: _GSetSortMerge, \
+  GSetShapoid*: _GSetSortMerge, \
+  GSetKnapSackPod*: _GSetSortMerge, \
+  GSetPBPhysParticle*: _GSetSortMerge, \
+  GSetGenTree*: _GSetSortMerge, \
+  GSetStr*: _GSetSortMerge, \
+  GSetGenTreeStr*: _GSetSortMerge, \
+  GSetSquidletInfo*: _GSetSortMerge, \
+  GSetSquidletTaskRequest*: _GSetSortMerge, \
+  GSetSquadRunningTask*: _GSetSortMerge, \
+  GSetArr*: _GSetArrSort, \
+  GSetArrVecFloat*: _GSetArrSort, \
+  GSetArrVecShort*: _GSetArrSort, \
+  GSetArrPBPhysParticle*: _GSetArrSort, \
+  GSetArrGenTree*: _GSetArrSort, \
+  GSetArrStr*: _GSetArrSort, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
 
 #define GSetMerge(IntoSet, MergedSet) _Generic(IntoSet, \
   GSet*: _Generic(MergedSet, \
@@ -2317,8 +3753,32 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquadRunningTask*: _Generic(AppendSet, \
     GSetSquadRunningTask*: _GSetAppendSet, \
     default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)((GSet*)(IntoSet), \
-    (GSet*)(AppendSet))
+  GSetArr*: _Generic(AppendSet, \
+    GSetArr*: _GSetArrAppendSet, \
+    const GSetArr*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecFloat*: _Generic(AppendSet, \
+    GSetArrVecFloat*: _GSetArrAppendSet, \
+    const GSetArrVecFloat*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(AppendSet, \
+    GSetArrVecShort*: _GSetArrAppendSet, \
+    const GSetArrVecShort*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(AppendSet, \
+    GSetArrPBPhysParticle*: _GSetArrAppendSet, \
+    const GSetArrPBPhysParticle*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(AppendSet, \
+    GSetArrGenTree*: _GSetArrAppendSet, \
+    const GSetArrGenTree*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(AppendSet, \
+    GSetArrStr*: _GSetArrAppendSet, \
+    const GSetArrStr*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((void*)(IntoSet), \
+    (void*)(AppendSet))
 
 #define GSetAppendSortedSet(IntoSet, AppendSet) _Generic(IntoSet, \
   GSet*: _Generic(AppendSet, \
@@ -2386,7 +3846,13 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetSquidletInfo*: _GSetSwitch, \
   GSetSquidletTaskRequest*: _GSetSwitch, \
   GSetSquadRunningTask*: _GSetSwitch, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), PosA, PosB)
+  GSetArr*: _GSetArrSwitch, \
+  GSetArrVecFloat*: _GSetArrSwitch, \
+  GSetArrVecShort*: _GSetArrSwitch, \
+  GSetArrPBPhysParticle*: _GSetArrSwitch, \
+  GSetArrGenTree*: _GSetArrSwitch, \
+  GSetArrStr*: _GSetArrSwitch, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), PosA, PosB)
 
 #define GSetMoveElem(Set, From, To) _Generic(Set, \
   GSet*: _GSetMoveElem, \
@@ -2434,7 +3900,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetCount, \
   GSetSquadRunningTask*: _GSetCount, \
   const GSetSquadRunningTask*: _GSetCount, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set), Data)
+  GSetArr*: _GSetArrCount, \
+  const GSetArr*: _GSetArrCount, \
+  GSetArrVecFloat*: _GSetArrCount, \
+  const GSetArrVecFloat*: _GSetArrCount, \
+  GSetArrVecShort*: _GSetArrCount, \
+  const GSetArrVecShort*: _GSetArrCount, \
+  GSetArrPBPhysParticle*: _GSetArrCount, \
+  const GSetArrPBPhysParticle*: _GSetArrCount, \
+  GSetArrGenTree*: _GSetArrCount, \
+  const GSetArrGenTree*: _GSetArrCount, \
+  GSetArrStr*: _GSetArrCount, \
+  const GSetArrStr*: _GSetArrCount, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Data)
 
 #define GSetGetBounds(Set) _Generic(Set, \
   GSetVecFloat*: _GSetVecFloatGetBounds, \
@@ -2470,7 +3948,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetIterForwardCreate, \
   GSetSquadRunningTask*: _GSetIterForwardCreate, \
   const GSetSquadRunningTask*: _GSetIterForwardCreate, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrIterForwardCreate, \
+  const GSetArr*: _GSetArrIterForwardCreate, \
+  GSetArrVecFloat*: _GSetArrIterForwardCreate, \
+  const GSetArrVecFloat*: _GSetArrIterForwardCreate, \
+  GSetArrVecShort*: _GSetArrIterForwardCreate, \
+  const GSetArrVecShort*: _GSetArrIterForwardCreate, \
+  GSetArrPBPhysParticle*: _GSetArrIterForwardCreate, \
+  const GSetArrPBPhysParticle*: _GSetArrIterForwardCreate, \
+  GSetArrGenTree*: _GSetArrIterForwardCreate, \
+  const GSetArrGenTree*: _GSetArrIterForwardCreate, \
+  GSetArrStr*: _GSetArrIterForwardCreate, \
+  const GSetArrStr*: _GSetArrIterForwardCreate, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
   
 #define GSetIterForwardCreateStatic(Set) _Generic(Set, \
   GSet*: _GSetIterForwardCreateStatic, \
@@ -2501,7 +3991,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetIterForwardCreateStatic, \
   GSetSquadRunningTask*: _GSetIterForwardCreateStatic, \
   const GSetSquadRunningTask*: _GSetIterForwardCreateStatic, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrIterForwardCreateStatic, \
+  const GSetArr*: _GSetArrIterForwardCreateStatic, \
+  GSetArrVecFloat*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrVecFloat*: _GSetArrIterForwardCreateStatic, \
+  GSetArrVecShort*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrVecShort*: _GSetArrIterForwardCreateStatic, \
+  GSetArrPBPhysParticle*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrPBPhysParticle*: _GSetArrIterForwardCreateStatic, \
+  GSetArrGenTree*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrGenTree*: _GSetArrIterForwardCreateStatic, \
+  GSetArrStr*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrStr*: _GSetArrIterForwardCreateStatic, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
   
 #define GSetIterBackwardCreate(Set) _Generic(Set, \
   GSet*: _GSetIterBackwardCreate, \
@@ -2530,7 +4032,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetIterBackwardCreate, \
   GSetSquadRunningTask*: _GSetIterBackwardCreate, \
   const GSetSquadRunningTask*: _GSetIterBackwardCreate, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrIterBackwardCreate, \
+  const GSetArr*: _GSetArrIterBackwardCreate, \
+  GSetArrVecFloat*: _GSetArrIterBackwardCreate, \
+  const GSetArrVecFloat*: _GSetArrIterBackwardCreate, \
+  GSetArrVecShort*: _GSetArrIterBackwardCreate, \
+  const GSetArrVecShort*: _GSetArrIterBackwardCreate, \
+  GSetArrPBPhysParticle*: _GSetArrIterBackwardCreate, \
+  const GSetArrPBPhysParticle*: _GSetArrIterBackwardCreate, \
+  GSetArrGenTree*: _GSetArrIterBackwardCreate, \
+  const GSetArrGenTree*: _GSetArrIterBackwardCreate, \
+  GSetArrStr*: _GSetArrIterBackwardCreate, \
+  const GSetArrStr*: _GSetArrIterBackwardCreate, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
   
 #define GSetIterBackwardCreateStatic(Set) _Generic(Set, \
   GSet*: _GSetIterBackwardCreateStatic, \
@@ -2561,7 +4075,19 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetSquidletTaskRequest*: _GSetIterBackwardCreateStatic, \
   GSetSquadRunningTask*: _GSetIterBackwardCreateStatic, \
   const GSetSquadRunningTask*: _GSetIterBackwardCreateStatic, \
-  default: PBErrInvalidPolymorphism)((GSet*)(Set))
+  GSetArr*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArr*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrVecFloat*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrVecFloat*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrVecShort*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrVecShort*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrPBPhysParticle*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrPBPhysParticle*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrGenTree*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrGenTree*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrStr*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrStr*: _GSetArrIterBackwardCreateStatic, \
+  default: PBErrInvalidPolymorphism)((void*)(Set))
   
 #define GSetIterSetGSet(Iter, Set) _Generic(Iter, \
   GSetIterForward*: _Generic(Set, \
@@ -2629,6 +4155,8 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
 #define GSetIterFree(IterRef) _Generic(IterRef, \
   GSetIterForward**: GSetIterForwardFree, \
   GSetIterBackward**: GSetIterBackwardFree, \
+  GSetArrIterForward**: GSetArrIterForwardFree, \
+  GSetArrIterBackward**: GSetArrIterBackwardFree, \
   default: PBErrInvalidPolymorphism)(IterRef)
 
 #define GSetIterClone(Iter) _Generic(Iter, \
@@ -2639,21 +4167,29 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
 #define GSetIterReset(Iter) _Generic(Iter, \
   GSetIterForward*: GSetIterForwardReset, \
   GSetIterBackward*: GSetIterBackwardReset, \
+  GSetArrIterForward*: GSetArrIterForwardReset, \
+  GSetArrIterBackward*: GSetArrIterBackwardReset, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterStep(Iter) _Generic(Iter, \
   GSetIterForward*: GSetIterForwardStep, \
   GSetIterBackward*: GSetIterBackwardStep, \
+  GSetArrIterForward*: GSetArrIterForwardStep, \
+  GSetArrIterBackward*: GSetArrIterBackwardStep, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterStepBack(Iter) _Generic(Iter, \
   GSetIterForward*: GSetIterForwardStepBack, \
   GSetIterBackward*: GSetIterBackwardStepBack, \
+  GSetArrIterForward*: GSetArrIterForwardStepBack, \
+  GSetArrIterBackward*: GSetArrIterBackwardStepBack, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterApply(Iter, Fun, Param) _Generic(Iter, \
   GSetIterForward*: GSetIterForwardApply, \
   GSetIterBackward*: GSetIterBackwardApply, \
+  GSetArrIterForward*: GSetArrIterForwardApply, \
+  GSetArrIterBackward*: GSetArrIterBackwardApply, \
   default: PBErrInvalidPolymorphism)(Iter, Fun, Param)
 
 #define GSetIterIsFirst(Iter) _Generic(Iter, \
@@ -2661,6 +4197,10 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetIterForward*: GSetIterForwardIsFirst, \
   GSetIterBackward*: GSetIterBackwardIsFirst, \
   const GSetIterBackward*: GSetIterBackwardIsFirst, \
+  GSetArrIterForward*: GSetArrIterForwardIsFirst, \
+  const GSetArrIterForward*: GSetArrIterForwardIsFirst, \
+  GSetArrIterBackward*: GSetArrIterBackwardIsFirst, \
+  const GSetArrIterBackward*: GSetArrIterBackwardIsFirst, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterIsLast(Iter) _Generic(Iter, \
@@ -2668,6 +4208,10 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetIterForward*: GSetIterForwardIsLast, \
   GSetIterBackward*: GSetIterBackwardIsLast, \
   const GSetIterBackward*: GSetIterBackwardIsLast, \
+  GSetArrIterForward*: GSetArrIterForwardIsLast, \
+  const GSetArrIterForward*: GSetArrIterForwardIsLast, \
+  GSetArrIterBackward*: GSetArrIterBackwardIsLast, \
+  const GSetArrIterBackward*: GSetArrIterBackwardIsLast, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterGet(Iter) _Generic(Iter, \
@@ -2675,6 +4219,10 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetIterForward*: GSetIterForwardGet, \
   GSetIterBackward*: GSetIterBackwardGet, \
   const GSetIterBackward*: GSetIterBackwardGet, \
+  GSetArrIterForward*: GSetArrIterForwardGet, \
+  const GSetArrIterForward*: GSetArrIterForwardGet, \
+  GSetArrIterBackward*: GSetArrIterBackwardGet, \
+  const GSetArrIterBackward*: GSetArrIterBackwardGet, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterSetData(Iter, Data) _Generic(Iter, \
@@ -2682,6 +4230,10 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetIterForward*: GSetIterForwardSetData, \
   GSetIterBackward*: GSetIterBackwardSetData, \
   const GSetIterBackward*: GSetIterBackwardSetData, \
+  GSetArrIterForward*: GSetArrIterForwardSetData, \
+  const GSetArrIterForward*: GSetArrIterForwardSetData, \
+  GSetArrIterBackward*: GSetArrIterBackwardSetData, \
+  const GSetArrIterBackward*: GSetArrIterBackwardSetData, \
   default: PBErrInvalidPolymorphism)(Iter, Data)
 
 #define GSetIterGetElem(Iter) _Generic(Iter, \
@@ -2696,11 +4248,17 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   const GSetIterForward*: GSetIterForwardGetSortVal, \
   GSetIterBackward*: GSetIterBackwardGetSortVal, \
   const GSetIterBackward*: GSetIterBackwardGetSortVal, \
+  GSetArrIterForward*: GSetArrIterForwardGetSortVal, \
+  const GSetArrIterForward*: GSetArrIterForwardGetSortVal, \
+  GSetArrIterBackward*: GSetArrIterBackwardGetSortVal, \
+  const GSetArrIterBackward*: GSetArrIterBackwardGetSortVal, \
   default: PBErrInvalidPolymorphism)(Iter)
 
 #define GSetIterSetSortVal(Iter, Val) _Generic(Iter, \
   GSetIterForward*: GSetIterForwardSetSortVal, \
   GSetIterBackward*: GSetIterBackwardSetSortVal, \
+  GSetArrIterForward*: GSetArrIterForwardSetSortVal, \
+  GSetArrIterBackward*: GSetArrIterBackwardSetSortVal, \
   default: PBErrInvalidPolymorphism)(Iter, Val)
 
 #define GSetIterRemoveElem(Iter) _Generic(Iter, \
@@ -2708,6 +4266,864 @@ static inline SquadRunningTask* _GSetSquadRunningTaskRemoveElem(
   GSetIterBackward*: GSetIterBackwardRemoveElem, \
   default: PBErrInvalidPolymorphism)(Iter)
 
+// ================= Generic GSetArr functions ==================
+
+#define GSetArrFree(Set) _Generic(Set, \
+  GSetArr**: _GSetArrFree, \
+  GSetArrVecFloat**: _GSetArrFree, \
+  GSetArrVecShort**: _GSetArrFree, \
+  GSetArrPBPhysParticle**: _GSetArrFree, \
+  GSetArrGenTree**: _GSetArrFree, \
+  GSetArrStr**: _GSetArrFree, \
+  default: PBErrInvalidPolymorphism)((GSetArr**)(Set))
+
+#define GSetArrPush(Set, Data) _Generic(Set, \
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrPush), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrPush, \
+    VecFloat2D*: _GSetArrPush, \
+    VecFloat3D*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrPush, \
+    VecShort2D*: _GSetArrPush, \
+    VecShort3D*: _GSetArrPush, \
+    VecShort4D*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrPush, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), (void*)(Data))
+
+#define GSetArrAppend(Set, Data) _Generic(Set, \
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrAppend), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrAppend, \
+    VecFloat2D*: _GSetArrAppend, \
+    VecFloat3D*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrAppend, \
+    VecShort2D*: _GSetArrAppend, \
+    VecShort3D*: _GSetArrAppend, \
+    VecShort4D*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrAppend, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), (void*)(Data))
+
+#define GSetArrAddSort(Set, Data, Value) _Generic(Set, \
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrAddSort), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrAddSort, \
+    VecFloat2D*: _GSetArrAddSort, \
+    VecFloat3D*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrAddSort, \
+    VecShort2D*: _GSetArrAddSort, \
+    VecShort3D*: _GSetArrAddSort, \
+    VecShort4D*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrAddSort, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), (void*)(Data), Value)
+
+#define GSetArrInsert(Set, Data, Pos) _Generic(Set, \
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrInsert), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrInsert, \
+    VecFloat2D*: _GSetArrInsert, \
+    VecFloat3D*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrInsert, \
+    VecShort2D*: _GSetArrInsert, \
+    VecShort3D*: _GSetArrInsert, \
+    VecShort4D*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrInsert, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), (void*)(Data), Pos)
+
+#define GSetArrSet(Set, Pos, Data) _Generic(Set, \
+  GSetArr*: _Generic(Data, \
+    default: _GSetArrSet), \
+  GSetArrVecFloat*: _Generic(Data, \
+    VecFloat*: _GSetArrSet, \
+    VecFloat2D*: _GSetArrSet, \
+    VecFloat3D*: _GSetArrSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(Data, \
+    VecShort*: _GSetArrSet, \
+    VecShort2D*: _GSetArrSet, \
+    VecShort3D*: _GSetArrSet, \
+    VecShort4D*: _GSetArrSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(Data, \
+    PBPhysParticle*: _GSetArrSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(Data, \
+    GenTree*: _GSetArrSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(Data, \
+    char*: _GSetArrSet, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Pos, (void*)(Data))
+
+#define GSetArrRemoveFirst(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrRemoveFirst, \
+  GSetArrVecFloat*: _GSetArrRemoveFirst, \
+  GSetArrVecShort*: _GSetArrRemoveFirst, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveFirst, \
+  GSetArrGenTree*: _GSetArrRemoveFirst, \
+  GSetArrStr*: _GSetArrRemoveFirst, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Data)
+
+#define GSetArrRemoveLast(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrRemoveLast, \
+  GSetArrVecFloat*: _GSetArrRemoveLast, \
+  GSetArrVecShort*: _GSetArrRemoveLast, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveLast, \
+  GSetArrGenTree*: _GSetArrRemoveLast, \
+  GSetArrStr*: _GSetArrRemoveLast, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Data)
+
+#define GSetArrRemoveAll(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrRemoveAll, \
+  GSetArrVecFloat*: _GSetArrRemoveAll, \
+  GSetArrVecShort*: _GSetArrRemoveAll, \
+  GSetArrPBPhysParticle*: _GSetArrRemoveAll, \
+  GSetArrGenTree*: _GSetArrRemoveAll, \
+  GSetArrStr*: _GSetArrRemoveAll, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Data)
+
+#define GSetArrFlush(Set) _Generic(Set, \
+  GSetArr*: _GSetArrFlush, \
+  GSetArrVecFloat*: _GSetArrFlush, \
+  GSetArrVecShort*: _GSetArrFlush, \
+  GSetArrPBPhysParticle*: _GSetArrFlush, \
+  GSetArrGenTree*: _GSetArrFlush, \
+  GSetArrStr*: _GSetArrFlush, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrNbElem(Set) _Generic(Set, \
+  GSetArr*: _GSetArrNbElem, \
+  const GSetArr*: _GSetArrNbElem, \
+  GSetArrVecFloat*: _GSetArrNbElem, \
+  const GSetArrVecFloat*: _GSetArrNbElem, \
+  GSetArrVecShort*: _GSetArrNbElem, \
+  const GSetArrVecShort*: _GSetArrNbElem, \
+  GSetArrPBPhysParticle*: _GSetArrNbElem, \
+  const GSetArrPBPhysParticle*: _GSetArrNbElem, \
+  GSetArrGenTree*: _GSetArrNbElem, \
+  const GSetArrGenTree*: _GSetArrNbElem, \
+  GSetArrStr*: _GSetArrNbElem, \
+  const GSetArrStr*: _GSetArrNbElem, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set))
+
+#define GSetArrReserve(Set, Nb) _Generic(Set, \
+  GSetArr*: _GSetArrReserve, \
+  GSetArrVecFloat*: _GSetArrReserve, \
+  GSetArrVecShort*: _GSetArrReserve, \
+  GSetArrPBPhysParticle*: _GSetArrReserve, \
+  GSetArrGenTree*: _GSetArrReserve, \
+  GSetArrStr*: _GSetArrReserve, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Nb)
+
+#define GSetArrPrint(Set, Stream, Fun, Sep) _Generic(Set, \
+  GSetArr*: _GSetArrPrint, \
+  const GSetArr*: _GSetArrPrint, \
+  GSetArrVecFloat*: _GSetArrPrint, \
+  const GSetArrVecFloat*: _GSetArrPrint, \
+  GSetArrVecShort*: _GSetArrPrint, \
+  const GSetArrVecShort*: _GSetArrPrint, \
+  GSetArrPBPhysParticle*: _GSetArrPrint, \
+  const GSetArrPBPhysParticle*: _GSetArrPrint, \
+  GSetArrGenTree*: _GSetArrPrint, \
+  const GSetArrGenTree*: _GSetArrPrint, \
+  GSetArrStr*: _GSetArrPrint, \
+  const GSetArrStr*: _GSetArrPrint, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Stream, Fun, Sep)
+
+#define GSetArrPop(Set) _Generic(Set, \
+  GSetArr*: _GSetArrPop, \
+  GSetArrVecFloat*: _GSetArrVecFloatPop, \
+  GSetArrVecShort*: _GSetArrVecShortPop, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticlePop, \
+  GSetArrGenTree*: _GSetArrGenTreePop, \
+  GSetArrStr*: _GSetArrStrPop, \
+  default: PBErrInvalidPolymorphism)(Set)
+
+#define GSetArrDrop(Set) _Generic(Set, \
+  GSetArr*: _GSetArrDrop, \
+  GSetArrVecFloat*: _GSetArrVecFloatDrop, \
+  GSetArrVecShort*: _GSetArrVecShortDrop, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleDrop, \
+  GSetArrGenTree*: _GSetArrGenTreeDrop, \
+  GSetArrStr*: _GSetArrStrDrop, \
+  default: PBErrInvalidPolymorphism)(Set)
+
+#define GSetArrRemove(Set, Pos) _Generic(Set, \
+  GSetArr*: _GSetArrRemove, \
+  GSetArrVecFloat*: _GSetArrVecFloatRemove, \
+  GSetArrVecShort*: _GSetArrVecShortRemove, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleRemove, \
+  GSetArrGenTree*: _GSetArrGenTreeRemove, \
+  GSetArrStr*: _GSetArrStrRemove, \
+  default: PBErrInvalidPolymorphism)(Set, Pos)
+
+#define GSetArrGet(Set, Pos) _Generic(Set, \
+  GSetArr*: _GSetArrGet, \
+  const GSetArr*: _GSetArrGet, \
+  GSetArrVecFloat*: _GSetArrVecFloatGet, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGet, \
+  GSetArrVecShort*: _GSetArrVecShortGet, \
+  const GSetArrVecShort*: _GSetArrVecShortGet, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGet, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGet, \
+  GSetArrGenTree*: _GSetArrGenTreeGet, \
+  const GSetArrGenTree*: _GSetArrGenTreeGet, \
+  GSetArrStr*: _GSetArrStrGet, \
+  const GSetArrStr*: _GSetArrStrGet, \
+  default: PBErrInvalidPolymorphism)(Set, Pos)
+
+#define GSetArrHead(Set) _Generic(Set, \
+  GSetArr*: _GSetArrHead, \
+  const GSetArr*: _GSetArrHead, \
+  GSetArrVecFloat*: _GSetArrVecFloatGetHead, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGetHead, \
+  GSetArrVecShort*: _GSetArrVecShortGetHead, \
+  const GSetArrVecShort*: _GSetArrVecShortGetHead, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetHead, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetHead, \
+  GSetArrGenTree*: _GSetArrGenTreeGetHead, \
+  const GSetArrGenTree*: _GSetArrGenTreeGetHead, \
+  GSetArrStr*: _GSetArrStrGetHead, \
+  const GSetArrStr*: _GSetArrStrGetHead, \
+  default: PBErrInvalidPolymorphism)(Set)
+
+#define GSetArrTail(Set) _Generic(Set, \
+  GSetArr*: _GSetArrTail, \
+  const GSetArr*: _GSetArrTail, \
+  GSetArrVecFloat*: _GSetArrVecFloatGetTail, \
+  const GSetArrVecFloat*: _GSetArrVecFloatGetTail, \
+  GSetArrVecShort*: _GSetArrVecShortGetTail, \
+  const GSetArrVecShort*: _GSetArrVecShortGetTail, \
+  GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetTail, \
+  const GSetArrPBPhysParticle*: _GSetArrPBPhysParticleGetTail, \
+  GSetArrGenTree*: _GSetArrGenTreeGetTail, \
+  const GSetArrGenTree*: _GSetArrGenTreeGetTail, \
+  GSetArrStr*: _GSetArrStrGetTail, \
+  const GSetArrStr*: _GSetArrStrGetTail, \
+  default: PBErrInvalidPolymorphism)(Set)
+
+#define GSetArrElement(Set, Pos) _Generic(Set, \
+  GSetArr*: _GSetArrElement, \
+  const GSetArr*: _GSetArrElement, \
+  GSetArrVecFloat*: _GSetArrElement, \
+  const GSetArrVecFloat*: _GSetArrElement, \
+  GSetArrVecShort*: _GSetArrElement, \
+  const GSetArrVecShort*: _GSetArrElement, \
+  GSetArrPBPhysParticle*: _GSetArrElement, \
+  const GSetArrPBPhysParticle*: _GSetArrElement, \
+  GSetArrGenTree*: _GSetArrElement, \
+  const GSetArrGenTree*: _GSetArrElement, \
+  GSetArrStr*: _GSetArrElement, \
+  const GSetArrStr*: _GSetArrElement, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Pos)
+
+#define GSetArrGetSortVal(Set, Pos) _Generic(Set, \
+  GSetArr*: _GSetArrGetSortVal, \
+  const GSetArr*: _GSetArrGetSortVal, \
+  GSetArrVecFloat*: _GSetArrGetSortVal, \
+  const GSetArrVecFloat*: _GSetArrGetSortVal, \
+  GSetArrVecShort*: _GSetArrGetSortVal, \
+  const GSetArrVecShort*: _GSetArrGetSortVal, \
+  GSetArrPBPhysParticle*: _GSetArrGetSortVal, \
+  const GSetArrPBPhysParticle*: _GSetArrGetSortVal, \
+  GSetArrGenTree*: _GSetArrGetSortVal, \
+  const GSetArrGenTree*: _GSetArrGetSortVal, \
+  GSetArrStr*: _GSetArrGetSortVal, \
+  const GSetArrStr*: _GSetArrGetSortVal, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Pos)
+
+#define GSetArrSetSortVal(Set, Pos, Val) _Generic(Set, \
+  GSetArr*: _GSetArrSetSortVal, \
+  GSetArrVecFloat*: _GSetArrSetSortVal, \
+  GSetArrVecShort*: _GSetArrSetSortVal, \
+  GSetArrPBPhysParticle*: _GSetArrSetSortVal, \
+  GSetArrGenTree*: _GSetArrSetSortVal, \
+  GSetArrStr*: _GSetArrSetSortVal, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), Pos, Val)
+
+#define GSetArrGetIndexFirst(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrGetIndexFirst, \
+  const GSetArr*: _GSetArrGetIndexFirst, \
+  GSetArrVecFloat*: _GSetArrGetIndexFirst, \
+  const GSetArrVecFloat*: _GSetArrGetIndexFirst, \
+  GSetArrVecShort*: _GSetArrGetIndexFirst, \
+  const GSetArrVecShort*: _GSetArrGetIndexFirst, \
+  GSetArrPBPhysParticle*: _GSetArrGetIndexFirst, \
+  const GSetArrPBPhysParticle*: _GSetArrGetIndexFirst, \
+  GSetArrGenTree*: _GSetArrGetIndexFirst, \
+  const GSetArrGenTree*: _GSetArrGetIndexFirst, \
+  GSetArrStr*: _GSetArrGetIndexFirst, \
+  const GSetArrStr*: _GSetArrGetIndexFirst, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Data)
+
+#define GSetArrGetIndexLast(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrGetIndexLast, \
+  const GSetArr*: _GSetArrGetIndexLast, \
+  GSetArrVecFloat*: _GSetArrGetIndexLast, \
+  const GSetArrVecFloat*: _GSetArrGetIndexLast, \
+  GSetArrVecShort*: _GSetArrGetIndexLast, \
+  const GSetArrVecShort*: _GSetArrGetIndexLast, \
+  GSetArrPBPhysParticle*: _GSetArrGetIndexLast, \
+  const GSetArrPBPhysParticle*: _GSetArrGetIndexLast, \
+  GSetArrGenTree*: _GSetArrGetIndexLast, \
+  const GSetArrGenTree*: _GSetArrGetIndexLast, \
+  GSetArrStr*: _GSetArrGetIndexLast, \
+  const GSetArrStr*: _GSetArrGetIndexLast, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Data)
+
+#define GSetArrCount(Set, Data) _Generic(Set, \
+  GSetArr*: _GSetArrCount, \
+  const GSetArr*: _GSetArrCount, \
+  GSetArrVecFloat*: _GSetArrCount, \
+  const GSetArrVecFloat*: _GSetArrCount, \
+  GSetArrVecShort*: _GSetArrCount, \
+  const GSetArrVecShort*: _GSetArrCount, \
+  GSetArrPBPhysParticle*: _GSetArrCount, \
+  const GSetArrPBPhysParticle*: _GSetArrCount, \
+  GSetArrGenTree*: _GSetArrCount, \
+  const GSetArrGenTree*: _GSetArrCount, \
+  GSetArrStr*: _GSetArrCount, \
+  const GSetArrStr*: _GSetArrCount, \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), Data)
+
+#define GSetArrSort(Set) _Generic(Set, \
+  GSetArr*: _GSetArrSort, \
+  GSetArrVecFloat*: _GSetArrSort, \
+  GSetArrVecShort*: _GSetArrSort, \
+  GSetArrPBPhysParticle*: _GSetArrSort, \
+  GSetArrGenTree*: _GSetArrSort, \
+  GSetArrStr*: _GSetArrSort, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrSwitch(Set, PosA, PosB) _Generic(Set, \
+  GSetArr*: _GSetArrSwitch, \
+  GSetArrVecFloat*: _GSetArrSwitch, \
+  GSetArrVecShort*: _GSetArrSwitch, \
+  GSetArrPBPhysParticle*: _GSetArrSwitch, \
+  GSetArrGenTree*: _GSetArrSwitch, \
+  GSetArrStr*: _GSetArrSwitch, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set), PosA, PosB)
+
+#define GSetArrAppendSet(IntoSet, AppendSet) _Generic(IntoSet, \
+  GSetArr*: _Generic(AppendSet, \
+    GSetArr*: _GSetArrAppendSet, \
+    const GSetArr*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecFloat*: _Generic(AppendSet, \
+    GSetArrVecFloat*: _GSetArrAppendSet, \
+    const GSetArrVecFloat*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(AppendSet, \
+    GSetArrVecShort*: _GSetArrAppendSet, \
+    const GSetArrVecShort*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(AppendSet, \
+    GSetArrPBPhysParticle*: _GSetArrAppendSet, \
+    const GSetArrPBPhysParticle*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(AppendSet, \
+    GSetArrGenTree*: _GSetArrAppendSet, \
+    const GSetArrGenTree*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(AppendSet, \
+    GSetArrStr*: _GSetArrAppendSet, \
+    const GSetArrStr*: _GSetArrAppendSet, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(IntoSet), \
+  (const GSetArr*)(AppendSet))
+
+#define GSetArrAppendGSet(IntoSet, AppendSet) _Generic(IntoSet, \
+  GSetArr*: _Generic(AppendSet, \
+    GSet*: _GSetArrAppendGSet, \
+    const GSet*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecFloat*: _Generic(AppendSet, \
+    GSetVecFloat*: _GSetArrAppendGSet, \
+    const GSetVecFloat*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(AppendSet, \
+    GSetVecShort*: _GSetArrAppendGSet, \
+    const GSetVecShort*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(AppendSet, \
+    GSetPBPhysParticle*: _GSetArrAppendGSet, \
+    const GSetPBPhysParticle*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(AppendSet, \
+    GSetGenTree*: _GSetArrAppendGSet, \
+    const GSetGenTree*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(AppendSet, \
+    GSetStr*: _GSetArrAppendGSet, \
+    const GSetStr*: _GSetArrAppendGSet, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(IntoSet), \
+  (const GSet*)(AppendSet))
+
+#define GSetArrToGSet(Set, IntoSet) _Generic(Set, \
+  GSetArr*: _Generic(IntoSet, \
+    GSet*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArr*: _Generic(IntoSet, \
+    GSet*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecFloat*: _Generic(IntoSet, \
+    GSetVecFloat*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArrVecFloat*: _Generic(IntoSet, \
+    GSetVecFloat*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrVecShort*: _Generic(IntoSet, \
+    GSetVecShort*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArrVecShort*: _Generic(IntoSet, \
+    GSetVecShort*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrPBPhysParticle*: _Generic(IntoSet, \
+    GSetPBPhysParticle*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArrPBPhysParticle*: _Generic(IntoSet, \
+    GSetPBPhysParticle*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrGenTree*: _Generic(IntoSet, \
+    GSetGenTree*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArrGenTree*: _Generic(IntoSet, \
+    GSetGenTree*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  GSetArrStr*: _Generic(IntoSet, \
+    GSetStr*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  const GSetArrStr*: _Generic(IntoSet, \
+    GSetStr*: _GSetArrToGSet, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)((const GSetArr*)(Set), \
+  (GSet*)(IntoSet))
+
+#define GSetArrCreateFromGSet(Set) \
+  _GSetArrCreateFromGSet((const GSet*)(Set))
+
+#define GSetArrIterForwardCreate(Set) _Generic(Set, \
+  GSetArr*: _GSetArrIterForwardCreate, \
+  const GSetArr*: _GSetArrIterForwardCreate, \
+  GSetArrVecFloat*: _GSetArrIterForwardCreate, \
+  const GSetArrVecFloat*: _GSetArrIterForwardCreate, \
+  GSetArrVecShort*: _GSetArrIterForwardCreate, \
+  const GSetArrVecShort*: _GSetArrIterForwardCreate, \
+  GSetArrPBPhysParticle*: _GSetArrIterForwardCreate, \
+  const GSetArrPBPhysParticle*: _GSetArrIterForwardCreate, \
+  GSetArrGenTree*: _GSetArrIterForwardCreate, \
+  const GSetArrGenTree*: _GSetArrIterForwardCreate, \
+  GSetArrStr*: _GSetArrIterForwardCreate, \
+  const GSetArrStr*: _GSetArrIterForwardCreate, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrIterForwardCreateStatic(Set) _Generic(Set, \
+  GSetArr*: _GSetArrIterForwardCreateStatic, \
+  const GSetArr*: _GSetArrIterForwardCreateStatic, \
+  GSetArrVecFloat*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrVecFloat*: _GSetArrIterForwardCreateStatic, \
+  GSetArrVecShort*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrVecShort*: _GSetArrIterForwardCreateStatic, \
+  GSetArrPBPhysParticle*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrPBPhysParticle*: _GSetArrIterForwardCreateStatic, \
+  GSetArrGenTree*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrGenTree*: _GSetArrIterForwardCreateStatic, \
+  GSetArrStr*: _GSetArrIterForwardCreateStatic, \
+  const GSetArrStr*: _GSetArrIterForwardCreateStatic, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrIterBackwardCreate(Set) _Generic(Set, \
+  GSetArr*: _GSetArrIterBackwardCreate, \
+  const GSetArr*: _GSetArrIterBackwardCreate, \
+  GSetArrVecFloat*: _GSetArrIterBackwardCreate, \
+  const GSetArrVecFloat*: _GSetArrIterBackwardCreate, \
+  GSetArrVecShort*: _GSetArrIterBackwardCreate, \
+  const GSetArrVecShort*: _GSetArrIterBackwardCreate, \
+  GSetArrPBPhysParticle*: _GSetArrIterBackwardCreate, \
+  const GSetArrPBPhysParticle*: _GSetArrIterBackwardCreate, \
+  GSetArrGenTree*: _GSetArrIterBackwardCreate, \
+  const GSetArrGenTree*: _GSetArrIterBackwardCreate, \
+  GSetArrStr*: _GSetArrIterBackwardCreate, \
+  const GSetArrStr*: _GSetArrIterBackwardCreate, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrIterBackwardCreateStatic(Set) _Generic(Set, \
+  GSetArr*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArr*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrVecFloat*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrVecFloat*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrVecShort*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrVecShort*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrPBPhysParticle*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrPBPhysParticle*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrGenTree*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrGenTree*: _GSetArrIterBackwardCreateStatic, \
+  GSetArrStr*: _GSetArrIterBackwardCreateStatic, \
+  const GSetArrStr*: _GSetArrIterBackwardCreateStatic, \
+  default: PBErrInvalidPolymorphism)((GSetArr*)(Set))
+
+#define GSetArrIterFree(IterRef) _Generic(IterRef, \
+  GSetArrIterForward**: GSetArrIterForwardFree, \
+  GSetArrIterBackward**: GSetArrIterBackwardFree, \
+  default: PBErrInvalidPolymorphism)(IterRef)
+
+#define GSetArrIterReset(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardReset, \
+  GSetArrIterBackward*: GSetArrIterBackwardReset, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterStep(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardStep, \
+  GSetArrIterBackward*: GSetArrIterBackwardStep, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterStepBack(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardStepBack, \
+  GSetArrIterBackward*: GSetArrIterBackwardStepBack, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterApply(Iter, Fun, Param) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardApply, \
+  GSetArrIterBackward*: GSetArrIterBackwardApply, \
+  default: PBErrInvalidPolymorphism)(Iter, Fun, Param)
+
+#define GSetArrIterIsFirst(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardIsFirst, \
+  const GSetArrIterForward*: GSetArrIterForwardIsFirst, \
+  GSetArrIterBackward*: GSetArrIterBackwardIsFirst, \
+  const GSetArrIterBackward*: GSetArrIterBackwardIsFirst, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterIsLast(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardIsLast, \
+  const GSetArrIterForward*: GSetArrIterForwardIsLast, \
+  GSetArrIterBackward*: GSetArrIterBackwardIsLast, \
+  const GSetArrIterBackward*: GSetArrIterBackwardIsLast, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterGet(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardGet, \
+  const GSetArrIterForward*: GSetArrIterForwardGet, \
+  GSetArrIterBackward*: GSetArrIterBackwardGet, \
+  const GSetArrIterBackward*: GSetArrIterBackwardGet, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterSetData(Iter, Data) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardSetData, \
+  const GSetArrIterForward*: GSetArrIterForwardSetData, \
+  GSetArrIterBackward*: GSetArrIterBackwardSetData, \
+  const GSetArrIterBackward*: GSetArrIterBackwardSetData, \
+  default: PBErrInvalidPolymorphism)(Iter, Data)
+
+#define GSetArrIterGetSortVal(Iter) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardGetSortVal, \
+  const GSetArrIterForward*: GSetArrIterForwardGetSortVal, \
+  GSetArrIterBackward*: GSetArrIterBackwardGetSortVal, \
+  const GSetArrIterBackward*: GSetArrIterBackwardGetSortVal, \
+  default: PBErrInvalidPolymorphism)(Iter)
+
+#define GSetArrIterSetSortVal(Iter, Val) _Generic(Iter, \
+  GSetArrIterForward*: GSetArrIterForwardSetSortVal, \
+  GSetArrIterBackward*: GSetArrIterBackwardSetSortVal, \
+  default: PBErrInvalidPolymorphism)(Iter, Val)
+
+// ================= Generic GSetPool functions ==================
+
+#define GSetPushPool(Set, Data, Pool) _Generic(Set, \
+  GSet*: _GSetPushPool, \
+  GSetVecFloat*: _GSetPushPool, \
+  GSetVecShort*: _GSetPushPool, \
+  GSetBCurve*: _GSetPushPool, \
+  GSetSCurve*: _GSetPushPool, \
+  GSetShapoid*: _GSetPushPool, \
+  GSetKnapSackPod*: _GSetPushPool, \
+  GSetPBPhysParticle*: _GSetPushPool, \
+  GSetGenTree*: _GSetPushPool, \
+  GSetStr*: _GSetPushPool, \
+  GSetGenTreeStr*: _GSetPushPool, \
+  GSetSquidletInfo*: _GSetPushPool, \
+  GSetSquidletTaskRequest*: _GSetPushPool, \
+  GSetSquadRunningTask*: _GSetPushPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data), Pool)
+
+#define GSetAppendPool(Set, Data, Pool) _Generic(Set, \
+  GSet*: _GSetAppendPool, \
+  GSetVecFloat*: _GSetAppendPool, \
+  GSetVecShort*: _GSetAppendPool, \
+  GSetBCurve*: _GSetAppendPool, \
+  GSetSCurve*: _GSetAppendPool, \
+  GSetShapoid*: _GSetAppendPool, \
+  GSetKnapSackPod*: _GSetAppendPool, \
+  GSetPBPhysParticle*: _GSetAppendPool, \
+  GSetGenTree*: _GSetAppendPool, \
+  GSetStr*: _GSetAppendPool, \
+  GSetGenTreeStr*: _GSetAppendPool, \
+  GSetSquidletInfo*: _GSetAppendPool, \
+  GSetSquidletTaskRequest*: _GSetAppendPool, \
+  GSetSquadRunningTask*: _GSetAppendPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data), Pool)
+
+#define GSetAddSortPool(Set, Data, Value, Pool) _Generic(Set, \
+  GSet*: _GSetAddSortPool, \
+  GSetVecFloat*: _GSetAddSortPool, \
+  GSetVecShort*: _GSetAddSortPool, \
+  GSetBCurve*: _GSetAddSortPool, \
+  GSetSCurve*: _GSetAddSortPool, \
+  GSetShapoid*: _GSetAddSortPool, \
+  GSetKnapSackPod*: _GSetAddSortPool, \
+  GSetPBPhysParticle*: _GSetAddSortPool, \
+  GSetGenTree*: _GSetAddSortPool, \
+  GSetStr*: _GSetAddSortPool, \
+  GSetGenTreeStr*: _GSetAddSortPool, \
+  GSetSquidletInfo*: _GSetAddSortPool, \
+  GSetSquidletTaskRequest*: _GSetAddSortPool, \
+  GSetSquadRunningTask*: _GSetAddSortPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), (void*)(Data), Value, Pool)
+
+#define GSetPopPool(Set, Pool) _Generic(Set, \
+  GSet*: _GSetPopPool, \
+  GSetVecFloat*: _GSetPopPool, \
+  GSetVecShort*: _GSetPopPool, \
+  GSetBCurve*: _GSetPopPool, \
+  GSetSCurve*: _GSetPopPool, \
+  GSetShapoid*: _GSetPopPool, \
+  GSetKnapSackPod*: _GSetPopPool, \
+  GSetPBPhysParticle*: _GSetPopPool, \
+  GSetGenTree*: _GSetPopPool, \
+  GSetStr*: _GSetPopPool, \
+  GSetGenTreeStr*: _GSetPopPool, \
+  GSetSquidletInfo*: _GSetPopPool, \
+  GSetSquidletTaskRequest*: _GSetPopPool, \
+  GSetSquadRunningTask*: _GSetPopPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Pool)
+
+#define GSetDropPool(Set, Pool) _Generic(Set, \
+  GSet*: _GSetDropPool, \
+  GSetVecFloat*: _GSetDropPool, \
+  GSetVecShort*: _GSetDropPool, \
+  GSetBCurve*: _GSetDropPool, \
+  GSetSCurve*: _GSetDropPool, \
+  GSetShapoid*: _GSetDropPool, \
+  GSetKnapSackPod*: _GSetDropPool, \
+  GSetPBPhysParticle*: _GSetDropPool, \
+  GSetGenTree*: _GSetDropPool, \
+  GSetStr*: _GSetDropPool, \
+  GSetGenTreeStr*: _GSetDropPool, \
+  GSetSquidletInfo*: _GSetDropPool, \
+  GSetSquidletTaskRequest*: _GSetDropPool, \
+  GSetSquadRunningTask*: _GSetDropPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Pool)
+
+#define GSetRemoveElemPool(Set, Elem, Pool) _Generic(Set, \
+  GSet*: _GSetRemoveElemPool, \
+  GSetVecFloat*: _GSetRemoveElemPool, \
+  GSetVecShort*: _GSetRemoveElemPool, \
+  GSetBCurve*: _GSetRemoveElemPool, \
+  GSetSCurve*: _GSetRemoveElemPool, \
+  GSetShapoid*: _GSetRemoveElemPool, \
+  GSetKnapSackPod*: _GSetRemoveElemPool, \
+  GSetPBPhysParticle*: _GSetRemoveElemPool, \
+  GSetGenTree*: _GSetRemoveElemPool, \
+  GSetStr*: _GSetRemoveElemPool, \
+  GSetGenTreeStr*: _GSetRemoveElemPool, \
+  GSetSquidletInfo*: _GSetRemoveElemPool, \
+  GSetSquidletTaskRequest*: _GSetRemoveElemPool, \
+  GSetSquadRunningTask*: _GSetRemoveElemPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Elem, Pool)
+
+#define GSetFlushPool(Set, Pool) _Generic(Set, \
+  GSet*: _GSetFlushPool, \
+  GSetVecFloat*: _GSetFlushPool, \
+  GSetVecShort*: _GSetFlushPool, \
+  GSetBCurve*: _GSetFlushPool, \
+  GSetSCurve*: _GSetFlushPool, \
+  GSetShapoid*: _GSetFlushPool, \
+  GSetKnapSackPod*: _GSetFlushPool, \
+  GSetPBPhysParticle*: _GSetFlushPool, \
+  GSetGenTree*: _GSetFlushPool, \
+  GSetStr*: _GSetFlushPool, \
+  GSetGenTreeStr*: _GSetFlushPool, \
+  GSetSquidletInfo*: _GSetFlushPool, \
+  GSetSquidletTaskRequest*: _GSetFlushPool, \
+  GSetSquadRunningTask*: _GSetFlushPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Pool)
+
+// ================= Generic GSet parallel functions ==================
+
+#define GSetApplyParallel(Set, Fun, Param, NbThread) _Generic(Set, \
+  GSet*: _GSetApplyParallel, \
+  const GSet*: _GSetApplyParallel, \
+  GSetVecFloat*: _GSetApplyParallel, \
+  const GSetVecFloat*: _GSetApplyParallel, \
+  GSetVecShort*: _GSetApplyParallel, \
+  const GSetVecShort*: _GSetApplyParallel, \
+  GSetBCurve*: _GSetApplyParallel, \
+  const GSetBCurve*: _GSetApplyParallel, \
+  GSetSCurve*: _GSetApplyParallel, \
+  const GSetSCurve*: _GSetApplyParallel, \
+  GSetShapoid*: _GSetApplyParallel, \
+  const GSetShapoid*: _GSetApplyParallel, \
+  GSetKnapSackPod*: _GSetApplyParallel, \
+  const GSetKnapSackPod*: _GSetApplyParallel, \
+  GSetPBPhysParticle*: _GSetApplyParallel, \
+  const GSetPBPhysParticle*: _GSetApplyParallel, \
+  GSetGenTree*: _GSetApplyParallel, \
+  const GSetGenTree*: _GSetApplyParallel, \
+  GSetStr*: _GSetApplyParallel, \
+  const GSetStr*: _GSetApplyParallel, \
+  GSetGenTreeStr*: _GSetApplyParallel, \
+  const GSetGenTreeStr*: _GSetApplyParallel, \
+  GSetSquidletInfo*: _GSetApplyParallel, \
+  const GSetSquidletInfo*: _GSetApplyParallel, \
+  GSetSquidletTaskRequest*: _GSetApplyParallel, \
+  const GSetSquidletTaskRequest*: _GSetApplyParallel, \
+  GSetSquadRunningTask*: _GSetApplyParallel, \
+  const GSetSquadRunningTask*: _GSetApplyParallel, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Fun, Param, NbThread)
+
+#define GSetReduceParallel(Set, Fun, Merge, Acc, Param, NbThread) _Generic(Set, \
+  GSet*: _GSetReduceParallel, \
+  const GSet*: _GSetReduceParallel, \
+  GSetVecFloat*: _GSetReduceParallel, \
+  const GSetVecFloat*: _GSetReduceParallel, \
+  GSetVecShort*: _GSetReduceParallel, \
+  const GSetVecShort*: _GSetReduceParallel, \
+  GSetBCurve*: _GSetReduceParallel, \
+  const GSetBCurve*: _GSetReduceParallel, \
+  GSetSCurve*: _GSetReduceParallel, \
+  const GSetSCurve*: _GSetReduceParallel, \
+  GSetShapoid*: _GSetReduceParallel, \
+  const GSetShapoid*: _GSetReduceParallel, \
+  GSetKnapSackPod*: _GSetReduceParallel, \
+  const GSetKnapSackPod*: _GSetReduceParallel, \
+  GSetPBPhysParticle*: _GSetReduceParallel, \
+  const GSetPBPhysParticle*: _GSetReduceParallel, \
+  GSetGenTree*: _GSetReduceParallel, \
+  const GSetGenTree*: _GSetReduceParallel, \
+  GSetStr*: _GSetReduceParallel, \
+  const GSetStr*: _GSetReduceParallel, \
+  GSetGenTreeStr*: _GSetReduceParallel, \
+  const GSetGenTreeStr*: _GSetReduceParallel, \
+  GSetSquidletInfo*: _GSetReduceParallel, \
+  const GSetSquidletInfo*: _GSetReduceParallel, \
+  GSetSquidletTaskRequest*: _GSetReduceParallel, \
+  const GSetSquidletTaskRequest*: _GSetReduceParallel, \
+  GSetSquadRunningTask*: _GSetReduceParallel, \
+  const GSetSquadRunningTask*: _GSetReduceParallel, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Fun, Merge, \
+    Acc, sizeof(*(Acc)), Param, NbThread)
+
+#define GSetApplyThreadPool(Set, Fun, Param, Pool) _Generic(Set, \
+  GSet*: _GSetApplyThreadPool, \
+  const GSet*: _GSetApplyThreadPool, \
+  GSetVecFloat*: _GSetApplyThreadPool, \
+  const GSetVecFloat*: _GSetApplyThreadPool, \
+  GSetVecShort*: _GSetApplyThreadPool, \
+  const GSetVecShort*: _GSetApplyThreadPool, \
+  GSetBCurve*: _GSetApplyThreadPool, \
+  const GSetBCurve*: _GSetApplyThreadPool, \
+  GSetSCurve*: _GSetApplyThreadPool, \
+  const GSetSCurve*: _GSetApplyThreadPool, \
+  GSetShapoid*: _GSetApplyThreadPool, \
+  const GSetShapoid*: _GSetApplyThreadPool, \
+  GSetKnapSackPod*: _GSetApplyThreadPool, \
+  const GSetKnapSackPod*: _GSetApplyThreadPool, \
+  GSetPBPhysParticle*: _GSetApplyThreadPool, \
+  const GSetPBPhysParticle*: _GSetApplyThreadPool, \
+  GSetGenTree*: _GSetApplyThreadPool, \
+  const GSetGenTree*: _GSetApplyThreadPool, \
+  GSetStr*: _GSetApplyThreadPool, \
+  const GSetStr*: _GSetApplyThreadPool, \
+  GSetGenTreeStr*: _GSetApplyThreadPool, \
+  const GSetGenTreeStr*: _GSetApplyThreadPool, \
+  GSetSquidletInfo*: _GSetApplyThreadPool, \
+  const GSetSquidletInfo*: _GSetApplyThreadPool, \
+  GSetSquidletTaskRequest*: _GSetApplyThreadPool, \
+  const GSetSquidletTaskRequest*: _GSetApplyThreadPool, \
+  GSetSquadRunningTask*: _GSetApplyThreadPool, \
+  const GSetSquadRunningTask*: _GSetApplyThreadPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Fun, Param, Pool)
+
+#define GSetReduceThreadPool(Set, Fun, Merge, Acc, Param, Pool) _Generic(Set, \
+  GSet*: _GSetReduceThreadPool, \
+  const GSet*: _GSetReduceThreadPool, \
+  GSetVecFloat*: _GSetReduceThreadPool, \
+  const GSetVecFloat*: _GSetReduceThreadPool, \
+  GSetVecShort*: _GSetReduceThreadPool, \
+  const GSetVecShort*: _GSetReduceThreadPool, \
+  GSetBCurve*: _GSetReduceThreadPool, \
+  const GSetBCurve*: _GSetReduceThreadPool, \
+  GSetSCurve*: _GSetReduceThreadPool, \
+  const GSetSCurve*: _GSetReduceThreadPool, \
+  GSetShapoid*: _GSetReduceThreadPool, \
+  const GSetShapoid*: _GSetReduceThreadPool, \
+  GSetKnapSackPod*: _GSetReduceThreadPool, \
+  const GSetKnapSackPod*: _GSetReduceThreadPool, \
+  GSetPBPhysParticle*: _GSetReduceThreadPool, \
+  const GSetPBPhysParticle*: _GSetReduceThreadPool, \
+  GSetGenTree*: _GSetReduceThreadPool, \
+  const GSetGenTree*: _GSetReduceThreadPool, \
+  GSetStr*: _GSetReduceThreadPool, \
+  const GSetStr*: _GSetReduceThreadPool, \
+  GSetGenTreeStr*: _GSetReduceThreadPool, \
+  const GSetGenTreeStr*: _GSetReduceThreadPool, \
+  GSetSquidletInfo*: _GSetReduceThreadPool, \
+  const GSetSquidletInfo*: _GSetReduceThreadPool, \
+  GSetSquidletTaskRequest*: _GSetReduceThreadPool, \
+  const GSetSquidletTaskRequest*: _GSetReduceThreadPool, \
+  GSetSquadRunningTask*: _GSetReduceThreadPool, \
+  const GSetSquadRunningTask*: _GSetReduceThreadPool, \
+  default: PBErrInvalidPolymorphism)((void*)(Set), Fun, Merge, \
+    Acc, sizeof(*(Acc)), Param, Pool)
+
 // ================ static inliner ====================
 
 #if BUILDMODE != 0
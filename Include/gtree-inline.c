@@ -116,6 +116,127 @@ bool _GenTreeIsLastBrother(const GenTree* const that) {
   }
 }
 
+// Create a new GenTree with user data 'data', allocated from the 
+// GSetPool 'pool' (which must deliver blocks of at least 
+// sizeof(GenTree) bytes)
+// A pooled GenTree must be modified only with the *Pool functions and 
+// freed with GenTreeFreePool
+#if BUILDMODE != 0
+static inline
+#endif
+GenTree* GenTreeCreateDataPool(void* const data, GSetPool* const pool) {
+#if BUILDMODE == 0
+  if (pool == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'pool' is null");
+    PBErrCatch(GenTreeErr);
+  }
+  if (GSetPoolGetBlockSize(pool) < sizeof(GenTree)) {
+    GenTreeErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenTreeErr->_msg, "'pool' blocks are too small (%lu<%lu)", 
+      (unsigned long)GSetPoolGetBlockSize(pool), 
+      (unsigned long)sizeof(GenTree));
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTree* that = GSetPoolAlloc(pool);
+  that->_parent = NULL;
+  that->_subtrees = GSetGenTreeCreateStatic();
+  that->_data = data;
+  return that;
+}
+
+// Append a new node with user data 'data' to the subtrees of the 
+// pooled GenTree 'that'. The node is allocated from 'treePool' and 
+// its element in the set of subtrees from 'elemPool'
+// Return the new node
+#if BUILDMODE != 0
+static inline
+#endif
+GenTree* _GenTreeAppendDataPool(GenTree* const that, void* const data, 
+  GSetPool* const treePool, GSetPool* const elemPool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTree* tree = GenTreeCreateDataPool(data, treePool);
+  GSetAppendPool(_GenTreeSubtrees(that), tree, elemPool);
+  tree->_parent = that;
+  return tree;
+}
+
+// Count the nodes of the GenTree 'that' (including 'that')
+static inline long GenTreeCountNodes(const GenTree* const that) {
+  long nb = 1;
+  for (const GSetElem* e = that->_subtrees._set._head; e != NULL; 
+    e = e->_next)
+    nb += GenTreeCountNodes((const GenTree*)(e->_data));
+  return nb;
+}
+
+// Give back the nodes and elements of the pooled GenTree 'that' to 
+// 'treePool' and 'elemPool'
+static inline void GenTreeReleasePool(GenTree* const that, 
+  GSetPool* const treePool, GSetPool* const elemPool) {
+  GSetElem* e = that->_subtrees._set._head;
+  while (e != NULL) {
+    GSetElem* next = e->_next;
+    GenTreeReleasePool((GenTree*)(e->_data), treePool, elemPool);
+    GSetPoolRelease(elemPool, e);
+    e = next;
+  }
+  GSetPoolRelease(treePool, that);
+}
+
+// Free the memory used by the pooled GenTree 'that'
+// If 'that' is not a root node it is cut prior to be freed
+// Subtrees are recursively freed
+// If all the blocks in use in 'treePool' and 'elemPool' belong to 
+// 'that', the pools are flushed in one call each, else the nodes and 
+// elements are given back one by one to the pools
+// User data must be freed by the user
+#if BUILDMODE != 0
+static inline
+#endif
+void _GenTreeFreePool(GenTree** that, GSetPool* const treePool, 
+  GSetPool* const elemPool) {
+  if (that == NULL || *that == NULL) return;
+#if BUILDMODE == 0
+  if (treePool == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'treePool' is null");
+    PBErrCatch(GenTreeErr);
+  }
+  if (elemPool == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'elemPool' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  // Cut the tree from its parent
+  GenTree* parent = (*that)->_parent;
+  if (parent != NULL) {
+    GSetElem* e = (GSetElem*)GSetFirstElem(_GenTreeSubtrees(parent), *that);
+    if (e != NULL)
+      GSetRemoveElemPool(_GenTreeSubtrees(parent), &e, elemPool);
+    (*that)->_parent = NULL;
+  }
+  // If the pools are used only by this tree, release them in one call
+  long nbNode = GenTreeCountNodes(*that);
+  if (GSetPoolGetNbUsed(treePool) == nbNode && 
+    GSetPoolGetNbUsed(elemPool) == nbNode - 1) {
+    GSetPoolFlush(treePool);
+    GSetPoolFlush(elemPool);
+  // Else give back the nodes one by one
+  } else {
+    GenTreeReleasePool(*that, treePool, elemPool);
+  }
+  *that = NULL;
+}
+
 // ----------- GenTreeIter
 
 // ================ Functions declaration ====================
@@ -417,3 +538,469 @@ GSetGenTree* _GenTreeIterSeq(const GenTreeIter* const that) {
   return (GSetGenTree*)&(that->_seq);
 }
 
+
+// ----------- GenTreeIterLazyDepth, GenTreeIterLazyBreadth
+
+// Return a copy of the 'nb' slots of the circular array 'slots' of 
+// 'capacity' slots starting at 'first' into a new array of 
+// 'newCapacity' slots starting at 0, and free 'slots'
+static inline GSetElem** GenTreeIterLazyRealloc(GSetElem** const slots,
+  const long first, const long nb, const long capacity, 
+  const long newCapacity) {
+  GSetElem** ret = PBErrMalloc(GenTreeErr, 
+    sizeof(GSetElem*) * newCapacity);
+  for (long iSlot = 0; iSlot < nb; ++iSlot)
+    ret[iSlot] = slots[(first + iSlot) % capacity];
+  free(slots);
+  return ret;
+}
+
+// Create a new GenTreeIterLazyDepth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyDepth* GenTreeIterLazyDepthCreate(GenTree* const tree) {
+  GenTreeIterLazyDepth* that = 
+    PBErrMalloc(GenTreeErr, sizeof(GenTreeIterLazyDepth));
+  *that = GenTreeIterLazyDepthCreateStatic(tree);
+  return that;
+}
+
+// Create a new static GenTreeIterLazyDepth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyDepth GenTreeIterLazyDepthCreateStatic(
+  GenTree* const tree) {
+#if BUILDMODE == 0
+  if (tree == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'tree' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTreeIterLazyDepth that = {._tree = tree, ._depth = 0, 
+    ._capacity = GENTREEITERLAZY_INITCAPACITY};
+  that._stack = PBErrMalloc(GenTreeErr, 
+    sizeof(GSetElem*) * that._capacity);
+  GenTreeIterLazyDepthReset(&that);
+  return that;
+}
+
+// Free the memory used by the iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthFree(GenTreeIterLazyDepth** that) {
+  if (that == NULL || *that == NULL) return;
+  GenTreeIterLazyDepthFreeStatic(*that);
+  free(*that);
+  *that = NULL;
+}
+
+// Free the memory used by the static iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthFreeStatic(GenTreeIterLazyDepth* const that) {
+  if (that == NULL) return;
+  free(that->_stack);
+  that->_stack = NULL;
+  that->_depth = 0;
+  that->_capacity = 0;
+}
+
+// Reset the iterator 'that' at its start position
+// The iterator can be used after its attached GenTree has been 
+// modified once it has been reset
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthReset(GenTreeIterLazyDepth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  that->_depth = 0;
+  if (that->_tree->_subtrees._set._head != NULL) {
+    that->_stack[0] = that->_tree->_subtrees._set._head;
+    that->_depth = 1;
+  }
+}
+
+// Step the iterator 'that' at its next position
+// Return true if it could move to the next position
+// Return false if it's already at the last position
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyDepthStep(GenTreeIterLazyDepth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_depth == 0)
+    return false;
+  // If the current node has subtrees, move to the first one
+  GenTree* node = (GenTree*)(that->_stack[that->_depth - 1]->_data);
+  if (node->_subtrees._set._head != NULL) {
+    if (that->_depth == that->_capacity) {
+      that->_stack = GenTreeIterLazyRealloc(that->_stack, 0, 
+        that->_depth, that->_capacity, 2 * that->_capacity);
+      that->_capacity *= 2;
+    }
+    that->_stack[that->_depth] = node->_subtrees._set._head;
+    ++(that->_depth);
+    return true;
+  }
+  // Else move to the next sibling of the deepest ancestor having one
+  for (long iDepth = that->_depth; iDepth--;) {
+    if (that->_stack[iDepth]->_next != NULL) {
+      that->_stack[iDepth] = that->_stack[iDepth]->_next;
+      that->_depth = iDepth + 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Return true if the iterator is at the end of the elements
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyDepthIsLast(const GenTreeIterLazyDepth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_depth == 0)
+    return true;
+  GenTree* node = (GenTree*)(that->_stack[that->_depth - 1]->_data);
+  if (node->_subtrees._set._head != NULL)
+    return false;
+  for (long iDepth = that->_depth; iDepth--;)
+    if (that->_stack[iDepth]->_next != NULL)
+      return false;
+  return true;
+}
+
+// Return the tree currently pointed to by the iterator, or null if 
+// the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTree* GenTreeIterLazyDepthGetGenTree(
+  const GenTreeIterLazyDepth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_depth == 0)
+    return NULL;
+  return (GenTree*)(that->_stack[that->_depth - 1]->_data);
+}
+
+// Return the user data of the tree currently pointed to by the 
+// iterator, or null if the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GenTreeIterLazyDepthGetData(
+  const GenTreeIterLazyDepth* const that) {
+  GenTree* node = GenTreeIterLazyDepthGetGenTree(that);
+  return (node == NULL ? NULL : node->_data);
+}
+
+// Return the depth of the node currently pointed to by the iterator 
+// (1 for the subtrees of the attached tree)
+#if BUILDMODE != 0
+static inline
+#endif 
+long GenTreeIterLazyDepthGetDepth(
+  const GenTreeIterLazyDepth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  return that->_depth;
+}
+
+// Change the attached tree of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthSetGenTree(GenTreeIterLazyDepth* const that, 
+  GenTree* const tree) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+  if (tree == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'tree' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  that->_tree = tree;
+  GenTreeIterLazyDepthReset(that);
+}
+
+// Apply a function to all elements' data of the GenTree of the iterator
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthApply(GenTreeIterLazyDepth* const that, 
+  void(*fun)(void* const data, void* const param), void* const param) {
+#if BUILDMODE == 0
+  if (fun == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'fun' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTreeIterLazyDepthReset(that);
+  if (that->_depth == 0)
+    return;
+  do {
+    fun(GenTreeIterLazyDepthGetData(that), param);
+  } while (GenTreeIterLazyDepthStep(that));
+}
+
+// Create a new GenTreeIterLazyBreadth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyBreadth* GenTreeIterLazyBreadthCreate(
+  GenTree* const tree) {
+  GenTreeIterLazyBreadth* that = 
+    PBErrMalloc(GenTreeErr, sizeof(GenTreeIterLazyBreadth));
+  *that = GenTreeIterLazyBreadthCreateStatic(tree);
+  return that;
+}
+
+// Create a new static GenTreeIterLazyBreadth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyBreadth GenTreeIterLazyBreadthCreateStatic(
+  GenTree* const tree) {
+#if BUILDMODE == 0
+  if (tree == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'tree' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTreeIterLazyBreadth that = {._tree = tree, ._curElem = NULL, 
+    ._first = 0, ._nbElem = 0, 
+    ._capacity = GENTREEITERLAZY_INITCAPACITY};
+  that._queue = PBErrMalloc(GenTreeErr, 
+    sizeof(GSetElem*) * that._capacity);
+  GenTreeIterLazyBreadthReset(&that);
+  return that;
+}
+
+// Free the memory used by the iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthFree(GenTreeIterLazyBreadth** that) {
+  if (that == NULL || *that == NULL) return;
+  GenTreeIterLazyBreadthFreeStatic(*that);
+  free(*that);
+  *that = NULL;
+}
+
+// Free the memory used by the static iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthFreeStatic(
+  GenTreeIterLazyBreadth* const that) {
+  if (that == NULL) return;
+  free(that->_queue);
+  that->_queue = NULL;
+  that->_curElem = NULL;
+  that->_first = 0;
+  that->_nbElem = 0;
+  that->_capacity = 0;
+}
+
+// Reset the iterator 'that' at its start position
+// The iterator can be used after its attached GenTree has been 
+// modified once it has been reset
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthReset(GenTreeIterLazyBreadth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  that->_curElem = that->_tree->_subtrees._set._head;
+  that->_first = 0;
+  that->_nbElem = 0;
+}
+
+// Step the iterator 'that' at its next position
+// Return true if it could move to the next position
+// Return false if it's already at the last position
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyBreadthStep(GenTreeIterLazyBreadth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_curElem == NULL)
+    return false;
+  // Queue the subtrees of the current node, they will be visited after 
+  // the nodes at the current depth
+  GenTree* node = (GenTree*)(that->_curElem->_data);
+  if (node->_subtrees._set._head != NULL) {
+    if (that->_nbElem == that->_capacity) {
+      that->_queue = GenTreeIterLazyRealloc(that->_queue, that->_first,
+        that->_nbElem, that->_capacity, 2 * that->_capacity);
+      that->_first = 0;
+      that->_capacity *= 2;
+    }
+    that->_queue[(that->_first + that->_nbElem) % that->_capacity] = 
+      node->_subtrees._set._head;
+    ++(that->_nbElem);
+  }
+  // Move to the next sibling, or to the next queued subtrees
+  if (that->_curElem->_next != NULL) {
+    that->_curElem = that->_curElem->_next;
+    return true;
+  }
+  if (that->_nbElem > 0) {
+    that->_curElem = that->_queue[that->_first];
+    that->_first = (that->_first + 1) % that->_capacity;
+    --(that->_nbElem);
+    return true;
+  }
+  return false;
+}
+
+// Return true if the iterator is at the end of the elements
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyBreadthIsLast(
+  const GenTreeIterLazyBreadth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_curElem == NULL)
+    return true;
+  GenTree* node = (GenTree*)(that->_curElem->_data);
+  return (that->_curElem->_next == NULL && that->_nbElem == 0 && 
+    node->_subtrees._set._head == NULL);
+}
+
+// Return the tree currently pointed to by the iterator, or null if 
+// the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTree* GenTreeIterLazyBreadthGetGenTree(
+  const GenTreeIterLazyBreadth* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  if (that->_curElem == NULL)
+    return NULL;
+  return (GenTree*)(that->_curElem->_data);
+}
+
+// Return the user data of the tree currently pointed to by the 
+// iterator, or null if the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GenTreeIterLazyBreadthGetData(
+  const GenTreeIterLazyBreadth* const that) {
+  GenTree* node = GenTreeIterLazyBreadthGetGenTree(that);
+  return (node == NULL ? NULL : node->_data);
+}
+
+// Change the attached tree of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthSetGenTree(
+  GenTreeIterLazyBreadth* const that, GenTree* const tree) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'that' is null");
+    PBErrCatch(GenTreeErr);
+  }
+  if (tree == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'tree' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  that->_tree = tree;
+  GenTreeIterLazyBreadthReset(that);
+}
+
+// Apply a function to all elements' data of the GenTree of the iterator
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthApply(GenTreeIterLazyBreadth* const that, 
+  void(*fun)(void* const data, void* const param), void* const param) {
+#if BUILDMODE == 0
+  if (fun == NULL) {
+    GenTreeErr->_type = PBErrTypeNullPointer;
+    sprintf(GenTreeErr->_msg, "'fun' is null");
+    PBErrCatch(GenTreeErr);
+  }
+#endif
+  GenTreeIterLazyBreadthReset(that);
+  if (that->_curElem == NULL)
+    return;
+  do {
+    fun(GenTreeIterLazyBreadthGetData(that), param);
+  } while (GenTreeIterLazyBreadthStep(that));
+}
@@ -126,6 +126,39 @@ bool _GenTreeAppendToNode(GenTree* const that,
 GenTree* _GenTreeSearch(const GenTree* const that, 
   const void* const data, GenTreeIter* const iter);
 
+// Create a new GenTree with user data 'data', allocated from the 
+// GSetPool 'pool' (which must deliver blocks of at least 
+// sizeof(GenTree) bytes)
+// A pooled GenTree must be modified only with the *Pool functions and 
+// freed with GenTreeFreePool
+#if BUILDMODE != 0
+static inline
+#endif
+GenTree* GenTreeCreateDataPool(void* const data, GSetPool* const pool);
+
+// Append a new node with user data 'data' to the subtrees of the 
+// pooled GenTree 'that'. The node is allocated from 'treePool' and 
+// its element in the set of subtrees from 'elemPool'
+// Return the new node
+#if BUILDMODE != 0
+static inline
+#endif
+GenTree* _GenTreeAppendDataPool(GenTree* const that, void* const data, 
+  GSetPool* const treePool, GSetPool* const elemPool);
+
+// Free the memory used by the pooled GenTree 'that'
+// If 'that' is not a root node it is cut prior to be freed
+// Subtrees are recursively freed
+// If all the blocks in use in 'treePool' and 'elemPool' belong to 
+// 'that', the pools are flushed in one call each, else the nodes and 
+// elements are given back one by one to the pools
+// User data must be freed by the user
+#if BUILDMODE != 0
+static inline
+#endif
+void _GenTreeFreePool(GenTree** that, GSetPool* const treePool, 
+  GSetPool* const elemPool);
+
 // Wrapping of GSet functions
 static inline GenTree* _GenTreeSubtree(const GenTree* const that, const int iSubtree) {
   return GSetGet(_GenTreeSubtrees(that), iSubtree);
@@ -196,6 +229,10 @@ static inline void _GenTreeAppendData(GenTree* const that, void* const data) {
 
 // ================= Define ==================
 
+// Default number of slots allocated by a lazy iterator for its 
+// stack or queue
+#define GENTREEITERLAZY_INITCAPACITY 16
+
 // ================= Data structure ===================
 
 typedef struct GenTreeIter {
@@ -212,6 +249,40 @@ typedef struct GenTreeIterDepth {GenTreeIter _iter;} GenTreeIterDepth;
 typedef struct GenTreeIterBreadth {GenTreeIter _iter;} GenTreeIterBreadth;
 typedef struct GenTreeIterValue {GenTreeIter _iter;} GenTreeIterValue;
 
+// Lazy depth first iterator, the nodes are visited in the same order 
+// as GenTreeIterDepth (root node excluded) but without building the 
+// sequence of nodes, the memory used is O(depth of the tree)
+typedef struct GenTreeIterLazyDepth {
+  // Attached tree
+  GenTree* _tree;
+  // Current element in the subtrees of each ancestor of the current 
+  // node, the last one is the current node
+  GSetElem** _stack;
+  // Number of elements in the stack
+  long _depth;
+  // Number of allocated slots in the stack
+  long _capacity;
+} GenTreeIterLazyDepth;
+
+// Lazy breadth first iterator, the nodes are visited in the same order 
+// as GenTreeIterBreadth (root node excluded) but without building the 
+// sequence of nodes, the memory used is O(width of the tree)
+typedef struct GenTreeIterLazyBreadth {
+  // Attached tree
+  GenTree* _tree;
+  // Current element
+  GSetElem* _curElem;
+  // Circular queue of the first element of the subtrees waiting to 
+  // be visited
+  GSetElem** _queue;
+  // Index of the head of the queue
+  long _first;
+  // Number of elements in the queue
+  long _nbElem;
+  // Number of allocated slots in the queue
+  long _capacity;
+} GenTreeIterLazyBreadth;
+
 // ================ Functions declaration ====================
 
 // Create a new GenTreeIterDepth for the GenTree 'tree'
@@ -350,6 +421,175 @@ static inline
 #endif 
 GSetGenTree* _GenTreeIterSeq(const GenTreeIter* const that);
 
+// Create a new GenTreeIterLazyDepth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyDepth* GenTreeIterLazyDepthCreate(GenTree* const tree);
+
+// Create a new static GenTreeIterLazyDepth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyDepth GenTreeIterLazyDepthCreateStatic(
+  GenTree* const tree);
+
+// Free the memory used by the iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthFree(GenTreeIterLazyDepth** that);
+
+// Free the memory used by the static iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthFreeStatic(GenTreeIterLazyDepth* const that);
+
+// Reset the iterator 'that' at its start position
+// The iterator can be used after its attached GenTree has been 
+// modified once it has been reset
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthReset(GenTreeIterLazyDepth* const that);
+
+// Step the iterator 'that' at its next position
+// Return true if it could move to the next position
+// Return false if it's already at the last position
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyDepthStep(GenTreeIterLazyDepth* const that);
+
+// Return true if the iterator is at the end of the elements
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyDepthIsLast(const GenTreeIterLazyDepth* const that);
+
+// Return the tree currently pointed to by the iterator, or null if 
+// the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTree* GenTreeIterLazyDepthGetGenTree(
+  const GenTreeIterLazyDepth* const that);
+
+// Return the user data of the tree currently pointed to by the 
+// iterator, or null if the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GenTreeIterLazyDepthGetData(const GenTreeIterLazyDepth* const that);
+
+// Return the depth of the node currently pointed to by the iterator 
+// (1 for the subtrees of the attached tree)
+#if BUILDMODE != 0
+static inline
+#endif 
+long GenTreeIterLazyDepthGetDepth(
+  const GenTreeIterLazyDepth* const that);
+
+// Change the attached tree of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthSetGenTree(GenTreeIterLazyDepth* const that, 
+  GenTree* const tree);
+
+// Apply a function to all elements' data of the GenTree of the iterator
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyDepthApply(GenTreeIterLazyDepth* const that, 
+  void(*fun)(void* const data, void* const param), void* const param);
+
+// Create a new GenTreeIterLazyBreadth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyBreadth* GenTreeIterLazyBreadthCreate(GenTree* const tree);
+
+// Create a new static GenTreeIterLazyBreadth for the GenTree 'tree'
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTreeIterLazyBreadth GenTreeIterLazyBreadthCreateStatic(
+  GenTree* const tree);
+
+// Free the memory used by the iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthFree(GenTreeIterLazyBreadth** that);
+
+// Free the memory used by the static iterator 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthFreeStatic(
+  GenTreeIterLazyBreadth* const that);
+
+// Reset the iterator 'that' at its start position
+// The iterator can be used after its attached GenTree has been 
+// modified once it has been reset
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthReset(GenTreeIterLazyBreadth* const that);
+
+// Step the iterator 'that' at its next position
+// Return true if it could move to the next position
+// Return false if it's already at the last position
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyBreadthStep(GenTreeIterLazyBreadth* const that);
+
+// Return true if the iterator is at the end of the elements
+// Return false else
+#if BUILDMODE != 0
+static inline
+#endif 
+bool GenTreeIterLazyBreadthIsLast(
+  const GenTreeIterLazyBreadth* const that);
+
+// Return the tree currently pointed to by the iterator, or null if 
+// the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+GenTree* GenTreeIterLazyBreadthGetGenTree(
+  const GenTreeIterLazyBreadth* const that);
+
+// Return the user data of the tree currently pointed to by the 
+// iterator, or null if the attached tree has no subtree
+#if BUILDMODE != 0
+static inline
+#endif 
+void* GenTreeIterLazyBreadthGetData(
+  const GenTreeIterLazyBreadth* const that);
+
+// Change the attached tree of the iterator, and reset it
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthSetGenTree(
+  GenTreeIterLazyBreadth* const that, GenTree* const tree);
+
+// Apply a function to all elements' data of the GenTree of the iterator
+// The iterator is first reset, then the function is apply sequencially
+// using the Step function of the iterator
+#if BUILDMODE != 0
+static inline
+#endif 
+void GenTreeIterLazyBreadthApply(GenTreeIterLazyBreadth* const that, 
+  void(*fun)(void* const data, void* const param), void* const param);
+
 // ================= Typed GenTree ==================
 
 typedef struct GenTreeStr {GenTree _tree;} GenTreeStr;
@@ -357,6 +597,8 @@ typedef struct GenTreeStr {GenTree _tree;} GenTreeStr;
 static inline GenTreeStr GenTreeStrCreateStatic(void) 
   {GenTreeStr ret = {._tree=GenTreeCreateStatic()}; return ret;}
 #define GenTreeStrCreateData(Data) ((GenTreeStr*)GenTreeCreateData(Data))
+#define GenTreeStrCreateDataPool(Data, Pool) \
+  ((GenTreeStr*)GenTreeCreateDataPool(Data, Pool))
 static inline char* _GenTreeStrData(const GenTreeStr* const that) {
   return (char*)_GenTreeData((const GenTree* const)that);
 }
@@ -434,6 +676,19 @@ static inline void _GenTreeStrAppendSubtree(GenTreeStr* const that,
   const GenTreeStr*: _GenTreeFreeStatic, \
   default: PBErrInvalidPolymorphism) ((GenTree*)(Tree))
 
+#define GenTreeFreePool(RefTree, TreePool, ElemPool) _Generic(RefTree, \
+  GenTree**: _GenTreeFreePool, \
+  GenTreeStr**: _GenTreeFreePool, \
+  default: PBErrInvalidPolymorphism) ((GenTree**)(RefTree), TreePool, \
+    ElemPool)
+
+#define GenTreeAppendDataPool(Tree, Data, TreePool, ElemPool) \
+  _Generic(Tree, \
+  GenTree*: _GenTreeAppendDataPool, \
+  GenTreeStr*: _GenTreeAppendDataPool, \
+  default: PBErrInvalidPolymorphism) ((GenTree*)(Tree), (void*)(Data), \
+    TreePool, ElemPool)
+
 #define GenTreeParent(Tree) _Generic(Tree, \
   GenTree*: _GenTreeParent, \
   const GenTree*: _GenTreeParent, \
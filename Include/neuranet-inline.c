@@ -312,3 +312,1460 @@ long NNGetGAAdnIntLength(const NeuraNet* const that) {
   return NNGetNbMaxLinks(that) * NN_NBPARAMLINK;
 }
 
+// Save the NeuraNet 'that' to the stream 'stream' in binary format
+// (see PBBin), the convolution parameters are saved too
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true if the NeuraNet could be saved, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNSaveBin(const NeuraNet* const that, FILE* const stream, 
+  const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (stream == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'stream' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "NNET", checksum);
+  PBBinWriteI64(&bin, that->_nbInputVal);
+  PBBinWriteI64(&bin, that->_nbOutputVal);
+  PBBinWriteI64(&bin, that->_nbMaxHidVal);
+  PBBinWriteI64(&bin, that->_nbMaxBases);
+  PBBinWriteI64(&bin, that->_nbMaxLinks);
+  PBBinWriteI64(&bin, that->_nbBasesConv);
+  PBBinWriteI64(&bin, that->_nbBasesCellConv);
+  _VecFloatEncodeAsBin(that->_bases, &bin);
+  _VecLongEncodeAsBin(that->_links, &bin);
+  return PBBinWriteFooter(&bin);
+}
+
+// Load the NeuraNet 'that' from the stream 'stream' in binary format
+// If 'that' is not null the memory is first freed 
+// Return true if the NeuraNet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNLoadBin(NeuraNet** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (stream == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'stream' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (*that != NULL)
+    NeuraNetFree(that);
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "NNET"))
+    return false;
+  int nbIn = (int)PBBinReadI64(&bin);
+  int nbOut = (int)PBBinReadI64(&bin);
+  long nbHid = (long)PBBinReadI64(&bin);
+  long nbBases = (long)PBBinReadI64(&bin);
+  long nbLinks = (long)PBBinReadI64(&bin);
+  long nbBasesConv = (long)PBBinReadI64(&bin);
+  long nbBasesCellConv = (long)PBBinReadI64(&bin);
+  if (!PBBinIsOk(&bin) || nbIn <= 0 || nbOut <= 0 || nbHid < 0 || 
+    nbBases <= 0 || nbLinks <= 0 || nbBasesConv < 0 || 
+    nbBasesCellConv < 0)
+    return false;
+  VecFloat* bases = NULL;
+  VecLong* links = NULL;
+  bool ret = _VecFloatDecodeAsBin(&bases, &bin) && 
+    _VecLongDecodeAsBin(&links, &bin) && 
+    PBBinReadFooter(&bin) && 
+    VecGetDim(bases) == nbBases * NN_NBPARAMBASE && 
+    VecGetDim(links) == nbLinks * NN_NBPARAMLINK;
+  if (ret) {
+    *that = NeuraNetCreate(nbIn, nbOut, nbHid, nbBases, nbLinks);
+    // The convolution parameters are const once the NeuraNet is 
+    // created, they are restored here as NeuraNetCreateConvolution 
+    // would have set them
+    *(long*)&((*that)->_nbBasesConv) = nbBasesConv;
+    *(long*)&((*that)->_nbBasesCellConv) = nbBasesCellConv;
+    NNSetBases(*that, bases);
+    NNSetLinks(*that, links);
+  }
+  if (bases != NULL)
+    VecFree(&bases);
+  if (links != NULL)
+    VecFree(&links);
+  return ret;
+}
+
+// Write the JSON encoding of the NeuraNet 'that' with the JSONWriter 
+// 'writer', as the value of the last key, an element of the current 
+// array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEncodeAsJSONStream(const NeuraNet* const that, 
+  JSONWriter* const writer) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (writer == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'writer' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  JSONWriterObjStart(writer);
+  JSONWriterPropLong(writer, "_nbInputVal", that->_nbInputVal);
+  JSONWriterPropLong(writer, "_nbOutputVal", that->_nbOutputVal);
+  JSONWriterPropLong(writer, "_nbMaxHidVal", that->_nbMaxHidVal);
+  JSONWriterPropLong(writer, "_nbMaxBases", that->_nbMaxBases);
+  JSONWriterPropLong(writer, "_nbMaxLinks", that->_nbMaxLinks);
+  JSONWriterKey(writer, "_bases");
+  VecEncodeAsJSONStream(that->_bases, writer);
+  JSONWriterKey(writer, "_links");
+  VecEncodeAsJSONStream(that->_links, writer);
+  JSONWriterObjEnd(writer);
+}
+
+// Save the NeuraNet 'that' to the stream 'stream' with a JSONWriter, 
+// without building the JSONNode tree
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true if the NeuraNet could be saved, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNSaveFast(const NeuraNet* const that, FILE* const stream, 
+  const bool compact) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (stream == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'stream' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  JSONWriter writer = JSONWriterCreateStatic(stream, compact);
+  NNEncodeAsJSONStream(that, &writer);
+  return JSONWriterFlush(&writer);
+}
+
+// ----- NNEvalPlan
+
+// ================ Functions implementation ====================
+
+// Create a new NNEvalPlan compiled from the NeuraNet 'nn'
+#if BUILDMODE != 0
+static inline
+#endif
+NNEvalPlan* NNEvalPlanCreate(const NeuraNet* const nn) {
+#if BUILDMODE == 0
+  if (nn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'nn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  NNEvalPlan* that = PBErrMalloc(NeuraNetErr, sizeof(NNEvalPlan));
+  that->_nbIn = 0;
+  that->_nbHid = 0;
+  that->_nbOut = 0;
+  that->_nbOp = 0;
+  that->_ops = NULL;
+  that->_nbLayer = 0;
+  that->_layers = NULL;
+  that->_dimIn = NULL;
+  that->_dimCell = NULL;
+  that->_depthConv = 0;
+  that->_thickConv = 0;
+  that->_nbConv = 0;
+  that->_convs = NULL;
+  that->_bases = NULL;
+  that->_links = NULL;
+  NNEvalPlanCompile(that, nn);
+  return that;
+}
+
+// Free the memory used by the dense layers of the NNEvalPlan 'that'
+static inline void NNEvalPlanFreeLayers(NNEvalPlan* const that) {
+  for (long iLayer = that->_nbLayer; iLayer--;)
+    free(that->_layers[iLayer]._slope);
+  if (that->_layers != NULL)
+    free(that->_layers);
+  that->_layers = NULL;
+  that->_nbLayer = 0;
+}
+
+// Detect the dense layers in the operations of the NNEvalPlan 'that'
+// and memorize their parameters
+static inline void NNEvalPlanDetectLayers(NNEvalPlan* const that) {
+  NNEvalPlanFreeLayers(that);
+  const NNEvalOp* const ops = that->_ops;
+  long iOp = 0;
+  while (iOp < that->_nbOp) {
+    // Get the sources of the first destination, they must be 
+    // consecutive and not chained
+    const long src = ops[iOp]._src;
+    long nbSrc = 0;
+    bool isDense = true;
+    while (true) {
+      const NNEvalOp* op = ops + iOp + nbSrc;
+      if (op->_src != src + nbSrc || (op->_flag & NN_EVALOP_CHAIN))
+        isDense = false;
+      ++nbSrc;
+      if (op->_flag & NN_EVALOP_LAST)
+        break;
+    }
+    // The sources must be all inputs or all hidden values
+    if (src < that->_nbIn && src + nbSrc > that->_nbIn)
+      isDense = false;
+    if (!isDense) {
+      iOp += nbSrc;
+      continue;
+    }
+    // Count the next destinations with the same sources
+    const int flagOut = ops[iOp]._flag & NN_EVALOP_OUT;
+    long nbDst = 1;
+    while (iOp + (nbDst + 1) * nbSrc <= that->_nbOp) {
+      const NNEvalOp* op = ops + iOp + nbDst * nbSrc;
+      bool isSame = true;
+      for (long iSrc = 0; iSrc < nbSrc && isSame; ++iSrc)
+        if (op[iSrc]._src != src + iSrc || 
+          op[iSrc]._dst != ops[iOp]._dst + nbDst ||
+          (op[iSrc]._flag & NN_EVALOP_OUT) != flagOut ||
+          (op[iSrc]._flag & NN_EVALOP_CHAIN) ||
+          ((op[iSrc]._flag & NN_EVALOP_LAST) != 0) != 
+          (iSrc == nbSrc - 1))
+          isSame = false;
+      if (!isSame)
+        break;
+      ++nbDst;
+    }
+    if (nbDst < NN_EVALDENSEMINDIM) {
+      iOp += nbSrc;
+      continue;
+    }
+    // Memorize the layer, a layer has at least NN_EVALDENSEMINDIM
+    // operations which bounds their number
+    if (that->_layers == NULL)
+      that->_layers = PBErrMalloc(NeuraNetErr, 
+        sizeof(NNEvalLayer) * (that->_nbOp / NN_EVALDENSEMINDIM + 1));
+    NNEvalLayer* layer = that->_layers + that->_nbLayer;
+    ++(that->_nbLayer);
+    layer->_iOp = iOp;
+    layer->_src = src;
+    layer->_nbSrc = nbSrc;
+    layer->_dst = ops[iOp]._dst;
+    layer->_nbDst = nbDst;
+    layer->_isOut = (flagOut != 0);
+    layer->_slope = PBErrMalloc(NeuraNetErr, 
+      sizeof(float) * 3 * nbSrc * nbDst);
+    layer->_shift = layer->_slope + nbSrc * nbDst;
+    layer->_bias = layer->_shift + nbSrc * nbDst;
+    for (long iDst = 0; iDst < nbDst; ++iDst)
+      for (long iSrc = 0; iSrc < nbSrc; ++iSrc) {
+        const NNEvalOp* op = ops + iOp + iDst * nbSrc + iSrc;
+        layer->_slope[iSrc * nbDst + iDst] = op->_slope;
+        layer->_shift[iSrc * nbDst + iDst] = op->_shift;
+        layer->_bias[iSrc * nbDst + iDst] = op->_bias;
+      }
+    iOp += nbSrc * nbDst;
+  }
+}
+
+// Free the memory used by the convolution maps of the NNEvalPlan 
+// 'that'
+static inline void NNEvalPlanFreeConv(NNEvalPlan* const that) {
+  for (long iConv = that->_nbConv; iConv--;) {
+    free(that->_convs[iConv]._offset);
+    free(that->_convs[iConv]._slope);
+  }
+  if (that->_convs != NULL)
+    free(that->_convs);
+  that->_convs = NULL;
+  that->_nbConv = 0;
+}
+
+// Memorize in 'offset' the offsets, according to the strides 'stride',
+// of the 'nb' positions in a grid of 'nbDim' dimensions 'dim', the 
+// positions being ordered with the first dimension running fastest
+static inline void NNEvalConvOffsets(const long nbDim, 
+  const long* const dim, const long* const stride, 
+  long* const offset, const long nb) {
+  for (long iPos = 0; iPos < nb; ++iPos) {
+    long pos = iPos;
+    offset[iPos] = 0;
+    for (long iDim = 0; iDim < nbDim; ++iDim) {
+      offset[iPos] += (pos % dim[iDim]) * stride[iDim];
+      pos /= dim[iDim];
+    }
+  }
+}
+
+// Detect in the operations of the NNEvalPlan 'that' the convolution 
+// maps of its structure of convolution, memorize their shared 
+// parameters and remove their operations
+// The operations are left unchanged if they don't match exactly the 
+// links of the structure of convolution
+static inline void NNEvalPlanDetectConv(NNEvalPlan* const that) {
+  NNEvalPlanFreeConv(that);
+  if (that->_dimIn == NULL || that->_depthConv <= 0)
+    return;
+  const long nbDim = VecGetDim(that->_dimIn);
+  // Dimensions of the cell, source and destination values of the 
+  // current layer, and strides of the source values
+  long* dim = PBErrMalloc(NeuraNetErr, sizeof(long) * 4 * nbDim);
+  long* dimCell = dim;
+  long* dimSrc = dimCell + nbDim;
+  long* dimDst = dimSrc + nbDim;
+  long* stride = dimDst + nbDim;
+  long nbCell = 1;
+  long sizeSrc = 1;
+  for (long iDim = 0; iDim < nbDim; ++iDim) {
+    dimCell[iDim] = VecGet(that->_dimCell, iDim);
+    dimSrc[iDim] = VecGet(that->_dimIn, iDim);
+    nbCell *= dimCell[iDim];
+    sizeSrc *= dimSrc[iDim];
+  }
+  that->_convs = PBErrMalloc(NeuraNetErr, 
+    sizeof(NNEvalConv) * that->_depthConv * that->_thickConv);
+  const NNEvalOp* const ops = that->_ops;
+  // First source of the current layer and first destination of the 
+  // current convolution map
+  long src = 0;
+  long dst = 0;
+  bool isConv = (sizeSrc == that->_nbIn);
+  for (int iLayer = 0; iLayer < that->_depthConv && isConv; ++iLayer) {
+    long nbRow = 1;
+    for (long iDim = 0; iDim < nbDim; ++iDim) {
+      dimDst[iDim] = dimSrc[iDim] - dimCell[iDim] + 1;
+      stride[iDim] = (iDim == 0 ? 1 : stride[iDim - 1] * dimSrc[iDim - 1]);
+      if (iDim > 0)
+        nbRow *= dimDst[iDim];
+      if (dimDst[iDim] <= 0)
+        isConv = false;
+    }
+    const long sizeDst = nbRow * dimDst[0];
+    if (!isConv || dst + that->_thickConv * sizeDst > that->_nbHid ||
+      (dst + that->_thickConv * sizeDst) * nbCell > that->_nbOp) {
+      isConv = false;
+      break;
+    }
+    const long srcNext = that->_nbIn + dst;
+    for (int iThick = 0; iThick < that->_thickConv && isConv; 
+      ++iThick) {
+      NNEvalConv* conv = that->_convs + that->_nbConv;
+      ++(that->_nbConv);
+      conv->_src = (iLayer == 0 ? src : src + iThick * sizeSrc);
+      conv->_dst = dst;
+      conv->_nbRow = nbRow;
+      conv->_lenRow = dimDst[0];
+      conv->_nbCell = nbCell;
+      conv->_offset = 
+        PBErrMalloc(NeuraNetErr, sizeof(long) * (nbRow + nbCell));
+      NNEvalConvOffsets(nbDim - 1, dimDst + 1, stride + 1, 
+        conv->_offset, nbRow);
+      long* cell = conv->_offset + nbRow;
+      NNEvalConvOffsets(nbDim, dimCell, stride, cell, nbCell);
+      // The parameters are those of the links toward the first 
+      // destination value, the links toward the other ones must be 
+      // the same
+      conv->_slope = PBErrMalloc(NeuraNetErr, sizeof(float) * 3 * nbCell);
+      conv->_shift = conv->_slope + nbCell;
+      conv->_bias = conv->_shift + nbCell;
+      for (long iCell = nbCell; iCell--;) {
+        const NNEvalOp* op = ops + dst * nbCell + iCell;
+        conv->_slope[iCell] = op->_slope;
+        conv->_shift[iCell] = op->_shift;
+        conv->_bias[iCell] = op->_bias;
+      }
+      for (long iDst = 0; iDst < sizeDst && isConv; ++iDst) {
+        const long first = conv->_src + 
+          conv->_offset[iDst / conv->_lenRow] + iDst % conv->_lenRow;
+        const NNEvalOp* op = ops + (dst + iDst) * nbCell;
+        for (long iCell = 0; iCell < nbCell; ++iCell, ++op)
+          if (op->_src != first + cell[iCell] || 
+            op->_dst != dst + iDst ||
+            op->_flag != (iCell == nbCell - 1 ? NN_EVALOP_LAST : 0) ||
+            op->_slope != conv->_slope[iCell] || 
+            op->_shift != conv->_shift[iCell] || 
+            op->_bias != conv->_bias[iCell])
+            isConv = false;
+      }
+      dst += sizeDst;
+    }
+    src = srcNext;
+    sizeSrc = sizeDst;
+    for (long iDim = nbDim; iDim--;)
+      dimSrc[iDim] = dimDst[iDim];
+  }
+  free(dim);
+  if (!isConv) {
+    NNEvalPlanFreeConv(that);
+    return;
+  }
+  // Remove the operations of the convolution maps, they are the first 
+  // ones as the maps are the first hidden values
+  const long nbOp = that->_nbOp - dst * nbCell;
+  NNEvalOp* opsKept = PBErrMalloc(NeuraNetErr, 
+    sizeof(NNEvalOp) * (nbOp > 0 ? nbOp : 1));
+  if (nbOp > 0)
+    memcpy(opsKept, ops + dst * nbCell, sizeof(NNEvalOp) * nbOp);
+  free(that->_ops);
+  that->_ops = opsKept;
+  that->_nbOp = nbOp;
+}
+
+// Free the memory used by the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanFree(NNEvalPlan** const that) {
+  if (that == NULL || *that == NULL) return;
+  NNEvalPlanFreeLayers(*that);
+  NNEvalPlanFreeConv(*that);
+  if ((*that)->_dimIn != NULL)
+    VecFree(&((*that)->_dimIn));
+  if ((*that)->_dimCell != NULL)
+    VecFree(&((*that)->_dimCell));
+  if ((*that)->_ops != NULL)
+    free((*that)->_ops);
+  if ((*that)->_bases != NULL)
+    VecFree(&((*that)->_bases));
+  if ((*that)->_links != NULL)
+    VecFree(&((*that)->_links));
+  free(*that);
+  *that = NULL;
+}
+
+// Compile the NNEvalPlan 'that' from the current bases and links of
+// the NeuraNet 'nn'
+// Links which are inactive or refer to values out of bounds are
+// pruned, as well as those whose input id is not lower than their
+// output id, or whose base id is out of bounds
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanCompile(NNEvalPlan* const that, const NeuraNet* const nn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (nn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'nn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  // Memorize the bases and links the plan is compiled from
+  if (that->_bases != NULL)
+    VecFree(&(that->_bases));
+  if (that->_links != NULL)
+    VecFree(&(that->_links));
+  that->_bases = VecClone(nn->_bases);
+  that->_links = VecClone(nn->_links);
+  that->_nbIn = NNGetNbInput(nn);
+  that->_nbHid = NNGetNbMaxHidden(nn);
+  that->_nbOut = NNGetNbOutput(nn);
+  const long nbBase = NNGetNbMaxBases(nn);
+  const long nbLink = NNGetNbMaxLinks(nn);
+  const long nbVal = that->_nbIn + that->_nbHid + that->_nbOut;
+  const long* links = nn->_links->_val;
+  const float* bases = nn->_bases->_val;
+  // Precompute the slope of each base function
+  float* slope = PBErrMalloc(NeuraNetErr, 
+    sizeof(float) * (nbBase > 0 ? nbBase : 1));
+  for (long iBase = nbBase; iBase--;)
+    slope[iBase] = 
+      tan(bases[iBase * NN_NBPARAMBASE] * NN_THETA);
+  // Count the active links per destination value, the links are then
+  // sorted by destination with a stable counting sort to keep the 
+  // order of contributions of NNEval toward each value
+  long* start = PBErrMalloc(NeuraNetErr, sizeof(long) * (nbVal + 1));
+  memset(start, 0, sizeof(long) * (nbVal + 1));
+  long nbOp = 0;
+  for (long iLink = 0; iLink < nbLink; ++iLink) {
+    const long* link = links + iLink * NN_NBPARAMLINK;
+    if (link[0] < 0 || link[0] >= nbBase || link[1] < 0 || 
+      link[1] >= link[2] || link[1] >= that->_nbIn + that->_nbHid || 
+      link[2] < that->_nbIn || link[2] >= nbVal)
+      continue;
+    ++(start[link[2] + 1]);
+    ++nbOp;
+  }
+  for (long iVal = 0; iVal < nbVal; ++iVal)
+    start[iVal + 1] += start[iVal];
+  if (that->_ops != NULL)
+    free(that->_ops);
+  that->_ops = PBErrMalloc(NeuraNetErr, 
+    sizeof(NNEvalOp) * (nbOp > 0 ? nbOp : 1));
+  that->_nbOp = nbOp;
+  // Emit the operations, a link is chained with the previous one 
+  // toward the same destination if they were consecutive and had the 
+  // same input in the links of the NeuraNet (their results are 
+  // multiplied by NNEval)
+  long* prevLink = PBErrMalloc(NeuraNetErr, sizeof(long) * nbVal);
+  for (long iVal = nbVal; iVal--;)
+    prevLink[iVal] = -2;
+  for (long iLink = 0; iLink < nbLink; ++iLink) {
+    const long* link = links + iLink * NN_NBPARAMLINK;
+    if (link[0] < 0 || link[0] >= nbBase || link[1] < 0 || 
+      link[1] >= link[2] || link[1] >= that->_nbIn + that->_nbHid || 
+      link[2] < that->_nbIn || link[2] >= nbVal)
+      continue;
+    const long iDst = link[2];
+    NNEvalOp* op = that->_ops + start[iDst];
+    if (prevLink[iDst] == iLink - 1 && 
+      (op - 1)->_src == link[1])
+      (op - 1)->_flag |= NN_EVALOP_CHAIN;
+    prevLink[iDst] = iLink;
+    op->_src = link[1];
+    const float* param = bases + link[0] * NN_NBPARAMBASE;
+    op->_slope = slope[link[0]];
+    op->_shift = param[1];
+    op->_bias = param[2];
+    if (iDst >= that->_nbIn + that->_nbHid) {
+      op->_dst = iDst - that->_nbIn - that->_nbHid;
+      op->_flag = NN_EVALOP_OUT;
+    } else {
+      op->_dst = iDst - that->_nbIn;
+      op->_flag = 0;
+    }
+    ++(start[iDst]);
+  }
+  // Flag the last operation toward each destination
+  for (long iOp = 0; iOp < nbOp; ++iOp) {
+    NNEvalOp* op = that->_ops + iOp;
+    if (iOp == nbOp - 1 || op[1]._dst != op->_dst || 
+      (op[1]._flag & NN_EVALOP_OUT) != (op->_flag & NN_EVALOP_OUT))
+      op->_flag |= NN_EVALOP_LAST;
+  }
+  free(prevLink);
+  free(start);
+  free(slope);
+  NNEvalPlanDetectConv(that);
+  NNEvalPlanDetectLayers(that);
+}
+
+// Memorize in the NNEvalPlan 'that' the structure of convolution of 
+// the NeuraNet 'nn' created by NeuraNetCreateConvolution(dimIn, 
+// nbOutput, dimCell, depthConv, thickConv) and recompile the plan
+// The links of the convolution cells are then evaluated with a sliding
+// window over the source values and their shared parameters, as long 
+// as they match the structure of convolution (they don't anymore if
+// the links of 'nn' have been modified since its creation), else they
+// are evaluated as any other links
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanSetConvolution(NNEvalPlan* const that, 
+  const NeuraNet* const nn, const VecShort* const dimIn, 
+  const VecShort* const dimCell, const int depthConv, 
+  const int thickConv) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (nn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'nn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (dimIn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'dimIn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (dimCell == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'dimCell' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecGetDim(dimCell) != VecGetDim(dimIn)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'dimCell' 's dimension is invalid (%ld!=%ld)", 
+      VecGetDim(dimCell), VecGetDim(dimIn));
+    PBErrCatch(NeuraNetErr);
+  }
+  for (long iDim = VecGetDim(dimCell); iDim--;)
+    if (VecGet(dimCell, iDim) < 1 || VecGet(dimIn, iDim) < 1) {
+      NeuraNetErr->_type = PBErrTypeInvalidArg;
+      sprintf(NeuraNetErr->_msg, 
+        "'dimIn' or 'dimCell' is invalid (%d<1 or %d<1)", 
+        VecGet(dimIn, iDim), VecGet(dimCell, iDim));
+      PBErrCatch(NeuraNetErr);
+    }
+  if (depthConv < 0) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, "'depthConv' is invalid (%d>=0)", 
+      depthConv);
+    PBErrCatch(NeuraNetErr);
+  }
+  if (thickConv < 1) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, "'thickConv' is invalid (%d>0)", 
+      thickConv);
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (that->_dimIn != NULL)
+    VecFree(&(that->_dimIn));
+  if (that->_dimCell != NULL)
+    VecFree(&(that->_dimCell));
+  that->_dimIn = VecClone(dimIn);
+  that->_dimCell = VecClone(dimCell);
+  that->_depthConv = depthConv;
+  that->_thickConv = thickConv;
+  NNEvalPlanCompile(that, nn);
+}
+
+// Return true if the NNEvalPlan 'that' has been compiled from the
+// current bases and links of the NeuraNet 'nn', false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNEvalPlanIsUpToDate(const NNEvalPlan* const that,
+  const NeuraNet* const nn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (nn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'nn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (that->_nbIn != NNGetNbInput(nn) || 
+    that->_nbHid != NNGetNbMaxHidden(nn) ||
+    that->_nbOut != NNGetNbOutput(nn) ||
+    VecGetDim(that->_bases) != VecGetDim(nn->_bases) ||
+    VecGetDim(that->_links) != VecGetDim(nn->_links))
+    return false;
+  return memcmp(that->_bases->_val, nn->_bases->_val, 
+    sizeof(float) * VecGetDim(nn->_bases)) == 0 &&
+    memcmp(that->_links->_val, nn->_links->_val, 
+    sizeof(long) * VecGetDim(nn->_links)) == 0;
+}
+
+// Get the nb of operations of the NNEvalPlan 'that' (the links of its
+// convolution maps excluded)
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbOp(const NNEvalPlan* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  return that->_nbOp;
+}
+
+// Get the nb of dense layers of the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbLayer(const NNEvalPlan* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  return that->_nbLayer;
+}
+
+// Get the nb of convolution maps of the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbConv(const NNEvalPlan* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  return that->_nbConv;
+}
+
+#if PBMATH_SIMD_X86
+__attribute__((target("avx2,fma")))
+static inline void NNKernelDenseRowAVX2(const float x, 
+  const float* const slope, const float* const shift, 
+  const float* const bias, float* const acc, const float min, 
+  const float max, const long nb) {
+  const __m256 vX = _mm256_set1_ps(x);
+  const __m256 vMin = _mm256_set1_ps(min);
+  const __m256 vMax = _mm256_set1_ps(max);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    const __m256 v = _mm256_fmadd_ps(_mm256_loadu_ps(slope + i), 
+      _mm256_add_ps(vX, _mm256_loadu_ps(shift + i)), 
+      _mm256_loadu_ps(bias + i));
+    _mm256_storeu_ps(acc + i, _mm256_min_ps(_mm256_max_ps(
+      _mm256_add_ps(_mm256_loadu_ps(acc + i), v), vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + slope[i] * (x + shift[i]) + bias[i];
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+
+static inline void NNKernelDenseRowSSE(const float x, 
+  const float* const slope, const float* const shift, 
+  const float* const bias, float* const acc, const float min, 
+  const float max, const long nb) {
+  const __m128 vX = _mm_set1_ps(x);
+  const __m128 vMin = _mm_set1_ps(min);
+  const __m128 vMax = _mm_set1_ps(max);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    const __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(slope + i), 
+      _mm_add_ps(vX, _mm_loadu_ps(shift + i))), _mm_loadu_ps(bias + i));
+    _mm_storeu_ps(acc + i, _mm_min_ps(_mm_max_ps(
+      _mm_add_ps(_mm_loadu_ps(acc + i), v), vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + slope[i] * (x + shift[i]) + bias[i];
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+#endif
+
+// Add to each of the 'nb' floats of 'acc' the result of its link 
+// slope * (x + shift) + bias on the float 'x', and clamp the result 
+// to ['min', 'max']
+static inline void NNKernelDenseRow(const float x, 
+  const float* const slope, const float* const shift, 
+  const float* const bias, float* const acc, const float min, 
+  const float max, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      NNKernelDenseRowAVX2(x, slope, shift, bias, acc, min, max, nb);
+    else
+      NNKernelDenseRowSSE(x, slope, shift, bias, acc, min, max, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;) {
+    const float a = acc[i] + slope[i] * (x + shift[i]) + bias[i];
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+
+// Evaluate the dense layer 'layer' on the input values 'input' and 
+// hidden values 'hidVal', memorize the result in 'hidVal' or 'output'
+// The contributions toward each destination are added in the order of 
+// their source and clamped after each one, as in NNEval
+static inline void NNEvalLayerRun(const NNEvalLayer* const layer, 
+  const long nbIn, const float* const input, float* const hidVal, 
+  float* const output) {
+  const float* x = (layer->_src < nbIn ? 
+    input + layer->_src : hidVal + layer->_src - nbIn);
+  float* acc = (layer->_isOut ? output : hidVal) + layer->_dst;
+  const float min = (layer->_isOut ? -FLT_MAX : -1.0);
+  const float max = (layer->_isOut ? FLT_MAX : 1.0);
+  for (long iSrc = 0; iSrc < layer->_nbSrc; ++iSrc) {
+    const long shift = iSrc * layer->_nbDst;
+    NNKernelDenseRow(x[iSrc], layer->_slope + shift, 
+      layer->_shift + shift, layer->_bias + shift, acc, min, max, 
+      layer->_nbDst);
+  }
+}
+
+#if PBMATH_SIMD_X86
+__attribute__((target("avx2,fma")))
+static inline void NNKernelConvRowAVX2(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const acc, const long nb) {
+  const __m256 vSlope = _mm256_set1_ps(slope);
+  const __m256 vShift = _mm256_set1_ps(shift);
+  const __m256 vBias = _mm256_set1_ps(bias);
+  const __m256 vMin = _mm256_set1_ps(-1.0);
+  const __m256 vMax = _mm256_set1_ps(1.0);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    const __m256 v = _mm256_fmadd_ps(vSlope, 
+      _mm256_add_ps(_mm256_loadu_ps(x + i), vShift), vBias);
+    _mm256_storeu_ps(acc + i, _mm256_min_ps(_mm256_max_ps(
+      _mm256_add_ps(_mm256_loadu_ps(acc + i), v), vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + slope * (x[i] + shift) + bias;
+    acc[i] = (a < -1.0 ? -1.0 : (a > 1.0 ? 1.0 : a));
+  }
+}
+
+static inline void NNKernelConvRowSSE(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const acc, const long nb) {
+  const __m128 vSlope = _mm_set1_ps(slope);
+  const __m128 vShift = _mm_set1_ps(shift);
+  const __m128 vBias = _mm_set1_ps(bias);
+  const __m128 vMin = _mm_set1_ps(-1.0);
+  const __m128 vMax = _mm_set1_ps(1.0);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    const __m128 v = _mm_add_ps(_mm_mul_ps(vSlope, 
+      _mm_add_ps(_mm_loadu_ps(x + i), vShift)), vBias);
+    _mm_storeu_ps(acc + i, _mm_min_ps(_mm_max_ps(
+      _mm_add_ps(_mm_loadu_ps(acc + i), v), vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + slope * (x[i] + shift) + bias;
+    acc[i] = (a < -1.0 ? -1.0 : (a > 1.0 ? 1.0 : a));
+  }
+}
+#endif
+
+// Add to each of the 'nb' floats of 'acc' the result of the link 
+// slope * (x + shift) + bias on the corresponding float of 'x', and 
+// clamp the result to [-1,1]
+static inline void NNKernelConvRow(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const acc, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      NNKernelConvRowAVX2(x, slope, shift, bias, acc, nb);
+    else
+      NNKernelConvRowSSE(x, slope, shift, bias, acc, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;) {
+    const float a = acc[i] + slope * (x[i] + shift) + bias;
+    acc[i] = (a < -1.0 ? -1.0 : (a > 1.0 ? 1.0 : a));
+  }
+}
+
+// Evaluate the convolution map 'conv' on the input values 'input' and 
+// hidden values 'hidVal', memorize the result in 'hidVal'
+// The cell slides over the source values one position of the cell at 
+// a time, so the contributions toward each destination are added in 
+// the order of their source and clamped after each one, as in NNEval
+static inline void NNEvalConvRun(const NNEvalConv* const conv, 
+  const long nbIn, const float* const input, float* const hidVal) {
+  const float* x = (conv->_src < nbIn ? 
+    input + conv->_src : hidVal + conv->_src - nbIn);
+  float* acc = hidVal + conv->_dst;
+  const long* row = conv->_offset;
+  const long* cell = conv->_offset + conv->_nbRow;
+  for (long iCell = 0; iCell < conv->_nbCell; ++iCell)
+    for (long iRow = 0; iRow < conv->_nbRow; ++iRow)
+      NNKernelConvRow(x + row[iRow] + cell[iCell], conv->_slope[iCell],
+        conv->_shift[iCell], conv->_bias[iCell], 
+        acc + iRow * conv->_lenRow, conv->_lenRow);
+}
+
+// Run the NNEvalPlan 'that' on the input values 'input' and
+// memorize the hidden values in 'hidVal' and the output values in
+// 'output'
+// 'hidVal' and 'output' are set to 0.0 before evaluating
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanRun(const NNEvalPlan* const that,
+  const float* const input, float* const hidVal, float* const output) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (input == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'input' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (hidVal == NULL && that->_nbHid > 0) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'hidVal' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (output == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'output' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (that->_nbHid > 0)
+    memset(hidVal, 0, sizeof(float) * that->_nbHid);
+  memset(output, 0, sizeof(float) * that->_nbOut);
+  const long nbIn = that->_nbIn;
+  for (long iConv = 0; iConv < that->_nbConv; ++iConv)
+    NNEvalConvRun(that->_convs + iConv, nbIn, input, hidVal);
+  // The contributions toward one destination are accumulated in a 
+  // register and the hidden values are clamped to [-1,1] after each 
+  // contribution, as in NNEval
+  // The dense layers are evaluated at once when their first operation
+  // is reached
+  float prod = 1.0;
+  float acc = 0.0;
+  const NNEvalLayer* layer = that->_layers;
+  const NNEvalLayer* const endLayer = that->_layers + that->_nbLayer;
+  const NNEvalOp* const end = that->_ops + that->_nbOp;
+  for (const NNEvalOp* op = that->_ops; op != end; ++op) {
+    if (layer != endLayer && op == that->_ops + layer->_iOp) {
+      NNEvalLayerRun(layer, nbIn, input, hidVal, output);
+      op += layer->_nbSrc * layer->_nbDst - 1;
+      ++layer;
+      continue;
+    }
+    const float x = 
+      (op->_src < nbIn ? input[op->_src] : hidVal[op->_src - nbIn]);
+    prod *= op->_slope * (x + op->_shift) + op->_bias;
+    if (op->_flag & NN_EVALOP_CHAIN)
+      continue;
+    acc += prod;
+    prod = 1.0;
+    if (op->_flag & NN_EVALOP_OUT) {
+      if (op->_flag & NN_EVALOP_LAST) {
+        output[op->_dst] = acc;
+        acc = 0.0;
+      }
+    } else {
+      acc = (acc < -1.0 ? -1.0 : (acc > 1.0 ? 1.0 : acc));
+      if (op->_flag & NN_EVALOP_LAST) {
+        hidVal[op->_dst] = acc;
+        acc = 0.0;
+      }
+    }
+  }
+}
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' with its NNEvalPlan 'plan' and memorize the result
+// in 'output', as NNEval
+// 'plan' must be up to date (cf NNEvalPlanIsUpToDate), NNEvalFast
+// checks it automatically
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalWithPlan(const NeuraNet* const that,
+  const NNEvalPlan* const plan, const VecFloat* const input,
+  VecFloat* const output) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (plan == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'plan' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (input == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'input' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (output == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'output' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecGetDim(input) != NNGetNbInput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'input' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(input), NNGetNbInput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecGetDim(output) != NNGetNbOutput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'output' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(output), NNGetNbOutput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+  if (!NNEvalPlanIsUpToDate(plan, that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, "'plan' is out of date");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  NNEvalPlanRun(plan, input->_val, 
+    (that->_hidVal != NULL ? that->_hidVal->_val : NULL), output->_val);
+}
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' and memorize the result in 'output', as NNEval
+// The evaluation uses the NNEvalPlan 'plan', which is recompiled first
+// if the bases or links of 'that' have changed since its last
+// compilation (NNSetBases, NNBasesSet, NNSetLinks, ...)
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalFast(const NeuraNet* const that, NNEvalPlan* const plan,
+  const VecFloat* const input, VecFloat* const output) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (plan == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'plan' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (!NNEvalPlanIsUpToDate(plan, that))
+    NNEvalPlanCompile(plan, that);
+  NNEvalWithPlan(that, plan, input, output);
+}
+
+#if PBMATH_SIMD_X86
+__attribute__((target("avx2,fma")))
+static inline void NNKernelMulLinkAVX2(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const prod, const long nb) {
+  const __m256 vSlope = _mm256_set1_ps(slope);
+  const __m256 vShift = _mm256_set1_ps(shift);
+  const __m256 vBias = _mm256_set1_ps(bias);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    const __m256 v = _mm256_fmadd_ps(vSlope, 
+      _mm256_add_ps(_mm256_loadu_ps(x + i), vShift), vBias);
+    _mm256_storeu_ps(prod + i, _mm256_mul_ps(_mm256_loadu_ps(prod + i), v));
+  }
+  for (; i < nb; ++i)
+    prod[i] *= slope * (x[i] + shift) + bias;
+}
+
+static inline void NNKernelMulLinkSSE(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const prod, const long nb) {
+  const __m128 vSlope = _mm_set1_ps(slope);
+  const __m128 vShift = _mm_set1_ps(shift);
+  const __m128 vBias = _mm_set1_ps(bias);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    const __m128 v = _mm_add_ps(_mm_mul_ps(vSlope, 
+      _mm_add_ps(_mm_loadu_ps(x + i), vShift)), vBias);
+    _mm_storeu_ps(prod + i, _mm_mul_ps(_mm_loadu_ps(prod + i), v));
+  }
+  for (; i < nb; ++i)
+    prod[i] *= slope * (x[i] + shift) + bias;
+}
+
+__attribute__((target("avx2,fma")))
+static inline void NNKernelAddLinkAVX2(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  const float* const prod, float* const acc, const float min, 
+  const float max, const long nb) {
+  const __m256 vSlope = _mm256_set1_ps(slope);
+  const __m256 vShift = _mm256_set1_ps(shift);
+  const __m256 vBias = _mm256_set1_ps(bias);
+  const __m256 vMin = _mm256_set1_ps(min);
+  const __m256 vMax = _mm256_set1_ps(max);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    const __m256 v = _mm256_fmadd_ps(vSlope, 
+      _mm256_add_ps(_mm256_loadu_ps(x + i), vShift), vBias);
+    const __m256 a = _mm256_fmadd_ps(_mm256_loadu_ps(prod + i), v, 
+      _mm256_loadu_ps(acc + i));
+    _mm256_storeu_ps(acc + i, 
+      _mm256_min_ps(_mm256_max_ps(a, vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + prod[i] * (slope * (x[i] + shift) + bias);
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+
+static inline void NNKernelAddLinkSSE(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  const float* const prod, float* const acc, const float min, 
+  const float max, const long nb) {
+  const __m128 vSlope = _mm_set1_ps(slope);
+  const __m128 vShift = _mm_set1_ps(shift);
+  const __m128 vBias = _mm_set1_ps(bias);
+  const __m128 vMin = _mm_set1_ps(min);
+  const __m128 vMax = _mm_set1_ps(max);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    const __m128 v = _mm_add_ps(_mm_mul_ps(vSlope, 
+      _mm_add_ps(_mm_loadu_ps(x + i), vShift)), vBias);
+    const __m128 a = _mm_add_ps(_mm_loadu_ps(acc + i), 
+      _mm_mul_ps(_mm_loadu_ps(prod + i), v));
+    _mm_storeu_ps(acc + i, _mm_min_ps(_mm_max_ps(a, vMin), vMax));
+  }
+  for (; i < nb; ++i) {
+    const float a = acc[i] + prod[i] * (slope * (x[i] + shift) + bias);
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+#endif
+
+// Multiply the 'nb' floats of 'prod' by the result of the link
+// slope * (x + shift) + bias on the 'nb' floats of 'x'
+static inline void NNKernelMulLink(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  float* const prod, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      NNKernelMulLinkAVX2(x, slope, shift, bias, prod, nb);
+    else
+      NNKernelMulLinkSSE(x, slope, shift, bias, prod, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;)
+    prod[i] *= slope * (x[i] + shift) + bias;
+}
+
+// Add to the 'nb' floats of 'acc' the product of the 'nb' floats of 
+// 'prod' by the result of the link slope * (x + shift) + bias on the 
+// 'nb' floats of 'x', and clamp the result to ['min', 'max']
+static inline void NNKernelAddLink(const float* const x, 
+  const float slope, const float shift, const float bias, 
+  const float* const prod, float* const acc, const float min, 
+  const float max, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      NNKernelAddLinkAVX2(x, slope, shift, bias, prod, acc, min, max, nb);
+    else
+      NNKernelAddLinkSSE(x, slope, shift, bias, prod, acc, min, max, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;) {
+    const float a = acc[i] + prod[i] * (slope * (x[i] + shift) + bias);
+    acc[i] = (a < min ? min : (a > max ? max : a));
+  }
+}
+
+// Run the NNEvalPlan 'that' on the 'nb' input vectors of 'inputs' 
+// starting at index 'iFirst' and memorize the output vectors at the
+// same indices in 'outputs'
+// 'hidVal' is the scratch for the hidden values, NN_EVALBATCHCHUNK 
+// floats per hidden value, 'prod' is the scratch for the chained 
+// links and 'ones' is filled with 1.0, NN_EVALBATCHCHUNK floats each
+static inline void NNEvalPlanRunBatch(const NNEvalPlan* const that,
+  const VecFloatBatch* const inputs, VecFloatBatch* const outputs, 
+  const long iFirst, const long nb, float* const hidVal, 
+  float* const prod, const float* const ones) {
+  if (that->_nbHid > 0)
+    memset(hidVal, 0, sizeof(float) * that->_nbHid * NN_EVALBATCHCHUNK);
+  for (long iOut = that->_nbOut; iOut--;)
+    memset(outputs->_val + iOut * outputs->_stride + iFirst, 0, 
+      sizeof(float) * nb);
+  const long nbIn = that->_nbIn;
+  for (long iConv = 0; iConv < that->_nbConv; ++iConv) {
+    const NNEvalConv* conv = that->_convs + iConv;
+    const long* cell = conv->_offset + conv->_nbRow;
+    for (long iCell = 0; iCell < conv->_nbCell; ++iCell)
+      for (long iDst = 0; iDst < conv->_nbRow * conv->_lenRow; ++iDst) {
+        const long src = conv->_src + conv->_offset[iDst / conv->_lenRow] +
+          iDst % conv->_lenRow + cell[iCell];
+        const float* x = (src < nbIn ? 
+          inputs->_val + src * inputs->_stride + iFirst : 
+          hidVal + (src - nbIn) * NN_EVALBATCHCHUNK);
+        NNKernelAddLink(x, conv->_slope[iCell], conv->_shift[iCell], 
+          conv->_bias[iCell], ones, 
+          hidVal + (conv->_dst + iDst) * NN_EVALBATCHCHUNK, 
+          -1.0, 1.0, nb);
+      }
+  }
+  bool isChained = false;
+  const NNEvalOp* const end = that->_ops + that->_nbOp;
+  for (const NNEvalOp* op = that->_ops; op != end; ++op) {
+    const float* x = (op->_src < nbIn ? 
+      inputs->_val + op->_src * inputs->_stride + iFirst : 
+      hidVal + (op->_src - nbIn) * NN_EVALBATCHCHUNK);
+    if (op->_flag & NN_EVALOP_CHAIN) {
+      if (!isChained) {
+        memcpy(prod, ones, sizeof(float) * nb);
+        isChained = true;
+      }
+      NNKernelMulLink(x, op->_slope, op->_shift, op->_bias, prod, nb);
+    } else if (op->_flag & NN_EVALOP_OUT) {
+      NNKernelAddLink(x, op->_slope, op->_shift, op->_bias, 
+        (isChained ? prod : ones), 
+        outputs->_val + op->_dst * outputs->_stride + iFirst, 
+        -FLT_MAX, FLT_MAX, nb);
+      isChained = false;
+    } else {
+      NNKernelAddLink(x, op->_slope, op->_shift, op->_bias, 
+        (isChained ? prod : ones), 
+        hidVal + op->_dst * NN_EVALBATCHCHUNK, -1.0, 1.0, nb);
+      isChained = false;
+    }
+  }
+}
+
+// Process the chunks of the NNEvalBatchJob 'job' until they are all
+// done
+static inline void* NNEvalBatchWorker(void* job) {
+  NNEvalBatchJob* that = (NNEvalBatchJob*)job;
+  // Scratch of this thread for the hidden values, chained links and 
+  // ones
+  const long nbHid = that->_plan->_nbHid;
+  float* scratch = PBErrMalloc(NeuraNetErr, 
+    sizeof(float) * (nbHid + 2) * NN_EVALBATCHCHUNK);
+  float* prod = scratch + nbHid * NN_EVALBATCHCHUNK;
+  float* ones = prod + NN_EVALBATCHCHUNK;
+  for (long i = NN_EVALBATCHCHUNK; i--;)
+    ones[i] = 1.0;
+  const long nbVec = that->_inputs->_nb;
+  while (true) {
+    pthread_mutex_lock(&(that->_mutex));
+    const long iChunk = that->_nextChunk;
+    if (iChunk < that->_nbChunk)
+      ++(that->_nextChunk);
+    pthread_mutex_unlock(&(that->_mutex));
+    if (iChunk >= that->_nbChunk)
+      break;
+    const long iFirst = iChunk * NN_EVALBATCHCHUNK;
+    const long nb = (nbVec - iFirst < NN_EVALBATCHCHUNK ? 
+      nbVec - iFirst : NN_EVALBATCHCHUNK);
+    NNEvalPlanRunBatch(that->_plan, that->_inputs, that->_outputs, 
+      iFirst, nb, scratch, prod, ones);
+  }
+  free(scratch);
+  return NULL;
+}
+
+// Calculate the output values for each vector of input values of
+// 'inputs' for the NeuraNet 'that' and memorize the results in the
+// vectors of 'outputs', as NNEval
+// The evaluation uses the NNEvalPlan 'plan', recompiled first if
+// needed as in NNEvalFast, and runs each link over chunks of
+// NN_EVALBATCHCHUNK input vectors at once using 'nbThread' threads (if
+// 'nbThread' <= 0, one per online core), small batches are processed
+// by the calling thread only
+// Each thread uses its own hidden values, the hidden values of 'that'
+// are left unchanged
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalBatch(const NeuraNet* const that, NNEvalPlan* const plan,
+  const VecFloatBatch* const inputs, VecFloatBatch* const outputs,
+  int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (plan == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'plan' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (inputs == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'inputs' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (outputs == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'outputs' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecFloatBatchGetDim(inputs) != NNGetNbInput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'inputs' 's dimension is invalid (%ld!=%d)", 
+      VecFloatBatchGetDim(inputs), NNGetNbInput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecFloatBatchGetDim(outputs) != NNGetNbOutput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'outputs' 's dimension is invalid (%ld!=%d)", 
+      VecFloatBatchGetDim(outputs), NNGetNbOutput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecFloatBatchGetNb(outputs) != VecFloatBatchGetNb(inputs)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'outputs' 's number of vectors is invalid (%ld!=%ld)", 
+      VecFloatBatchGetNb(outputs), VecFloatBatchGetNb(inputs));
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (!NNEvalPlanIsUpToDate(plan, that))
+    NNEvalPlanCompile(plan, that);
+  if (nbThread <= 0) {
+    nbThread = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThread <= 0)
+      nbThread = 1;
+  }
+  NNEvalBatchJob job = {._plan = plan, ._inputs = inputs, 
+    ._outputs = outputs, 
+    ._nbChunk = 
+      (inputs->_nb + NN_EVALBATCHCHUNK - 1) / NN_EVALBATCHCHUNK,
+    ._nextChunk = 0};
+  if (nbThread > job._nbChunk)
+    nbThread = (int)(job._nbChunk);
+  long nbLink = plan->_nbOp;
+  for (long iConv = plan->_nbConv; iConv--;)
+    nbLink += plan->_convs[iConv]._nbRow * plan->_convs[iConv]._lenRow *
+      plan->_convs[iConv]._nbCell;
+  if (nbLink * inputs->_nb < NN_EVALBATCHMINPARALLEL)
+    nbThread = 1;
+  pthread_mutex_init(&(job._mutex), NULL);
+  if (nbThread <= 1) {
+    NNEvalBatchWorker(&job);
+    pthread_mutex_destroy(&(job._mutex));
+    return;
+  }
+  pthread_t* threads = 
+    PBErrMalloc(NeuraNetErr, sizeof(pthread_t) * (nbThread - 1));
+  int nbStarted = 0;
+  // If a thread can't be created the remaining chunks are simply 
+  // processed by the other ones
+  while (nbStarted < nbThread - 1 && pthread_create(threads + 
+    nbStarted, NULL, NNEvalBatchWorker, &job) == 0)
+    ++nbStarted;
+  NNEvalBatchWorker(&job);
+  for (int iThread = 0; iThread < nbStarted; ++iThread)
+    pthread_join(threads[iThread], NULL);
+  free(threads);
+  pthread_mutex_destroy(&(job._mutex));
+}
+
+// ----- NNEvalCtx
+
+// ================ Functions implementation ====================
+
+// Create a new NNEvalCtx for the NeuraNet 'nn'
+#if BUILDMODE != 0
+static inline
+#endif
+NNEvalCtx* NNEvalCtxCreate(const NeuraNet* const nn) {
+#if BUILDMODE == 0
+  if (nn == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'nn' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  NNEvalCtx* that = PBErrMalloc(NeuraNetErr, sizeof(NNEvalCtx));
+  that->_plan = NNEvalPlanCreate(nn);
+  that->_hidVal = VecFloatCreate(
+    (NNGetNbMaxHidden(nn) > 0 ? NNGetNbMaxHidden(nn) : 1));
+  return that;
+}
+
+// Free the memory used by the NNEvalCtx 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalCtxFree(NNEvalCtx** const that) {
+  if (that == NULL || *that == NULL) return;
+  NNEvalPlanFree(&((*that)->_plan));
+  VecFree(&((*that)->_hidVal));
+  free(*that);
+  *that = NULL;
+}
+
+// Get the hidden values of the last evaluation with the NNEvalCtx 
+// 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const VecFloat* NNEvalCtxHiddenValues(const NNEvalCtx* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  return that->_hidVal;
+}
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' and memorize the result in 'output', as NNEval
+// The plan and the hidden values are those of the NNEvalCtx 'ctx', 
+// the plan is recompiled first if needed as in NNEvalFast
+// 'that' is not modified, so it can be evaluated by several threads 
+// at once as long as each one uses its own NNEvalCtx
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalWithCtx(const NeuraNet* const that, NNEvalCtx* const ctx,
+  const VecFloat* const input, VecFloat* const output) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'that' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (ctx == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'ctx' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (input == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'input' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (output == NULL) {
+    NeuraNetErr->_type = PBErrTypeNullPointer;
+    sprintf(NeuraNetErr->_msg, "'output' is null");
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecGetDim(input) != NNGetNbInput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'input' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(input), NNGetNbInput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+  if (VecGetDim(output) != NNGetNbOutput(that)) {
+    NeuraNetErr->_type = PBErrTypeInvalidArg;
+    sprintf(NeuraNetErr->_msg, 
+      "'output' 's dimension is invalid (%ld!=%d)", 
+      VecGetDim(output), NNGetNbOutput(that));
+    PBErrCatch(NeuraNetErr);
+  }
+#endif
+  if (!NNEvalPlanIsUpToDate(ctx->_plan, that)) {
+    NNEvalPlanCompile(ctx->_plan, that);
+    if (VecGetDim(ctx->_hidVal) < ctx->_plan->_nbHid) {
+      VecFree(&(ctx->_hidVal));
+      ctx->_hidVal = VecFloatCreate(ctx->_plan->_nbHid);
+    }
+  }
+  NNEvalPlanRun(ctx->_plan, input->_val, ctx->_hidVal->_val, 
+    output->_val);
+}
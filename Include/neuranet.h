@@ -136,6 +136,8 @@ NeuraNet* NeuraNetCreateFullyConnected(const int nbIn, const int nbOut,
 //    10,16,25, 11,17,25, 12,18,26, 13,19,26, 12,19,27, 13,20,27, 
 //    14,21,26, 15,22,26, 14,22,27, 15,23,27, 16,24,28, 17,24,29, 
 //    18,25,28, 19,25,29, 20,26,28, 21,26,29, 22,27,28, 23,27,29
+// The structure of convolution can be given to a NNEvalPlan with 
+// NNEvalPlanSetConvolution to evaluate it with a sliding window
 NeuraNet* NeuraNetCreateConvolution(const VecShort* const dimIn, 
   const int nbOutput, const VecShort* const dimCell, 
   const int depthConv, const int thickConv);
@@ -254,11 +256,49 @@ bool NNDecodeAsJSON(NeuraNet** that, const JSONNode* const json);
 // Return true if the NeuraNet could be saved, false else
 bool NNSave(const NeuraNet* const that, FILE* const stream, const bool compact);
 
+// Write the JSON encoding of the NeuraNet 'that' with the JSONWriter 
+// 'writer', as the value of the last key, an element of the current 
+// array or the root
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEncodeAsJSONStream(const NeuraNet* const that, 
+  JSONWriter* const writer);
+
+// Save the NeuraNet 'that' to the stream 'stream' with a JSONWriter, 
+// without building the JSONNode tree
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true if the NeuraNet could be saved, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNSaveFast(const NeuraNet* const that, FILE* const stream, 
+  const bool compact);
+
 // Load the NeuraNet 'that' from the stream 'stream'
 // If 'that' is not null the memory is first freed 
 // Return true if the NeuraNet could be loaded, false else
 bool NNLoad(NeuraNet** that, FILE* const stream);
 
+// Save the NeuraNet 'that' to the stream 'stream' in binary format
+// (see PBBin), the convolution parameters are saved too
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true if the NeuraNet could be saved, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNSaveBin(const NeuraNet* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the NeuraNet 'that' from the stream 'stream' in binary format
+// If 'that' is not null the memory is first freed 
+// Return true if the NeuraNet could be loaded, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNLoadBin(NeuraNet** that, FILE* const stream);
+
 // Print the NeuraNet 'that' to the stream 'stream'
 void NNPrintln(const NeuraNet* const that, FILE* const stream);
 
@@ -303,6 +343,317 @@ VecFloat* NNGetMutabilityBases(const NeuraNet* const that,
 VecFloat* NNGetMutabilityLinks(const NeuraNet* const that, 
   const VecFloat* const accuracy);
 
+// ----- NNEvalPlan
+
+// ================= Define ==================
+
+// Flags of the operations of a NNEvalPlan
+// The product of this link continues with the next operation
+#define NN_EVALOP_CHAIN 1
+// This operation is the last one toward its destination value
+#define NN_EVALOP_LAST 2
+// The destination value is an output value (not clamped)
+#define NN_EVALOP_OUT 4
+// Number of input vectors evaluated at once by a thread in NNEvalBatch
+#define NN_EVALBATCHCHUNK 256
+// Minimum number of link evaluations from which NNEvalBatch actually
+// uses several threads
+#define NN_EVALBATCHMINPARALLEL 2000000L
+// Minimum number of destination values of a dense layer to be 
+// evaluated with the dense layer kernel by NNEvalPlanRun
+#define NN_EVALDENSEMINDIM 8
+
+// ================= Data structure ===================
+
+// One operation of a NNEvalPlan, evaluation of one active link
+// slope * (x + shift) + bias, where slope = tan(param[0] * NN_THETA)
+typedef struct NNEvalOp {
+  // Index of the source value, in the input values if lower than the
+  // nb of input values, else in the hidden values (minus the nb of
+  // input values)
+  long _src;
+  // Index of the destination value in the hidden values, or in the
+  // output values if the flag NN_EVALOP_OUT is set
+  long _dst;
+  // Parameters of the base function
+  float _slope;
+  float _shift;
+  float _bias;
+  // Flags (NN_EVALOP_xxx)
+  int _flag;
+} NNEvalOp;
+
+// Dense layer of a NNEvalPlan: a range of consecutive destination 
+// values each linked once, in the same order, to the same range of 
+// consecutive source values and nothing else, as in the nets created 
+// by NeuraNetCreateFullyConnected
+// The parameters of the links are stored by source value, each row
+// running along the destination values
+typedef struct NNEvalLayer {
+  // Index of the first operation of the layer in the plan, its 
+  // operations are the next _nbSrc * _nbDst ones
+  long _iOp;
+  // First source value (same convention as NNEvalOp._src) and nb of 
+  // source values
+  long _src;
+  long _nbSrc;
+  // First destination value (same convention as NNEvalOp._dst) and nb 
+  // of destination values
+  long _dst;
+  long _nbDst;
+  // Flag to memorize if the destination values are output values
+  bool _isOut;
+  // Parameters of the links, _nbSrc * _nbDst each
+  float* _slope;
+  float* _shift;
+  float* _bias;
+} NNEvalLayer;
+
+// Convolution map of a NNEvalPlan: the hidden values of one convolution
+// of one layer of the structure of convolution of a NeuraNet created 
+// by NeuraNetCreateConvolution (cf NNEvalPlanSetConvolution)
+// The links toward all the destination values share the parameters of
+// the base function of their position in the cell, hence they are 
+// memorized once per position instead of once per link
+typedef struct NNEvalConv {
+  // First source value (same convention as NNEvalOp._src)
+  long _src;
+  // First destination value, in the hidden values
+  long _dst;
+  // Nb of rows of destination values (along the first dimension) and 
+  // nb of destination values per row
+  long _nbRow;
+  long _lenRow;
+  // Nb of positions in the convolution cell
+  long _nbCell;
+  // Offsets in the source values of the first source of each row 
+  // (_nbRow values) followed by the offsets of each position in the 
+  // cell (_nbCell values)
+  long* _offset;
+  // Parameters of the links, _nbCell each
+  float* _slope;
+  float* _shift;
+  float* _bias;
+} NNEvalConv;
+
+// Evaluation plan of a NeuraNet: its active links pruned, sorted by
+// destination (which is a topological order as the input id of a link
+// is always lower than its output id) and with the base functions
+// precomputed, plus a copy of the bases and links it was compiled from
+// to detect when it becomes out of date
+// Dense layers in the operations are detected and evaluated by 
+// NNEvalPlanRun with SIMD along their destination values
+// If the plan knows the structure of convolution of the NeuraNet 
+// (cf NNEvalPlanSetConvolution) the links of the convolution cells are
+// replaced by convolution maps, evaluated before the operations
+typedef struct NNEvalPlan {
+  // Nb of input values
+  long _nbIn;
+  // Nb of hidden values
+  long _nbHid;
+  // Nb of output values
+  long _nbOut;
+  // Nb of operations
+  long _nbOp;
+  // Operations
+  NNEvalOp* _ops;
+  // Nb of dense layers
+  long _nbLayer;
+  // Dense layers, in increasing order of their first operation
+  NNEvalLayer* _layers;
+  // Structure of convolution of the NeuraNet, null if unknown
+  VecShort* _dimIn;
+  VecShort* _dimCell;
+  int _depthConv;
+  int _thickConv;
+  // Nb of convolution maps
+  long _nbConv;
+  // Convolution maps, in increasing order of their destination values
+  NNEvalConv* _convs;
+  // Copy of the bases and links at compilation time
+  VecFloat* _bases;
+  VecLong* _links;
+} NNEvalPlan;
+
+// Job shared by the threads of NNEvalBatch
+typedef struct NNEvalBatchJob {
+  // Plan, input and output vectors
+  const NNEvalPlan* _plan;
+  const VecFloatBatch* _inputs;
+  VecFloatBatch* _outputs;
+  // Number of chunks of NN_EVALBATCHCHUNK input vectors
+  long _nbChunk;
+  // Index of the next chunk to be processed
+  long _nextChunk;
+  // Mutex protecting _nextChunk
+  pthread_mutex_t _mutex;
+} NNEvalBatchJob;
+
+// ================ Functions declaration ====================
+
+// Create a new NNEvalPlan compiled from the NeuraNet 'nn'
+#if BUILDMODE != 0
+static inline
+#endif
+NNEvalPlan* NNEvalPlanCreate(const NeuraNet* const nn);
+
+// Free the memory used by the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanFree(NNEvalPlan** const that);
+
+// Compile the NNEvalPlan 'that' from the current bases and links of
+// the NeuraNet 'nn'
+// Links which are inactive or refer to values out of bounds are
+// pruned, as well as those whose input id is not lower than their
+// output id, or whose base id is out of bounds
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanCompile(NNEvalPlan* const that, const NeuraNet* const nn);
+
+// Memorize in the NNEvalPlan 'that' the structure of convolution of 
+// the NeuraNet 'nn' created by NeuraNetCreateConvolution(dimIn, 
+// nbOutput, dimCell, depthConv, thickConv) and recompile the plan
+// The links of the convolution cells are then evaluated with a sliding
+// window over the source values and their shared parameters, as long 
+// as they match the structure of convolution (they don't anymore if
+// the links of 'nn' have been modified since its creation), else they
+// are evaluated as any other links
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanSetConvolution(NNEvalPlan* const that, 
+  const NeuraNet* const nn, const VecShort* const dimIn, 
+  const VecShort* const dimCell, const int depthConv, 
+  const int thickConv);
+
+// Return true if the NNEvalPlan 'that' has been compiled from the
+// current bases and links of the NeuraNet 'nn', false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool NNEvalPlanIsUpToDate(const NNEvalPlan* const that,
+  const NeuraNet* const nn);
+
+// Get the nb of operations of the NNEvalPlan 'that' (the links of its
+// convolution maps excluded)
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbOp(const NNEvalPlan* const that);
+
+// Get the nb of dense layers of the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbLayer(const NNEvalPlan* const that);
+
+// Get the nb of convolution maps of the NNEvalPlan 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long NNEvalPlanGetNbConv(const NNEvalPlan* const that);
+
+// Run the NNEvalPlan 'that' on the input values 'input' and
+// memorize the hidden values in 'hidVal' and the output values in
+// 'output'
+// 'hidVal' and 'output' are set to 0.0 before evaluating
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalPlanRun(const NNEvalPlan* const that,
+  const float* const input, float* const hidVal, float* const output);
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' with its NNEvalPlan 'plan' and memorize the result
+// in 'output', as NNEval
+// 'plan' must be up to date (cf NNEvalPlanIsUpToDate), NNEvalFast
+// checks it automatically
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalWithPlan(const NeuraNet* const that,
+  const NNEvalPlan* const plan, const VecFloat* const input,
+  VecFloat* const output);
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' and memorize the result in 'output', as NNEval
+// The evaluation uses the NNEvalPlan 'plan', which is recompiled first
+// if the bases or links of 'that' have changed since its last
+// compilation (NNSetBases, NNBasesSet, NNSetLinks, ...)
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalFast(const NeuraNet* const that, NNEvalPlan* const plan,
+  const VecFloat* const input, VecFloat* const output);
+
+// Calculate the output values for each vector of input values of
+// 'inputs' for the NeuraNet 'that' and memorize the results in the
+// vectors of 'outputs', as NNEval
+// The evaluation uses the NNEvalPlan 'plan', recompiled first if
+// needed as in NNEvalFast, and runs each link over chunks of
+// NN_EVALBATCHCHUNK input vectors at once using 'nbThread' threads (if
+// 'nbThread' <= 0, one per online core), small batches are processed
+// by the calling thread only
+// Each thread uses its own hidden values, the hidden values of 'that'
+// are left unchanged
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalBatch(const NeuraNet* const that, NNEvalPlan* const plan,
+  const VecFloatBatch* const inputs, VecFloatBatch* const outputs,
+  int nbThread);
+
+// ----- NNEvalCtx
+
+// ================= Data structure ===================
+
+// Scratch state of the evaluation of a NeuraNet: its compiled plan and
+// hidden values
+// One NNEvalCtx per thread allows to evaluate the same NeuraNet from 
+// several threads at once as the NeuraNet is left unchanged
+typedef struct NNEvalCtx {
+  // Evaluation plan
+  NNEvalPlan* _plan;
+  // Hidden values
+  VecFloat* _hidVal;
+} NNEvalCtx;
+
+// ================ Functions declaration ====================
+
+// Create a new NNEvalCtx for the NeuraNet 'nn'
+#if BUILDMODE != 0
+static inline
+#endif
+NNEvalCtx* NNEvalCtxCreate(const NeuraNet* const nn);
+
+// Free the memory used by the NNEvalCtx 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalCtxFree(NNEvalCtx** const that);
+
+// Get the hidden values of the last evaluation with the NNEvalCtx 
+// 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const VecFloat* NNEvalCtxHiddenValues(const NNEvalCtx* const that);
+
+// Calculate the output values for the input values 'input' for the
+// NeuraNet 'that' and memorize the result in 'output', as NNEval
+// The plan and the hidden values are those of the NNEvalCtx 'ctx', 
+// the plan is recompiled first if needed as in NNEvalFast
+// 'that' is not modified, so it can be evaluated by several threads 
+// at once as long as each one uses its own NNEvalCtx
+#if BUILDMODE != 0
+static inline
+#endif
+void NNEvalWithCtx(const NeuraNet* const that, NNEvalCtx* const ctx,
+  const VecFloat* const input, VecFloat* const output);
+
 // ================= Interface with library GenAlg ==================
 
 // Get the length of the adn of float values to be used in the GenAlg 
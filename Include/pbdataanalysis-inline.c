@@ -2,6 +2,70 @@
 
 // ----------------- Principal component analysis ---------------
 
+// Same as PCAConvert but the samples are normalized, centered and 
+// projected all at once through a VecFloatBatch
+#if BUILDMODE != 0 
+static inline 
+#endif
+GDataSetVecFloat PCAConvertFast(
+  const PrincipalComponentAnalysis* const that,
+  const GDataSetVecFloat* const dataset, const int nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'that' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (dataset == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'dataset' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (nb <= 0 || nb > PCAGetNbComponents(that)) {
+    PBDataAnalysisErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBDataAnalysisErr->_msg, "'nb' is invalid (0<%d<=%d)",
+      nb, PCAGetNbComponents(that));
+    PBErrCatch(PBDataAnalysisErr);
+  }
+#endif
+  // Let the library handle the degenerated cases
+  if (PCAGetNbComponents(that) == 0 || GDSGetSize(dataset) == 0)
+    return PCAConvert(that, dataset, nb);
+  GDataSetVecFloat res = GDSClone(dataset);
+  GSetVecFloat* samples = (GSetVecFloat*)GDSSamples(&res);
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(samples);
+  VecFloatBatchNormalise(batch);
+  VecFloatBatchMeanCenter(batch);
+  VecFloatBatch* proj = VecFloatBatchGetProj(batch, 
+    PCAComponents(that), nb);
+  // Replace the samples of the clone with their projection
+  while (GSetNbElem(samples) > 0) {
+    VecFloat* sample = GSetPop(samples);
+    VecFree(&sample);
+  }
+  GSetVecFloat projSamples = VecFloatBatchGetGSet(proj);
+  GSetMerge(samples, &projSamples);
+  VecFloatBatchFree(&batch);
+  VecFloatBatchFree(&proj);
+  VecSet(res._dataSet._sampleDim, 0, nb);
+  // Update the name and description
+  const char* fmtName = "%s - PCA%dD";
+  char* name = PBErrMalloc(PBDataAnalysisErr, 
+    strlen(fmtName) + strlen(GDSName(dataset)) + 12);
+  sprintf(name, fmtName, GDSName(dataset), nb);
+  free(res._dataSet._name);
+  res._dataSet._name = name;
+  const char* fmtDesc = 
+    "%s\nProjection on the %d first principal components.";
+  char* desc = PBErrMalloc(PBDataAnalysisErr, 
+    strlen(fmtDesc) + strlen(GDSDesc(dataset)) + 12);
+  sprintf(desc, fmtDesc, GDSDesc(dataset), nb);
+  free(res._dataSet._desc);
+  res._dataSet._desc = desc;
+  GDSResetCategories((GDataSet*)&res);
+  return res;
+}
+
 // Get the principal components of the PrincipalComponentAnalysis 'that'
 #if BUILDMODE != 0 
 static inline 
@@ -39,6 +103,237 @@ int PCAGetNbComponents(
 
 // ================ Functions implementation ====================
 
+// Replace the centers of the KMeansClusters 'that' with 'K' null 
+// vectors of dimension 'dim'
+static inline void KMeansClustersResetCenters(KMeansClusters* const that,
+  const int K, const long dim) {
+  while (GSetNbElem(&(that->_centers)) > 0) {
+    VecFloat* center = GSetPop(&(that->_centers));
+    VecFree(&center);
+  }
+  for (int iCluster = K; iCluster--;)
+    GSetPush(&(that->_centers), VecFloatCreate(dim));
+}
+
+// Initialise the centers of the KMeansClusters 'that' for the input
+// data 'batch' according to its seed technique, with the PBRandom 'rng'
+static inline void KMeansClustersInitWith(KMeansClusters* const that,
+  const VecFloatBatch* const batch, PBRandom* const rng) {
+  const long nb = VecFloatBatchGetNb(batch);
+  const long dim = VecFloatBatchGetDim(batch);
+  const int K = GSetNbElem(&(that->_centers));
+  GSetElem* elem = that->_centers._set._head;
+  if (that->_seed == KMeansClustersSeed_Random) {
+    // Centers uniformly distributed inside the bounding box of inputs
+    float* bounds = PBErrMalloc(PBDataAnalysisErr, sizeof(float) * 2 * dim);
+    for (long iDim = dim; iDim--;) {
+      const float* const comp = VecFloatBatchComp(batch, iDim);
+      bounds[2 * iDim] = bounds[2 * iDim + 1] = comp[0];
+      for (long iVec = nb; iVec--;) {
+        bounds[2 * iDim] = MIN(bounds[2 * iDim], comp[iVec]);
+        bounds[2 * iDim + 1] = MAX(bounds[2 * iDim + 1], comp[iVec]);
+      }
+    }
+    for (; elem != NULL; elem = elem->_next) {
+      VecFloat* center = (VecFloat*)(elem->_data);
+      for (long iDim = 0; iDim < dim; ++iDim)
+        center->_val[iDim] = PBRandomGetFloatRange(rng, 
+          bounds[2 * iDim], bounds[2 * iDim + 1]);
+    }
+    free(bounds);
+  } else if (that->_seed == KMeansClustersSeed_Forgy) {
+    // Centers on K distinct inputs chosen at random
+    long* iVecs = PBErrMalloc(PBDataAnalysisErr, sizeof(long) * nb);
+    for (long iVec = nb; iVec--;)
+      iVecs[iVec] = iVec;
+    for (int iCluster = 0; elem != NULL; ++iCluster, elem = elem->_next) {
+      const long j = iCluster + PBRandomGetLong(rng, nb - iCluster);
+      const long swap = iVecs[iCluster];
+      iVecs[iCluster] = iVecs[j];
+      iVecs[j] = swap;
+      VecFloat* center = (VecFloat*)(elem->_data);
+      for (long iDim = dim; iDim--;)
+        center->_val[iDim] = VecFloatBatchGet(batch, iVecs[iCluster], iDim);
+    }
+    free(iVecs);
+  } else {
+    // K-means++: the first center on a random input, the following 
+    // ones on an input chosen with a probability proportional to its 
+    // squared distance to the nearest center already chosen
+    float* minDist = PBErrMalloc(PBDataAnalysisErr, sizeof(float) * nb);
+    float* dist = PBErrMalloc(PBDataAnalysisErr, sizeof(float) * nb);
+    long iVecCenter = PBRandomGetLong(rng, nb);
+    for (int iCluster = 0; iCluster < K; ++iCluster) {
+      VecFloat* center = (VecFloat*)(elem->_data);
+      for (long iDim = dim; iDim--;)
+        center->_val[iDim] = VecFloatBatchGet(batch, iVecCenter, iDim);
+      elem = elem->_next;
+      if (iCluster == K - 1)
+        break;
+      float* const acc = (iCluster == 0 ? minDist : dist);
+      memset(acc, 0, sizeof(float) * nb);
+      for (long iDim = 0; iDim < dim; ++iDim)
+        VecFloatKernelAddSqDiff(VecFloatBatchComp(batch, iDim), 
+          center->_val[iDim], acc, nb);
+      double sum = 0.0;
+      for (long iVec = 0; iVec < nb; ++iVec) {
+        if (iCluster > 0 && dist[iVec] < minDist[iVec])
+          minDist[iVec] = dist[iVec];
+        sum += minDist[iVec];
+      }
+      const double target = sum * PBRandomGetFloat(rng);
+      double cumul = 0.0;
+      iVecCenter = nb - 1;
+      for (long iVec = 0; iVec < nb; ++iVec) {
+        cumul += minDist[iVec];
+        if (cumul > target) {
+          iVecCenter = iVec;
+          break;
+        }
+      }
+    }
+    free(minDist);
+    free(dist);
+  }
+}
+
+// Run the Lloyd iterations of the KMeansClusters 'that' on the input
+// data 'batch' from the current centers until the clusters are stable
+static inline void KMeansClustersLloyd(KMeansClusters* const that,
+  const VecFloatBatch* const batch) {
+  const long nb = VecFloatBatchGetNb(batch);
+  const long dim = VecFloatBatchGetDim(batch);
+  const int K = GSetNbElem(&(that->_centers));
+  long* ids = PBErrMalloc(PBDataAnalysisErr, sizeof(long) * nb);
+  long* prevIds = PBErrMalloc(PBDataAnalysisErr, sizeof(long) * nb);
+  double* sums = PBErrMalloc(PBDataAnalysisErr, sizeof(double) * K * dim);
+  long* counts = PBErrMalloc(PBDataAnalysisErr, sizeof(long) * K);
+  for (long iVec = nb; iVec--;)
+    prevIds[iVec] = -1;
+  bool flagChanged = true;
+  while (flagChanged) {
+    // Assign each input to its nearest center
+    VecFloatBatchGetIdNearest(batch, &(that->_centers), ids);
+    flagChanged = false;
+    for (long iVec = nb; iVec-- && !flagChanged;)
+      flagChanged = (ids[iVec] != prevIds[iVec]);
+    if (flagChanged) {
+      // Move each center to the mean of its inputs, a center without
+      // inputs stays where it is
+      memset(sums, 0, sizeof(double) * K * dim);
+      memset(counts, 0, sizeof(long) * K);
+      for (long iVec = nb; iVec--;)
+        ++(counts[ids[iVec]]);
+      for (long iDim = dim; iDim--;) {
+        const float* const comp = VecFloatBatchComp(batch, iDim);
+        for (long iVec = nb; iVec--;)
+          sums[ids[iVec] * dim + iDim] += comp[iVec];
+      }
+      const GSetElem* elem = GSetHeadElem(&(that->_centers));
+      for (long iCluster = 0; elem != NULL; ++iCluster) {
+        if (counts[iCluster] > 0) {
+          VecFloat* center = (VecFloat*)GSetElemData(elem);
+          for (long iDim = dim; iDim--;)
+            center->_val[iDim] = 
+              sums[iCluster * dim + iDim] / (double)(counts[iCluster]);
+        }
+        elem = GSetElemNext(elem);
+      }
+      long* swap = prevIds;
+      prevIds = ids;
+      ids = swap;
+    }
+  }
+  free(ids);
+  free(prevIds);
+  free(sums);
+  free(counts);
+}
+
+// Same as KMeansClustersSearch but the assignment of the input data to
+// the clusters and the update of the centers are made on all the input
+// data at once through a VecFloatBatch
+#if BUILDMODE != 0 
+static inline 
+#endif
+void KMeansClustersSearchFast(KMeansClusters* const that,
+  const GSetVecFloat* const input, const int K) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'that' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (input == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'input' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (K <= 0 || K > GSetNbElem(input)) {
+    PBDataAnalysisErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBDataAnalysisErr->_msg, "'K' is invalid (0<%d<=%ld)",
+      K, GSetNbElem(input));
+    PBErrCatch(PBDataAnalysisErr);
+  }
+#endif
+  // Reset the centers and initialise them with the seed technique
+  KMeansClustersResetCenters(that, K, 
+    VecGetDim((VecFloat*)GSetHead(input)));
+  switch (that->_seed) {
+    case KMeansClustersSeed_Random:
+      KMeansClustersInitRandom(that, input);
+      break;
+    case KMeansClustersSeed_Forgy:
+      KMeansClustersInitForgy(that, input);
+      break;
+    case KMeansClustersSeed_PlusPlus:
+      KMeansClustersInitPlusPlus(that, input);
+      break;
+    default:
+      break;
+  }
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(input);
+  KMeansClustersLloyd(that, batch);
+  VecFloatBatchFree(&batch);
+}
+
+// Same as KMeansClustersSearchFast but the centers are initialised 
+// with the PBRandom 'rng' instead of the global random generator
+#if BUILDMODE != 0 
+static inline 
+#endif
+void KMeansClustersSearchWith(KMeansClusters* const that,
+  const GSetVecFloat* const input, const int K, PBRandom* const rng) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'that' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (input == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'input' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (rng == NULL) {
+    PBDataAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBDataAnalysisErr->_msg, "'rng' is null");
+    PBErrCatch(PBDataAnalysisErr);
+  }
+  if (K <= 0 || K > GSetNbElem(input)) {
+    PBDataAnalysisErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBDataAnalysisErr->_msg, "'K' is invalid (0<%d<=%ld)",
+      K, GSetNbElem(input));
+    PBErrCatch(PBDataAnalysisErr);
+  }
+#endif
+  VecFloatBatch* batch = VecFloatBatchCreateFromGSet(input);
+  KMeansClustersResetCenters(that, K, VecFloatBatchGetDim(batch));
+  KMeansClustersInitWith(that, batch, rng);
+  KMeansClustersLloyd(that, batch);
+  VecFloatBatchFree(&batch);
+}
+
 // Get the set of clusters' center for the KMeansClusters 'that'
 #if BUILDMODE != 0 
 static inline 
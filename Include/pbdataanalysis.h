@@ -54,6 +54,15 @@ void PCASearch(PrincipalComponentAnalysis* const that,
 GDataSetVecFloat PCAConvert(const PrincipalComponentAnalysis* const that,
   const GDataSetVecFloat* const dataset, const int nb);
 
+// Same as PCAConvert but the samples are normalized, centered and 
+// projected all at once through a VecFloatBatch
+#if BUILDMODE != 0 
+static inline 
+#endif
+GDataSetVecFloat PCAConvertFast(
+  const PrincipalComponentAnalysis* const that,
+  const GDataSetVecFloat* const dataset, const int nb);
+
 // Get the principal components of the PrincipalComponentAnalysis 'that'
 #if BUILDMODE != 0 
 static inline 
@@ -107,6 +116,33 @@ void KMeansClustersFreeStatic(KMeansClusters* const that);
 void KMeansClustersSearch(KMeansClusters* const that,
   const GSetVecFloat* const input, const int K);
 
+// Initialize the centers of the KMeansClusters 'that' for the 'input'
+// data with the Random, Forgy or PlusPlus technique
+// The K centers must have been allocated with the dimension of 'input'
+void KMeansClustersInitRandom(KMeansClusters* const that,
+  const GSetVecFloat* const input);
+void KMeansClustersInitForgy(KMeansClusters* const that,
+  const GSetVecFloat* const input);
+void KMeansClustersInitPlusPlus(KMeansClusters* const that,
+  const GSetVecFloat* const input);
+
+// Same as KMeansClustersSearch but the assignment of the input data to
+// the clusters and the update of the centers are made on all the input
+// data at once through a VecFloatBatch
+#if BUILDMODE != 0 
+static inline 
+#endif
+void KMeansClustersSearchFast(KMeansClusters* const that,
+  const GSetVecFloat* const input, const int K);
+
+// Same as KMeansClustersSearchFast but the centers are initialised 
+// with the PBRandom 'rng' instead of the global random generator
+#if BUILDMODE != 0 
+static inline 
+#endif
+void KMeansClustersSearchWith(KMeansClusters* const that,
+  const GSetVecFloat* const input, const int K, PBRandom* const rng);
+
 // Get the set of clusters' center for the KMeansClusters 'that'
 #if BUILDMODE != 0 
 static inline 
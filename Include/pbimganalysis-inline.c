@@ -629,6 +629,65 @@ const NeuraNet* ISCRGBNeuraNet(
   return that->_nn;
 }
 
+// Same as ISCRGBPredict but the pixels are evaluated all at once by 
+// NNEvalBatch, in parallel and without modifying the NeuraNet
+#if BUILDMODE != 0
+static inline
+#endif
+VecFloat* ISCRGBPredictFast(const ImgSegmentorCriterionRGB* const that,
+  const VecFloat* input, const VecShort2D* const dim, const int iSample) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBImgAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBImgAnalysisErr->_msg, "'that' is null");
+    PBErrCatch(PBImgAnalysisErr);
+  }
+  if (input == NULL) {
+    PBImgAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBImgAnalysisErr->_msg, "'input' is null");
+    PBErrCatch(PBImgAnalysisErr);
+  }
+  if (dim == NULL) {
+    PBImgAnalysisErr->_type = PBErrTypeNullPointer;
+    sprintf(PBImgAnalysisErr->_msg, "'dim' is null");
+    PBErrCatch(PBImgAnalysisErr);
+  }
+  if (VecGetDim(input) != 3L * VecGet(dim, 0) * VecGet(dim, 1)) {
+    PBImgAnalysisErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBImgAnalysisErr->_msg, 
+      "'input' 's dimension is invalid (%ld!=%ld)", 
+      VecGetDim(input), 3L * VecGet(dim, 0) * VecGet(dim, 1));
+    PBErrCatch(PBImgAnalysisErr);
+  }
+#endif
+  // Unused argument
+  (void)iSample;
+  const int nbClass = ISCGetNbClass(that);
+  const long nbPixel = (long)VecGet(dim, 0) * (long)VecGet(dim, 1);
+  VecFloat* res = VecFloatCreate(nbClass * nbPixel);
+  if (nbPixel == 0)
+    return res;
+  // Gather the RGB values of the pixels
+  VecFloatBatch* inputs = VecFloatBatchCreate(nbPixel, 3);
+  for (long iPixel = nbPixel; iPixel--;)
+    for (long iRGB = 3; iRGB--;)
+      inputs->_val[iRGB * inputs->_stride + iPixel] = 
+        input->_val[iPixel * 3 + iRGB];
+  // Evaluate all the pixels
+  VecFloatBatch* outputs = VecFloatBatchCreate(nbPixel, nbClass);
+  NNEvalPlan* plan = NNEvalPlanCreate(that->_nn);
+  NNEvalBatch(that->_nn, plan, inputs, outputs, 0);
+  // Scatter the result
+  for (long iPixel = nbPixel; iPixel--;)
+    for (long iClass = nbClass; iClass--;)
+      res->_val[iPixel * nbClass + iClass] = 
+        outputs->_val[iClass * outputs->_stride + iPixel];
+  NNEvalPlanFree(&plan);
+  VecFloatBatchFree(&outputs);
+  VecFloatBatchFree(&inputs);
+  return res;
+}
+
 // ---- ImgSegmentorCriterion
 
 // Return the nb of class of the ImgSegmentorCriterion 'that'
@@ -620,6 +620,14 @@ void ImgSegmentorCriterionRGBFree(ImgSegmentorCriterionRGB** that);
 VecFloat* ISCRGBPredict(const ImgSegmentorCriterionRGB* const that,
   const VecFloat* input, const VecShort2D* const dim, const int iSample);
 
+// Same as ISCRGBPredict but the pixels are evaluated all at once by 
+// NNEvalBatch, in parallel and without modifying the NeuraNet
+#if BUILDMODE != 0
+static inline
+#endif
+VecFloat* ISCRGBPredictFast(const ImgSegmentorCriterionRGB* const that,
+  const VecFloat* input, const VecShort2D* const dim, const int iSample);
+
 // Return the number of int parameters for the criterion 'that'
 long ISCRGBGetNbParamInt(const ImgSegmentorCriterionRGB* const that);
 
@@ -139,3 +139,1511 @@ void JSONArrayValFlush(JSONArrayVal* const that) {
     free(val);
   }
 }
+
+// Free the labels of the JSON node 'that' and its subnodes
+// Return the number of nodes
+static inline long JSONFreeLabels(JSONNode* const that) {
+  long nb = 1;
+  free(JSONLabel(that));
+  GenTreeSetData(that, NULL);
+  for (const GSetElem* e = GenTreeSubtrees(that)->_set._head; e != NULL; 
+    e = e->_next)
+    nb += JSONFreeLabels((JSONNode*)(e->_data));
+  return nb;
+}
+
+// Free the memory used by the pooled JSON node 'that' and its 
+// subnodes, created with JSONCreatePool and JSONAddPropStrPool
+// The memory used by the label of each node is freed too
+// If all the blocks in use in 'treePool' and 'elemPool' belong to 
+// 'that', the pools are flushed in one call each
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONFreePool(JSONNode** that, GSetPool* const treePool, 
+  GSetPool* const elemPool) {
+  if (that == NULL || *that == NULL) return;
+  // Free the labels
+  JSONFreeLabels(*that);
+  // Give back the nodes to the pools
+  GenTreeFreePool(that, treePool, elemPool);
+}
+
+// Add a property to the pooled node 'that'. The property's key is a 
+// copy of 'key' and its value is a copy of 'val'. The nodes are 
+// allocated from 'treePool' and the elements of their sets of 
+// subtrees from 'elemPool'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONAddPropStrPool(JSONNode* const that, const char* const key, 
+  const char* const val, GSetPool* const treePool, 
+  GSetPool* const elemPool) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (key == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'key' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (val == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'val' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  // Create the node for the key and the node for the value
+  JSONNode* nodeKey = (JSONNode*)GenTreeAppendDataPool(that, NULL, 
+    treePool, elemPool);
+  JSONNode* nodeVal = (JSONNode*)GenTreeAppendDataPool(nodeKey, NULL, 
+    treePool, elemPool);
+  // Set the key and val label
+  JSONSetLabel(nodeKey, key);
+  JSONSetLabel(nodeVal, val);
+}
+
+// Get the next character from the JSONSAXReader 'that'
+// Return EOF at the end of the source
+static inline int JSONSAXGetChar(JSONSAXReader* const that) {
+  if (that->_back != EOF) {
+    int c = that->_back;
+    that->_back = EOF;
+    return c;
+  }
+  if (that->_stream != NULL)
+    return getc(that->_stream);
+  if (*(that->_str) == '\0')
+    return EOF;
+  return (unsigned char)*((that->_str)++);
+}
+
+// Get the next non blank character from the JSONSAXReader 'that'
+static inline int JSONSAXGetNonBlank(JSONSAXReader* const that) {
+  int c = JSONSAXGetChar(that);
+  while (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+    c = JSONSAXGetChar(that);
+  return c;
+}
+
+// Append the character 'c' to the buffer of the JSONSAXReader 'that'
+static inline void JSONSAXPutChar(JSONSAXReader* const that, 
+  const char c) {
+  if (that->_len + 1 >= that->_bufSize) {
+    char* buf = PBErrMalloc(JSONErr, 2 * that->_bufSize);
+    memcpy(buf, that->_buf, that->_len);
+    free(that->_buf);
+    that->_buf = buf;
+    that->_bufSize *= 2;
+  }
+  that->_buf[(that->_len)++] = c;
+}
+
+// Append the code point 'cp' encoded in UTF-8 to the buffer of the 
+// JSONSAXReader 'that'
+static inline void JSONSAXPutCodePoint(JSONSAXReader* const that, 
+  const unsigned long cp) {
+  if (cp < 0x80) {
+    JSONSAXPutChar(that, (char)cp);
+  } else if (cp < 0x800) {
+    JSONSAXPutChar(that, (char)(0xC0 | (cp >> 6)));
+    JSONSAXPutChar(that, (char)(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    JSONSAXPutChar(that, (char)(0xE0 | (cp >> 12)));
+    JSONSAXPutChar(that, (char)(0x80 | ((cp >> 6) & 0x3F)));
+    JSONSAXPutChar(that, (char)(0x80 | (cp & 0x3F)));
+  } else {
+    JSONSAXPutChar(that, (char)(0xF0 | (cp >> 18)));
+    JSONSAXPutChar(that, (char)(0x80 | ((cp >> 12) & 0x3F)));
+    JSONSAXPutChar(that, (char)(0x80 | ((cp >> 6) & 0x3F)));
+    JSONSAXPutChar(that, (char)(0x80 | (cp & 0x3F)));
+  }
+}
+
+// Read the 4 hexadecimal digits of a \u escape sequence from the 
+// JSONSAXReader 'that'
+// Return the code unit, or -1 if the sequence is invalid
+static inline long JSONSAXReadHex4(JSONSAXReader* const that) {
+  long ret = 0;
+  for (int iDigit = 4; iDigit--;) {
+    int c = JSONSAXGetChar(that);
+    ret <<= 4;
+    if (c >= '0' && c <= '9')
+      ret |= c - '0';
+    else if (c >= 'a' && c <= 'f')
+      ret |= c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+      ret |= c - 'A' + 10;
+    else
+      return -1;
+  }
+  return ret;
+}
+
+// Read a string (the opening quote has already been read) from the 
+// JSONSAXReader 'that' into its buffer, decoding the escape sequences
+// Return true if the string is valid, false else
+static inline bool JSONSAXReadStr(JSONSAXReader* const that) {
+  that->_len = 0;
+  while (true) {
+    int c = JSONSAXGetChar(that);
+    if (c == EOF) {
+      return false;
+    } else if (c == '"') {
+      break;
+    } else if (c == '\\') {
+      c = JSONSAXGetChar(that);
+      switch (c) {
+        case '"': case '\\': case '/':
+          JSONSAXPutChar(that, (char)c);
+          break;
+        case 'b':
+          JSONSAXPutChar(that, '\b');
+          break;
+        case 'f':
+          JSONSAXPutChar(that, '\f');
+          break;
+        case 'n':
+          JSONSAXPutChar(that, '\n');
+          break;
+        case 'r':
+          JSONSAXPutChar(that, '\r');
+          break;
+        case 't':
+          JSONSAXPutChar(that, '\t');
+          break;
+        case 'u': {
+          long cp = JSONSAXReadHex4(that);
+          if (cp < 0)
+            return false;
+          // Surrogate pair
+          if (cp >= 0xD800 && cp < 0xDC00) {
+            if (JSONSAXGetChar(that) != '\\' || 
+              JSONSAXGetChar(that) != 'u')
+              return false;
+            long low = JSONSAXReadHex4(that);
+            if (low < 0xDC00 || low >= 0xE000)
+              return false;
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+          }
+          JSONSAXPutCodePoint(that, (unsigned long)cp);
+          break;
+        }
+        default:
+          return false;
+      }
+    } else {
+      JSONSAXPutChar(that, (char)c);
+    }
+  }
+  that->_buf[that->_len] = '\0';
+  return true;
+}
+
+// Return true if the 'len' characters at 'str' are a valid unquoted 
+// value: true, false, null or a number as defined by the JSON grammar
+// The non finite values written by JSONFloatToStr (inf, -inf, nan, 
+// -nan) are accepted as numbers too
+static inline bool JSONIsLiteral(const char* const str, const long len) {
+  if ((len == 4 && strncmp(str, "true", 4) == 0) || 
+    (len == 5 && strncmp(str, "false", 5) == 0) || 
+    (len == 4 && strncmp(str, "null", 4) == 0))
+    return true;
+  const char* p = str;
+  const char* end = str + len;
+  if (p < end && *p == '-')
+    ++p;
+  if ((end - p == 3 && strncmp(p, "inf", 3) == 0) || 
+    (end - p == 3 && strncmp(p, "nan", 3) == 0))
+    return true;
+  // Integer part, without leading zero
+  if (p == end || *p < '0' || *p > '9')
+    return false;
+  if (*p == '0')
+    ++p;
+  else
+    while (p < end && *p >= '0' && *p <= '9')
+      ++p;
+  // Fraction
+  if (p < end && *p == '.') {
+    ++p;
+    if (p == end || *p < '0' || *p > '9')
+      return false;
+    while (p < end && *p >= '0' && *p <= '9')
+      ++p;
+  }
+  // Exponent
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p < end && (*p == '+' || *p == '-'))
+      ++p;
+    if (p == end || *p < '0' || *p > '9')
+      return false;
+    while (p < end && *p >= '0' && *p <= '9')
+      ++p;
+  }
+  return p == end;
+}
+
+// Read an unquoted value (number, true, false, null), whose first 
+// character 'c' has already been read, from the JSONSAXReader 'that' 
+// into its buffer
+// Return true if the value is valid, false else
+static inline bool JSONSAXReadLiteral(JSONSAXReader* const that, int c) {
+  that->_len = 0;
+  while (c != EOF && c != ',' && c != '}' && c != ']' && c != ' ' && 
+    c != '\t' && c != '\n' && c != '\r') {
+    JSONSAXPutChar(that, (char)c);
+    c = JSONSAXGetChar(that);
+  }
+  that->_back = c;
+  that->_buf[that->_len] = '\0';
+  return JSONIsLiteral(that->_buf, (long)(that->_len));
+}
+
+// Push the container 'c' ('{' or '[') on the stack of the 
+// JSONSAXReader 'that'
+static inline void JSONSAXPush(JSONSAXReader* const that, const char c) {
+  if (that->_depth == that->_stackSize) {
+    char* stack = PBErrMalloc(JSONErr, 2 * that->_stackSize);
+    memcpy(stack, that->_stack, that->_depth);
+    free(that->_stack);
+    that->_stack = stack;
+    that->_stackSize *= 2;
+  }
+  that->_stack[(that->_depth)++] = c;
+}
+
+// States of the streaming parser
+typedef enum JSONSAXState {
+  JSONSAXState_Value, JSONSAXState_ValueOrEnd, JSONSAXState_Key, 
+  JSONSAXState_KeyOrEnd, JSONSAXState_Colon, JSONSAXState_CommaOrEnd
+} JSONSAXState;
+
+// Parse the JSON from the JSONSAXReader 'that' with the callbacks of
+// 'handler'
+// Return true if the JSON is valid and no callback aborted the 
+// parsing, false else
+static inline bool JSONSAXRun(JSONSAXReader* const that, 
+  const JSONSAXHandler* const handler) {
+  void* param = handler->_param;
+  JSONSAXState state = JSONSAXState_Value;
+  while (true) {
+    int c = JSONSAXGetNonBlank(that);
+    if (c == EOF)
+      return false;
+    bool isValEnd = false;
+    switch (state) {
+      case JSONSAXState_Value:
+      case JSONSAXState_ValueOrEnd:
+        if (c == ']' && state == JSONSAXState_ValueOrEnd) {
+          --(that->_depth);
+          if (handler->_arrEnd != NULL && !handler->_arrEnd(param))
+            return false;
+          isValEnd = true;
+        } else if (c == '{') {
+          JSONSAXPush(that, '{');
+          if (handler->_objStart != NULL && !handler->_objStart(param))
+            return false;
+          state = JSONSAXState_KeyOrEnd;
+        } else if (c == '[') {
+          JSONSAXPush(that, '[');
+          if (handler->_arrStart != NULL && !handler->_arrStart(param))
+            return false;
+          state = JSONSAXState_ValueOrEnd;
+        } else if (c == '}' || c == ']' || c == ',' || c == ':') {
+          return false;
+        } else {
+          if (c == '"') {
+            if (!JSONSAXReadStr(that))
+              return false;
+          } else if (!JSONSAXReadLiteral(that, c)) {
+            return false;
+          }
+          if (handler->_val != NULL && !handler->_val(that->_buf, param))
+            return false;
+          isValEnd = true;
+        }
+        break;
+      case JSONSAXState_Key:
+      case JSONSAXState_KeyOrEnd:
+        if (c == '}' && state == JSONSAXState_KeyOrEnd) {
+          --(that->_depth);
+          if (handler->_objEnd != NULL && !handler->_objEnd(param))
+            return false;
+          isValEnd = true;
+        } else if (c == '"') {
+          if (!JSONSAXReadStr(that))
+            return false;
+          if (handler->_key != NULL && !handler->_key(that->_buf, param))
+            return false;
+          state = JSONSAXState_Colon;
+        } else {
+          return false;
+        }
+        break;
+      case JSONSAXState_Colon:
+        if (c != ':')
+          return false;
+        state = JSONSAXState_Value;
+        break;
+      case JSONSAXState_CommaOrEnd:
+        if (c == ',') {
+          state = (that->_stack[that->_depth - 1] == '{' ? 
+            JSONSAXState_Key : JSONSAXState_Value);
+        } else if (c == '}' && that->_stack[that->_depth - 1] == '{') {
+          --(that->_depth);
+          if (handler->_objEnd != NULL && !handler->_objEnd(param))
+            return false;
+          isValEnd = true;
+        } else if (c == ']' && that->_stack[that->_depth - 1] == '[') {
+          --(that->_depth);
+          if (handler->_arrEnd != NULL && !handler->_arrEnd(param))
+            return false;
+          isValEnd = true;
+        } else {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+    // If a value has been completed, the parsing ends with the first 
+    // complete top level value
+    if (isValEnd) {
+      if (that->_depth == 0)
+        return true;
+      state = JSONSAXState_CommaOrEnd;
+    }
+  }
+}
+
+// Parse the JSON from the stream 'stream', or the string 'str' if 
+// 'stream' is null, with the callbacks of 'handler'
+static inline bool JSONSAXParse(FILE* const stream, 
+  const char* const str, const JSONSAXHandler* const handler) {
+  JSONSAXReader reader = {._stream = stream, ._str = str, ._back = EOF,
+    ._len = 0, ._bufSize = PBJSON_MAXLENGTHLBL, ._depth = 0, 
+    ._stackSize = PBJSON_CONTEXTSIZE};
+  reader._buf = PBErrMalloc(JSONErr, reader._bufSize);
+  reader._stack = PBErrMalloc(JSONErr, reader._stackSize);
+  bool ret = JSONSAXRun(&reader, handler);
+  // Give back to the stream the character read after a top level 
+  // literal
+  if (stream != NULL && reader._back != EOF)
+    ungetc(reader._back, stream);
+  free(reader._buf);
+  free(reader._stack);
+  return ret;
+}
+
+// Parse the JSON on the stream 'stream' without building the JSONNode
+// tree, calling the callbacks of 'handler' as the JSON is read
+// The parsing stops at the end of the first JSON value of the stream
+// Return true if the JSON is valid and no callback aborted the 
+// parsing, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONParse(FILE* const stream, const JSONSAXHandler* const handler) {
+#if BUILDMODE == 0
+  if (stream == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'stream' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (handler == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'handler' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  return JSONSAXParse(stream, NULL, handler);
+}
+
+// Parse the JSON in the string 'str' without building the JSONNode 
+// tree, calling the callbacks of 'handler' as the JSON is read
+// Return true if the JSON is valid and no callback aborted the 
+// parsing, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONParseFromStr(const char* const str, 
+  const JSONSAXHandler* const handler) {
+#if BUILDMODE == 0
+  if (str == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'str' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (handler == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'handler' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  return JSONSAXParse(NULL, str, handler);
+}
+
+// Frame of the stack of opened objects and arrays when loading a 
+// JSONDoc
+typedef struct JSONDocFrame {
+  // Node receiving the properties of the object, or the values of the
+  // array
+  GenTree* _node;
+  // '{' for an object, '[' for an array
+  char _kind;
+  // Kind of values of the array: 0 if unknown yet, 's' for strings, 
+  // '{' for objects
+  char _arrKind;
+} JSONDocFrame;
+
+// Return the first non blank character from 'p'
+static inline char* JSONDocSkipBlank(char* p) {
+  while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+    ++p;
+  return p;
+}
+
+// Terminate in situ the string starting at 'p' (after its opening 
+// quote)
+// Return the position after the closing quote, or null if the string 
+// is not terminated
+static inline char* JSONDocScanStr(char* p) {
+  while (*p != '"') {
+    if (*p == '\0')
+      return NULL;
+    // Skip the escaped character
+    if (*p == '\\' && *(++p) == '\0')
+      return NULL;
+    ++p;
+  }
+  *p = '\0';
+  return p + 1;
+}
+
+// Terminate in situ the unquoted value (number, true, false, null) 
+// starting at 'p', moving it one character backward to keep intact 
+// the character following it
+// Set 'lbl' to the moved value
+// Return the position after the value, or null if the value is not 
+// valid
+static inline char* JSONDocScanLiteral(char* p, char** const lbl) {
+  char* start = p;
+  while (*p != '\0' && strchr(",}] \t\n\r", *p) == NULL)
+    ++p;
+  if (!JSONIsLiteral(start, p - start))
+    return NULL;
+  memmove(start - 1, start, p - start);
+  *(p - 1) = '\0';
+  *lbl = start - 1;
+  return p;
+}
+
+// Build in situ the nodes of the JSONDoc 'that' from its buffer
+// Return true if the JSON is valid, false else
+static inline bool JSONDocParse(JSONDoc* const that) {
+  GSetPool* treePool = &(that->_treePool);
+  GSetPool* elemPool = &(that->_elemPool);
+  char* p = JSONDocSkipBlank(that->_buf);
+  if (*p != '{' && *p != '[')
+    return false;
+  // The root of an array is labelled "[]", it is never modified
+  char rootKind = *p;
+  ++p;
+  that->_root = (JSONNode*)GenTreeCreateDataPool(
+    (rootKind == '[' ? (void*)"[]" : NULL), treePool);
+  // Stack of the opened objects and arrays
+  long size = PBJSON_CONTEXTSIZE;
+  long depth = 0;
+  JSONDocFrame* stack = 
+    PBErrMalloc(JSONErr, sizeof(JSONDocFrame) * size);
+  stack[depth++] = (JSONDocFrame){._node = (GenTree*)(that->_root), 
+    ._kind = rootKind, ._arrKind = 0};
+  // true if the next token can close the current object or array
+  bool canEnd = true;
+  bool ret = false;
+  while (true) {
+    JSONDocFrame* frame = stack + depth - 1;
+    GenTree* opened = NULL;
+    char kind = 0;
+    p = JSONDocSkipBlank(p);
+    if (frame->_kind == '{') {
+      if (*p == '}' && canEnd) {
+        ++p;
+        --depth;
+      } else {
+        // Key of the property
+        if (*p != '"')
+          break;
+        char* key = p + 1;
+        if ((p = JSONDocScanStr(key)) == NULL)
+          break;
+        p = JSONDocSkipBlank(p);
+        if (*p != ':')
+          break;
+        p = JSONDocSkipBlank(p + 1);
+        GenTree* node = 
+          _GenTreeAppendDataPool(frame->_node, key, treePool, elemPool);
+        // Value of the property
+        if (*p == '{' || *p == '[') {
+          opened = node;
+          kind = *p;
+          ++p;
+        } else {
+          char* lbl = p + 1;
+          if (*p == '"')
+            p = JSONDocScanStr(lbl);
+          else
+            p = JSONDocScanLiteral(p, &lbl);
+          if (p == NULL)
+            break;
+          _GenTreeAppendDataPool(node, lbl, treePool, elemPool);
+        }
+      }
+    } else {
+      if (*p == ']' && canEnd) {
+        // Empty array
+        ++p;
+        _GenTreeAppendDataPool(frame->_node, NULL, treePool, elemPool);
+        --depth;
+      } else if (*p == '{') {
+        if (frame->_arrKind == 's')
+          break;
+        // The key of an array of objects is prefixed with "[]", the 
+        // two characters before the key (opening quote and separator) 
+        // are free (the root of an array is already labelled "[]")
+        if (frame->_arrKind == 0) {
+          if (depth > 1) {
+            char* key = (char*)(frame->_node->_data) - 2;
+            key[0] = '[';
+            key[1] = ']';
+            frame->_node->_data = key;
+          }
+          frame->_arrKind = '{';
+        }
+        opened = 
+          _GenTreeAppendDataPool(frame->_node, NULL, treePool, elemPool);
+        kind = '{';
+        ++p;
+      } else if (*p == '[' || frame->_arrKind == '{') {
+        // Arrays of arrays and mixed arrays are not supported
+        break;
+      } else {
+        frame->_arrKind = 's';
+        char* lbl = p + 1;
+        if (*p == '"')
+          p = JSONDocScanStr(lbl);
+        else
+          p = JSONDocScanLiteral(p, &lbl);
+        if (p == NULL)
+          break;
+        _GenTreeAppendDataPool(frame->_node, lbl, treePool, elemPool);
+      }
+    }
+    if (opened != NULL) {
+      // Open a new object or array
+      if (depth == size) {
+        JSONDocFrame* s = 
+          PBErrMalloc(JSONErr, sizeof(JSONDocFrame) * 2 * size);
+        memcpy(s, stack, sizeof(JSONDocFrame) * size);
+        free(stack);
+        stack = s;
+        size *= 2;
+      }
+      stack[depth++] = (JSONDocFrame){._node = opened, ._kind = kind, 
+        ._arrKind = 0};
+      canEnd = true;
+      continue;
+    }
+    // A value has been completed, close the ended objects and arrays
+    bool isValid = true;
+    while (depth > 0) {
+      p = JSONDocSkipBlank(p);
+      if (*p == ',') {
+        ++p;
+        break;
+      } else if (*p == (stack[depth - 1]._kind == '{' ? '}' : ']')) {
+        ++p;
+        --depth;
+      } else {
+        isValid = false;
+        break;
+      }
+    }
+    if (!isValid)
+      break;
+    if (depth == 0) {
+      ret = true;
+      break;
+    }
+    canEnd = false;
+  }
+  free(stack);
+  return ret;
+}
+
+// Return a new JSONDoc owning the buffer 'buf' after loading in situ 
+// its content, or null if it's not a valid JSON
+static inline JSONDoc* JSONDocCreate(char* const buf) {
+  JSONDoc* that = PBErrMalloc(JSONErr, sizeof(JSONDoc));
+  that->_buf = buf;
+  that->_treePool = GSetPoolCreateStatic(sizeof(GenTree));
+  that->_elemPool = GSetPoolCreateStatic(sizeof(GSetElem));
+  that->_root = NULL;
+  if (!JSONDocParse(that))
+    JSONDocFree(&that);
+  return that;
+}
+
+// Load in situ the JSON from the stream 'stream'
+// Return the JSONDoc, or null if the JSON couldn't be loaded
+#if BUILDMODE != 0
+static inline
+#endif
+JSONDoc* JSONDocLoad(FILE* const stream) {
+#if BUILDMODE == 0
+  if (stream == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'stream' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  // Read the whole stream in one buffer
+  size_t size = PBJSON_MAXLENGTHLBL;
+  size_t len = 0;
+  char* buf = PBErrMalloc(JSONErr, size);
+  while (true) {
+    len += fread(buf + len, 1, size - len - 1, stream);
+    if (len < size - 1)
+      break;
+    char* b = PBErrMalloc(JSONErr, 2 * size);
+    memcpy(b, buf, len);
+    free(buf);
+    buf = b;
+    size *= 2;
+  }
+  if (ferror(stream)) {
+    free(buf);
+    return NULL;
+  }
+  buf[len] = '\0';
+  return JSONDocCreate(buf);
+}
+
+// Load in situ the JSON from a copy of the string 'str'
+// Return the JSONDoc, or null if the JSON couldn't be loaded
+#if BUILDMODE != 0
+static inline
+#endif
+JSONDoc* JSONDocLoadFromStr(const char* const str) {
+#if BUILDMODE == 0
+  if (str == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'str' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  char* buf = PBErrMalloc(JSONErr, strlen(str) + 1);
+  strcpy(buf, str);
+  return JSONDocCreate(buf);
+}
+
+// Free the memory used by the JSONDoc 'that', its nodes and labels
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONDocFree(JSONDoc** that) {
+  if (that == NULL || *that == NULL) return;
+  GSetPoolFlush(&((*that)->_treePool));
+  GSetPoolFlush(&((*that)->_elemPool));
+  free((*that)->_buf);
+  free(*that);
+  *that = NULL;
+}
+
+// Return the root node of the JSONDoc 'that'
+// Its label is "[]" if the JSON is an array, null if it's an object
+#if BUILDMODE != 0
+static inline
+#endif
+const JSONNode* JSONDocRoot(const JSONDoc* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  return that->_root;
+}
+
+// Powers of 10 exactly representable as double
+static const double JSONPow10[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Return 'val' multiplied by 10^'exp'
+// The result is correctly rounded if -22<='exp'<=22
+static inline double JSONScalePow10(double val, int exp) {
+  for (; exp > 22; exp -= 22)
+    val *= 1e22;
+  for (; exp < -22; exp += 22)
+    val /= 1e22;
+  return (exp >= 0 ? val * JSONPow10[exp] : val / JSONPow10[-exp]);
+}
+
+// Convert 'mant' * 10^'exp' to the nearest float and memorize it in
+// 'val' if it can be done without the standard library
+// 'mant' and 10^|'exp'| being exact doubles, the product (or quotient)
+// is correctly rounded to double, and its conversion to float is then
+// correctly rounded too unless the double lies exactly halfway between
+// two floats, where the first rounding may have decided the tie
+// Return true if 'val' has been set, false else
+static inline bool JSONDecToFloat(const uint64_t mant, const int exp, 
+  float* const val) {
+#if FLT_EVAL_METHOD == 0
+  if (mant > ((uint64_t)1 << 53) || exp < -22 || exp > 22)
+    return false;
+  const double d = JSONScalePow10((double)mant, exp);
+  if (d < FLT_MIN || d > FLT_MAX)
+    return false;
+  // The 29 low bits of the mantissa of a double in the range of normal
+  // floats are those lost by the float, halfway is 1 followed by 0s
+  uint64_t bits = 0;
+  memcpy(&bits, &d, sizeof(bits));
+  if ((bits & 0x1FFFFFFF) == 0x10000000)
+    return false;
+  *val = (float)d;
+  return true;
+#else
+  // The intermediate results may have more precision than double
+  (void)mant;
+  (void)exp;
+  (void)val;
+  return false;
+#endif
+}
+
+// Convert the string 'str' to the nearest float and memorize it 
+// in 'val'
+// Return true if the whole 'str' is a valid number, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONStrToFloat(const char* const str, float* const val) {
+#if BUILDMODE == 0
+  if (str == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'str' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (val == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'val' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  const char* ptr = str;
+  bool isNeg = (*ptr == '-');
+  if (*ptr == '-' || *ptr == '+')
+    ++ptr;
+  // Accumulate up to 19 significant digits in the mantissa, the 
+  // exponent is corrected for the digits after the point and the 
+  // ignored ones
+  uint64_t mant = 0;
+  int nbDigit = 0;
+  int nbSignif = 0;
+  int exp = 0;
+  bool isExact = true;
+  for (; *ptr >= '0' && *ptr <= '9'; ++ptr, ++nbDigit) {
+    if (nbSignif < 19) {
+      mant = mant * 10 + (uint64_t)(*ptr - '0');
+      if (mant > 0)
+        ++nbSignif;
+    } else {
+      ++exp;
+      if (*ptr != '0')
+        isExact = false;
+    }
+  }
+  if (*ptr == '.') {
+    for (++ptr; *ptr >= '0' && *ptr <= '9'; ++ptr, ++nbDigit) {
+      if (nbSignif < 19) {
+        mant = mant * 10 + (uint64_t)(*ptr - '0');
+        if (mant > 0)
+          ++nbSignif;
+        --exp;
+      } else if (*ptr != '0') {
+        isExact = false;
+      }
+    }
+  }
+  if (nbDigit == 0) {
+    // Not a decimal number (inf, nan, ...), let the standard library 
+    // decide
+    char* end = NULL;
+    *val = strtof(str, &end);
+    return (end != str && *end == '\0');
+  }
+  if (*ptr == 'e' || *ptr == 'E') {
+    ++ptr;
+    bool isNegExp = (*ptr == '-');
+    if (*ptr == '-' || *ptr == '+')
+      ++ptr;
+    if (*ptr < '0' || *ptr > '9')
+      return false;
+    int expPart = 0;
+    for (; *ptr >= '0' && *ptr <= '9'; ++ptr)
+      if (expPart < 10000)
+        expPart = expPart * 10 + (*ptr - '0');
+    exp += (isNegExp ? -expPart : expPart);
+  }
+  if (*ptr != '\0')
+    return false;
+  if (mant == 0) {
+    *val = (isNeg ? -0.0 : 0.0);
+    return true;
+  }
+  float f = 0.0;
+  if (isExact && JSONDecToFloat(mant, exp, &f)) {
+    *val = (isNeg ? -f : f);
+    return true;
+  }
+  *val = strtof(str, NULL);
+  return true;
+}
+
+// Write in 'str' the shortest decimal representation of 'val' which 
+// JSONStrToFloat (or strtof) converts back exactly to 'val'
+// 'str' must be at least PBJSON_FLOATSTRLEN long
+// Return the length of the representation
+#if BUILDMODE != 0
+static inline
+#endif
+int JSONFloatToStr(const float val, char* const str) {
+#if BUILDMODE == 0
+  if (str == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'str' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  if (isnan(val) || isinf(val))
+    return snprintf(str, PBJSON_FLOATSTRLEN, "%f", val);
+  int len = 0;
+  if (signbit(val))
+    str[len++] = '-';
+  if (val == 0.0) {
+    str[len++] = '0';
+    str[len] = '\0';
+    return len;
+  }
+  double d = fabs((double)val);
+  // Decimal exponent of the first significant digit, the estimation 
+  // from the binary exponent is at most one below
+  int exp2 = 0;
+  (void)frexp(d, &exp2);
+  int exp10 = (int)floor((double)(exp2 - 1) * 0.30102999566398120);
+  if (JSONScalePow10(1.0, exp10 + 1) <= d)
+    ++exp10;
+  // Search the smallest number of significant digits for which the 
+  // nearest decimal converts back to 'val', 9 digits always do
+  uint64_t digits = 0;
+  int nbDigit = 1;
+  int expDigit = exp10;
+  for (; nbDigit <= 9; ++nbDigit) {
+    digits = (uint64_t)(JSONScalePow10(d, nbDigit - 1 - exp10) + 0.5);
+    expDigit = exp10;
+    if (digits >= (uint64_t)JSONPow10[nbDigit]) {
+      digits = (digits + 5) / 10;
+      ++expDigit;
+    }
+    int expVal = expDigit - nbDigit + 1;
+    float back = 0.0;
+    if (!JSONDecToFloat(digits, expVal, &back)) {
+      char tmp[48];
+      snprintf(tmp, sizeof(tmp), "%llue%d", 
+        (unsigned long long)digits, expVal);
+      back = strtof(tmp, NULL);
+    }
+    if (back == (float)d)
+      break;
+  }
+  if (nbDigit > 9)
+    return len + 
+      snprintf(str + len, PBJSON_FLOATSTRLEN - len, "%.9g", d);
+  // Remove the trailing zeros
+  while (nbDigit > 1 && digits % 10 == 0) {
+    digits /= 10;
+    --nbDigit;
+  }
+  char buf[10];
+  for (int iDigit = nbDigit; iDigit--;) {
+    buf[iDigit] = '0' + (char)(digits % 10);
+    digits /= 10;
+  }
+  if (expDigit >= 0 && expDigit < 9) {
+    // Fixed notation, integer part
+    for (int iDigit = 0; iDigit <= expDigit; ++iDigit)
+      str[len++] = (iDigit < nbDigit ? buf[iDigit] : '0');
+    if (nbDigit > expDigit + 1) {
+      str[len++] = '.';
+      for (int iDigit = expDigit + 1; iDigit < nbDigit; ++iDigit)
+        str[len++] = buf[iDigit];
+    }
+  } else if (expDigit < 0 && expDigit >= -4) {
+    // Fixed notation, value lower than 1
+    str[len++] = '0';
+    str[len++] = '.';
+    for (int iZero = -expDigit - 1; iZero--;)
+      str[len++] = '0';
+    for (int iDigit = 0; iDigit < nbDigit; ++iDigit)
+      str[len++] = buf[iDigit];
+  } else {
+    // Scientific notation
+    str[len++] = buf[0];
+    if (nbDigit > 1) {
+      str[len++] = '.';
+      for (int iDigit = 1; iDigit < nbDigit; ++iDigit)
+        str[len++] = buf[iDigit];
+    }
+    str[len++] = 'e';
+    if (expDigit < 0) {
+      str[len++] = '-';
+      expDigit = -expDigit;
+    }
+    if (expDigit >= 10)
+      str[len++] = '0' + (char)(expDigit / 10);
+    str[len++] = '0' + (char)(expDigit % 10);
+  }
+  str[len] = '\0';
+  return len;
+}
+
+// Create a static JSONWriter writing on the stream 'stream', in 
+// compact form if 'compact' equals true, else in readable form
+#if BUILDMODE != 0
+static inline
+#endif
+JSONWriter JSONWriterCreateStatic(FILE* const stream, 
+  const bool compact) {
+#if BUILDMODE == 0
+  if (stream == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'stream' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONWriter that;
+  that._stream = stream;
+  that._compact = compact;
+  that._isOk = true;
+  that._isKeyPending = false;
+  that._depth = 0;
+  that._nbItem[0] = 0;
+  that._isArr[0] = false;
+  that._hasObj[0] = false;
+  that._len = 0;
+  return that;
+}
+
+// Write the buffered content of the JSONWriter 'that' to its stream
+// Return true if all the writes succeeded so far, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONWriterFlush(JSONWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  if (that->_len > 0) {
+    if (that->_isOk && 
+      fwrite(that->_buf, 1, that->_len, that->_stream) != that->_len)
+      that->_isOk = false;
+    that->_len = 0;
+  }
+  return that->_isOk;
+}
+
+// Append the 'len' bytes 'str' to the buffer of the JSONWriter 'that'
+static inline void JSONWriterWrite(JSONWriter* const that, 
+  const char* const str, const size_t len) {
+  if (that->_len + len > PBJSON_WRITERBUFSIZE)
+    JSONWriterFlush(that);
+  if (len > PBJSON_WRITERBUFSIZE) {
+    if (that->_isOk && fwrite(str, 1, len, that->_stream) != len)
+      that->_isOk = false;
+  } else {
+    memcpy(that->_buf + that->_len, str, len);
+    that->_len += len;
+  }
+}
+
+// Append the char 'c' to the buffer of the JSONWriter 'that'
+static inline void JSONWriterPutc(JSONWriter* const that, const char c) {
+  if (that->_len == PBJSON_WRITERBUFSIZE)
+    JSONWriterFlush(that);
+  that->_buf[(that->_len)++] = c;
+}
+
+// Append a new line and the indentation for the depth 'depth' to the 
+// buffer of the JSONWriter 'that', if it is not in compact form
+static inline void JSONWriterNewLine(JSONWriter* const that, 
+  const int depth) {
+  if (that->_compact)
+    return;
+  JSONWriterPutc(that, '\n');
+  for (int iDepth = depth; iDepth--;)
+    JSONWriterWrite(that, PBJSON_INDENT, sizeof(PBJSON_INDENT) - 1);
+}
+
+// Append the string 'str' between quotes to the buffer of the 
+// JSONWriter 'that'
+static inline void JSONWriterQuoted(JSONWriter* const that, 
+  const char* const str) {
+  JSONWriterPutc(that, '"');
+  JSONWriterWrite(that, str, strlen(str));
+  JSONWriterPutc(that, '"');
+}
+
+// Prepare the JSONWriter 'that' for a new value (string, object or 
+// array): nothing after a key, the separator for an element of an 
+// array
+// 'isObj' is true if the value is an object
+static inline void JSONWriterStartVal(JSONWriter* const that, 
+  const bool isObj) {
+  if (that->_isKeyPending) {
+    that->_isKeyPending = false;
+  } else if (that->_depth > 0 && that->_isArr[that->_depth]) {
+    if (that->_nbItem[that->_depth] > 0)
+      JSONWriterPutc(that, ',');
+    ++(that->_nbItem[that->_depth]);
+    // Objects in an array are written one per line
+    if (isObj) {
+      that->_hasObj[that->_depth] = true;
+      JSONWriterNewLine(that, that->_depth);
+    }
+  }
+}
+
+// Open a container (object if 'isArr' is false, else array) with the 
+// JSONWriter 'that'
+static inline void JSONWriterOpen(JSONWriter* const that, 
+  const bool isArr) {
+  JSONWriterStartVal(that, !isArr);
+  if (that->_depth + 1 >= PBJSON_WRITERMAXDEPTH) {
+    that->_isOk = false;
+    return;
+  }
+  ++(that->_depth);
+  that->_nbItem[that->_depth] = 0;
+  that->_isArr[that->_depth] = isArr;
+  that->_hasObj[that->_depth] = false;
+  JSONWriterPutc(that, (isArr ? '[' : '{'));
+}
+
+// Open/close an object with the JSONWriter 'that', as the root, the 
+// value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterObjStart(JSONWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONWriterOpen(that, false);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterObjEnd(JSONWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (that->_depth <= 0 || that->_isArr[that->_depth]) {
+    JSONErr->_type = PBErrTypeInvalidArg;
+    sprintf(JSONErr->_msg, "no object to close");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  if (that->_nbItem[that->_depth] > 0)
+    JSONWriterNewLine(that, that->_depth - 1);
+  JSONWriterPutc(that, '}');
+  --(that->_depth);
+  // As JSONSave, end the root with a new line
+  if (that->_depth == 0)
+    JSONWriterPutc(that, '\n');
+}
+
+// Open/close an array with the JSONWriter 'that', as the value of 
+// the last key
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterArrStart(JSONWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONWriterOpen(that, true);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterArrEnd(JSONWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (that->_depth <= 0 || !that->_isArr[that->_depth]) {
+    JSONErr->_type = PBErrTypeInvalidArg;
+    sprintf(JSONErr->_msg, "no array to close");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  if (that->_hasObj[that->_depth])
+    JSONWriterNewLine(that, that->_depth - 1);
+  JSONWriterPutc(that, ']');
+  --(that->_depth);
+}
+
+// Write the key 'key' of a property of the current object with the 
+// JSONWriter 'that'
+// 'key' is written as is, it must be already escaped
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterKey(JSONWriter* const that, const char* const key) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (key == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'key' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (that->_depth <= 0 || that->_isArr[that->_depth]) {
+    JSONErr->_type = PBErrTypeInvalidArg;
+    sprintf(JSONErr->_msg, "a key must be in an object");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  if (that->_nbItem[that->_depth] > 0)
+    JSONWriterPutc(that, ',');
+  ++(that->_nbItem[that->_depth]);
+  JSONWriterNewLine(that, that->_depth);
+  JSONWriterQuoted(that, key);
+  JSONWriterPutc(that, ':');
+  that->_isKeyPending = true;
+}
+
+// Write the value 'val' with the JSONWriter 'that', as the value of 
+// the last key or an element of the current array
+// 'val' is written as is, it must be already escaped
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterVal(JSONWriter* const that, const char* const val) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (val == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'val' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONWriterStartVal(that, false);
+  JSONWriterQuoted(that, val);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterValLong(JSONWriter* const that, const long val) {
+  char str[32];
+  sprintf(str, "%ld", val);
+  JSONWriterVal(that, str);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterValFloat(JSONWriter* const that, const float val) {
+  char str[PBJSON_FLOATSTRLEN];
+  JSONFloatToStr(val, str);
+  JSONWriterVal(that, str);
+}
+
+// Write the property 'key' with the value 'val' in the current object 
+// with the JSONWriter 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropStr(JSONWriter* const that, const char* const key, 
+  const char* const val) {
+  JSONWriterKey(that, key);
+  JSONWriterVal(that, val);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropLong(JSONWriter* const that, 
+  const char* const key, const long val) {
+  JSONWriterKey(that, key);
+  JSONWriterValLong(that, val);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropFloat(JSONWriter* const that, 
+  const char* const key, const float val) {
+  JSONWriterKey(that, key);
+  JSONWriterValFloat(that, val);
+}
+
+// Write the property 'key' with the 'nb' values 'vals' in the current 
+// object with the JSONWriter 'that'
+// As with JSONSave, one single value is written without the brackets
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropFloats(JSONWriter* const that, 
+  const char* const key, const float* const vals, const long nb) {
+  JSONWriterKey(that, key);
+  if (nb == 1) {
+    JSONWriterValFloat(that, vals[0]);
+    return;
+  }
+  JSONWriterArrStart(that);
+  for (long iVal = 0; iVal < nb; ++iVal)
+    JSONWriterValFloat(that, vals[iVal]);
+  JSONWriterArrEnd(that);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropLongs(JSONWriter* const that, 
+  const char* const key, const long* const vals, const long nb) {
+  JSONWriterKey(that, key);
+  if (nb == 1) {
+    JSONWriterValLong(that, vals[0]);
+    return;
+  }
+  JSONWriterArrStart(that);
+  for (long iVal = 0; iVal < nb; ++iVal)
+    JSONWriterValLong(that, vals[iVal]);
+  JSONWriterArrEnd(that);
+}
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropShorts(JSONWriter* const that, 
+  const char* const key, const short* const vals, const long nb) {
+  JSONWriterKey(that, key);
+  if (nb == 1) {
+    JSONWriterValLong(that, vals[0]);
+    return;
+  }
+  JSONWriterArrStart(that);
+  for (long iVal = 0; iVal < nb; ++iVal)
+    JSONWriterValLong(that, vals[iVal]);
+  JSONWriterArrEnd(that);
+}
+
+// Create a static JSONIndex on the properties of the JSON node 'node'
+// The hash table is built lazily by the first JSONIndexProperty
+#if BUILDMODE != 0
+static inline
+#endif
+JSONIndex JSONIndexCreateStatic(const JSONNode* const node) {
+#if BUILDMODE == 0
+  if (node == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'node' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONIndex that = {._node = node, ._nbProp = -1, ._capacity = 0, 
+    ._slots = NULL};
+  return that;
+}
+
+// Free the memory used by the JSONIndex 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONIndexFreeStatic(JSONIndex* const that) {
+  if (that == NULL)
+    return;
+  free(that->_slots);
+  that->_slots = NULL;
+  that->_capacity = 0;
+  that->_nbProp = -1;
+}
+
+// Invalidate the JSONIndex 'that', it will be rebuilt at the next 
+// lookup
+// This function must be called after adding, removing or relabelling
+// any property of the indexed node
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONIndexInvalidate(JSONIndex* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  that->_nbProp = -1;
+}
+
+// Return the FNV-1a hash of the string 'str'
+static inline uint32_t JSONIndexHash(const char* const str) {
+  uint32_t hash = 2166136261u;
+  for (const unsigned char* ptr = (const unsigned char*)str; 
+    *ptr != '\0'; ++ptr) {
+    hash ^= *ptr;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Add the property 'prop' with the key 'key' to the hash table of the 
+// JSONIndex 'that', unless the key is already there (as JSONProperty, 
+// the first property with a given label wins)
+static inline void JSONIndexInsert(JSONIndex* const that, 
+  const char* const key, JSONNode* const prop) {
+  long mask = that->_capacity - 1;
+  for (long iSlot = JSONIndexHash(key) & mask; ; 
+    iSlot = (iSlot + 1) & mask) {
+    JSONIndexSlot* slot = that->_slots + iSlot;
+    if (slot->_key == NULL) {
+      slot->_key = key;
+      slot->_prop = prop;
+      return;
+    }
+    if (strcmp(slot->_key, key) == 0)
+      return;
+  }
+}
+
+// Build the hash table of the JSONIndex 'that' for its 'nbProp' 
+// properties
+static inline void JSONIndexBuild(JSONIndex* const that, 
+  const long nbProp) {
+  // Each property can be inserted twice (with and without the "[]" 
+  // prefix), keep the load factor under 1/2
+  long capacity = 16;
+  while (capacity < 4 * nbProp)
+    capacity *= 2;
+  if (capacity != that->_capacity) {
+    free(that->_slots);
+    that->_slots = PBErrMalloc(JSONErr, sizeof(JSONIndexSlot) * capacity);
+    that->_capacity = capacity;
+  }
+  memset(that->_slots, 0, sizeof(JSONIndexSlot) * capacity);
+  for (const GSetElem* elem = JSONProperties(that->_node)->_set._head; 
+    elem != NULL; elem = elem->_next) {
+    JSONNode* prop = elem->_data;
+    const char* lbl = JSONLabel(prop);
+    if (lbl == NULL)
+      continue;
+    JSONIndexInsert(that, lbl, prop);
+    if (lbl[0] == '[' && lbl[1] == ']')
+      JSONIndexInsert(that, lbl + 2, prop);
+  }
+  that->_nbProp = nbProp;
+}
+
+// Return the property with label 'lbl' of the node indexed by the 
+// JSONIndex 'that', same as JSONProperty but in constant time
+// If the property doesn't exist return NULL
+// The properties of the node must not have changed since the index was
+// built, or JSONIndexInvalidate must have been called since then (in
+// development mode an out of date index raises an error)
+#if BUILDMODE != 0
+static inline
+#endif
+JSONNode* JSONIndexProperty(JSONIndex* const that, 
+  const char* const lbl) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'that' is null");
+    PBErrCatch(JSONErr);
+  }
+  if (lbl == NULL) {
+    JSONErr->_type = PBErrTypeNullPointer;
+    sprintf(JSONErr->_msg, "'lbl' is null");
+    PBErrCatch(JSONErr);
+  }
+#endif
+  long nbProp = GSetNbElem(JSONProperties(that->_node));
+  // Small objects are searched directly
+  if (nbProp < PBJSON_INDEXMINPROP)
+    return JSONProperty(that->_node, lbl);
+  if (that->_nbProp == -1)
+    JSONIndexBuild(that, nbProp);
+#if BUILDMODE == 0
+  if (nbProp != that->_nbProp) {
+    JSONErr->_type = PBErrTypeInvalidArg;
+    sprintf(JSONErr->_msg, 
+      "'that' is out of date (%ld!=%ld), call JSONIndexInvalidate", 
+      nbProp, that->_nbProp);
+    PBErrCatch(JSONErr);
+  }
+#endif
+  JSONNode* prop = NULL;
+  long mask = that->_capacity - 1;
+  for (long iSlot = JSONIndexHash(lbl) & mask; 
+    prop == NULL && that->_slots[iSlot]._key != NULL; 
+    iSlot = (iSlot + 1) & mask)
+    if (strcmp(that->_slots[iSlot]._key, lbl) == 0)
+      prop = that->_slots[iSlot]._prop;
+#if BUILDMODE == 0
+  // Check the result against the properties of the node, without 
+  // dereferencing the result which may have been freed
+  bool isStale = (prop == NULL && JSONProperty(that->_node, lbl) != NULL);
+  if (prop != NULL) {
+    isStale = true;
+    for (const GSetElem* elem = JSONProperties(that->_node)->_set._head; 
+      isStale && elem != NULL; elem = elem->_next)
+      if (elem->_data == prop)
+        isStale = false;
+  }
+  if (isStale) {
+    JSONErr->_type = PBErrTypeInvalidArg;
+    sprintf(JSONErr->_msg, 
+      "'that' is out of date for '%s', call JSONIndexInvalidate", lbl);
+    PBErrCatch(JSONErr);
+  }
+#endif
+  return prop;
+}
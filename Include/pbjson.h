@@ -8,8 +8,10 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <float.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "pberr.h"
 #include "gset.h"
 #include "gtree.h"
@@ -19,6 +21,12 @@
 #define PBJSON_INDENT "  "
 #define PBJSON_MAXLENGTHLBL 1024
 #define PBJSON_CONTEXTSIZE 10
+// Size of the buffer needed by JSONFloatToStr, '\0' included
+#define PBJSON_FLOATSTRLEN 16
+#define PBJSON_WRITERBUFSIZE 4096
+#define PBJSON_WRITERMAXDEPTH 64
+// Under this number of properties JSONIndex searches linearly
+#define PBJSON_INDEXMINPROP 16
 
 // ================= Data structure ===================
 
@@ -26,6 +34,124 @@
 #define JSONArrayVal GSetStr
 #define JSONArrayStruct GSetGenTreeStr
 
+// Callbacks of the streaming parser (JSONParse, JSONParseFromStr)
+// Each callback returns true to continue the parsing or false to 
+// abort it, and can be null if the event is not needed
+// 'key' and 'val' are valid only during the call of the callback
+// Values are given as strings, quoted or not in the JSON (numbers, 
+// true, false, null), any other unquoted value makes the JSON invalid
+typedef struct JSONSAXHandler {
+  // Start of an object
+  bool (*_objStart)(void* const param);
+  // End of an object
+  bool (*_objEnd)(void* const param);
+  // Start of an array
+  bool (*_arrStart)(void* const param);
+  // End of an array
+  bool (*_arrEnd)(void* const param);
+  // Key of a property
+  bool (*_key)(const char* const key, void* const param);
+  // Value of a property or an array
+  bool (*_val)(const char* const val, void* const param);
+  // User data given to the callbacks
+  void* _param;
+} JSONSAXHandler;
+
+// Source and buffers of the streaming parser
+typedef struct JSONSAXReader {
+  // Stream, or null if reading from a string
+  FILE* _stream;
+  // Current position in the string if reading from a string
+  const char* _str;
+  // Character pushed back by the parser, EOF if none
+  int _back;
+  // Buffer for the current key or value
+  char* _buf;
+  // Length of the current key or value
+  size_t _len;
+  // Allocated size of _buf
+  size_t _bufSize;
+  // Stack of the opened containers ('{' or '[')
+  char* _stack;
+  // Number of opened containers
+  long _depth;
+  // Allocated size of _stack
+  long _stackSize;
+} JSONSAXReader;
+
+// JSON document loaded in situ: the whole JSON text is kept in one 
+// buffer, the labels of the nodes point into this buffer and the nodes 
+// are allocated from two pools
+// The labels are the raw text of the JSON as for JSONLoad (escape 
+// sequences are not decoded)
+// The tree of nodes has the same structure as the one of JSONLoad and 
+// can be read with the same functions, but must not be modified nor 
+// freed with JSONFree
+// If the JSON is an array the root node is labelled "[]" and its 
+// subtrees are the ones of a property holding this array (labels of 
+// the values, or unlabelled object nodes), else the root is unlabelled
+typedef struct JSONDoc {
+  // Buffer holding the JSON text
+  char* _buf;
+  // Pool of the nodes
+  GSetPool _treePool;
+  // Pool of the elements of the sets of subtrees
+  GSetPool _elemPool;
+  // Root node of the JSON
+  JSONNode* _root;
+} JSONDoc;
+
+// Writer streaming the JSON directly to a FILE, in the same format as 
+// JSONSave, without building the JSONNode tree
+typedef struct JSONWriter {
+  // Stream
+  FILE* _stream;
+  // Flag for the compact form
+  bool _compact;
+  // Flag to memorize if all the writes succeeded so far
+  bool _isOk;
+  // Flag to memorize if a key is waiting for its value
+  bool _isKeyPending;
+  // Current depth of nesting (0 outside the root)
+  int _depth;
+  // Nb of items written in the container at each depth
+  long _nbItem[PBJSON_WRITERMAXDEPTH];
+  // Flags to memorize if the container at each depth is an array, 
+  // and if an array contains objects
+  bool _isArr[PBJSON_WRITERMAXDEPTH];
+  bool _hasObj[PBJSON_WRITERMAXDEPTH];
+  // Nb of bytes in the buffer
+  size_t _len;
+  // Buffer
+  char _buf[PBJSON_WRITERBUFSIZE];
+} JSONWriter;
+
+// Entry of the hash table of a JSONIndex
+typedef struct JSONIndexSlot {
+  // Label used as key (the label of the property, without its "[]" 
+  // prefix for arrays of objects)
+  const char* _key;
+  // Property
+  JSONNode* _prop;
+} JSONIndexSlot;
+
+// Hashed index of the properties of a JSON object node
+// The index is built at the first lookup and memorizes pointers to the
+// properties and their labels, it must be invalidated with 
+// JSONIndexInvalidate after any change of the properties of the node
+typedef struct JSONIndex {
+  // Indexed node
+  const JSONNode* _node;
+  // Nb of properties of the node when the index was built, -1 if the 
+  // index is not built (used to detect in development mode the changes
+  // of the properties without JSONIndexInvalidate)
+  long _nbProp;
+  // Capacity of the hash table (power of 2)
+  long _capacity;
+  // Hash table (open addressing with linear probing)
+  JSONIndexSlot* _slots;
+} JSONIndex;
+
 // ================ Functions declaration ====================
 
 // Free the memory used by the JSON node 'that' and its subnodes
@@ -104,8 +230,229 @@ static inline
 #endif
 void JSONArrayValFlush(JSONArrayVal* const that);
 
+// Free the memory used by the pooled JSON node 'that' and its 
+// subnodes, created with JSONCreatePool and JSONAddPropStrPool
+// The memory used by the label of each node is freed too
+// If all the blocks in use in 'treePool' and 'elemPool' belong to 
+// 'that', the pools are flushed in one call each
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONFreePool(JSONNode** that, GSetPool* const treePool, 
+  GSetPool* const elemPool);
+
+// Add a property to the pooled node 'that'. The property's key is a 
+// copy of 'key' and its value is a copy of 'val'. The nodes are 
+// allocated from 'treePool' and the elements of their sets of 
+// subtrees from 'elemPool'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONAddPropStrPool(JSONNode* const that, const char* const key, 
+  const char* const val, GSetPool* const treePool, 
+  GSetPool* const elemPool);
+
+// Parse the JSON on the stream 'stream' without building the JSONNode
+// tree, calling the callbacks of 'handler' as the JSON is read
+// The parsing stops at the end of the first JSON value of the stream
+// Return true if the JSON is valid and no callback aborted the 
+// parsing, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONParse(FILE* const stream, const JSONSAXHandler* const handler);
+
+// Parse the JSON in the string 'str' without building the JSONNode 
+// tree, calling the callbacks of 'handler' as the JSON is read
+// Return true if the JSON is valid and no callback aborted the 
+// parsing, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONParseFromStr(const char* const str, 
+  const JSONSAXHandler* const handler);
+
+// Load in situ the JSON from the stream 'stream'
+// Return the JSONDoc, or null if the JSON couldn't be loaded
+#if BUILDMODE != 0
+static inline
+#endif
+JSONDoc* JSONDocLoad(FILE* const stream);
+
+// Load in situ the JSON from a copy of the string 'str'
+// Return the JSONDoc, or null if the JSON couldn't be loaded
+#if BUILDMODE != 0
+static inline
+#endif
+JSONDoc* JSONDocLoadFromStr(const char* const str);
+
+// Free the memory used by the JSONDoc 'that', its nodes and labels
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONDocFree(JSONDoc** that);
+
+// Return the root node of the JSONDoc 'that'
+// Its label is "[]" if the JSON is an array, null if it's an object
+#if BUILDMODE != 0
+static inline
+#endif
+const JSONNode* JSONDocRoot(const JSONDoc* const that);
+
+// Write in 'str' the shortest decimal representation of 'val' which 
+// JSONStrToFloat (or strtof) converts back exactly to 'val'
+// 'str' must be at least PBJSON_FLOATSTRLEN long
+// Return the length of the representation
+#if BUILDMODE != 0
+static inline
+#endif
+int JSONFloatToStr(const float val, char* const str);
+
+// Convert the string 'str' to the nearest float and memorize it 
+// in 'val'
+// Return true if the whole 'str' is a valid number, false else
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONStrToFloat(const char* const str, float* const val);
+
+// Create a static JSONWriter writing on the stream 'stream', in 
+// compact form if 'compact' equals true, else in readable form
+#if BUILDMODE != 0
+static inline
+#endif
+JSONWriter JSONWriterCreateStatic(FILE* const stream, 
+  const bool compact);
+
+// Write the buffered content of the JSONWriter 'that' to its stream
+// Return true if all the writes succeeded so far, else false
+#if BUILDMODE != 0
+static inline
+#endif
+bool JSONWriterFlush(JSONWriter* const that);
+
+// Open/close an object with the JSONWriter 'that', as the root, the 
+// value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterObjStart(JSONWriter* const that);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterObjEnd(JSONWriter* const that);
+
+// Open/close an array with the JSONWriter 'that', as the value of 
+// the last key
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterArrStart(JSONWriter* const that);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterArrEnd(JSONWriter* const that);
+
+// Write the key 'key' of a property of the current object with the 
+// JSONWriter 'that'
+// 'key' is written as is, it must be already escaped
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterKey(JSONWriter* const that, const char* const key);
+
+// Write the value 'val' with the JSONWriter 'that', as the value of 
+// the last key or an element of the current array
+// 'val' is written as is, it must be already escaped
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterVal(JSONWriter* const that, const char* const val);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterValLong(JSONWriter* const that, const long val);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterValFloat(JSONWriter* const that, const float val);
+
+// Write the property 'key' with the value 'val' in the current object 
+// with the JSONWriter 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropStr(JSONWriter* const that, const char* const key, 
+  const char* const val);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropLong(JSONWriter* const that, 
+  const char* const key, const long val);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropFloat(JSONWriter* const that, 
+  const char* const key, const float val);
+
+// Write the property 'key' with the 'nb' values 'vals' in the current 
+// object with the JSONWriter 'that'
+// As with JSONSave, one single value is written without the brackets
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropFloats(JSONWriter* const that, 
+  const char* const key, const float* const vals, const long nb);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropLongs(JSONWriter* const that, 
+  const char* const key, const long* const vals, const long nb);
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONWriterPropShorts(JSONWriter* const that, 
+  const char* const key, const short* const vals, const long nb);
+
+// Create a static JSONIndex on the properties of the JSON node 'node'
+// The hash table is built lazily by the first JSONIndexProperty
+#if BUILDMODE != 0
+static inline
+#endif
+JSONIndex JSONIndexCreateStatic(const JSONNode* const node);
+
+// Free the memory used by the JSONIndex 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONIndexFreeStatic(JSONIndex* const that);
+
+// Invalidate the JSONIndex 'that', it will be rebuilt at the next 
+// lookup
+// This function must be called after adding, removing or relabelling
+// any property of the indexed node, else JSONIndexProperty may miss 
+// the new properties and return the removed ones (possibly already 
+// freed)
+#if BUILDMODE != 0
+static inline
+#endif
+void JSONIndexInvalidate(JSONIndex* const that);
+
+// Return the property with label 'lbl' of the node indexed by the 
+// JSONIndex 'that', same as JSONProperty but in constant time
+// If the property doesn't exist return NULL
+// The properties of the node must not have changed since the index was
+// built, or JSONIndexInvalidate must have been called since then (in
+// development mode an out of date index raises an error)
+#if BUILDMODE != 0
+static inline
+#endif
+JSONNode* JSONIndexProperty(JSONIndex* const that, 
+  const char* const lbl);
+
 // Wrapping of GenTreeStr functions
 #define JSONCreate() ((JSONNode*)GenTreeStrCreate())
+#define JSONCreatePool(Pool) GenTreeStrCreateDataPool(NULL, Pool)
 #define JSONLabel(Node) GenTreeData(Node)
 #define JSONAppendVal(Key, Val) GenTreeAppendSubtree(Key, Val)
 #define JSONProperties(JSON) GenTreeSubtrees(JSON)
@@ -2,6 +2,435 @@
 
 // ================ Functions implementation ====================
 
+// -------------- PBBin
+
+// CRC32 (IEEE 802.3, reflected) of 4 bits at a time
+static const uint32_t PBBinCRCTable[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 
+  0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C, 
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 
+  0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+// Update the CRC32 'crc' with the 'nb' bytes 'data'
+static inline uint32_t PBBinUpdateCRC(uint32_t crc, 
+  const unsigned char* const data, const size_t nb) {
+  for (size_t iByte = nb; iByte--;) {
+    crc ^= data[nb - 1 - iByte];
+    crc = PBBinCRCTable[crc & 0x0F] ^ (crc >> 4);
+    crc = PBBinCRCTable[crc & 0x0F] ^ (crc >> 4);
+  }
+  return crc;
+}
+
+// Create a static PBBin reading/writing on the stream 'stream'
+#if BUILDMODE != 0
+static inline
+#endif 
+PBBin PBBinCreateStatic(FILE* const stream) {
+#if BUILDMODE == 0
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBin that = {._stream = stream, ._crc = 0xFFFFFFFF, 
+    ._checksum = false, ._isOk = true};
+  return that;
+}
+
+// Return true if all the reads/writes of the PBBin 'that' succeeded 
+// so far, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinIsOk(const PBBin* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_isOk;
+}
+
+// Write 'nb' bytes 'data' with the PBBin 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteBytes(PBBin* const that, const void* const data, 
+  const size_t nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (data == NULL && nb > 0) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'data' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (!that->_isOk || nb == 0)
+    return;
+  if (fwrite(data, 1, nb, that->_stream) != nb)
+    that->_isOk = false;
+  else
+    that->_crc = PBBinUpdateCRC(that->_crc, data, nb);
+}
+
+// Read 'nb' bytes 'data' with the PBBin 'that'
+// On failure 'data' is set to 0
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadBytes(PBBin* const that, void* const data, 
+  const size_t nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (data == NULL && nb > 0) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'data' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (nb == 0)
+    return;
+  if (!that->_isOk || fread(data, 1, nb, that->_stream) != nb) {
+    that->_isOk = false;
+    memset(data, 0, nb);
+  } else {
+    that->_crc = PBBinUpdateCRC(that->_crc, data, nb);
+  }
+}
+
+// Write/read one value with the PBBin 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteU16(PBBin* const that, const uint16_t val) {
+  unsigned char bytes[2] = {val & 0xFF, (val >> 8) & 0xFF};
+  PBBinWriteBytes(that, bytes, 2);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+uint16_t PBBinReadU16(PBBin* const that) {
+  unsigned char bytes[2];
+  PBBinReadBytes(that, bytes, 2);
+  return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteU32(PBBin* const that, const uint32_t val) {
+  unsigned char bytes[4];
+  for (int iByte = 4; iByte--;)
+    bytes[iByte] = (val >> (8 * iByte)) & 0xFF;
+  PBBinWriteBytes(that, bytes, 4);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+uint32_t PBBinReadU32(PBBin* const that) {
+  unsigned char bytes[4];
+  PBBinReadBytes(that, bytes, 4);
+  uint32_t val = 0;
+  for (int iByte = 4; iByte--;)
+    val |= (uint32_t)(bytes[iByte]) << (8 * iByte);
+  return val;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteI64(PBBin* const that, const int64_t val) {
+  unsigned char bytes[8];
+  uint64_t uval = (uint64_t)val;
+  for (int iByte = 8; iByte--;)
+    bytes[iByte] = (uval >> (8 * iByte)) & 0xFF;
+  PBBinWriteBytes(that, bytes, 8);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+int64_t PBBinReadI64(PBBin* const that) {
+  unsigned char bytes[8];
+  PBBinReadBytes(that, bytes, 8);
+  uint64_t val = 0;
+  for (int iByte = 8; iByte--;)
+    val |= (uint64_t)(bytes[iByte]) << (8 * iByte);
+  return (int64_t)val;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteFloat(PBBin* const that, const float val) {
+  PBBinWriteFloats(that, &val, 1);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float PBBinReadFloat(PBBin* const that) {
+  float val = 0.0;
+  PBBinReadFloats(that, &val, 1);
+  return val;
+}
+
+// Size in values of the chunks used to convert arrays
+#define PBBIN_CHUNK 256
+
+// Write/read the 'nb' values of the array 'vals' with the PBBin 'that'
+// The values are converted by chunks to limit the number of calls to 
+// fwrite/fread
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteFloats(PBBin* const that, const float* const vals, 
+  const long nb) {
+  unsigned char bytes[4 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    for (long jVal = nbChunk; jVal--;) {
+      uint32_t bits = 0;
+      memcpy(&bits, vals + iVal + jVal, 4);
+      for (int iByte = 4; iByte--;)
+        bytes[4 * jVal + iByte] = (bits >> (8 * iByte)) & 0xFF;
+    }
+    PBBinWriteBytes(that, bytes, 4 * nbChunk);
+  }
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadFloats(PBBin* const that, float* const vals, 
+  const long nb) {
+  unsigned char bytes[4 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    PBBinReadBytes(that, bytes, 4 * nbChunk);
+    for (long jVal = nbChunk; jVal--;) {
+      uint32_t bits = 0;
+      for (int iByte = 4; iByte--;)
+        bits |= (uint32_t)(bytes[4 * jVal + iByte]) << (8 * iByte);
+      memcpy(vals + iVal + jVal, &bits, 4);
+    }
+  }
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteShorts(PBBin* const that, const short* const vals, 
+  const long nb) {
+  unsigned char bytes[2 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    for (long jVal = nbChunk; jVal--;) {
+      uint16_t bits = (uint16_t)(vals[iVal + jVal]);
+      bytes[2 * jVal] = bits & 0xFF;
+      bytes[2 * jVal + 1] = (bits >> 8) & 0xFF;
+    }
+    PBBinWriteBytes(that, bytes, 2 * nbChunk);
+  }
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadShorts(PBBin* const that, short* const vals, 
+  const long nb) {
+  unsigned char bytes[2 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    PBBinReadBytes(that, bytes, 2 * nbChunk);
+    for (long jVal = nbChunk; jVal--;)
+      vals[iVal + jVal] = 
+        (short)(uint16_t)(bytes[2 * jVal] | (bytes[2 * jVal + 1] << 8));
+  }
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteLongs(PBBin* const that, const long* const vals, 
+  const long nb) {
+  unsigned char bytes[8 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    for (long jVal = nbChunk; jVal--;) {
+      uint64_t bits = (uint64_t)(int64_t)(vals[iVal + jVal]);
+      for (int iByte = 8; iByte--;)
+        bytes[8 * jVal + iByte] = (bits >> (8 * iByte)) & 0xFF;
+    }
+    PBBinWriteBytes(that, bytes, 8 * nbChunk);
+  }
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadLongs(PBBin* const that, long* const vals, 
+  const long nb) {
+  unsigned char bytes[8 * PBBIN_CHUNK];
+  for (long iVal = 0; iVal < nb; iVal += PBBIN_CHUNK) {
+    long nbChunk = MIN(nb - iVal, PBBIN_CHUNK);
+    PBBinReadBytes(that, bytes, 8 * nbChunk);
+    for (long jVal = nbChunk; jVal--;) {
+      uint64_t bits = 0;
+      for (int iByte = 8; iByte--;)
+        bits |= (uint64_t)(bytes[8 * jVal + iByte]) << (8 * iByte);
+      vals[iVal + jVal] = (long)(int64_t)bits;
+    }
+  }
+}
+
+#undef PBBIN_CHUNK
+
+// Write the string 'str' (which may be null) with the PBBin 'that'
+// The string is stored as its length (0xFFFFFFFF for null) followed 
+// by its characters without the terminating '\0'
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteStr(PBBin* const that, const char* const str) {
+  if (str == NULL) {
+    PBBinWriteU32(that, 0xFFFFFFFF);
+  } else {
+    size_t len = strlen(str);
+    PBBinWriteU32(that, (uint32_t)len);
+    PBBinWriteBytes(that, str, len);
+  }
+}
+
+// Read a string with the PBBin 'that'
+// Return a newly allocated string, or null if the string was null or 
+// the read failed
+#if BUILDMODE != 0
+static inline
+#endif 
+char* PBBinReadStr(PBBin* const that) {
+  uint32_t len = PBBinReadU32(that);
+  if (!that->_isOk || len == 0xFFFFFFFF)
+    return NULL;
+  char* str = PBErrMalloc(PBMathErr, (size_t)len + 1);
+  PBBinReadBytes(that, str, len);
+  str[len] = '\0';
+  if (!that->_isOk) {
+    free(str);
+    return NULL;
+  }
+  return str;
+}
+
+// Write the header for the type 'tag' (4 chars) with the PBBin 'that'
+// If 'checksum' equals true the payload will be followed by its CRC32
+// Return true upon success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinWriteHeader(PBBin* const that, const char* const tag, 
+  const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tag == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tag' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBinWriteBytes(that, PBBIN_MAGIC, 4);
+  PBBinWriteU16(that, PBBIN_VERSION);
+  PBBinWriteU16(that, (checksum ? PBBIN_FLAGCHECKSUM : 0));
+  PBBinWriteBytes(that, tag, 4);
+  // The CRC32 covers only the payload
+  that->_checksum = checksum;
+  that->_crc = 0xFFFFFFFF;
+  return that->_isOk;
+}
+
+// Read the header with the PBBin 'that' and check it is a supported 
+// version for the type 'tag' (4 chars)
+// Return true upon success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinReadHeader(PBBin* const that, const char* const tag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tag == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tag' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  char magic[4];
+  PBBinReadBytes(that, magic, 4);
+  uint16_t version = PBBinReadU16(that);
+  uint16_t flags = PBBinReadU16(that);
+  char readTag[4];
+  PBBinReadBytes(that, readTag, 4);
+  if (memcmp(magic, PBBIN_MAGIC, 4) != 0 || 
+    version == 0 || version > PBBIN_VERSION || 
+    (flags & ~PBBIN_FLAGCHECKSUM) != 0 || 
+    memcmp(readTag, tag, 4) != 0)
+    that->_isOk = false;
+  that->_checksum = ((flags & PBBIN_FLAGCHECKSUM) != 0);
+  that->_crc = 0xFFFFFFFF;
+  return that->_isOk;
+}
+
+// Write the footer (CRC32 if requested in the header) with the 
+// PBBin 'that'
+// Return true if all the writes succeeded, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinWriteFooter(PBBin* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (that->_checksum)
+    PBBinWriteU32(that, ~(that->_crc));
+  return that->_isOk;
+}
+
+// Read the footer with the PBBin 'that' and check the CRC32 if 
+// requested in the header
+// Return true if all the reads succeeded and the CRC32 matches, 
+// else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinReadFooter(PBBin* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (that->_checksum) {
+    uint32_t crc = ~(that->_crc);
+    if (PBBinReadU32(that) != crc)
+      that->_isOk = false;
+  }
+  return that->_isOk;
+}
+
 // -------------- VecShort
 
 // Static constructors for VecShort
@@ -1045,119 +1474,254 @@ short _VecShortGetMinValAbs(const VecShort* const that) {
   return min;
 }
 
-// -------------- VecLong
-
-// Static constructors for VecLong
-#if BUILDMODE != 0
-static inline
-#endif 
-VecLong2D VecLongCreateStatic2D() {
-  VecLong2D v = {._val = {0, 0}, ._dim = 2};
-  return v;
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-VecLong3D VecLongCreateStatic3D() {
-  VecLong3D v = {._val = {0, 0, 0}, ._dim = 3};
-  return v;
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-VecLong4D VecLongCreateStatic4D() {
-  VecLong4D v = {._val = {0, 0, 0, 0}, ._dim = 4};
-  return v;
-}
-
-// Return the i-th value of the VecLong
+// Write the binary encoding of the VecShort 'that' with the PBBin 'bin'
 #if BUILDMODE != 0
 static inline
 #endif 
-long _VecLongGet(const VecLong* const that, const long i) {
+void _VecShortEncodeAsBin(const VecShort* const that, PBBin* const bin) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= that->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
-      that->_dim);
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  return ((long*)(((void*)that) + sizeof(long)))[i];
+  PBBinWriteI64(bin, that->_dim);
+  PBBinWriteShorts(bin, that->_val, that->_dim);
 }
+
+// Read the binary encoding of a VecShort with the PBBin 'bin' into 'that'
+// If the VecShort is already allocated, it is freed before loading
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-long _VecLongGet2D(const VecLong2D* const that, const long i) {
+bool _VecShortDecodeAsBin(VecShort** that, PBBin* const bin) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= 2) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_val[i];
+  if (*that != NULL)
+    _VecShortFree(that);
+  long dim = (long)PBBinReadI64(bin);
+  if (!PBBinIsOk(bin) || dim <= 0)
+    return false;
+  *that = VecShortCreate(dim);
+  PBBinReadShorts(bin, (*that)->_val, dim);
+  if (!PBBinIsOk(bin)) {
+    _VecShortFree(that);
+    return false;
+  }
+  return true;
 }
+
+// Save the VecShort 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-long _VecLongGet3D(const VecLong3D* const that, const long i) {
+bool _VecShortSaveBin(const VecShort* const that, FILE* const stream, 
+  const bool checksum) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_val[i];
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "VECS", checksum);
+  _VecShortEncodeAsBin(that, &bin);
+  return PBBinWriteFooter(&bin);
 }
+
+// Load the VecShort 'that' from the stream 'stream' in binary format
+// If the VecShort is already allocated, it is freed before loading
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-long _VecLongGet4D(const VecLong4D* const that, const long i) {
+bool _VecShortLoadBin(VecShort** that, FILE* const stream) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= 4) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<4)", i);
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_val[i];
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "VECS") || 
+    !_VecShortDecodeAsBin(that, &bin) || 
+    !PBBinReadFooter(&bin)) {
+    if (*that != NULL)
+      _VecShortFree(that);
+    return false;
+  }
+  return true;
 }
 
-// Set the i-th value of the VecLong to v
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecLongSet(VecLong* const that, const long i, const long v) {
+void _VecShortEncodeAsJSONStream(const VecShort* const that, 
+  JSONWriter* const writer) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= that->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
+  if (writer == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'writer' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONWriterObjStart(writer);
+  JSONWriterPropLong(writer, "_dim", that->_dim);
+  JSONWriterPropShorts(writer, "_val", that->_val, that->_dim);
+  JSONWriterObjEnd(writer);
+}
+
+// -------------- VecLong
+
+// Static constructors for VecLong
+#if BUILDMODE != 0
+static inline
+#endif 
+VecLong2D VecLongCreateStatic2D() {
+  VecLong2D v = {._val = {0, 0}, ._dim = 2};
+  return v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecLong3D VecLongCreateStatic3D() {
+  VecLong3D v = {._val = {0, 0, 0}, ._dim = 3};
+  return v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecLong4D VecLongCreateStatic4D() {
+  VecLong4D v = {._val = {0, 0, 0, 0}, ._dim = 4};
+  return v;
+}
+
+// Return the i-th value of the VecLong
+#if BUILDMODE != 0
+static inline
+#endif 
+long _VecLongGet(const VecLong* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
+      that->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return ((long*)(((void*)that) + sizeof(long)))[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+long _VecLongGet2D(const VecLong2D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+long _VecLongGet3D(const VecLong3D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+long _VecLongGet4D(const VecLong4D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 4) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<4)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[i];
+}
+
+// Set the i-th value of the VecLong to v
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecLongSet(VecLong* const that, const long i, const long v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
     sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
       that->_dim);
     PBErrCatch(PBMathErr);
@@ -2088,241 +2652,4302 @@ long _VecLongGetMinValAbs(const VecLong* const that) {
   return min;
 }
 
-// -------------- VecFloat
-
-// Static constructors for VecFloat
-#if BUILDMODE != 0
-static inline
-#endif 
-VecFloat2D VecFloatCreateStatic2D() {
-  VecFloat2D v = {._val = {0.0, 0.0}, ._dim = 2};
-  return v;
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-VecFloat3D VecFloatCreateStatic3D() {
-  VecFloat3D v = {._val = {0.0, 0.0, 0.0}, ._dim = 3};
-  return v;
-}
-
-// Return the i-th value of the VecFloat
+// Write the binary encoding of the VecLong 'that' with the PBBin 'bin'
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatGet(const VecFloat* const that, const long i) {
+void _VecLongEncodeAsBin(const VecLong* const that, PBBin* const bin) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= that->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
-    PBErrCatch(PBMathErr);
-  }
-#endif
-  // Return the value
-  return that->_val[i];
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-float _VecFloatGet2D(const VecFloat2D* const that, const long i) {
-#if BUILDMODE == 0
-  if (that == NULL) {
+  if (bin == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (i < 0 || i >= 2) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    sprintf(PBMathErr->_msg, "'bin' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the value
-  return that->_val[i];
+  PBBinWriteI64(bin, that->_dim);
+  PBBinWriteLongs(bin, that->_val, that->_dim);
 }
+
+// Read the binary encoding of a VecLong with the PBBin 'bin' into 'that'
+// If the VecLong is already allocated, it is freed before loading
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatGet3D(const VecFloat3D* const that, const long i) {
+bool _VecLongDecodeAsBin(VecLong** that, PBBin* const bin) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the value
-  return that->_val[i];
+  if (*that != NULL)
+    _VecLongFree(that);
+  long dim = (long)PBBinReadI64(bin);
+  if (!PBBinIsOk(bin) || dim <= 0)
+    return false;
+  *that = VecLongCreate(dim);
+  PBBinReadLongs(bin, (*that)->_val, dim);
+  if (!PBBinIsOk(bin)) {
+    _VecLongFree(that);
+    return false;
+  }
+  return true;
 }
 
-// Set the i-th value of the VecFloat to v
+// Save the VecLong 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSet(VecFloat* const that, const long i, const float v) {
+bool _VecLongSaveBin(const VecLong* const that, FILE* const stream, 
+  const bool checksum) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= that->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
-    PBErrCatch(PBMathErr);
-  }
-#endif
-  // Set the value
-  that->_val[i] = v;
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-void _VecFloatSet2D(VecFloat2D* const that, const long i, const float v) {
-#if BUILDMODE == 0
-  if (that == NULL) {
+  if (stream == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (i < 0 || i >= 2) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set the value
-  that->_val[i] = v;
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "VECL", checksum);
+  _VecLongEncodeAsBin(that, &bin);
+  return PBBinWriteFooter(&bin);
 }
+
+// Load the VecLong 'that' from the stream 'stream' in binary format
+// If the VecLong is already allocated, it is freed before loading
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSet3D(VecFloat3D* const that, const long i, const float v) {
+bool _VecLongLoadBin(VecLong** that, FILE* const stream) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set the value
-  that->_val[i] = v;
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "VECL") || 
+    !_VecLongDecodeAsBin(that, &bin) || 
+    !PBBinReadFooter(&bin)) {
+    if (*that != NULL)
+      _VecLongFree(that);
+    return false;
+  }
+  return true;
 }
 
-// Set the i-th value of the VecFloat to v plus its current value
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetAdd(VecFloat* const that, const long i, const float v) {
+void _VecLongEncodeAsJSONStream(const VecLong* const that, 
+  JSONWriter* const writer) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (i < 0 || i >= that->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
-    PBErrCatch(PBMathErr);
-  }
-#endif
-  // Set the value
-  that->_val[i] += v;
-}
-#if BUILDMODE != 0
-static inline
-#endif 
-void _VecFloatSetAdd2D(VecFloat2D* const that, const long i, 
-  const float v) {
-#if BUILDMODE == 0
-  if (that == NULL) {
+  if (writer == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (i < 0 || i >= 2) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    sprintf(PBMathErr->_msg, "'writer' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set the value
-  that->_val[i] += v;
+  JSONWriterObjStart(writer);
+  JSONWriterPropLong(writer, "_dim", that->_dim);
+  JSONWriterPropLongs(writer, "_val", that->_val, that->_dim);
+  JSONWriterObjEnd(writer);
 }
-#if BUILDMODE != 0
-static inline
+
+// -------------- VecFloat
+
+// Kernels for the arithmetic on the values of VecFloat
+// They work on raw arrays of 'nb' floats, unaligned, and the result
+// array 'res' may be the same as one of the operands
+// On x86 the AVX2 version is selected at runtime if the CPU supports
+// it, else the SSE version is used. On other architectures, or if the
+// dimension is smaller than PBMATH_SIMDMINDIM, the scalar loop is used.
+// The vectorised versions accumulate in a different order than the
+// scalar loop, and the AVX2 ones use fused multiply-add, hence the 
+// results of Dot, DistSq and Op may differ in the last bits
+
+// Return true if the CPU supports AVX2 and FMA, in which case the 
+// kernels of VecFloat use their AVX2 version, false else (and always
+// false on other architectures than x86)
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatSetAdd3D(VecFloat3D* const that, const long i, 
-  const float v) {
-#if BUILDMODE == 0
-  if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (i < 0 || i >= 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
-    PBErrCatch(PBMathErr);
+bool VecFloatKernelHasAVX2(void) {
+#if PBMATH_SIMD_X86
+  // The CPU features are checked only once
+  static int hasAVX2 = -1;
+  if (hasAVX2 < 0) {
+    __builtin_cpu_init();
+    hasAVX2 = (__builtin_cpu_supports("avx2") && 
+      __builtin_cpu_supports("fma") ? 1 : 0);
+  }
+  return (hasAVX2 == 1);
+#else
+  return false;
+#endif
+}
+
+#if PBMATH_SIMD_X86
+
+// Return the sum of the 4 floats in 'v'
+static inline float VecFloatKernelHSumSSE(__m128 v) {
+  v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+  return _mm_cvtss_f32(v);
+}
+
+__attribute__((target("avx2,fma")))
+static inline float VecFloatKernelDotAVX2(const float* const a, 
+  const float* const b, const long nb) {
+  __m256 accA = _mm256_setzero_ps();
+  __m256 accB = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 16 <= nb; i += 16) {
+    accA = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), 
+      _mm256_loadu_ps(b + i), accA);
+    accB = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), 
+      _mm256_loadu_ps(b + i + 8), accB);
+  }
+  if (i + 8 <= nb) {
+    accA = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), 
+      _mm256_loadu_ps(b + i), accA);
+    i += 8;
+  }
+  accA = _mm256_add_ps(accA, accB);
+  float res = VecFloatKernelHSumSSE(_mm_add_ps(
+    _mm256_castps256_ps128(accA), _mm256_extractf128_ps(accA, 1)));
+  for (; i < nb; ++i)
+    res += a[i] * b[i];
+  return res;
+}
+
+static inline float VecFloatKernelDotSSE(const float* const a, 
+  const float* const b, const long nb) {
+  __m128 accA = _mm_setzero_ps();
+  __m128 accB = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    accA = _mm_add_ps(accA, 
+      _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    accB = _mm_add_ps(accB, 
+      _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+  }
+  float res = VecFloatKernelHSumSSE(_mm_add_ps(accA, accB));
+  for (; i < nb; ++i)
+    res += a[i] * b[i];
+  return res;
+}
+
+__attribute__((target("avx2,fma")))
+static inline float VecFloatKernelDistSqAVX2(const float* const a, 
+  const float* const b, const long nb) {
+  __m256 accA = _mm256_setzero_ps();
+  __m256 accB = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 16 <= nb; i += 16) {
+    __m256 dA = _mm256_sub_ps(_mm256_loadu_ps(a + i), 
+      _mm256_loadu_ps(b + i));
+    __m256 dB = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), 
+      _mm256_loadu_ps(b + i + 8));
+    accA = _mm256_fmadd_ps(dA, dA, accA);
+    accB = _mm256_fmadd_ps(dB, dB, accB);
+  }
+  if (i + 8 <= nb) {
+    __m256 dA = _mm256_sub_ps(_mm256_loadu_ps(a + i), 
+      _mm256_loadu_ps(b + i));
+    accA = _mm256_fmadd_ps(dA, dA, accA);
+    i += 8;
+  }
+  accA = _mm256_add_ps(accA, accB);
+  float res = VecFloatKernelHSumSSE(_mm_add_ps(
+    _mm256_castps256_ps128(accA), _mm256_extractf128_ps(accA, 1)));
+  for (; i < nb; ++i)
+    res += fsquare(a[i] - b[i]);
+  return res;
+}
+
+static inline float VecFloatKernelDistSqSSE(const float* const a, 
+  const float* const b, const long nb) {
+  __m128 accA = _mm_setzero_ps();
+  __m128 accB = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    __m128 dA = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    __m128 dB = 
+      _mm_sub_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4));
+    accA = _mm_add_ps(accA, _mm_mul_ps(dA, dA));
+    accB = _mm_add_ps(accB, _mm_mul_ps(dB, dB));
+  }
+  float res = VecFloatKernelHSumSSE(_mm_add_ps(accA, accB));
+  for (; i < nb; ++i)
+    res += fsquare(a[i] - b[i]);
+  return res;
+}
+
+__attribute__((target("avx2,fma")))
+static inline void VecFloatKernelOpAVX2(const float* const a, 
+  const float ca, const float* const b, const float cb, 
+  float* const res, const long nb) {
+  const __m256 vA = _mm256_set1_ps(ca);
+  const __m256 vB = _mm256_set1_ps(cb);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8)
+    _mm256_storeu_ps(res + i, _mm256_add_ps(
+      _mm256_mul_ps(vA, _mm256_loadu_ps(a + i)), 
+      _mm256_mul_ps(vB, _mm256_loadu_ps(b + i))));
+  for (; i < nb; ++i)
+    res[i] = ca * a[i] + cb * b[i];
+}
+
+static inline void VecFloatKernelOpSSE(const float* const a, 
+  const float ca, const float* const b, const float cb, 
+  float* const res, const long nb) {
+  const __m128 vA = _mm_set1_ps(ca);
+  const __m128 vB = _mm_set1_ps(cb);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4)
+    _mm_storeu_ps(res + i, _mm_add_ps(
+      _mm_mul_ps(vA, _mm_loadu_ps(a + i)), 
+      _mm_mul_ps(vB, _mm_loadu_ps(b + i))));
+  for (; i < nb; ++i)
+    res[i] = ca * a[i] + cb * b[i];
+}
+
+__attribute__((target("avx2,fma")))
+static inline void VecFloatKernelHadamardAVX2(const float* const a, 
+  const float* const b, float* const res, const long nb) {
+  long i = 0;
+  for (; i + 8 <= nb; i += 8)
+    _mm256_storeu_ps(res + i, 
+      _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+  for (; i < nb; ++i)
+    res[i] = a[i] * b[i];
+}
+
+static inline void VecFloatKernelHadamardSSE(const float* const a, 
+  const float* const b, float* const res, const long nb) {
+  long i = 0;
+  for (; i + 4 <= nb; i += 4)
+    _mm_storeu_ps(res + i, 
+      _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  for (; i < nb; ++i)
+    res[i] = a[i] * b[i];
+}
+
+__attribute__((target("avx2,fma")))
+static inline void VecFloatKernelScaleAVX2(const float* const a, 
+  const float c, float* const res, const long nb) {
+  const __m256 vC = _mm256_set1_ps(c);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8)
+    _mm256_storeu_ps(res + i, _mm256_mul_ps(vC, _mm256_loadu_ps(a + i)));
+  for (; i < nb; ++i)
+    res[i] = c * a[i];
+}
+
+static inline void VecFloatKernelScaleSSE(const float* const a, 
+  const float c, float* const res, const long nb) {
+  const __m128 vC = _mm_set1_ps(c);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4)
+    _mm_storeu_ps(res + i, _mm_mul_ps(vC, _mm_loadu_ps(a + i)));
+  for (; i < nb; ++i)
+    res[i] = c * a[i];
+}
+
+__attribute__((target("avx2,fma")))
+static inline void VecFloatKernelAddSqDiffAVX2(const float* const a, 
+  const float c, float* const res, const long nb) {
+  const __m256 vC = _mm256_set1_ps(c);
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    const __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a + i), vC);
+    _mm256_storeu_ps(res + i, 
+      _mm256_fmadd_ps(d, d, _mm256_loadu_ps(res + i)));
+  }
+  for (; i < nb; ++i)
+    res[i] += fsquare(a[i] - c);
+}
+
+static inline void VecFloatKernelAddSqDiffSSE(const float* const a, 
+  const float c, float* const res, const long nb) {
+  const __m128 vC = _mm_set1_ps(c);
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    const __m128 d = _mm_sub_ps(_mm_loadu_ps(a + i), vC);
+    _mm_storeu_ps(res + i, 
+      _mm_add_ps(_mm_loadu_ps(res + i), _mm_mul_ps(d, d)));
+  }
+  for (; i < nb; ++i)
+    res[i] += fsquare(a[i] - c);
+}
+
+__attribute__((target("avx2,fma")))
+static inline double VecFloatKernelDotDoubleAVX2(const float* const a, 
+  const float* const b, const long nb) {
+  __m256d accA = _mm256_setzero_pd();
+  __m256d accB = _mm256_setzero_pd();
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    accA = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(a + i)), 
+      _mm256_cvtps_pd(_mm_loadu_ps(b + i)), accA);
+    accB = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(a + i + 4)), 
+      _mm256_cvtps_pd(_mm_loadu_ps(b + i + 4)), accB);
+  }
+  accA = _mm256_add_pd(accA, accB);
+  __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(accA), 
+    _mm256_extractf128_pd(accA, 1));
+  double res = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+  for (; i < nb; ++i)
+    res += (double)(a[i]) * (double)(b[i]);
+  return res;
+}
+
+static inline double VecFloatKernelDotDoubleSSE(const float* const a, 
+  const float* const b, const long nb) {
+  __m128d accA = _mm_setzero_pd();
+  __m128d accB = _mm_setzero_pd();
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    __m128 vA = _mm_loadu_ps(a + i);
+    __m128 vB = _mm_loadu_ps(b + i);
+    accA = _mm_add_pd(accA, 
+      _mm_mul_pd(_mm_cvtps_pd(vA), _mm_cvtps_pd(vB)));
+    accB = _mm_add_pd(accB, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(vA, vA)), 
+      _mm_cvtps_pd(_mm_movehl_ps(vB, vB))));
+  }
+  __m128d acc = _mm_add_pd(accA, accB);
+  double res = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+  for (; i < nb; ++i)
+    res += (double)(a[i]) * (double)(b[i]);
+  return res;
+}
+
+__attribute__((target("avx2,fma")))
+static inline double VecFloatKernelDistSqDoubleAVX2(const float* const a, 
+  const float* const b, const long nb) {
+  __m256d accA = _mm256_setzero_pd();
+  __m256d accB = _mm256_setzero_pd();
+  long i = 0;
+  for (; i + 8 <= nb; i += 8) {
+    __m256d dA = _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(a + i)), 
+      _mm256_cvtps_pd(_mm_loadu_ps(b + i)));
+    __m256d dB = _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(a + i + 4)), 
+      _mm256_cvtps_pd(_mm_loadu_ps(b + i + 4)));
+    accA = _mm256_fmadd_pd(dA, dA, accA);
+    accB = _mm256_fmadd_pd(dB, dB, accB);
+  }
+  accA = _mm256_add_pd(accA, accB);
+  __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(accA), 
+    _mm256_extractf128_pd(accA, 1));
+  double res = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+  for (; i < nb; ++i) {
+    double d = (double)(a[i]) - (double)(b[i]);
+    res += d * d;
+  }
+  return res;
+}
+
+static inline double VecFloatKernelDistSqDoubleSSE(const float* const a, 
+  const float* const b, const long nb) {
+  __m128d accA = _mm_setzero_pd();
+  __m128d accB = _mm_setzero_pd();
+  long i = 0;
+  for (; i + 4 <= nb; i += 4) {
+    __m128 vA = _mm_loadu_ps(a + i);
+    __m128 vB = _mm_loadu_ps(b + i);
+    __m128d dA = _mm_sub_pd(_mm_cvtps_pd(vA), _mm_cvtps_pd(vB));
+    __m128d dB = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(vA, vA)), 
+      _mm_cvtps_pd(_mm_movehl_ps(vB, vB)));
+    accA = _mm_add_pd(accA, _mm_mul_pd(dA, dA));
+    accB = _mm_add_pd(accB, _mm_mul_pd(dB, dB));
+  }
+  __m128d acc = _mm_add_pd(accA, accB);
+  double res = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+  for (; i < nb; ++i) {
+    double d = (double)(a[i]) - (double)(b[i]);
+    res += d * d;
+  }
+  return res;
+}
+#endif
+
+// Return the dot product of the 'nb' floats 'a' and 'b'
+static inline float VecFloatKernelDot(const float* const a, 
+  const float* const b, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      return VecFloatKernelDotAVX2(a, b, nb);
+    return VecFloatKernelDotSSE(a, b, nb);
+  }
+#endif
+  float res = 0.0;
+  for (long i = nb; i--;)
+    res += a[i] * b[i];
+  return res;
+}
+
+// Return the squared euclidean distance between the 'nb' floats 'a' 
+// and 'b'
+static inline float VecFloatKernelDistSq(const float* const a, 
+  const float* const b, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      return VecFloatKernelDistSqAVX2(a, b, nb);
+    return VecFloatKernelDistSqSSE(a, b, nb);
+  }
+#endif
+  float res = 0.0;
+  for (long i = nb; i--;)
+    res += fsquare(a[i] - b[i]);
+  return res;
+}
+
+// Calculate (a * ca + b * cb) on the 'nb' floats and store the result
+// in 'res'
+static inline void VecFloatKernelOp(const float* const a, 
+  const float ca, const float* const b, const float cb, 
+  float* const res, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      VecFloatKernelOpAVX2(a, ca, b, cb, res, nb);
+    else
+      VecFloatKernelOpSSE(a, ca, b, cb, res, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;)
+    res[i] = ca * a[i] + cb * b[i];
+}
+
+// Calculate the Hadamard product of the 'nb' floats 'a' and 'b' and 
+// store the result in 'res'
+static inline void VecFloatKernelHadamard(const float* const a, 
+  const float* const b, float* const res, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      VecFloatKernelHadamardAVX2(a, b, res, nb);
+    else
+      VecFloatKernelHadamardSSE(a, b, res, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;)
+    res[i] = a[i] * b[i];
+}
+
+// Calculate (a * c) on the 'nb' floats and store the result in 'res'
+static inline void VecFloatKernelScale(const float* const a, 
+  const float c, float* const res, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      VecFloatKernelScaleAVX2(a, c, res, nb);
+    else
+      VecFloatKernelScaleSSE(a, c, res, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;)
+    res[i] = c * a[i];
+}
+
+// Add (a[i] - c)^2 to each of the 'nb' floats res[i], with the SIMD
+// kernels of VecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatKernelAddSqDiff(const float* const a, const float c, 
+  float* const res, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      VecFloatKernelAddSqDiffAVX2(a, c, res, nb);
+    else
+      VecFloatKernelAddSqDiffSSE(a, c, res, nb);
+    return;
+  }
+#endif
+  for (long i = nb; i--;)
+    res[i] += fsquare(a[i] - c);
+}
+
+// Return the dot product of the 'nb' floats 'a' and 'b', the products
+// are converted to and accumulated in double precision
+static inline double VecFloatKernelDotDouble(const float* const a, 
+  const float* const b, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      return VecFloatKernelDotDoubleAVX2(a, b, nb);
+    return VecFloatKernelDotDoubleSSE(a, b, nb);
+  }
+#endif
+  double res = 0.0;
+  for (long i = nb; i--;)
+    res += (double)(a[i]) * (double)(b[i]);
+  return res;
+}
+
+// Return the squared euclidean distance between the 'nb' floats 'a' 
+// and 'b', the differences are converted to and accumulated in double
+// precision
+static inline double VecFloatKernelDistSqDouble(const float* const a, 
+  const float* const b, const long nb) {
+#if PBMATH_SIMD_X86
+  if (nb >= PBMATH_SIMDMINDIM) {
+    if (VecFloatKernelHasAVX2())
+      return VecFloatKernelDistSqDoubleAVX2(a, b, nb);
+    return VecFloatKernelDistSqDoubleSSE(a, b, nb);
+  }
+#endif
+  double res = 0.0;
+  for (long i = nb; i--;) {
+    double d = (double)(a[i]) - (double)(b[i]);
+    res += d * d;
+  }
+  return res;
+}
+
+// Static constructors for VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D VecFloatCreateStatic2D() {
+  VecFloat2D v = {._val = {0.0, 0.0}, ._dim = 2};
+  return v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D VecFloatCreateStatic3D() {
+  VecFloat3D v = {._val = {0.0, 0.0, 0.0}, ._dim = 3};
+  return v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat4D VecFloatCreateStatic4D() {
+  VecFloat4D v = {._val = {0.0, 0.0, 0.0, 0.0}, ._dim = 4};
+  return v;
+}
+
+// Return the i-th value of the VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatGet(const VecFloat* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the value
+  return that->_val[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatGet2D(const VecFloat2D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the value
+  return that->_val[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatGet3D(const VecFloat3D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the value
+  return that->_val[i];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatGet4D(const VecFloat4D* const that, const long i) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 4) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<4)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the value
+  return that->_val[i];
+}
+
+// Set the i-th value of the VecFloat to v
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSet(VecFloat* const that, const long i, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
+    PBErrCatch(PBMathErr);
   }
 #endif
   // Set the value
-  that->_val[i] += v;
+  that->_val[i] = v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSet2D(VecFloat2D* const that, const long i, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] = v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSet3D(VecFloat3D* const that, const long i, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] = v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSet4D(VecFloat4D* const that, const long i, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 4) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<4)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] = v;
+}
+
+// Set the i-th value of the VecFloat to v plus its current value
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAdd(VecFloat* const that, const long i, const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'i' is invalid (0<=%ld<%ld)", i, that->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] += v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAdd2D(VecFloat2D* const that, const long i, 
+  const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<2)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] += v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAdd3D(VecFloat3D* const that, const long i, 
+  const float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (i < 0 || i >= 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<3)", i);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[i] += v;
+}
+
+// Set all values of the vector 'that' to 0.0
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetNull(VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] = 0.0;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetNull2D(VecFloat2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  that->_val[0] = 0.0;
+  that->_val[1] = 0.0;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetNull3D(VecFloat3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  that->_val[0] = 0.0;
+  that->_val[1] = 0.0;
+  that->_val[2] = 0.0;
+}
+
+// Set all values of the vector 'that' to 'v'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAll(VecFloat* const that, float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] = v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAll2D(VecFloat2D* const that, float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  that->_val[0] = v;
+  that->_val[1] = v;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSetAll3D(VecFloat3D* const that, float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set values
+  that->_val[0] = v;
+  that->_val[1] = v;
+  that->_val[2] = v;
+}
+
+// Return the dimension of the VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+long _VecFloatGetDim(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_dim;
+}
+
+// Copy the values of 'tho' in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatCopy(VecFloat* const that, const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Copy the values
+  memcpy(that->_val, tho->_val, sizeof(float) * that->_dim);
+}
+
+// Return the norm of the VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatNorm(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Calculate the norm
+  float ret = 
+    sqrt(VecFloatKernelDot(that->_val, that->_val, that->_dim));
+  // Return the result
+  return ret;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatNorm2D(const VecFloat2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the result
+  return sqrt(fsquare(VecGet(that, 0)) + fsquare(VecGet(that, 1)));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatNorm3D(const VecFloat3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the result
+  return sqrt(fsquare(VecGet(that, 0)) + fsquare(VecGet(that, 1)) + 
+    fsquare(VecGet(that, 2)));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatNorm4D(const VecFloat4D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the result
+  return sqrt(fsquare(that->_val[0]) + fsquare(that->_val[1]) + 
+    fsquare(that->_val[2]) + fsquare(that->_val[3]));
+}
+
+// Normalise the VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatNormalise(VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Normalise
+  float norm = VecNorm(that);
+  for (long iDim = that->_dim; iDim--;)
+    VecSet(that, iDim, VecGet(that, iDim) / norm);
+}
+
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatNormalise2D(VecFloat2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Normalise
+  float norm = _VecFloatNorm2D(that);
+  VecSet(that, 0, VecGet(that, 0) / norm);
+  VecSet(that, 1, VecGet(that, 1) / norm);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatNormalise3D(VecFloat3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Normalise
+  float norm = _VecFloatNorm3D(that);
+  VecSet(that, 0, VecGet(that, 0) / norm);
+  VecSet(that, 1, VecGet(that, 1) / norm);
+  VecSet(that, 2, VecGet(that, 2) / norm);
+}
+
+// Return the distance between the VecFloat 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDist(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Calculate the distance
+  float ret = 
+    sqrt(VecFloatKernelDistSq(that->_val, tho->_val, that->_dim));
+  // Return the distance
+  return ret;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDist2D(const VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return sqrt(fsquare(VecGet(that, 0) - VecGet(tho, 0)) +
+    fsquare(VecGet(that, 1) - VecGet(tho, 1)));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDist3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return sqrt(fsquare(VecGet(that, 0) - VecGet(tho, 0)) +
+    fsquare(VecGet(that, 1) - VecGet(tho, 1)) +
+    fsquare(VecGet(that, 2) - VecGet(tho, 2)));
+}
+
+// Return the Hamiltonian distance between the VecFloat 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatHamiltonDist(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to calculate the distance
+  float ret = 0.0;
+  for (long iDim = that->_dim; iDim--;)
+    ret += fabs(VecGet(that, iDim) - VecGet(tho, iDim));
+  // Return the distance
+  return ret;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatHamiltonDist2D(const VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return fabs(VecGet(that, 0) - VecGet(tho, 0)) + 
+    fabs(VecGet(that, 1) - VecGet(tho, 1));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatHamiltonDist3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return fabs(VecGet(that, 0) - VecGet(tho, 0)) + 
+    fabs(VecGet(that, 1) - VecGet(tho, 1)) +
+    fabs(VecGet(that, 2) - VecGet(tho, 2));
+}
+
+// Return the Pixel distance between the VecFloat 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatPixelDist(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to calculate the distance
+  float ret = 0.0;
+  for (long iDim = that->_dim; iDim--;)
+    ret += fabs(floor(VecGet(that, iDim)) - floor(VecGet(tho, iDim)));
+  // Return the distance
+  return ret;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatPixelDist2D(const VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return fabs(floor(VecGet(that, 0)) - floor(VecGet(tho, 0))) +
+    fabs(floor(VecGet(that, 1)) - floor(VecGet(tho, 1)));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatPixelDist3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the distance
+  return fabs(floor(VecGet(that, 0)) - floor(VecGet(tho, 0))) +
+    fabs(floor(VecGet(that, 1)) - floor(VecGet(tho, 1))) +
+    fabs(floor(VecGet(that, 2)) - floor(VecGet(tho, 2)));
+}
+
+// Return true if the VecFloat 'that' is equal to 'tho', else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatIsEqual(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // For each component
+  for (long iDim = that->_dim; iDim--;)
+    // If the values of this components are different
+    if (!ISEQUALF(VecGet(that, iDim), VecGet(tho, iDim)))
+      // Return false
+      return false;
+  // Return true
+  return true;
+}
+
+// Calculate (that * a + tho * b) and store the result in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatOp(VecFloat* const that, const float a, 
+  const VecFloat* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloatKernelOp(that->_val, a, tho->_val, b, that->_val, that->_dim);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatOp2D(VecFloat2D* const that, const float a, 
+  const VecFloat2D* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
+  VecSet(that, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatOp3D(VecFloat3D* const that, const float a, 
+  const VecFloat3D* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
+  VecSet(that, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
+  VecSet(that, 2, a * VecGet(that, 2) + b * VecGet(tho, 2));
+}
+
+// Return a VecFloat equal to (that * a + tho * b)
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat* _VecFloatGetOp(const VecFloat* const that, const float a, 
+  const VecFloat* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat* res = VecFloatCreate(that->_dim);
+  VecFloatKernelOp(that->_val, a, tho->_val, b, res->_val, that->_dim);
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D _VecFloatGetOp2D(const VecFloat2D* const that, const float a, 
+  const VecFloat2D* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat2D res = VecFloatCreateStatic2D();
+  VecSet(&res, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
+  VecSet(&res, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetOp3D(const VecFloat3D* const that, const float a, 
+  const VecFloat3D* const tho, const float b) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat3D res = VecFloatCreateStatic3D();
+  VecSet(&res, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
+  VecSet(&res, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
+  VecSet(&res, 2, a * VecGet(that, 2) + b * VecGet(tho, 2));
+  return res;
+}
+
+// Calculate the Hadamard product of that by tho and store the 
+// result in 'that'
+// 'tho' and 'that' must be of same dimension
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecFloatHadamardProd(VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloatKernelHadamard(that->_val, tho->_val, that->_val, that->_dim);
+}
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecFloatHadamardProd2D(VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, VecGet(that, 0) * VecGet(tho, 0));
+  VecSet(that, 1, VecGet(that, 1) * VecGet(tho, 1));
+}
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecFloatHadamardProd3D(VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, VecGet(that, 0) * VecGet(tho, 0));
+  VecSet(that, 1, VecGet(that, 1) * VecGet(tho, 1));
+  VecSet(that, 2, VecGet(that, 2) * VecGet(tho, 2));
+}
+
+// Return a VecFloat equal to the hadamard product of 'that' and 'tho'
+// Return NULL if arguments are invalid
+// 'tho' and 'that' must be of same dimension
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* _VecFloatGetHadamardProd(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat* res = VecFloatCreate(that->_dim);
+  VecFloatKernelHadamard(that->_val, tho->_val, res->_val, that->_dim);
+  return res;
+}
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat2D _VecFloatGetHadamardProd2D(const VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat2D res = VecFloatCreateStatic2D();
+  VecSet(&res, 0, VecGet(that, 0) * VecGet(tho, 0));
+  VecSet(&res, 1, VecGet(that, 1) * VecGet(tho, 1));
+  return res;
+}
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat3D _VecFloatGetHadamardProd3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat3D res = VecFloatCreateStatic3D();
+  VecSet(&res, 0, VecGet(that, 0) * VecGet(tho, 0));
+  VecSet(&res, 1, VecGet(that, 1) * VecGet(tho, 1));
+  VecSet(&res, 2, VecGet(that, 2) * VecGet(tho, 2));
+  return res;
+}
+
+// Calculate (that * a) and store the result in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatScale(VecFloat* const that, const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloatKernelScale(that->_val, a, that->_val, that->_dim);
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatScale2D(VecFloat2D* const that, const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, a * VecGet(that, 0));
+  VecSet(that, 1, a * VecGet(that, 1));
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatScale3D(VecFloat3D* const that, const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecSet(that, 0, a * VecGet(that, 0));
+  VecSet(that, 1, a * VecGet(that, 1));
+  VecSet(that, 2, a * VecGet(that, 2));
+}
+
+// Return a VecFloat equal to (that * a)
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat* _VecFloatGetScale(const VecFloat* const that, const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat* res = VecFloatCreate(that->_dim);
+  VecFloatKernelScale(that->_val, a, res->_val, that->_dim);
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D _VecFloatGetScale2D(const VecFloat2D* const that, 
+  const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat2D res = VecFloatCreateStatic2D();
+  VecSet(&res, 0, a * VecGet(that, 0));
+  VecSet(&res, 1, a * VecGet(that, 1));
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetScale3D(const VecFloat3D* const that, 
+  const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat3D res = VecFloatCreateStatic3D();
+  VecSet(&res, 0, a * VecGet(that, 0));
+  VecSet(&res, 1, a * VecGet(that, 1));
+  VecSet(&res, 2, a * VecGet(that, 2));
+  return res;
+}
+
+// Rotate CCW 'that' by 'theta' radians and store the result in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatRot2D(VecFloat2D* const that, const float theta) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(that) != 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==2)",
+      VecGetDim(that));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  *that = _VecFloatGetRot2D(that, theta);
+}
+
+// Return a VecFloat2D equal to 'that' rotated CCW by 'theta' radians
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D _VecFloatGetRot2D(const VecFloat2D* const that, const float theta) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(that) != 2) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==2)",
+      VecGetDim(that));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result 
+  VecFloat2D res = VecFloatCreateStatic2D();
+  // Declare variable for optimization
+  float cosTheta = cos(theta);
+  float sinTheta = sin(theta);
+  // Calculate the rotation
+  VecSet(&res, 0, 
+    cosTheta * VecGet(that, 0) - sinTheta * VecGet(that, 1));
+  VecSet(&res, 1, 
+    sinTheta * VecGet(that, 0) + cosTheta * VecGet(that, 1));
+  // Return the result
+  return res;
+}
+
+// Return the dot product of 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDotProd(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Calculate
+  float res = VecFloatKernelDot(that->_val, tho->_val, that->_dim);
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDotProd2D(const VecFloat2D* const that, 
+  const VecFloat2D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[0] * tho->_val[0] + that->_val[1] * tho->_val[1];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDotProd3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[0] * tho->_val[0] + that->_val[1] * tho->_val[1] +
+    that->_val[2] * tho->_val[2];
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+float _VecFloatDotProd4D(const VecFloat4D* const that, 
+  const VecFloat4D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val[0] * tho->_val[0] + that->_val[1] * tho->_val[1] +
+    that->_val[2] * tho->_val[2] + that->_val[3] * tho->_val[3];
+}
+
+// Return the dot product of 'that' and 'tho', the values are stored in 
+// float but the products are accumulated in double precision
+#if BUILDMODE != 0
+static inline
+#endif 
+double _VecFloatDotProdDouble(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return VecFloatKernelDotDouble(that->_val, tho->_val, that->_dim);
+}
+
+// Return the norm of the VecFloat, accumulated in double precision
+#if BUILDMODE != 0
+static inline
+#endif 
+double _VecFloatNormDouble(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return sqrt(VecFloatKernelDotDouble(that->_val, that->_val, that->_dim));
+}
+
+// Return the distance between the VecFloat 'that' and 'tho', 
+// accumulated in double precision
+#if BUILDMODE != 0
+static inline
+#endif 
+double _VecFloatDistDouble(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return sqrt(VecFloatKernelDistSqDouble(that->_val, tho->_val, 
+    that->_dim));
+}
+
+// Return the cross product of 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat* _VecFloatGetCrossProd(const VecFloat* const that, 
+  const VecFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim || tho->_dim != 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "invalid dimensions (%ld==%ld==3)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  VecFloat* res = VecFloatCreate(3);
+  // Calculate
+  VecSet(res, 0,
+    VecGet(that, 1) * VecGet(tho, 2) - 
+    VecGet(that, 2) * VecGet(tho, 1));
+  VecSet(res, 1, -1.0 *
+    (VecGet(that, 0) * VecGet(tho, 2) - 
+    VecGet(that, 2) * VecGet(tho, 0)));
+  VecSet(res, 2, 
+    VecGet(that, 0) * VecGet(tho, 1) - 
+    VecGet(that, 1) * VecGet(tho, 0));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetCrossProd3D(const VecFloat3D* const that, 
+  const VecFloat3D* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  VecFloat3D res = VecFloatCreateStatic3D();
+  // Calculate
+  VecSet(&res, 0,
+    VecGet(that, 1) * VecGet(tho, 2) - 
+    VecGet(that, 2) * VecGet(tho, 1));
+  VecSet(&res, 1, -1.0 *
+    (VecGet(that, 0) * VecGet(tho, 2) - 
+    VecGet(that, 2) * VecGet(tho, 0)));
+  VecSet(&res, 2, 
+    VecGet(that, 0) * VecGet(tho, 1) - 
+    VecGet(that, 1) * VecGet(tho, 0));
+  // Return the result
+  return res;
+}
+
+// Return the conversion of VecFloat 'that' to a VecShort using round()
+#if BUILDMODE != 0
+static inline
+#endif 
+VecShort* VecFloatToShort(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecShort* res = VecShortCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;)
+    VecSet(res, iDim, SHORT(VecGet(that, iDim)));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecShort2D VecFloatToShort2D(const VecFloat2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecShort2D res = VecShortCreateStatic2D();
+  VecSet(&res, 0, SHORT(VecGet(that, 0)));
+  VecSet(&res, 1, SHORT(VecGet(that, 1)));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecShort3D VecFloatToShort3D(const VecFloat3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecShort3D res = VecShortCreateStatic3D();
+  VecSet(&res, 0, SHORT(VecGet(that, 0)));
+  VecSet(&res, 1, SHORT(VecGet(that, 1)));
+  VecSet(&res, 2, SHORT(VecGet(that, 2)));
+  // Return the result
+  return res;
+}
+
+// Return the conversion of VecShort 'that' to a VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat* VecShortToFloat(const VecShort* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat* res = VecFloatCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;)
+    VecSet(res, iDim, (float)VecGet(that, iDim));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D VecShortToFloat2D(const VecShort2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat2D res = VecFloatCreateStatic2D();
+  VecSet(&res, 0, (float)VecGet(that, 0));
+  VecSet(&res, 1, (float)VecGet(that, 1));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D VecShortToFloat3D(const VecShort3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat3D res = VecFloatCreateStatic3D();
+  VecSet(&res, 0, (float)VecGet(that, 0));
+  VecSet(&res, 1, (float)VecGet(that, 1));
+  VecSet(&res, 2, (float)VecGet(that, 2));
+  // Return the result
+  return res;
+}
+
+// Return the conversion of VecLong 'that' to a VecFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat* VecLongToFloat(const VecLong* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat* res = VecFloatCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;)
+    VecSet(res, iDim, (float)VecGet(that, iDim));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat2D VecLongToFloat2D(const VecLong2D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat2D res = VecFloatCreateStatic2D();
+  VecSet(&res, 0, (float)VecGet(that, 0));
+  VecSet(&res, 1, (float)VecGet(that, 1));
+  // Return the result
+  return res;
+}
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D VecLongToFloat3D(const VecLong3D* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the result
+  VecFloat3D res = VecFloatCreateStatic3D();
+  VecSet(&res, 0, (float)VecGet(that, 0));
+  VecSet(&res, 1, (float)VecGet(that, 1));
+  VecSet(&res, 2, (float)VecGet(that, 2));
+  // Return the result
+  return res;
+}
+
+// Get the max value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMaxVal(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  float max = VecGet(that, 0);
+  // Search for the maximum value
+  for (long i = VecGetDim(that); i-- && i != 0;)
+    max = MAX(max, VecGet(that, i));
+  // Return the result
+  return max;
+}
+
+// Get the index of the max value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long _VecFloatGetIMaxVal(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  long iMax = 0;
+  // Declare a variable to memorize the max value
+  float max = VecGet(that, iMax);
+  // Search for the maximum value
+  for (long i = VecGetDim(that); i-- && i != 0;) {
+    if(max < VecGet(that, i)) {
+      max = VecGet(that, i);
+      iMax = i;
+    }
+  }
+  // Return the result
+  return iMax;
+}
+
+// Get the min value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMinVal(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  float min = VecGet(that, 0);
+  // Search for the minimum value
+  for (long i = VecGetDim(that); i-- && i != 0;)
+    min = MIN(min, VecGet(that, i));
+  // Return the result
+  return min;
+}
+
+// Get the max value (in absolute value) in components of the 
+// vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMaxValAbs(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  float max = fabs(VecGet(that, 0));
+  // Search for the maximum value
+  for (long i = VecGetDim(that); i-- && i != 0;)
+    max = (fabs(max) > fabs(VecGet(that, i)) ? max : VecGet(that, i));
+  // Return the result
+  return max;
+}
+
+// Get the min value (in absolute value) in components of the 
+// vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMinValAbs(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable to memorize the result
+  float min = fabs(VecGet(that, 0));
+  // Search for the minimum value
+  for (long i = VecGetDim(that); i-- && i != 0;)
+    min = (fabs(min) < fabs(VecGet(that, i)) ? min : VecGet(that, i));
+  // Return the result
+  return min;
+}
+
+// Set the MatFloat to the identity matrix
+// The matrix must be a square matrix
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatFloatSetIdentity(MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "the matrix is not square (%dx%d)",
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the values
+  VecShort2D i = VecShortCreateStatic2D();
+  do {
+    if (VecGet(&i, 0) == VecGet(&i, 1))
+      MatSet(that, &i, 1.0);
+    else
+      MatSet(that, &i, 0.0);
+  } while (VecStep(&i, &(that->_dim)));
+}
+
+// Return the addition of matrix 'that' with matrix 'tho'
+// 'that' and 'tho' must have same dimensions
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetAdd(MatFloat* const that, MatFloat* tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecIsEqual(MatDim(that), MatDim(tho)) == false) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'that' and 'tho' have different dimensions");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare a variable for the result
+  MatFloat* res = MatFloatCreate(MatDim(that));
+  // Add each values
+  VecShort2D i = VecShortCreateStatic2D();
+  do {
+    MatSet(res, &i, MatGet(that, &i) + MatGet(tho, &i));
+  } while (VecStep(&i, MatDim(that)));
+  // Return the result
+  return res;
+}
+
+// Add matrix 'that' with matrix 'tho' and store the result in 'that'
+// 'that' and 'tho' must have same dimensions
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatAdd(MatFloat* const that, MatFloat* tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecIsEqual(MatDim(that), MatDim(tho)) == false) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'that' and 'tho' have different dimensions");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Add each values
+  VecShort2D i = VecShortCreateStatic2D();
+  do {
+    MatSet(that, &i, MatGet(that, &i) + MatGet(tho, &i));
+  } while (VecStep(&i, MatDim(that)));
+}
+
+// Multiply the matrix 'that' by 'a'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatScale(MatFloat* const that, const float a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Multiply each values
+  VecShort2D i = VecShortCreateStatic2D();
+  do {
+    MatSet(that, &i, MatGet(that, &i) * a);
+  } while (VecStep(&i, MatDim(that)));
+}
+
+// Copy the values of 'w' in 'that' (must have same dimensions)
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatFloatCopy(MatFloat* const that, const MatFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (!VecIsEqual(&(that->_dim), &(tho->_dim))) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'that' and 'tho' have different dimensions (%dx%d==%dx%d)",
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1), 
+      VecGet(&(tho->_dim), 0), VecGet(&(tho->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Copy the matrix values
+  int d = VecGet(&(that->_dim), 0) * VecGet(&(that->_dim), 1);
+  memcpy(that->_val, tho->_val, d * sizeof(float));
+}
+
+// Return the value at index 'i' (col, line) of the MatFloat
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0
+static inline
+#endif 
+float _MatFloatGet(const MatFloat* const that, 
+  VecShort2D* index) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (index == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'index' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(index, 0) < 0 || 
+    VecGet(index, 0) >= VecGet(&(that->_dim), 0) ||
+    VecGet(index, 1) < 0 || 
+    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'index' is invalid (0,0 <= %d,%d < %d,%d)",
+      VecGet(index, 0), VecGet(index, 1), 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the value
+  return that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
+    VecGet(index, 0)];
+}
+
+// Set the value at index 'i' (col, line) of the MatFloat to 'v'
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatFloatSet(MatFloat* const that, VecShort2D* index, float v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (index == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'index' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(index, 0) < 0 || 
+    VecGet(index, 0) >= VecGet(&(that->_dim), 0) ||
+    VecGet(index, 1) < 0 || 
+    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'index' is invalid (0,0 <= %d,%d < %d,%d)",
+      VecGet(index, 0), VecGet(index, 1), 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Set the value
+  that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
+    VecGet(index, 0)] = v;
+}
+
+// Return the dimension of the MatFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+const VecShort2D* _MatFloatDim(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the dimension
+  return &(that->_dim);
+}
+
+// Return a VecShort2D containing the dimension of the MatFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+VecShort2D _MatFloatGetDim(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the dimension
+  return that->_dim;
+}
+
+// Return the number of rows of the MatFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatFloatGetNbRow(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the nb of rows
+  return VecGet(&(that->_dim), 1);
+}
+
+// Return the number of columns of the MatFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatFloatGetNbCol(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Return the nb of cols
+  return VecGet(&(that->_dim), 0);
+  
+}
+
+// Add to the 'nbRow' x 'nbCol' block 'c' the product of the 'nbRow' x
+// 'nbInner' block 'a' by the 'nbInner' x 'nbCol' block 'b', the blocks
+// being inside row-major arrays whose rows are 'lda', 'ldb', 'ldc' 
+// floats long
+static inline void MatFloatKernelProdBlockScalar(const float* const a,
+  const long lda, const float* const b, const long ldb, float* const c,
+  const long ldc, const long nbRow, const long nbInner, 
+  const long nbCol) {
+  for (long iRow = 0; iRow < nbRow; ++iRow) {
+    float* const cRow = c + iRow * ldc;
+    for (long k = 0; k < nbInner; ++k) {
+      const float aVal = a[iRow * lda + k];
+      const float* const bRow = b + k * ldb;
+      for (long iCol = 0; iCol < nbCol; ++iCol)
+        cRow[iCol] += aVal * bRow[iCol];
+    }
+  }
+}
+
+#if PBMATH_SIMD_X86
+// The vectorised versions keep 4 rows by 8 (AVX2) or 4 (SSE) columns 
+// of 'c' in registers while running along the inner dimension, the 
+// remaining columns are processed by the scalar version
+__attribute__((target("avx2,fma")))
+static inline void MatFloatKernelProdBlockAVX2(const float* const a,
+  const long lda, const float* const b, const long ldb, float* const c,
+  const long ldc, const long nbRow, const long nbInner, 
+  const long nbCol) {
+  const long nbColVec = nbCol - nbCol % 8;
+  long iRow = 0;
+  for (; iRow + 4 <= nbRow; iRow += 4) {
+    const float* const a0 = a + iRow * lda;
+    const float* const a1 = a0 + lda;
+    const float* const a2 = a1 + lda;
+    const float* const a3 = a2 + lda;
+    float* const c0 = c + iRow * ldc;
+    float* const c1 = c0 + ldc;
+    float* const c2 = c1 + ldc;
+    float* const c3 = c2 + ldc;
+    for (long iCol = 0; iCol < nbColVec; iCol += 8) {
+      __m256 acc0 = _mm256_loadu_ps(c0 + iCol);
+      __m256 acc1 = _mm256_loadu_ps(c1 + iCol);
+      __m256 acc2 = _mm256_loadu_ps(c2 + iCol);
+      __m256 acc3 = _mm256_loadu_ps(c3 + iCol);
+      const float* bVal = b + iCol;
+      for (long k = 0; k < nbInner; ++k, bVal += ldb) {
+        const __m256 vB = _mm256_loadu_ps(bVal);
+        acc0 = _mm256_fmadd_ps(_mm256_set1_ps(a0[k]), vB, acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_set1_ps(a1[k]), vB, acc1);
+        acc2 = _mm256_fmadd_ps(_mm256_set1_ps(a2[k]), vB, acc2);
+        acc3 = _mm256_fmadd_ps(_mm256_set1_ps(a3[k]), vB, acc3);
+      }
+      _mm256_storeu_ps(c0 + iCol, acc0);
+      _mm256_storeu_ps(c1 + iCol, acc1);
+      _mm256_storeu_ps(c2 + iCol, acc2);
+      _mm256_storeu_ps(c3 + iCol, acc3);
+    }
+  }
+  for (; iRow < nbRow; ++iRow) {
+    const float* const a0 = a + iRow * lda;
+    float* const c0 = c + iRow * ldc;
+    for (long iCol = 0; iCol < nbColVec; iCol += 8) {
+      __m256 acc0 = _mm256_loadu_ps(c0 + iCol);
+      const float* bVal = b + iCol;
+      for (long k = 0; k < nbInner; ++k, bVal += ldb)
+        acc0 = _mm256_fmadd_ps(_mm256_set1_ps(a0[k]), 
+          _mm256_loadu_ps(bVal), acc0);
+      _mm256_storeu_ps(c0 + iCol, acc0);
+    }
+  }
+  if (nbColVec < nbCol)
+    MatFloatKernelProdBlockScalar(a, lda, b + nbColVec, ldb, 
+      c + nbColVec, ldc, nbRow, nbInner, nbCol - nbColVec);
+}
+
+static inline void MatFloatKernelProdBlockSSE(const float* const a,
+  const long lda, const float* const b, const long ldb, float* const c,
+  const long ldc, const long nbRow, const long nbInner, 
+  const long nbCol) {
+  const long nbColVec = nbCol - nbCol % 4;
+  long iRow = 0;
+  for (; iRow + 4 <= nbRow; iRow += 4) {
+    const float* const a0 = a + iRow * lda;
+    const float* const a1 = a0 + lda;
+    const float* const a2 = a1 + lda;
+    const float* const a3 = a2 + lda;
+    float* const c0 = c + iRow * ldc;
+    float* const c1 = c0 + ldc;
+    float* const c2 = c1 + ldc;
+    float* const c3 = c2 + ldc;
+    for (long iCol = 0; iCol < nbColVec; iCol += 4) {
+      __m128 acc0 = _mm_loadu_ps(c0 + iCol);
+      __m128 acc1 = _mm_loadu_ps(c1 + iCol);
+      __m128 acc2 = _mm_loadu_ps(c2 + iCol);
+      __m128 acc3 = _mm_loadu_ps(c3 + iCol);
+      const float* bVal = b + iCol;
+      for (long k = 0; k < nbInner; ++k, bVal += ldb) {
+        const __m128 vB = _mm_loadu_ps(bVal);
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(a0[k]), vB));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_set1_ps(a1[k]), vB));
+        acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_set1_ps(a2[k]), vB));
+        acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_set1_ps(a3[k]), vB));
+      }
+      _mm_storeu_ps(c0 + iCol, acc0);
+      _mm_storeu_ps(c1 + iCol, acc1);
+      _mm_storeu_ps(c2 + iCol, acc2);
+      _mm_storeu_ps(c3 + iCol, acc3);
+    }
+  }
+  for (; iRow < nbRow; ++iRow) {
+    const float* const a0 = a + iRow * lda;
+    float* const c0 = c + iRow * ldc;
+    for (long iCol = 0; iCol < nbColVec; iCol += 4) {
+      __m128 acc0 = _mm_loadu_ps(c0 + iCol);
+      const float* bVal = b + iCol;
+      for (long k = 0; k < nbInner; ++k, bVal += ldb)
+        acc0 = _mm_add_ps(acc0, 
+          _mm_mul_ps(_mm_set1_ps(a0[k]), _mm_loadu_ps(bVal)));
+      _mm_storeu_ps(c0 + iCol, acc0);
+    }
+  }
+  if (nbColVec < nbCol)
+    MatFloatKernelProdBlockScalar(a, lda, b + nbColVec, ldb, 
+      c + nbColVec, ldc, nbRow, nbInner, nbCol - nbColVec);
+}
+#endif
+
+// Calculate the rows 'fromRow' to 'toRow' (excluded) of the product of
+// the MatFloat 'that' by the MatFloat 'tho' into the MatFloat 'res'
+// The inner and column dimensions are split into blocks of 
+// PBMATH_MATPRODBLOCKINNER x PBMATH_MATPRODBLOCKCOL values of 'tho' 
+// so they stay in cache while the rows of 'that' run along them
+static inline void MatFloatKernelProdRows(const MatFloat* const that,
+  const MatFloat* const tho, MatFloat* const res, const long fromRow,
+  const long toRow) {
+  const long nbInner = VecGet(&(that->_dim), 0);
+  const long nbCol = VecGet(&(tho->_dim), 0);
+  const float* const a = that->_val + fromRow * nbInner;
+  float* const c = res->_val + fromRow * nbCol;
+  const long nbRow = toRow - fromRow;
+  memset(c, 0, sizeof(float) * nbRow * nbCol);
+#if PBMATH_SIMD_X86
+  const bool hasAVX2 = VecFloatKernelHasAVX2();
+#endif
+  for (long k = 0; k < nbInner; k += PBMATH_MATPRODBLOCKINNER) {
+    const long nbK = (nbInner - k < PBMATH_MATPRODBLOCKINNER ?
+      nbInner - k : PBMATH_MATPRODBLOCKINNER);
+    for (long iCol = 0; iCol < nbCol; iCol += PBMATH_MATPRODBLOCKCOL) {
+      const long nbC = (nbCol - iCol < PBMATH_MATPRODBLOCKCOL ?
+        nbCol - iCol : PBMATH_MATPRODBLOCKCOL);
+      const float* const aBlock = a + k;
+      const float* const bBlock = tho->_val + k * nbCol + iCol;
+      float* const cBlock = c + iCol;
+#if PBMATH_SIMD_X86
+      if (hasAVX2)
+        MatFloatKernelProdBlockAVX2(aBlock, nbInner, bBlock, nbCol, 
+          cBlock, nbCol, nbRow, nbK, nbC);
+      else
+        MatFloatKernelProdBlockSSE(aBlock, nbInner, bBlock, nbCol, 
+          cBlock, nbCol, nbRow, nbK, nbC);
+#else
+      MatFloatKernelProdBlockScalar(aBlock, nbInner, bBlock, nbCol, 
+        cBlock, nbCol, nbRow, nbK, nbC);
+#endif
+    }
+  }
+}
+
+// Process the blocks of rows of the MatFloatProdJob 'job' until they 
+// have all been processed
+static inline void* MatFloatProdWorker(void* job) {
+  MatFloatProdJob* that = (MatFloatProdJob*)job;
+  const long nbRow = VecGet(&(that->_that->_dim), 1);
+  while (true) {
+    // Get the next block to process
+    pthread_mutex_lock(&(that->_mutex));
+    long iBlock = that->_nextBlock;
+    ++(that->_nextBlock);
+    pthread_mutex_unlock(&(that->_mutex));
+    if (iBlock >= that->_nbBlock)
+      break;
+    long fromRow = iBlock * PBMATH_MATPRODBLOCKROW;
+    long toRow = fromRow + PBMATH_MATPRODBLOCKROW;
+    if (toRow > nbRow)
+      toRow = nbRow;
+    MatFloatKernelProdRows(that->_that, that->_tho, that->_res, 
+      fromRow, toRow);
+  }
+  return NULL;
+}
+
+// Check the arguments of the product of MatFloat 'that' by 'tho' 
+// into 'res'
+#if BUILDMODE == 0
+static inline void MatFloatProdCheckArgs(const MatFloat* const that,
+  const MatFloat* const tho, const MatFloat* const res) {
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(tho->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d==%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(tho->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(res->_dim), 0) != VecGet(&(tho->_dim), 0) ||
+    VecGet(&(res->_dim), 1) != VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'res' has invalid dimensions (%dx%d)", 
+      VecGet(&(res->_dim), 0), VecGet(&(res->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+  if (res == that || res == tho) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'res' is one of the operands");
+    PBErrCatch(PBMathErr);
+  }
+}
+#endif
+
+// Calculate the product of matrix 'that' and vector 'v' and store the
+// result in 'res'
+// Number of columns of 'that' must equal dimension of 'v', dimension
+// of 'res' must equal number of rows of 'that', 'res' must be 
+// different from 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdVecFloat(const MatFloat* const that, 
+  const VecFloat* const v, VecFloat* const res) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGetDim(v)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d==%ld)", 
+      VecGet(&(that->_dim), 0), VecGetDim(v));
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 1) != VecGetDim(res)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d==%ld)", 
+      VecGet(&(that->_dim), 1), VecGetDim(res));
+    PBErrCatch(PBMathErr);
+  }
+  if (res == v) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'res' is 'v'");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Each value of the result is the dot product of a row by 'v'
+  const long nbCol = VecGet(&(that->_dim), 0);
+  for (long iRow = VecGet(&(that->_dim), 1); iRow--;)
+    res->_val[iRow] = 
+      VecFloatKernelDot(that->_val + iRow * nbCol, v->_val, nbCol);
+}
+
+// Calculate the product of matrix 'that' by matrix 'tho' and store 
+// the result in 'res'
+// Number of columns of 'that' must equal number of rows of 'tho', 
+// 'res' must have as many rows as 'that' and as many columns as 'tho',
+// and must be different from 'that' and 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdMatFloat(const MatFloat* const that, 
+  const MatFloat* const tho, MatFloat* const res) {
+#if BUILDMODE == 0
+  MatFloatProdCheckArgs(that, tho, res);
+#endif
+  MatFloatKernelProdRows(that, tho, res, 0, VecGet(&(that->_dim), 1));
+}
+
+// Same as _MatFloatProdMatFloat but using 'nbThread' threads (if 
+// 'nbThread' <= 0, one per online core)
+// The rows of the result are split into blocks processed in parallel,
+// small products are processed by the calling thread only
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdMatFloatParallel(const MatFloat* const that, 
+  const MatFloat* const tho, MatFloat* const res, int nbThread) {
+#if BUILDMODE == 0
+  MatFloatProdCheckArgs(that, tho, res);
+#endif
+  const long nbRow = VecGet(&(that->_dim), 1);
+  const long nbMult = nbRow * VecGet(&(that->_dim), 0) * 
+    VecGet(&(tho->_dim), 0);
+  if (nbThread <= 0) {
+    nbThread = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThread <= 0)
+      nbThread = 1;
+  }
+  MatFloatProdJob job = {._that = that, ._tho = tho, ._res = res, 
+    ._nbBlock = 
+      (nbRow + PBMATH_MATPRODBLOCKROW - 1) / PBMATH_MATPRODBLOCKROW,
+    ._nextBlock = 0};
+  if (nbThread > job._nbBlock)
+    nbThread = (int)(job._nbBlock);
+  if (nbThread <= 1 || nbMult < PBMATH_MATPRODMINPARALLEL) {
+    MatFloatKernelProdRows(that, tho, res, 0, nbRow);
+    return;
+  }
+  pthread_mutex_init(&(job._mutex), NULL);
+  pthread_t* threads = 
+    PBErrMalloc(PBMathErr, sizeof(pthread_t) * (nbThread - 1));
+  int nbStarted = 0;
+  // If a thread can't be created the remaining blocks are simply 
+  // processed by the other ones
+  while (nbStarted < nbThread - 1 && pthread_create(threads + 
+    nbStarted, NULL, MatFloatProdWorker, &job) == 0)
+    ++nbStarted;
+  MatFloatProdWorker(&job);
+  for (int iThread = 0; iThread < nbStarted; ++iThread)
+    pthread_join(threads[iThread], NULL);
+  free(threads);
+  pthread_mutex_destroy(&(job._mutex));
+}
+
+// Return the product of matrix 'that' and vector 'v'
+// Same as _MatFloatGetProdVecFloat but faster, see _MatFloatProdVecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* _MatFloatGetProdVecFloatFast(const MatFloat* const that, 
+  const VecFloat* const v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat* res = VecFloatCreate(VecGet(&(that->_dim), 1));
+  _MatFloatProdVecFloat(that, v, res);
+  return res;
+}
+
+// Return the product of matrix 'that' by matrix 'tho'
+// Same as _MatFloatGetProdMatFloat but faster, see _MatFloatProdMatFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetProdMatFloatFast(const MatFloat* const that, 
+  const MatFloat* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(&dim, 0, VecGet(&(tho->_dim), 0));
+  VecSet(&dim, 1, VecGet(&(that->_dim), 1));
+  MatFloat* res = MatFloatCreate(&dim);
+  _MatFloatProdMatFloat(that, tho, res);
+  return res;
+}
+
+// Calculate the LU decomposition with partial pivoting of the MatFloat
+// 'that'
+// 'that' must be a square matrix
+// Return {NULL, NULL} if the matrix is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+LUDecomp _MatFloatGetLU(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' is not square (%dx%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long dim = VecGet(&(that->_dim), 0);
+  LUDecomp res = {._LU = MatClone(that), ._perm = VecShortCreate(dim)};
+  float* const a = res._LU->_val;
+  // Pivots smaller than this relatively to the biggest value are 
+  // considered null
+  float scale = 0.0;
+  for (long i = dim * dim; i--;)
+    if (fabs(a[i]) > scale)
+      scale = fabs(a[i]);
+  scale *= FLT_EPSILON;
+  for (long i = dim; i--;)
+    res._perm->_val[i] = i;
+  for (long k = 0; k < dim; ++k) {
+    // Search the pivot and swap its row with the current one
+    long iPivot = k;
+    for (long i = k + 1; i < dim; ++i)
+      if (fabs(a[i * dim + k]) > fabs(a[iPivot * dim + k]))
+        iPivot = i;
+    if (fabs(a[iPivot * dim + k]) <= scale) {
+      LUDecompFreeStatic(&res);
+      return res;
+    }
+    if (iPivot != k) {
+      for (long j = dim; j--;) {
+        const float x = a[k * dim + j];
+        a[k * dim + j] = a[iPivot * dim + j];
+        a[iPivot * dim + j] = x;
+      }
+      const short x = res._perm->_val[k];
+      res._perm->_val[k] = res._perm->_val[iPivot];
+      res._perm->_val[iPivot] = x;
+    }
+    // Eliminate the values below the pivot
+    const float* const rowPivot = a + k * dim;
+    for (long i = k + 1; i < dim; ++i) {
+      float* const row = a + i * dim;
+      row[k] /= rowPivot[k];
+      VecFloatKernelOp(row + k + 1, 1.0, rowPivot + k + 1, -row[k], 
+        row + k + 1, dim - k - 1);
+    }
+  }
+  return res;
+}
+
+// Calculate the Cholesky decomposition of the MatFloat 'that', i.e. 
+// the lower triangular matrix L such as L.L' = 'that'
+// 'that' must be a symmetric square matrix, only its lower triangular
+// part is used
+// Return NULL if the matrix is not positive definite
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetCholesky(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' is not square (%dx%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long dim = VecGet(&(that->_dim), 0);
+  MatFloat* res = MatFloatCreate(&(that->_dim));
+  float* const l = res->_val;
+  for (long j = 0; j < dim; ++j) {
+    const float* const rowJ = l + j * dim;
+    const double diag = (double)(that->_val[j * dim + j]) - 
+      VecFloatKernelDotDouble(rowJ, rowJ, j);
+    if (diag <= 0.0) {
+      MatFree(&res);
+      return NULL;
+    }
+    l[j * dim + j] = sqrt(diag);
+    for (long i = j + 1; i < dim; ++i)
+      l[i * dim + j] = ((double)(that->_val[i * dim + j]) - 
+        VecFloatKernelDotDouble(l + i * dim, rowJ, j)) / l[j * dim + j];
+  }
+  return res;
+}
+
+// Solve the system A.x = 'b' with the Cholesky decomposition 'that' of
+// A and store the solution x in 'res'
+// 'res' can be 'b'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatCholeskySolve(const MatFloat* const that, 
+  const VecFloat* const b, VecFloat* const res) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (b == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'b' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(b) != VecGet(&(that->_dim), 0) || 
+    VecGetDim(res) != VecGet(&(that->_dim), 0)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld==%d)", 
+      VecGetDim(b), VecGetDim(res), VecGet(&(that->_dim), 0));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long dim = VecGet(&(that->_dim), 0);
+  const float* const l = that->_val;
+  float* const x = res->_val;
+  // Solve L.y = b then L'.x = y, the sums being accumulated in double
+  // precision
+  for (long i = 0; i < dim; ++i)
+    x[i] = ((double)(b->_val[i]) - 
+      VecFloatKernelDotDouble(l + i * dim, x, i)) / l[i * dim + i];
+  for (long i = dim; i--;) {
+    double sum = x[i];
+    for (long j = i + 1; j < dim; ++j)
+      sum -= (double)(l[j * dim + i]) * x[j];
+    x[i] = sum / l[i * dim + i];
+  }
+}
+
+// Return the inverse matrix of 'that'
+// Same as _MatFloatGetInv but calculated with the LU decomposition, 
+// hence it works whatever the values on the diagonal
+// Return NULL if the matrix is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetInvFast(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  LUDecomp lu = MatGetLU(that);
+  if (lu._LU == NULL)
+    return NULL;
+  // Solve the system for each column of the identity
+  const long dim = VecGet(&(that->_dim), 0);
+  MatFloat* res = MatFloatCreate(&(that->_dim));
+  VecFloat* b = VecFloatCreate(dim);
+  VecFloat* x = VecFloatCreate(dim);
+  for (long j = 0; j < dim; ++j) {
+    VecSetNull(b);
+    VecSet(b, j, 1.0);
+    LUDecompSolve(&lu, b, x);
+    for (long i = 0; i < dim; ++i)
+      res->_val[i * dim + j] = VecGet(x, i);
+  }
+  VecFree(&b);
+  VecFree(&x);
+  LUDecompFreeStatic(&lu);
+  return res;
+}
+
+// Static constructors for MatFloat3x3 and MatFloat4x4
+// Values are initalized to 0.0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 MatFloatCreateStatic3x3() {
+  MatFloat3x3 m = {._dim = {._val = {3, 3}, ._dim = 2}, ._val = {0.0}};
+  return m;
+}
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat4x4 MatFloatCreateStatic4x4() {
+  MatFloat4x4 m = {._dim = {._val = {4, 4}, ._dim = 2}, ._val = {0.0}};
+  return m;
+}
+
+// Return the matrix of the right-hand rotation by 'theta' radians 
+// around 'axis'
+// 'axis' must be normalized
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 MatFloatGetRotAxis3x3(const VecFloat3D* const axis, 
+  const float theta) {
+#if BUILDMODE == 0
+  if (axis == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'axis' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const float c = cos(theta);
+  const float s = sin(theta);
+  const float t = 1.0 - c;
+  const float* const k = axis->_val;
+  MatFloat3x3 res = MatFloatCreateStatic3x3();
+  res._val[0] = t * k[0] * k[0] + c;
+  res._val[1] = t * k[0] * k[1] - s * k[2];
+  res._val[2] = t * k[0] * k[2] + s * k[1];
+  res._val[3] = t * k[0] * k[1] + s * k[2];
+  res._val[4] = t * k[1] * k[1] + c;
+  res._val[5] = t * k[1] * k[2] - s * k[0];
+  res._val[6] = t * k[0] * k[2] - s * k[1];
+  res._val[7] = t * k[1] * k[2] + s * k[0];
+  res._val[8] = t * k[2] * k[2] + c;
+  return res;
+}
+
+// Return the product of the MatFloat3x3 'that' by the VecFloat3D 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat3D _MatFloatGetProdVecFloat3x3(const MatFloat3x3* const that, 
+  const VecFloat3D* const v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const float* const m = that->_val;
+  VecFloat3D res = VecFloatCreateStatic3D();
+  res._val[0] = m[0] * v->_val[0] + m[1] * v->_val[1] + m[2] * v->_val[2];
+  res._val[1] = m[3] * v->_val[0] + m[4] * v->_val[1] + m[5] * v->_val[2];
+  res._val[2] = m[6] * v->_val[0] + m[7] * v->_val[1] + m[8] * v->_val[2];
+  return res;
+}
+
+// Return the product of the MatFloat4x4 'that' by the VecFloat4D 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat4D _MatFloatGetProdVecFloat4x4(const MatFloat4x4* const that, 
+  const VecFloat4D* const v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat4D res = VecFloatCreateStatic4D();
+  for (int iRow = 4; iRow--;) {
+    const float* const m = that->_val + iRow * 4;
+    res._val[iRow] = m[0] * v->_val[0] + m[1] * v->_val[1] + 
+      m[2] * v->_val[2] + m[3] * v->_val[3];
+  }
+  return res;
+}
+
+// Return the product of the MatFloat3x3 'that' by the MatFloat3x3 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 _MatFloatGetProdMatFloat3x3(const MatFloat3x3* const that, 
+  const MatFloat3x3* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  MatFloat3x3 res = MatFloatCreateStatic3x3();
+  for (int iRow = 3; iRow--;)
+    for (int iCol = 3; iCol--;)
+      res._val[iRow * 3 + iCol] = 
+        that->_val[iRow * 3] * tho->_val[iCol] + 
+        that->_val[iRow * 3 + 1] * tho->_val[3 + iCol] + 
+        that->_val[iRow * 3 + 2] * tho->_val[6 + iCol];
+  return res;
+}
+
+// Return the product of the MatFloat4x4 'that' by the MatFloat4x4 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat4x4 _MatFloatGetProdMatFloat4x4(const MatFloat4x4* const that, 
+  const MatFloat4x4* const tho) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  MatFloat4x4 res = MatFloatCreateStatic4x4();
+  for (int iRow = 4; iRow--;)
+    for (int iCol = 4; iCol--;)
+      res._val[iRow * 4 + iCol] = 
+        that->_val[iRow * 4] * tho->_val[iCol] + 
+        that->_val[iRow * 4 + 1] * tho->_val[4 + iCol] + 
+        that->_val[iRow * 4 + 2] * tho->_val[8 + iCol] + 
+        that->_val[iRow * 4 + 3] * tho->_val[12 + iCol];
+  return res;
+}
+
+// Write the binary encoding of the VecFloat 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatEncodeAsBin(const VecFloat* const that, PBBin* const bin) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBinWriteI64(bin, that->_dim);
+  PBBinWriteFloats(bin, that->_val, that->_dim);
+}
+
+// Read the binary encoding of a VecFloat with the PBBin 'bin' into 'that'
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatDecodeAsBin(VecFloat** that, PBBin* const bin) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (*that != NULL)
+    _VecFloatFree(that);
+  long dim = (long)PBBinReadI64(bin);
+  if (!PBBinIsOk(bin) || dim <= 0)
+    return false;
+  *that = VecFloatCreate(dim);
+  PBBinReadFloats(bin, (*that)->_val, dim);
+  if (!PBBinIsOk(bin)) {
+    _VecFloatFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Save the VecFloat 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatSaveBin(const VecFloat* const that, FILE* const stream, 
+  const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "VECF", checksum);
+  _VecFloatEncodeAsBin(that, &bin);
+  return PBBinWriteFooter(&bin);
+}
+
+// Load the VecFloat 'that' from the stream 'stream' in binary format
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatLoadBin(VecFloat** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "VECF") || 
+    !_VecFloatDecodeAsBin(that, &bin) || 
+    !PBBinReadFooter(&bin)) {
+    if (*that != NULL)
+      _VecFloatFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Write the binary encoding of the MatFloat 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatFloatEncodeAsBin(const MatFloat* const that, 
+  PBBin* const bin) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBinWriteShorts(bin, that->_dim._val, 2);
+  PBBinWriteFloats(bin, that->_val, 
+    (long)(that->_dim._val[0]) * (long)(that->_dim._val[1]));
+}
+
+// Read the binary encoding of a MatFloat with the PBBin 'bin' into 
+// 'that'
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatDecodeAsBin(MatFloat** that, PBBin* const bin) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (bin == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'bin' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (*that != NULL)
+    _MatFloatFree(that);
+  VecShort2D dim = VecShortCreateStatic2D();
+  PBBinReadShorts(bin, dim._val, 2);
+  if (!PBBinIsOk(bin) || dim._val[0] <= 0 || dim._val[1] <= 0)
+    return false;
+  *that = MatFloatCreate(&dim);
+  PBBinReadFloats(bin, (*that)->_val, 
+    (long)(dim._val[0]) * (long)(dim._val[1]));
+  if (!PBBinIsOk(bin)) {
+    _MatFloatFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Save the MatFloat 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatSaveBin(const MatFloat* const that, FILE* const stream, 
+  const bool checksum) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  PBBinWriteHeader(&bin, "MATF", checksum);
+  _MatFloatEncodeAsBin(that, &bin);
+  return PBBinWriteFooter(&bin);
+}
+
+// Load the MatFloat 'that' from the stream 'stream' in binary format
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatLoadBin(MatFloat** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBBin bin = PBBinCreateStatic(stream);
+  if (!PBBinReadHeader(&bin, "MATF") || 
+    !_MatFloatDecodeAsBin(that, &bin) || 
+    !PBBinReadFooter(&bin)) {
+    if (*that != NULL)
+      _MatFloatFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Add to the JSON node 'that' the property 'key' whose values are the 
+// 'nb' floats 'vals' converted with JSONFloatToStr
+static inline void JSONAddPropFloats(JSONNode* const that, 
+  const char* const key, const float* const vals, const long nb) {
+  JSONNode* prop = JSONCreate();
+  JSONSetLabel(prop, key);
+  char str[PBJSON_FLOATSTRLEN];
+  for (long iVal = 0; iVal < nb; ++iVal) {
+    JSONFloatToStr(vals[iVal], str);
+    JSONNode* val = JSONCreate();
+    JSONSetLabel(val, str);
+    JSONAppendVal(prop, val);
+  }
+  JSONAppendVal(that, prop);
+}
+
+// Convert the 'nb' values of the property 'prop' with JSONStrToFloat 
+// into 'vals'
+// Return false if 'prop' hasn't 'nb' values or one of them is invalid
+static inline bool JSONGetPropFloats(const JSONNode* const prop, 
+  float* const vals, const long nb) {
+  if (JSONGetNbValue(prop) != nb)
+    return false;
+  long iVal = 0;
+  for (const GSetElem* elem = JSONProperties(prop)->_set._head; 
+    elem != NULL; elem = elem->_next, ++iVal) {
+    const char* lbl = JSONLabel((const JSONNode*)(elem->_data));
+    if (lbl == NULL || !JSONStrToFloat(lbl, vals + iVal))
+      return false;
+  }
+  return true;
+}
+
+// Function which return the JSON encoding of 'that', same as 
+// _VecFloatEncodeAsJSON but the values are written with JSONFloatToStr 
+// (shortest representation converting back exactly to the value)
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _VecFloatEncodeAsJSONFast(const VecFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONNode* json = JSONCreate();
+  char val[32];
+  sprintf(val, "%ld", that->_dim);
+  JSONAddProp(json, "_dim", val);
+  JSONAddPropFloats(json, "_val", that->_val, that->_dim);
+  return json;
+}
+
+// Function which decode from JSON encoding 'json' to 'that', same as 
+// _VecFloatDecodeAsJSON but the values are read with JSONStrToFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatDecodeAsJSONFast(VecFloat** that, 
+  const JSONNode* const json) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (json == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'json' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (*that != NULL)
+    VecFree(that);
+  JSONNode* prop = JSONProperty(json, "_dim");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  long dim = atol(JSONLblVal(prop));
+  if (dim <= 0)
+    return false;
+  prop = JSONProperty(json, "_val");
+  if (prop == NULL)
+    return false;
+  *that = VecFloatCreate(dim);
+  if (!JSONGetPropFloats(prop, (*that)->_val, dim)) {
+    VecFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Save the VecFloat to the stream with _VecFloatEncodeAsJSONFast
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatSaveFast(const VecFloat* const that, 
+  FILE* const stream, const bool compact) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONNode* json = _VecFloatEncodeAsJSONFast(that);
+  bool ret = JSONSave(json, stream, compact);
+  JSONFree(&json);
+  return ret;
+}
+
+// Load the VecFloat from the stream with _VecFloatDecodeAsJSONFast, the JSON 
+// is loaded in situ with JSONDocLoad
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatLoadFast(VecFloat** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONDoc* doc = JSONDocLoad(stream);
+  if (doc == NULL)
+    return false;
+  bool ret = _VecFloatDecodeAsJSONFast(that, JSONDocRoot(doc));
+  JSONDocFree(&doc);
+  return ret;
+}
+
+// Function which return the JSON encoding of 'that', same as 
+// _MatFloatEncodeAsJSON but the values are written with JSONFloatToStr 
+// (shortest representation converting back exactly to the value)
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _MatFloatEncodeAsJSONFast(const MatFloat* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONNode* json = JSONCreate();
+  char val[32];
+  sprintf(val, "%d", that->_dim._val[0]);
+  JSONAddProp(json, "_nbRow", val);
+  sprintf(val, "%d", that->_dim._val[1]);
+  JSONAddProp(json, "_nbCol", val);
+  JSONAddPropFloats(json, "_val", that->_val, 
+    (long)(that->_dim._val[0]) * (long)(that->_dim._val[1]));
+  return json;
+}
+
+// Function which decode from JSON encoding 'json' to 'that', same as 
+// _MatFloatDecodeAsJSON but the values are read with JSONStrToFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatDecodeAsJSONFast(MatFloat** that, 
+  const JSONNode* const json) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (json == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'json' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  if (*that != NULL)
+    MatFree(that);
+  VecShort2D dim = VecShortCreateStatic2D();
+  JSONNode* prop = JSONProperty(json, "_nbRow");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  dim._val[0] = atoi(JSONLblVal(prop));
+  prop = JSONProperty(json, "_nbCol");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  dim._val[1] = atoi(JSONLblVal(prop));
+  if (dim._val[0] <= 0 || dim._val[1] <= 0)
+    return false;
+  prop = JSONProperty(json, "_val");
+  if (prop == NULL)
+    return false;
+  *that = MatFloatCreate(&dim);
+  if (!JSONGetPropFloats(prop, (*that)->_val, 
+    (long)(dim._val[0]) * (long)(dim._val[1]))) {
+    MatFree(that);
+    return false;
+  }
+  return true;
+}
+
+// Save the MatFloat to the stream with _MatFloatEncodeAsJSONFast
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatSaveFast(const MatFloat* const that, 
+  FILE* const stream, const bool compact) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONNode* json = _MatFloatEncodeAsJSONFast(that);
+  bool ret = JSONSave(json, stream, compact);
+  JSONFree(&json);
+  return ret;
+}
+
+// Load the MatFloat from the stream with _MatFloatDecodeAsJSONFast, the JSON 
+// is loaded in situ with JSONDocLoad
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatLoadFast(MatFloat** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONDoc* doc = JSONDocLoad(stream);
+  if (doc == NULL)
+    return false;
+  bool ret = _MatFloatDecodeAsJSONFast(that, JSONDocRoot(doc));
+  JSONDocFree(&doc);
+  return ret;
+}
+
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatEncodeAsJSONStream(const VecFloat* const that, 
+  JSONWriter* const writer) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (writer == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'writer' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  JSONWriterObjStart(writer);
+  JSONWriterPropLong(writer, "_dim", that->_dim);
+  JSONWriterPropFloats(writer, "_val", that->_val, that->_dim);
+  JSONWriterObjEnd(writer);
+}
+
+// -------------- PBRandom
+
+// Return the next value of the splitmix64 generator of state 'state', 
+// used to expand a seed into the state of a PBRandom
+static inline uint64_t PBRandomSplitMix64(uint64_t* const state) {
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+// Rotate left the 64 bits of 'x' by 'k'
+static inline uint64_t PBRandomRotl(const uint64_t x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+// Create a static PBRandom initialized with the seed 'seed'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+PBRandom PBRandomCreateStatic(const uint64_t seed) {
+  PBRandom that;
+  PBRandomSeed(&that, seed);
+  return that;
+}
+
+// Reset the PBRandom 'that' with the seed 'seed'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PBRandomSeed(PBRandom* const that, const uint64_t seed) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  uint64_t state = seed;
+  for (int i = 0; i < 4; ++i)
+    that->_s[i] = PBRandomSplitMix64(&state);
+  that->_gauss = 0.0;
+  that->_hasGauss = false;
+}
+
+// Advance the PBRandom 'that' by 2^128 draws
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PBRandomJump(PBRandom* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  static const uint64_t jump[] = {0x180ec6d33cfd0abaULL, 
+    0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+  uint64_t s[4] = {0, 0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    for (int b = 0; b < 64; ++b) {
+      if (jump[i] & (1ULL << b))
+        for (int j = 0; j < 4; ++j)
+          s[j] ^= that->_s[j];
+      (void)PBRandomGetU64(that);
+    }
+  }
+  for (int j = 0; j < 4; ++j)
+    that->_s[j] = s[j];
+  that->_hasGauss = false;
+}
+
+// Return a copy of the PBRandom 'that' advanced by 'iStream' * 2^128
+// draws, streams with different 'iStream' don't overlap and can be 
+// given to different threads
+#if BUILDMODE != 0 
+static inline 
+#endif 
+PBRandom PBRandomGetStream(const PBRandom* const that, 
+  const int iStream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (iStream < 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iStream' is invalid (%d>=0)", iStream);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBRandom stream = *that;
+  stream._hasGauss = false;
+  for (int i = iStream; i--;)
+    PBRandomJump(&stream);
+  return stream;
+}
+
+// Return the next 64 random bits of the PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+uint64_t PBRandomGetU64(PBRandom* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  uint64_t* const s = that->_s;
+  const uint64_t res = PBRandomRotl(s[1] * 5, 7) * 9;
+  const uint64_t t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = PBRandomRotl(s[3], 45);
+  return res;
+}
+
+// Return a random float in [0.0, 1.0[ from the PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float PBRandomGetFloat(PBRandom* const that) {
+  // Use the 24 upper bits, the precision of the float mantissa
+  return (float)(PBRandomGetU64(that) >> 40) * 0x1.0p-24f;
+}
+
+// Return a random float in ['min', 'max'[ from the PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float PBRandomGetFloatRange(PBRandom* const that, const float min, 
+  const float max) {
+  return min + (max - min) * PBRandomGetFloat(that);
+}
+
+// Return a random integer in [0, 'nb'[ from the PBRandom 'that'
+// 'nb' must be greater than 0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long PBRandomGetLong(PBRandom* const that, const long nb) {
+#if BUILDMODE == 0
+  if (nb <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'nb' is invalid (%ld>0)", nb);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Reject the values below 2^64 modulo 'nb', the remaining ones are 
+  // a whole number of times [0, 'nb'[ and their modulo is unbiased
+  const uint64_t range = (uint64_t)nb;
+  const uint64_t threshold = -range % range;
+  uint64_t r = PBRandomGetU64(that);
+  while (r < threshold)
+    r = PBRandomGetU64(that);
+  return (long)(r % range);
+}
+
+// Return a random float with a normal distribution of mean 'mean' and
+// standard deviation 'sigma' from the PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float PBRandomGetGauss(PBRandom* const that, const float mean, 
+  const float sigma) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Marsaglia polar method, the values are generated by pairs
+  if (that->_hasGauss) {
+    that->_hasGauss = false;
+    return that->_gauss * sigma + mean;
+  }
+  float v1, v2, s;
+  do {
+    v1 = PBRandomGetFloat(that) * 2.0 - 1.0;
+    v2 = PBRandomGetFloat(that) * 2.0 - 1.0;
+    s = v1 * v1 + v2 * v2;
+  } while (s >= 1.0 || s == 0.0);
+  const float f = sqrt(-2.0 * log(s) / s);
+  that->_gauss = v2 * f;
+  that->_hasGauss = true;
+  return v1 * f * sigma + mean;
+}
+
+// Fill the array 'res' with 'nb' random floats in [0.0, 1.0[ from the 
+// PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PBRandomFillFloat(PBRandom* const that, float* const res, 
+  const long nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Work on a local copy of the state so it stays in registers, and
+  // use the two halves of each 64 bits draw
+  PBRandom rng = *that;
+  long i = 0;
+  for (; i + 2 <= nb; i += 2) {
+    const uint64_t r = PBRandomGetU64(&rng);
+    res[i] = (float)(r >> 40) * 0x1.0p-24f;
+    res[i + 1] = (float)((r >> 8) & 0xffffff) * 0x1.0p-24f;
+  }
+  if (i < nb)
+    res[i] = PBRandomGetFloat(&rng);
+  *that = rng;
+}
+
+// Fill the array 'res' with 'nb' random floats with a normal 
+// distribution of mean 'mean' and standard deviation 'sigma' from the
+// PBRandom 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PBRandomFillGauss(PBRandom* const that, float* const res, 
+  const long nb, const float mean, const float sigma) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  PBRandom rng = *that;
+  for (long i = 0; i < nb; ++i)
+    res[i] = PBRandomGetGauss(&rng, mean, sigma);
+  *that = rng;
+}
+
+// Seed rand() and random() with values drawn from the PBRandom 'that'
+// For the functions of the library which still use the global 
+// generator (GenAlg, GSetShuffle, KMeansClustersSearch, ...), to make
+// their results reproducible from a PBRandom
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void PBRandomSeedGlobal(PBRandom* const that) {
+  const uint64_t r = PBRandomGetU64(that);
+  srand((unsigned int)r);
+  srandom((unsigned int)(r >> 32));
+}
+
+// Shuffle the GSet 'that' with the PBRandom 'rng'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _GSetShuffleWith(GSet* const that, PBRandom* const rng) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (rng == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'rng' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long nb = GSetNbElem(that);
+  if (nb < 2)
+    return;
+  // Fisher-Yates shuffle of the data (and their sort value) on an 
+  // array of the elements
+  GSetElem** elems = PBErrMalloc(PBMathErr, sizeof(GSetElem*) * nb);
+  GSetElem* elem = that->_head;
+  for (long i = 0; i < nb; ++i) {
+    elems[i] = elem;
+    elem = elem->_next;
+  }
+  for (long i = nb - 1; i > 0; --i) {
+    const long j = PBRandomGetLong(rng, i + 1);
+    void* data = elems[i]->_data;
+    elems[i]->_data = elems[j]->_data;
+    elems[j]->_data = data;
+    const float sortVal = elems[i]->_sortVal;
+    elems[i]->_sortVal = elems[j]->_sortVal;
+    elems[j]->_sortVal = sortVal;
+  }
+  free(elems);
+}
+
+// -------------- Gauss
+
+// Return the value of the Gauss 'that' at 'x'
+#if BUILDMODE != 0
+static inline
+#endif 
+float GaussGet(const Gauss* const that, const float x) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Calculate the value
+  float a = 1.0 / (that->_sigma * sqrt(2.0 * PBMATH_PI));
+  float ret = a * exp(-1.0 * fsquare(x - that->_mean) / 
+    (2.0 * fsquare(that->_sigma)));
+  // Return the value
+  return ret;
+}
+
+// Return a random value (in ]0.0, 1.0[)according to the 
+// Gauss distribution 'that'
+// random() must have been called before calling this function
+#if BUILDMODE != 0
+static inline
+#endif 
+float GaussRnd(Gauss* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Declare variable for calcul
+  float v1,v2,s;
+  // Calculate the value
+  do {
+    v1 = (rnd() - 0.5) * 2.0;
+    v2 = (rnd() - 0.5) * 2.0;
+    s = v1 * v1 + v2 * v2;
+  } while (s >= 1.0);
+  // Return the value
+  float ret = 0.0;
+  if (s > PBMATH_EPSILON)
+    ret = v1 * sqrt(-2.0 * log(s) / s);
+  return ret * that->_sigma + that->_mean;
 }
 
-// Set all values of the vector 'that' to 0.0
+// Return a random value according to the Gauss 'that' drawn from the 
+// PBRandom 'rng'
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetNull(VecFloat* const that) {
+float GaussRndWith(const Gauss* const that, PBRandom* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (rng == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'rng' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Set values
-  for (long iDim = that->_dim; iDim--;)
-    that->_val[iDim] = 0.0;
+  return PBRandomGetGauss(rng, that->_mean, that->_sigma);
 }
+
+// Return the order 1 smooth value of 'x'
+// if x < 0.0 return 0.0
+// if x > 1.0 return 1.0
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetNull2D(VecFloat2D* const that) {
+float SmoothStep(const float x) {
+  if (x > 0.0)
+    if (x < 1.0)
+      return x * x * (3.0 - 2.0 * x);
+    else
+      return 1.0;
+  else
+    return 0.0;
+}
+
+// Return the order 2 smooth value of 'x'
+// if x < 0.0 return 0.0
+// if x > 1.0 return 1.0
+#if BUILDMODE != 0
+static inline
+#endif 
+float SmootherStep(const float x) {
+  if (x > 0.0)
+    if (x < 1.0)
+    return x * x * x * (x * (x * 6.0 - 15.0) + 10.0);
+    else
+      return 1.0;
+  else
+    return 0.0;
+}
+
+// Create a new SysLinEq with matrix 'm' and vector 'v'
+// Same as _SLECreate but the inverse matrix is calculated with the LU
+// decomposition of 'm'
+// Return NULL if 'm' is singular
+#if BUILDMODE != 0
+static inline
+#endif 
+SysLinEq* _SLECreateFast(const MatFloat* const m, 
+  const VecFloat* const v) {
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (m == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
+    sprintf(PBMathErr->_msg, "'m' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (v != NULL && VecGet(&(m->_dim), 0) != VecGetDim(v)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d==%ld)", 
+      VecGet(&(m->_dim), 0), VecGetDim(v));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set values
-  that->_val[0] = 0.0;
-  that->_val[1] = 0.0;
+  MatFloat* inv = MatGetInv(m);
+  if (inv == NULL)
+    return NULL;
+  SysLinEq* that = PBErrMalloc(PBMathErr, sizeof(SysLinEq));
+  that->_M = MatClone(m);
+  that->_Minv = inv;
+  if (v != NULL)
+    that->_V = VecClone(v);
+  else
+    that->_V = VecFloatCreate(VecGet(&(m->_dim), 1));
+  return that;
 }
+
+// Solve the SysLinEq _M.x = _V
+// Return the solution vector, or null if there is no solution or the 
+// arguments are invalid
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetNull3D(VecFloat3D* const that) {
+VecFloat* SysLinEqSolve(const SysLinEq* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2330,127 +6955,260 @@ void _VecFloatSetNull3D(VecFloat3D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set values
-  that->_val[0] = 0.0;
-  that->_val[1] = 0.0;
-  that->_val[2] = 0.0;
+  // Declare a variable to memorize the solution
+  VecFloat* ret = NULL;
+  // Calculate the solution
+  ret = MatGetProdVec(that->_Minv, that->_V);
+  // Return the solution vector
+  return ret;
 }
 
-// Set all values of the vector 'that' to 'v'
+// Set the matrix of the SysLinEq to a copy of 'm'
+// 'm' must have same dimensions has the current matrix
+// Do nothing if arguments are invalid
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetAll(VecFloat* const that, float v) {
+void SysLinEqSetM(SysLinEq* const that, const MatFloat* const m) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (m == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'m' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (!VecIsEqual(&(m->_dim), &(that->_M->_dim))) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'m' has invalid dimension (%dx%d==%dx%d)",
+      VecGet(&(m->_dim), 0), VecGet(&(m->_dim), 1), 
+      VecGet(&(that->_M->_dim), 0), VecGet(&(that->_M->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Update the matrix values
+  MatCopy(that->_M, m);
+  // Update the inverse matrix
+  MatFree(&(that->_Minv));
+  that->_Minv = MatGetInv(that->_M);
+#if BUILDMODE == 0
+  if (that->_Minv == NULL) {
+    PBMathErr->_type = PBErrTypeOther;
+    sprintf(PBMathErr->_msg, "couldn't inverse the matrix");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Set values
-  for (long iDim = that->_dim; iDim--;)
-    that->_val[iDim] = v;
 }
+
+// Set the vector of the SysLinEq to a copy of 'v'
+// 'v' must have same dimensions has the current vector
+// Do nothing if arguments are invalid
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetAll2D(VecFloat2D* const that, float v) {
+void _SLESetV(SysLinEq* const that, const VecFloat* const v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(v) != VecGetDim(that->_V)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'v' has invalid dimension (%ld==%ld)",
+      VecGetDim(v), VecGetDim(that->_V));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Set values
-  that->_val[0] = v;
-  that->_val[1] = v;
+  // Update the vector values
+  VecCopy(that->_V, v);
 }
+
+// Return x^y when x and y are int
+// to avoid numerical imprecision from (pow(double,double)
+// From https://stackoverflow.com/questions/29787310/
+// does-pow-work-for-int-data-type-in-c
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatSetAll3D(VecFloat3D* const that, float v) {
+int powi(const int base, const int exp) {
+  // Declare a variable to memorize the result and init to 1
+  int res = 1;
+  // Loop on exponent
+  int e = exp;
+  int b = base;
+  while (e) {
+    // Do some magic trick
+    if (e & 1)
+      res *= b;
+    e /= 2;
+    b *= b;
+  }
+  // Return the result
+  return res;
+}
+
+// Rotate right-hand 'that' by 'theta' radians around 'axis' and 
+// store the result in 'that'
+// 'axis' must be normalized
+// https://en.wikipedia.org/wiki/Rotation_matrix
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatRotAxis(VecFloat3D* const that, 
+  const VecFloat3D* const axis, const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (axis == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'axis' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(that) != 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
+      VecGetDim(that));
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(axis) != 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'axis' 's dimension is invalid (%ld==3)",
+      VecGetDim(axis));
+    PBErrCatch(PBMathErr);
+  }
+  if (ISEQUALF(VecNorm(axis), 1.0) == false) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'axis' is not normalized");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Set values
-  that->_val[0] = v;
-  that->_val[1] = v;
-  that->_val[2] = v;
+  VecFloat3D v = _VecFloatGetRotAxisFast(that, axis, theta);
+  VecCopy(that, &v);
 }
 
-// Return the dimension of the VecFloat
+// Rotate right-hand 'that' by 'theta' radians around X and 
+// store the result in 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-long _VecFloatGetDim(const VecFloat* const that) {
+void _VecFloatRotX(VecFloat3D* const that, const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (VecGetDim(that) != 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
+      VecGetDim(that));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  return that->_dim;
+  VecFloat3D v = _VecFloatGetRotXFast(that, theta);
+  VecCopy(that, &v);
 }
 
-// Copy the values of 'tho' in 'that'
+// Rotate right-hand 'that' by 'theta' radians around Y and 
+// store the result in 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatCopy(VecFloat* const that, const VecFloat* const tho) {
+void _VecFloatRotY(VecFloat3D* const that, const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (VecGetDim(that) != 3) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
+      VecGetDim(that));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat3D v = _VecFloatGetRotYFast(that, theta);
+  VecCopy(that, &v);
+}
+
+// Rotate right-hand 'that' by 'theta' radians around Z and 
+// store the result in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatRotZ(VecFloat3D* const that, const float theta) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (that->_dim != tho->_dim) {
+  if (VecGetDim(that) != 3) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
+      VecGetDim(that));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Copy the values
-  memcpy(that->_val, tho->_val, sizeof(float) * that->_dim);
+  VecFloat3D v = _VecFloatGetRotZFast(that, theta);
+  VecCopy(that, &v);
 }
 
-// Return the norm of the VecFloat
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around 'axis', same as _VecFloatGetRotAxis but unrolled and 
+// inlined
+// 'axis' must be normalized
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatNorm(const VecFloat* const that) {
+VecFloat3D _VecFloatGetRotAxisFast(const VecFloat3D* const that, 
+  const VecFloat3D* const axis, const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-#endif
-  // Declare a variable to calculate the norm
-  float ret = 0.0;
-  // Calculate the norm
-  for (long iDim = that->_dim; iDim--;)
-    ret += fsquare(VecGet(that, iDim));
-  ret = sqrt(ret);
-  // Return the result
-  return ret;
+  if (axis == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'axis' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Rodrigues' formula:
+  // v.cos(theta) + (axis x v).sin(theta) + axis.(axis.v)(1 - cos(theta))
+  const float c = cos(theta);
+  const float s = sin(theta);
+  const float* const v = that->_val;
+  const float* const k = axis->_val;
+  const float kv = (k[0] * v[0] + k[1] * v[1] + k[2] * v[2]) * (1.0 - c);
+  VecFloat3D res = VecFloatCreateStatic3D();
+  res._val[0] = v[0] * c + (k[1] * v[2] - k[2] * v[1]) * s + k[0] * kv;
+  res._val[1] = v[1] * c + (k[2] * v[0] - k[0] * v[2]) * s + k[1] * kv;
+  res._val[2] = v[2] * c + (k[0] * v[1] - k[1] * v[0]) * s + k[2] * kv;
+  return res;
 }
+
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around X, same as _VecFloatGetRotX but inlined
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatNorm2D(const VecFloat2D* const that) {
+VecFloat3D _VecFloatGetRotXFast(const VecFloat3D* const that, 
+  const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2458,13 +7216,22 @@ float _VecFloatNorm2D(const VecFloat2D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the result
-  return sqrt(fsquare(VecGet(that, 0)) + fsquare(VecGet(that, 1)));
+  const float c = cos(theta);
+  const float s = sin(theta);
+  VecFloat3D res = VecFloatCreateStatic3D();
+  res._val[0] = that->_val[0];
+  res._val[1] = c * that->_val[1] - s * that->_val[2];
+  res._val[2] = s * that->_val[1] + c * that->_val[2];
+  return res;
 }
+
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around Y, same as _VecFloatGetRotY but inlined
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatNorm3D(const VecFloat3D* const that) {
+VecFloat3D _VecFloatGetRotYFast(const VecFloat3D* const that, 
+  const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2472,16 +7239,22 @@ float _VecFloatNorm3D(const VecFloat3D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the result
-  return sqrt(fsquare(VecGet(that, 0)) + fsquare(VecGet(that, 1)) + 
-    fsquare(VecGet(that, 2)));
+  const float c = cos(theta);
+  const float s = sin(theta);
+  VecFloat3D res = VecFloatCreateStatic3D();
+  res._val[0] = c * that->_val[0] + s * that->_val[2];
+  res._val[1] = that->_val[1];
+  res._val[2] = c * that->_val[2] - s * that->_val[0];
+  return res;
 }
 
-// Normalise the VecFloat
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around Z, same as _VecFloatGetRotZ but inlined
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatNormalise(VecFloat* const that) {
+VecFloat3D _VecFloatGetRotZFast(const VecFloat3D* const that, 
+  const float theta) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2489,16 +7262,20 @@ void _VecFloatNormalise(VecFloat* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Normalise
-  float norm = VecNorm(that);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(that, iDim, VecGet(that, iDim) / norm);
+  const float c = cos(theta);
+  const float s = sin(theta);
+  VecFloat3D res = VecFloatCreateStatic3D();
+  res._val[0] = c * that->_val[0] - s * that->_val[1];
+  res._val[1] = s * that->_val[0] + c * that->_val[1];
+  res._val[2] = that->_val[2];
+  return res;
 }
 
-#if BUILDMODE != 0
-static inline
+// Free memory used by the QRDecomp 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatNormalise2D(VecFloat2D* const that) {
+void QRDecompFreeStatic(QRDecomp* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2506,15 +7283,15 @@ void _VecFloatNormalise2D(VecFloat2D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Normalise
-  float norm = _VecFloatNorm2D(that);
-  VecSet(that, 0, VecGet(that, 0) / norm);
-  VecSet(that, 1, VecGet(that, 1) / norm);
+  MatFree(&(that->_Q)); 
+  MatFree(&(that->_R));
 }
-#if BUILDMODE != 0
-static inline
+
+// Free memory used by the LUDecomp 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatNormalise3D(VecFloat3D* const that) {
+void LUDecompFreeStatic(LUDecomp* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -2522,634 +7299,1240 @@ void _VecFloatNormalise3D(VecFloat3D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Normalise
-  float norm = _VecFloatNorm3D(that);
-  VecSet(that, 0, VecGet(that, 0) / norm);
-  VecSet(that, 1, VecGet(that, 1) / norm);
-  VecSet(that, 2, VecGet(that, 2) / norm);
+  MatFree(&(that->_LU));
+  VecFree(&(that->_perm));
 }
 
-// Return the distance between the VecFloat 'that' and 'tho'
-#if BUILDMODE != 0
-static inline
+// Solve the system A.x = 'b' with the LUDecomp 'that' of A and store
+// the solution x in 'res'
+// 'res' must be different from 'b'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatDist(const VecFloat* const that, 
-  const VecFloat* const tho) {
+void LUDecompSolve(const LUDecomp* const that, const VecFloat* const b,
+  VecFloat* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (b == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'b' is null");
     PBErrCatch(PBMathErr);
   }
-  if (that->_dim != tho->_dim) {
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == b) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'res' is 'b'");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(b) != VecGetDim(that->_perm) || 
+    VecGetDim(res) != VecGetDim(that->_perm)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld==%ld)", 
+      VecGetDim(b), VecGetDim(res), VecGetDim(that->_perm));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Declare a variable to calculate the distance
-  float ret = 0.0;
-  for (long iDim = that->_dim; iDim--;)
-    ret += fsquare(VecGet(that, iDim) - VecGet(tho, iDim));
-  ret = sqrt(ret);
-  // Return the distance
-  return ret;
+  const long dim = VecGetDim(that->_perm);
+  const float* const lu = that->_LU->_val;
+  float* const x = res->_val;
+  // Solve L.y = P.b then U.x = y, the sums being accumulated in double
+  // precision
+  for (long i = 0; i < dim; ++i)
+    x[i] = (double)(b->_val[that->_perm->_val[i]]) - 
+      VecFloatKernelDotDouble(lu + i * dim, x, i);
+  for (long i = dim; i--;)
+    x[i] = ((double)(x[i]) - VecFloatKernelDotDouble(lu + i * dim + i + 1, 
+      x + i + 1, dim - i - 1)) / lu[i * dim + i];
 }
-#if BUILDMODE != 0
-static inline
+
+// Create a static EigenSolver for square matrices of dimension 'dim'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatDist2D(const VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+EigenSolver EigenSolverCreateStatic(const long dim) {
 #if BUILDMODE == 0
-  if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+  if (dim <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'dim' is invalid (%ld>0)", dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the distance
-  return sqrt(fsquare(VecGet(that, 0) - VecGet(tho, 0)) +
-    fsquare(VecGet(that, 1) - VecGet(tho, 1)));
+  EigenSolver that = {._dim = dim, ._nbIter = 0, ._isSym = false, 
+    ._isReal = false, ._isConverged = false};
+  that._mat = PBErrMalloc(PBMathErr, sizeof(double) * dim * dim);
+  that._vec = PBErrMalloc(PBMathErr, sizeof(double) * dim * dim);
+  that._val = PBErrMalloc(PBMathErr, sizeof(double) * dim);
+  that._imag = PBErrMalloc(PBMathErr, sizeof(double) * dim);
+  that._work = PBErrMalloc(PBMathErr, sizeof(double) * dim * 3);
+  that._order = PBErrMalloc(PBMathErr, sizeof(long) * dim);
+  return that;
 }
-#if BUILDMODE != 0
-static inline
+
+// Free the memory used by the EigenSolver 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatDist3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+void EigenSolverFreeStatic(EigenSolver* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Return the distance
-  return sqrt(fsquare(VecGet(that, 0) - VecGet(tho, 0)) +
-    fsquare(VecGet(that, 1) - VecGet(tho, 1)) +
-    fsquare(VecGet(that, 2) - VecGet(tho, 2)));
+  free(that->_mat);
+  free(that->_vec);
+  free(that->_val);
+  free(that->_imag);
+  free(that->_work);
+  free(that->_order);
+  that->_mat = NULL;
+  that->_vec = NULL;
+  that->_val = NULL;
+  that->_imag = NULL;
+  that->_work = NULL;
+  that->_order = NULL;
 }
 
-// Return the Hamiltonian distance between the VecFloat 'that' and 'tho'
-#if BUILDMODE != 0
-static inline
+// Return true if the values 'a' and 'b' are negligible relatively to
+// the values 'x' and 'y', or to 'norm' if these are null
+static inline bool EigenSolverIsNegligible(const double a, 
+  const double x, const double y, const double norm) {
+  double ref = fabs(x) + fabs(y);
+  if (ref == 0.0)
+    ref = norm;
+  return (fabs(a) <= DBL_EPSILON * ref);
+}
+
+// Apply the Householder reflection zeroing the values below the 
+// subdiagonal of the column 'iCol' of the working matrix of the 
+// EigenSolver 'that' on its left and right, and accumulate it
+// If 'isSym' is true the working matrix is symmetric and only its 
+// trailing submatrix is updated
+static inline void EigenSolverHouseholder(EigenSolver* const that, 
+  const long iCol, const bool isSym) {
+  const long dim = that->_dim;
+  double* const a = that->_mat;
+  double* const v = that->_work;
+  double* const p = that->_work + dim;
+  const long nb = dim - iCol - 1;
+  // Calculate the Householder vector of a[iCol + 1.., iCol]
+  double alpha = 0.0;
+  for (long i = 0; i < nb; ++i) {
+    v[i] = a[(iCol + 1 + i) * dim + iCol];
+    alpha += v[i] * v[i];
+  }
+  alpha = sqrt(alpha);
+  if (alpha == 0.0)
+    return;
+  if (v[0] > 0.0)
+    alpha = -alpha;
+  v[0] -= alpha;
+  double norm = 0.0;
+  for (long i = 0; i < nb; ++i)
+    norm += v[i] * v[i];
+  if (norm == 0.0)
+    return;
+  const double beta = 2.0 / norm;
+  if (isSym) {
+    // S = H.S.H on the trailing submatrix S with w = p - (beta/2)(p.v)v
+    // and p = beta.S.v, then S -= v.w' + w.v'
+    double pv = 0.0;
+    for (long i = 0; i < nb; ++i) {
+      const double* const row = a + (iCol + 1 + i) * dim + iCol + 1;
+      double sum = 0.0;
+      for (long j = 0; j < nb; ++j)
+        sum += row[j] * v[j];
+      p[i] = beta * sum;
+      pv += p[i] * v[i];
+    }
+    const double k = 0.5 * beta * pv;
+    for (long i = 0; i < nb; ++i)
+      p[i] -= k * v[i];
+    for (long i = 0; i < nb; ++i) {
+      double* const row = a + (iCol + 1 + i) * dim + iCol + 1;
+      for (long j = 0; j < nb; ++j)
+        row[j] -= v[i] * p[j] + p[i] * v[j];
+    }
+    a[(iCol + 1) * dim + iCol] = alpha;
+    a[iCol * dim + iCol + 1] = alpha;
+    for (long i = 1; i < nb; ++i) {
+      a[(iCol + 1 + i) * dim + iCol] = 0.0;
+      a[iCol * dim + iCol + 1 + i] = 0.0;
+    }
+  } else {
+    // A = H.A on the rows iCol + 1.., then A = A.H on all the rows
+    for (long j = iCol; j < dim; ++j) {
+      double sum = 0.0;
+      for (long i = 0; i < nb; ++i)
+        sum += v[i] * a[(iCol + 1 + i) * dim + j];
+      sum *= beta;
+      for (long i = 0; i < nb; ++i)
+        a[(iCol + 1 + i) * dim + j] -= sum * v[i];
+    }
+    for (long i = 0; i < dim; ++i) {
+      double* const row = a + i * dim + iCol + 1;
+      double sum = 0.0;
+      for (long j = 0; j < nb; ++j)
+        sum += row[j] * v[j];
+      sum *= beta;
+      for (long j = 0; j < nb; ++j)
+        row[j] -= sum * v[j];
+    }
+    for (long i = 1; i < nb; ++i)
+      a[(iCol + 1 + i) * dim + iCol] = 0.0;
+  }
+  // Accumulate the transformation, Q = Q.H
+  for (long i = 0; i < dim; ++i) {
+    double* const row = that->_vec + i * dim + iCol + 1;
+    double sum = 0.0;
+    for (long j = 0; j < nb; ++j)
+      sum += row[j] * v[j];
+    sum *= beta;
+    for (long j = 0; j < nb; ++j)
+      row[j] -= sum * v[j];
+  }
+}
+
+// Apply the rotation (c, s) on the columns 'iCol' and 'iCol' + 1 of 
+// the accumulated transformations of the EigenSolver 'that'
+static inline void EigenSolverRotateVec(EigenSolver* const that, 
+  const long iCol, const double c, const double s) {
+  const long dim = that->_dim;
+  double* col = that->_vec + iCol;
+  for (long i = dim; i--; col += dim) {
+    const double x = col[0];
+    const double y = col[1];
+    col[0] = c * x + s * y;
+    col[1] = c * y - s * x;
+  }
+}
+
+// Calculate the Eigen values and vectors of the symmetric tridiagonal
+// matrix in the working matrix of the EigenSolver 'that' with the 
+// implicit Wilkinson shifted QR algorithm
+// Return true if it has converged
+static inline bool EigenSolverTridiagQR(EigenSolver* const that, 
+  const double norm) {
+  const long dim = that->_dim;
+  double* const d = that->_val;
+  double* const e = that->_work + 2 * dim;
+  for (long i = 0; i < dim; ++i) {
+    d[i] = that->_mat[i * dim + i];
+    e[i] = (i < dim - 1 ? that->_mat[(i + 1) * dim + i] : 0.0);
+    that->_imag[i] = 0.0;
+  }
+  long hi = dim - 1;
+  const long maxIter = PBMATH_EIGENMAXITER * dim;
+  while (hi > 0) {
+    // Deflate the converged Eigen values
+    for (long i = 0; i < hi; ++i)
+      if (EigenSolverIsNegligible(e[i], d[i], d[i + 1], norm))
+        e[i] = 0.0;
+    while (hi > 0 && e[hi - 1] == 0.0)
+      --hi;
+    if (hi == 0)
+      break;
+    if (that->_nbIter >= maxIter)
+      return false;
+    ++(that->_nbIter);
+    long lo = hi - 1;
+    while (lo > 0 && e[lo - 1] != 0.0)
+      --lo;
+    // Wilkinson shift, Eigen value of the trailing 2x2 block closest 
+    // to its last diagonal value
+    const double delta = 0.5 * (d[hi - 1] - d[hi]);
+    const double e2 = e[hi - 1] * e[hi - 1];
+    const double mu = d[hi] - e2 / 
+      (delta + (delta >= 0.0 ? 1.0 : -1.0) * sqrt(delta * delta + e2));
+    // Chase the bulge created by the shifted rotation down the block
+    double x = d[lo] - mu;
+    double z = e[lo];
+    for (long k = lo; k < hi; ++k) {
+      const double r = hypot(x, z);
+      const double c = x / r;
+      const double s = z / r;
+      if (k > lo)
+        e[k - 1] = r;
+      const double dk = d[k];
+      const double dl = d[k + 1];
+      const double ek = e[k];
+      d[k] = c * c * dk + 2.0 * c * s * ek + s * s * dl;
+      d[k + 1] = s * s * dk - 2.0 * c * s * ek + c * c * dl;
+      e[k] = c * s * (dl - dk) + (c * c - s * s) * ek;
+      if (k < hi - 1) {
+        z = s * e[k + 1];
+        e[k + 1] *= c;
+        x = e[k];
+      }
+      EigenSolverRotateVec(that, k, c, s);
+    }
+  }
+  return true;
+}
+
+// Apply the rotation (c, s) on the rows and columns 'iRow' and 
+// 'iRow' + 1 of the working matrix of the EigenSolver 'that', the 
+// rows being updated from column 'fromCol' and the columns up to row
+// 'toRow' (included)
+static inline void EigenSolverRotateMat(EigenSolver* const that, 
+  const long iRow, const double c, const double s, const long fromCol,
+  const long toRow) {
+  const long dim = that->_dim;
+  double* const a = that->_mat;
+  for (long j = fromCol; j < dim; ++j) {
+    const double x = a[iRow * dim + j];
+    const double y = a[(iRow + 1) * dim + j];
+    a[iRow * dim + j] = c * x + s * y;
+    a[(iRow + 1) * dim + j] = c * y - s * x;
+  }
+  for (long i = 0; i <= toRow; ++i) {
+    const double x = a[i * dim + iRow];
+    const double y = a[i * dim + iRow + 1];
+    a[i * dim + iRow] = c * x + s * y;
+    a[i * dim + iRow + 1] = c * y - s * x;
+  }
+  EigenSolverRotateVec(that, iRow, c, s);
+}
+
+// Reduce the isolated 2x2 block at row 'iRow' of the Hessenberg 
+// matrix in the working matrix of the EigenSolver 'that' and set its
+// Eigen values
+static inline void EigenSolverHessenbergBlock(EigenSolver* const that,
+  const long iRow) {
+  const long dim = that->_dim;
+  double* const t = that->_mat;
+  const double a = t[iRow * dim + iRow];
+  const double b = t[iRow * dim + iRow + 1];
+  const double c = t[(iRow + 1) * dim + iRow];
+  const double d = t[(iRow + 1) * dim + iRow + 1];
+  const double half = 0.5 * (a - d);
+  const double disc = half * half + b * c;
+  if (disc < 0.0) {
+    // Complex conjugate Eigen values, the block is kept as is
+    that->_val[iRow] = 0.5 * (a + d);
+    that->_val[iRow + 1] = 0.5 * (a + d);
+    that->_imag[iRow] = sqrt(-disc);
+    that->_imag[iRow + 1] = -sqrt(-disc);
+    that->_isReal = false;
+    return;
+  }
+  // Real Eigen values, rotate the block to upper triangular form with 
+  // the Eigen vector of one of them
+  const double l = 0.5 * (a + d) + 
+    (half >= 0.0 ? 1.0 : -1.0) * sqrt(disc);
+  double x = b;
+  double y = l - a;
+  if (hypot(l - d, c) > hypot(x, y)) {
+    x = l - d;
+    y = c;
+  }
+  const double r = hypot(x, y);
+  if (r > 0.0)
+    EigenSolverRotateMat(that, iRow, x / r, y / r, iRow, iRow + 1);
+  t[(iRow + 1) * dim + iRow] = 0.0;
+  that->_val[iRow] = t[iRow * dim + iRow];
+  that->_val[iRow + 1] = t[(iRow + 1) * dim + iRow + 1];
+  that->_imag[iRow] = 0.0;
+  that->_imag[iRow + 1] = 0.0;
+}
+
+// Apply the Householder reflection (I - beta.v.v') of dimension 'nb' 
+// (2 or 3) on the rows 'iRow' to 'iRow' + 'nb' - 1 of the working 
+// matrix of the EigenSolver 'that' from column 'fromCol', on its 
+// columns 'iRow' to 'iRow' + 'nb' - 1 up to row 'toRow' (included), 
+// and accumulate it
+static inline void EigenSolverReflect(EigenSolver* const that, 
+  const long iRow, const long nb, const double* const v, 
+  const double beta, const long fromCol, const long toRow) {
+  const long dim = that->_dim;
+  double* const a = that->_mat;
+  for (long j = fromCol; j < dim; ++j) {
+    double sum = 0.0;
+    for (long i = 0; i < nb; ++i)
+      sum += v[i] * a[(iRow + i) * dim + j];
+    sum *= beta;
+    for (long i = 0; i < nb; ++i)
+      a[(iRow + i) * dim + j] -= sum * v[i];
+  }
+  for (long i = 0; i <= toRow; ++i) {
+    double* const row = a + i * dim + iRow;
+    double sum = 0.0;
+    for (long j = 0; j < nb; ++j)
+      sum += row[j] * v[j];
+    sum *= beta;
+    for (long j = 0; j < nb; ++j)
+      row[j] -= sum * v[j];
+  }
+  for (long i = 0; i < dim; ++i) {
+    double* const row = that->_vec + i * dim + iRow;
+    double sum = 0.0;
+    for (long j = 0; j < nb; ++j)
+      sum += row[j] * v[j];
+    sum *= beta;
+    for (long j = 0; j < nb; ++j)
+      row[j] -= sum * v[j];
+  }
+}
+
+// Calculate the Householder vector 'v' of dimension 'nb' and its 
+// coefficient such as (I - beta.v.v').v = alpha.e1
+// Return 0 if 'v' is null
+static inline double EigenSolverHouseVec(double* const v, 
+  const long nb) {
+  double alpha = 0.0;
+  for (long i = 0; i < nb; ++i)
+    alpha += v[i] * v[i];
+  if (alpha == 0.0)
+    return 0.0;
+  alpha = sqrt(alpha);
+  v[0] += (v[0] > 0.0 ? alpha : -alpha);
+  double norm = 0.0;
+  for (long i = 0; i < nb; ++i)
+    norm += v[i] * v[i];
+  return 2.0 / norm;
+}
+
+// Reduce the Hessenberg matrix in the working matrix of the 
+// EigenSolver 'that' to its real Schur form with the Francis double 
+// shifted QR algorithm, the shifts being the Eigen values of the 
+// trailing 2x2 block (Wilkinson shifts)
+// Return true if it has converged
+static inline bool EigenSolverHessenbergQR(EigenSolver* const that, 
+  const double norm) {
+  const long dim = that->_dim;
+  double* const t = that->_mat;
+  long hi = dim - 1;
+  long nbIterVal = 0;
+  const long maxIter = PBMATH_EIGENMAXITER * dim;
+  while (hi >= 0) {
+    // Look for a negligible subdiagonal value to split the matrix
+    long lo = hi;
+    while (lo > 0) {
+      if (EigenSolverIsNegligible(t[lo * dim + lo - 1], 
+        t[(lo - 1) * dim + lo - 1], t[lo * dim + lo], norm)) {
+        t[lo * dim + lo - 1] = 0.0;
+        break;
+      }
+      --lo;
+    }
+    if (lo == hi) {
+      // One Eigen value has converged
+      that->_val[hi] = t[hi * dim + hi];
+      that->_imag[hi] = 0.0;
+      --hi;
+      nbIterVal = 0;
+      continue;
+    }
+    if (lo == hi - 1) {
+      // Two Eigen values have converged
+      EigenSolverHessenbergBlock(that, lo);
+      hi -= 2;
+      nbIterVal = 0;
+      continue;
+    }
+    if (that->_nbIter >= maxIter)
+      return false;
+    ++(that->_nbIter);
+    ++nbIterVal;
+    // Sum and product of the shifts, or exceptional shifts if the 
+    // convergence stalls
+    double sum = t[(hi - 1) * dim + hi - 1] + t[hi * dim + hi];
+    double prod = t[(hi - 1) * dim + hi - 1] * t[hi * dim + hi] - 
+      t[(hi - 1) * dim + hi] * t[hi * dim + hi - 1];
+    if (nbIterVal % 10 == 0) {
+      const double w = fabs(t[hi * dim + hi - 1]) + 
+        fabs(t[(hi - 1) * dim + hi - 2]);
+      sum = 1.5 * w;
+      prod = w * w;
+    }
+    // First column of (T - mu1.I).(T - mu2.I)
+    double v[3];
+    const double t00 = t[lo * dim + lo];
+    const double t10 = t[(lo + 1) * dim + lo];
+    v[0] = t00 * t00 + t[lo * dim + lo + 1] * t10 - sum * t00 + prod;
+    v[1] = t10 * (t00 + t[(lo + 1) * dim + lo + 1] - sum);
+    v[2] = t10 * t[(lo + 2) * dim + lo + 1];
+    // Chase the bulge down the active block
+    for (long k = lo; k <= hi - 2; ++k) {
+      const double beta = EigenSolverHouseVec(v, 3);
+      if (beta > 0.0) {
+        const long toRow = (k + 3 < hi ? k + 3 : hi);
+        EigenSolverReflect(that, k, 3, v, beta, 
+          (k > lo ? k - 1 : lo), toRow);
+      }
+      if (k > lo) {
+        t[(k + 1) * dim + k - 1] = 0.0;
+        t[(k + 2) * dim + k - 1] = 0.0;
+      }
+      v[0] = t[(k + 1) * dim + k];
+      v[1] = t[(k + 2) * dim + k];
+      v[2] = (k < hi - 2 ? t[(k + 3) * dim + k] : 0.0);
+    }
+    const double beta = EigenSolverHouseVec(v, 2);
+    if (beta > 0.0)
+      EigenSolverReflect(that, hi - 1, 2, v, beta, hi - 2, hi);
+    t[hi * dim + hi - 2] = 0.0;
+  }
+  return true;
+}
+
+// Calculate the Eigen vectors of the real Eigen values of the real 
+// Schur form in the working matrix of the EigenSolver 'that' by back
+// substitution, and replace the Schur vectors with them
+static inline void EigenSolverSchurVectors(EigenSolver* const that, 
+  const double norm) {
+  const long dim = that->_dim;
+  const double* const t = that->_mat;
+  double* const y = that->_work;
+  double* const v = that->_work + dim;
+  const double small = (norm > 0.0 ? norm : 1.0) * DBL_EPSILON;
+  for (long k = dim; k--;) {
+    if (that->_imag[k] != 0.0)
+      continue;
+    const double l = that->_val[k];
+    // Solve (T - l.I).y = 0 with y[k] = 1 and y[j] = 0 for j > k
+    y[k] = 1.0;
+    for (long i = k; i--;) {
+      if (that->_imag[i] < 0.0) {
+        // 2x2 block of complex Eigen values at rows i - 1 and i
+        double r0 = 0.0;
+        double r1 = 0.0;
+        for (long j = i + 1; j <= k; ++j) {
+          r0 += t[(i - 1) * dim + j] * y[j];
+          r1 += t[i * dim + j] * y[j];
+        }
+        const double a = t[(i - 1) * dim + i - 1] - l;
+        const double b = t[(i - 1) * dim + i];
+        const double c = t[i * dim + i - 1];
+        const double d = t[i * dim + i] - l;
+        double det = a * d - b * c;
+        if (fabs(det) < small)
+          det = small;
+        y[i - 1] = (-r0 * d + r1 * b) / det;
+        y[i] = (-r1 * a + r0 * c) / det;
+        --i;
+      } else {
+        double r = 0.0;
+        for (long j = i + 1; j <= k; ++j)
+          r += t[i * dim + j] * y[j];
+        double den = t[i * dim + i] - l;
+        if (fabs(den) < small)
+          den = small;
+        y[i] = -r / den;
+      }
+    }
+    // v = Q.y, the columns after 'k' are not used hence the column 'k'
+    // can be replaced
+    double n = 0.0;
+    for (long i = 0; i < dim; ++i) {
+      const double* const row = that->_vec + i * dim;
+      double sum = 0.0;
+      for (long j = 0; j <= k; ++j)
+        sum += row[j] * y[j];
+      v[i] = sum;
+      n += sum * sum;
+    }
+    n = sqrt(n);
+    for (long i = 0; i < dim; ++i)
+      that->_vec[i * dim + k] = v[i] / n;
+  }
+}
+
+// Calculate the Eigen values and vectors of the MatFloat 'mat' with 
+// the EigenSolver 'that'
+// 'mat' must be a square matrix of dimension that->_dim
+// Return true if all the Eigen values have been found and are real, 
+// false else
+// If the matrix has complex Eigen values, their real part is used as
+// Eigen value and the Schur vectors are used as Eigen vectors
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatHamiltonDist(const VecFloat* const that, 
-  const VecFloat* const tho) {
+bool EigenSolverSolve(EigenSolver* const that, const MatFloat* const mat) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (mat == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'mat' is null");
     PBErrCatch(PBMathErr);
   }
-  if (that->_dim != tho->_dim) {
+  if (VecGet(&(mat->_dim), 0) != that->_dim || 
+    VecGet(&(mat->_dim), 1) != that->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
-    PBErrCatch(PBMathErr);
+    sprintf(PBMathErr->_msg, "'mat' has invalid dimensions (%dx%d)", 
+      VecGet(&(mat->_dim), 0), VecGet(&(mat->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long dim = that->_dim;
+  // Copy the matrix, check its symmetry and initialise the 
+  // transformations to the identity
+  double norm = 0.0;
+  that->_isSym = true;
+  for (long i = 0; i < dim; ++i) {
+    for (long j = 0; j < dim; ++j) {
+      const double x = mat->_val[i * dim + j];
+      that->_mat[i * dim + j] = x;
+      that->_vec[i * dim + j] = (i == j ? 1.0 : 0.0);
+      norm += x * x;
+      if (j < i && fabs(x - that->_mat[j * dim + i]) > 
+        PBMATH_EPSILON * (fabs(x) + fabs(that->_mat[j * dim + i])))
+        that->_isSym = false;
+    }
   }
-#endif
-  // Declare a variable to calculate the distance
-  float ret = 0.0;
-  for (long iDim = that->_dim; iDim--;)
-    ret += fabs(VecGet(that, iDim) - VecGet(tho, iDim));
-  // Return the distance
-  return ret;
+  norm = sqrt(norm);
+  that->_nbIter = 0;
+  that->_isReal = true;
+  // Reduce to tridiagonal/Hessenberg form and solve
+  for (long iCol = 0; iCol < dim - 2; ++iCol)
+    EigenSolverHouseholder(that, iCol, that->_isSym);
+  if (that->_isSym) {
+    that->_isConverged = EigenSolverTridiagQR(that, norm);
+  } else {
+    that->_isConverged = EigenSolverHessenbergQR(that, norm);
+    if (that->_isConverged)
+      EigenSolverSchurVectors(that, norm);
+    else
+      for (long i = 0; i < dim; ++i) {
+        that->_val[i] = that->_mat[i * dim + i];
+        that->_imag[i] = 0.0;
+      }
+  }
+  // Sort the Eigen values by decreasing absolute value
+  for (long i = 0; i < dim; ++i) {
+    long j = i;
+    for (; j > 0 && 
+      fabs(that->_val[that->_order[j - 1]]) < fabs(that->_val[i]); --j)
+      that->_order[j] = that->_order[j - 1];
+    that->_order[j] = i;
+  }
+  return (that->_isConverged && that->_isReal);
 }
-#if BUILDMODE != 0
-static inline
+
+// Return the 'iVal'-th Eigen value of the last matrix solved with the
+// EigenSolver 'that', Eigen values are sorted from biggest to 
+// smallest (in absolute value)
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatHamiltonDist2D(const VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+float EigenSolverGetValue(const EigenSolver* const that, 
+  const long iVal) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+  if (iVal < 0 || iVal >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iVal' is invalid (0<=%ld<%ld)", 
+      iVal, that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the distance
-  return fabs(VecGet(that, 0) - VecGet(tho, 0)) + 
-    fabs(VecGet(that, 1) - VecGet(tho, 1));
+  return (float)(that->_val[that->_order[iVal]]);
 }
-#if BUILDMODE != 0
-static inline
+
+// Copy the normalised Eigen vector of the 'iVal'-th Eigen value of the
+// last matrix solved with the EigenSolver 'that' into 'res'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatHamiltonDist3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+void EigenSolverGetVector(const EigenSolver* const that, 
+  const long iVal, VecFloat* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (res == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (iVal < 0 || iVal >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iVal' is invalid (0<=%ld<%ld)", 
+      iVal, that->_dim);
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(res) != that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'res' 's dimension is invalid (%ld==%ld)",
+      VecGetDim(res), that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the distance
-  return fabs(VecGet(that, 0) - VecGet(tho, 0)) + 
-    fabs(VecGet(that, 1) - VecGet(tho, 1)) +
-    fabs(VecGet(that, 2) - VecGet(tho, 2));
+  const double* col = that->_vec + that->_order[iVal];
+  for (long i = 0; i < that->_dim; ++i, col += that->_dim)
+    res->_val[i] = (float)(*col);
 }
 
-// Return the Pixel distance between the VecFloat 'that' and 'tho'
-#if BUILDMODE != 0
-static inline
+// Return the number of QR iterations used by the last resolution with
+// the EigenSolver 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatPixelDist(const VecFloat* const that, 
-  const VecFloat* const tho) {
+long EigenSolverGetNbIter(const EigenSolver* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (that->_dim != tho->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Declare a variable to calculate the distance
-  float ret = 0.0;
-  for (long iDim = that->_dim; iDim--;)
-    ret += fabs(floor(VecGet(that, iDim)) - floor(VecGet(tho, iDim)));
-  // Return the distance
-  return ret;
+  return that->_nbIter;
 }
-#if BUILDMODE != 0
-static inline
+
+// Return true if the last matrix solved with the EigenSolver 'that'
+// was symmetric
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatPixelDist2D(const VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+bool EigenSolverIsSym(const EigenSolver* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Return the distance
-  return fabs(floor(VecGet(that, 0)) - floor(VecGet(tho, 0))) +
-    fabs(floor(VecGet(that, 1)) - floor(VecGet(tho, 1)));
+  return that->_isSym;
 }
-#if BUILDMODE != 0
-static inline
+
+// Return true if the last resolution with the EigenSolver 'that' has
+// converged
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float _VecFloatPixelDist3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+bool EigenSolverIsConverged(const EigenSolver* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Return the distance
-  return fabs(floor(VecGet(that, 0)) - floor(VecGet(tho, 0))) +
-    fabs(floor(VecGet(that, 1)) - floor(VecGet(tho, 1))) +
-    fabs(floor(VecGet(that, 2)) - floor(VecGet(tho, 2)));
+  return that->_isConverged;
 }
 
-// Return true if the VecFloat 'that' is equal to 'tho', else false
-#if BUILDMODE != 0
-static inline
+// Return the residual of the last resolution of the MatFloat 'mat'  
+// with the EigenSolver 'that', i.e. the maximum over the real Eigen 
+// values 'l' and their vector 'v' of the norm of (mat.v - l.v)
+#if BUILDMODE != 0 
+static inline 
 #endif 
-bool _VecFloatIsEqual(const VecFloat* const that, 
-  const VecFloat* const tho) {
+float EigenSolverGetResidual(const EigenSolver* const that, 
+  const MatFloat* const mat) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (mat == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (that->_dim != tho->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'mat' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // For each component
-  for (long iDim = that->_dim; iDim--;)
-    // If the values of this components are different
-    if (!ISEQUALF(VecGet(that, iDim), VecGet(tho, iDim)))
-      // Return false
-      return false;
-  // Return true
-  return true;
+  const long dim = that->_dim;
+  double res = 0.0;
+  for (long k = 0; k < dim; ++k) {
+    if (that->_imag[k] != 0.0)
+      continue;
+    double err = 0.0;
+    for (long i = 0; i < dim; ++i) {
+      double sum = -that->_val[k] * that->_vec[i * dim + k];
+      for (long j = 0; j < dim; ++j)
+        sum += mat->_val[i * dim + j] * that->_vec[j * dim + k];
+      err += sum * sum;
+    }
+    if (err > res)
+      res = err;
+  }
+  return (float)sqrt(res);
 }
 
-// Calculate (that * a + tho * b) and store the result in 'that'
-#if BUILDMODE != 0
-static inline
+// Calculate the Eigen values and vectors of the MatFloat 'that'
+// Same as _MatFloatGetEigenValues but using a temporary EigenSolver, 
+// if it doesn't converge the current approximation is returned
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatOp(VecFloat* const that, const float a, 
-  const VecFloat* const tho, const float b) {
+GSetVecFloat _MatFloatGetEigenValuesFast(const MatFloat* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (that->_dim != tho->_dim) {
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'that' is not square (%dx%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
     PBErrCatch(PBMathErr);
   }
 #endif
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(that, iDim, 
-      a * VecGet(that, iDim) + b * VecGet(tho, iDim));
+  const long dim = VecGet(&(that->_dim), 0);
+  EigenSolver solver = EigenSolverCreateStatic(dim);
+  EigenSolverSolve(&solver, that);
+  GSetVecFloat res = GSetVecFloatCreateStatic();
+  VecFloat* values = VecFloatCreate(dim);
+  for (long iVal = 0; iVal < dim; ++iVal)
+    VecSet(values, iVal, EigenSolverGetValue(&solver, iVal));
+  GSetAppend(&res, values);
+  for (long iVal = 0; iVal < dim; ++iVal) {
+    VecFloat* v = VecFloatCreate(dim);
+    EigenSolverGetVector(&solver, iVal, v);
+    GSetAppend(&res, v);
+  }
+  EigenSolverFreeStatic(&solver);
+  return res;
 }
-#if BUILDMODE != 0
-static inline
+
+// Get the base of the Ratio 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatOp2D(VecFloat2D* const that, const float a, 
-  const VecFloat2D* const tho, const float b) {
+long RatioGetBase(const Ratio* that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+#endif
+  return that->_base;
+}
+
+// Get the numerator of the Ratio 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+unsigned int RatioGetNumerator(const Ratio* that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecSet(that, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
-  VecSet(that, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
+  return that->_numerator;
 }
-#if BUILDMODE != 0
-static inline
+
+// Get the denominator of the Ratio 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatOp3D(VecFloat3D* const that, const float a, 
-  const VecFloat3D* const tho, const float b) {
+unsigned int  RatioGetDenominator(const Ratio* that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+#endif
+  return that->_denominator;
+}
+
+// Set the base of the Ratio 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void RatioSetBase(Ratio* that, long v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecSet(that, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
-  VecSet(that, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
-  VecSet(that, 2, a * VecGet(that, 2) + b * VecGet(tho, 2));
+  that->_base = v;
 }
 
-// Return a VecFloat equal to (that * a + tho * b)
-#if BUILDMODE != 0
-static inline
+// Set the numerator of the Ratio 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-VecFloat* _VecFloatGetOp(const VecFloat* const that, const float a, 
-  const VecFloat* const tho, const float b) {
+void RatioSetNumerator(Ratio* that, unsigned int v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+#endif
+  that->_numerator = v;
+}
+
+// Set the denominator of the Ratio 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void RatioSetDenominator(Ratio* that, unsigned int v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (that->_dim != tho->_dim) {
+  if (v == 0) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'v' is invalid (%u > 0)", v);
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat* res = VecFloatCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, 
-      a * VecGet(that, iDim) + b * VecGet(tho, iDim));
-  return res;
+  that->_denominator = v;
+}
+
+// -------------- VecDouble
+
+// Add to the JSON node 'that' the property 'key' whose values are the
+// 'nb' doubles 'vals' written with 17 significant digits
+static inline void JSONAddPropDoubles(JSONNode* const that, 
+  const char* const key, const double* const vals, const long nb) {
+  JSONNode* prop = JSONCreate();
+  JSONSetLabel(prop, key);
+  char str[32];
+  for (long iVal = 0; iVal < nb; ++iVal) {
+    sprintf(str, "%.17g", vals[iVal]);
+    JSONNode* val = JSONCreate();
+    JSONSetLabel(val, str);
+    JSONAppendVal(prop, val);
+  }
+  JSONAppendVal(that, prop);
+}
+
+// Convert the 'nb' values of the property 'prop' with strtod into 'vals'
+// Return false if 'prop' hasn't 'nb' values or one of them is invalid
+static inline bool JSONGetPropDoubles(const JSONNode* const prop, 
+  double* const vals, const long nb) {
+  if (JSONGetNbValue(prop) != nb)
+    return false;
+  long iVal = 0;
+  for (const GSetElem* elem = JSONProperties(prop)->_set._head;
+    elem != NULL; elem = elem->_next, ++iVal) {
+    const char* lbl = JSONLabel((const JSONNode*)(elem->_data));
+    if (lbl == NULL)
+      return false;
+    char* end = NULL;
+    vals[iVal] = strtod(lbl, &end);
+    if (end == lbl || *end != '\0')
+      return false;
+  }
+  return true;
 }
+
+// Create a new VecDouble of dimension 'dim'
+// Values are initalized to 0.0
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat2D _VecFloatGetOp2D(const VecFloat2D* const that, const float a, 
-  const VecFloat2D* const tho, const float b) {
+VecDouble* VecDoubleCreate(const long dim) {
 #if BUILDMODE == 0
-  if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+  if (dim <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "invalid 'dim' (%ld)", dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat2D res = VecFloatCreateStatic2D();
-  VecSet(&res, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
-  VecSet(&res, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
-  return res;
+  VecDouble* that = 
+    PBErrMalloc(PBMathErr, sizeof(VecDouble) + sizeof(double) * dim);
+  that->_dim = dim;
+  memset(that->_val, 0, sizeof(double) * dim);
+  return that;
 }
+
+// Clone the VecDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat3D _VecFloatGetOp3D(const VecFloat3D* const that, const float a, 
-  const VecFloat3D* const tho, const float b) {
+VecDouble* _VecDoubleClone(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  VecFloat3D res = VecFloatCreateStatic3D();
-  VecSet(&res, 0, a * VecGet(that, 0) + b * VecGet(tho, 0));
-  VecSet(&res, 1, a * VecGet(that, 1) + b * VecGet(tho, 1));
-  VecSet(&res, 2, a * VecGet(that, 2) + b * VecGet(tho, 2));
-  return res;
+  VecDouble* clone = VecDoubleCreate(that->_dim);
+  memcpy(clone->_val, that->_val, sizeof(double) * that->_dim);
+  return clone;
 }
 
-// Calculate the Hadamard product of that by tho and store the 
-// result in 'that'
-// 'tho' and 'that' must be of same dimension
-#if BUILDMODE != 0 
-static inline 
+// Create a new VecDouble with the values of the VecFloat 'that'
+#if BUILDMODE != 0
+static inline
 #endif 
-void _VecFloatHadamardProd(VecFloat* const that, 
-  const VecFloat* const tho) {
+VecDouble* VecFloatGetVecDouble(const VecFloat* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (that->_dim != tho->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
-    PBErrCatch(PBMathErr);
-  }
 #endif
+  VecDouble* res = VecDoubleCreate(that->_dim);
   for (long iDim = that->_dim; iDim--;)
-    VecSet(that, iDim, VecGet(that, iDim) * VecGet(tho, iDim));
+    res->_val[iDim] = that->_val[iDim];
+  return res;
 }
-#if BUILDMODE != 0 
-static inline 
+
+// Create a new VecFloat with the values of the VecDouble 'that'
+// rounded to float
+#if BUILDMODE != 0
+static inline
 #endif 
-void _VecFloatHadamardProd2D(VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+VecFloat* VecDoubleGetVecFloat(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  VecSet(that, 0, VecGet(that, 0) * VecGet(tho, 0));
-  VecSet(that, 1, VecGet(that, 1) * VecGet(tho, 1));
+  VecFloat* res = VecFloatCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;)
+    res->_val[iDim] = (float)(that->_val[iDim]);
+  return res;
 }
-#if BUILDMODE != 0 
-static inline 
+
+// Function which return the JSON encoding of 'that'
+// The values are written with 17 significant digits, which converts
+// back exactly to the value
+#if BUILDMODE != 0
+static inline
 #endif 
-void _VecFloatHadamardProd3D(VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+JSONNode* _VecDoubleEncodeAsJSON(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  VecSet(that, 0, VecGet(that, 0) * VecGet(tho, 0));
-  VecSet(that, 1, VecGet(that, 1) * VecGet(tho, 1));
-  VecSet(that, 2, VecGet(that, 2) * VecGet(tho, 2));
+  JSONNode* json = JSONCreate();
+  char val[32];
+  sprintf(val, "%ld", that->_dim);
+  JSONAddProp(json, "_dim", val);
+  JSONAddPropDoubles(json, "_val", that->_val, that->_dim);
+  return json;
 }
 
-// Return a VecFloat equal to the hadamard product of 'that' and 'tho'
-// Return NULL if arguments are invalid
-// 'tho' and 'that' must be of same dimension
-#if BUILDMODE != 0 
-static inline 
+// Function which decode from JSON encoding 'json' to 'that'
+#if BUILDMODE != 0
+static inline
 #endif 
-VecFloat* _VecFloatGetHadamardProd(const VecFloat* const that, 
-  const VecFloat* const tho) {
+bool _VecDoubleDecodeAsJSON(VecDouble** that, 
+  const JSONNode* const json) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (json == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (that->_dim != tho->_dim) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
-      that->_dim, tho->_dim);
+    sprintf(PBMathErr->_msg, "'json' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat* res = VecFloatCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, VecGet(that, iDim) * VecGet(tho, iDim));
-  return res;
+  if (*that != NULL)
+    _VecDoubleFree(that);
+  JSONNode* prop = JSONProperty(json, "_dim");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  long dim = atol(JSONLblVal(prop));
+  if (dim <= 0)
+    return false;
+  prop = JSONProperty(json, "_val");
+  if (prop == NULL)
+    return false;
+  *that = VecDoubleCreate(dim);
+  if (!JSONGetPropDoubles(prop, (*that)->_val, dim)) {
+    _VecDoubleFree(that);
+    return false;
+  }
+  return true;
 }
-#if BUILDMODE != 0 
-static inline 
+
+// Save the VecDouble to the stream
+// If 'compact' equals true it saves in compact form, else it saves in
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
 #endif 
-VecFloat2D _VecFloatGetHadamardProd2D(const VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+bool _VecDoubleSave(const VecDouble* const that, 
+  FILE* const stream, const bool compact) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (stream == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat2D res = VecFloatCreateStatic2D();
-  VecSet(&res, 0, VecGet(that, 0) * VecGet(tho, 0));
-  VecSet(&res, 1, VecGet(that, 1) * VecGet(tho, 1));
-  return res;
+  JSONNode* json = _VecDoubleEncodeAsJSON(that);
+  bool ret = JSONSave(json, stream, compact);
+  JSONFree(&json);
+  return ret;
 }
-#if BUILDMODE != 0 
-static inline 
+
+// Load the VecDouble from the stream
+// If the VecDouble is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
 #endif 
-VecFloat3D _VecFloatGetHadamardProd3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+bool _VecDoubleLoad(VecDouble** that, FILE* const stream) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+  if (stream == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'stream' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D res = VecFloatCreateStatic3D();
-  VecSet(&res, 0, VecGet(that, 0) * VecGet(tho, 0));
-  VecSet(&res, 1, VecGet(that, 1) * VecGet(tho, 1));
-  VecSet(&res, 2, VecGet(that, 2) * VecGet(tho, 2));
-  return res;
+  JSONDoc* doc = JSONDocLoad(stream);
+  if (doc == NULL)
+    return false;
+  bool ret = _VecDoubleDecodeAsJSON(that, JSONDocRoot(doc));
+  JSONDocFree(&doc);
+  return ret;
 }
 
-// Calculate (that * a) and store the result in 'that'
+// Free the memory used by a VecDouble
+// Do nothing if arguments are invalid
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatScale(VecFloat* const that, const float a) {
+void _VecDoubleFree(VecDouble** that) {
+  if (that == NULL || *that == NULL)
+    return;
+  free(*that);
+  *that = NULL;
+}
+
+// Print the VecDouble on 'stream' with 'prec' digit precision
+#if BUILDMODE != 0
+static inline
+#endif 
+void VecDoublePrint(const VecDouble* const that, FILE* const stream, 
+  const unsigned int prec) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(that, iDim, a * VecGet(that, iDim));
+  fprintf(stream, "<");
+  for (long iDim = 0; iDim < that->_dim; ++iDim) {
+    fprintf(stream, "%.*f", (int)prec, that->_val[iDim]);
+    if (iDim < that->_dim - 1)
+      fprintf(stream, ",");
+  }
+  fprintf(stream, ">");
 }
+
+// Return the 'i'-th value of the VecDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatScale2D(VecFloat2D* const that, const float a) {
+double _VecDoubleGet(const VecDouble* const that, const long i) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
+      that->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  VecSet(that, 0, a * VecGet(that, 0));
-  VecSet(that, 1, a * VecGet(that, 1));
+  return that->_val[i];
 }
+
+// Set the 'i'-th value of the VecDouble to 'v'
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatScale3D(VecFloat3D* const that, const float a) {
+void _VecDoubleSet(VecDouble* const that, const long i, const double v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
+      that->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  VecSet(that, 0, a * VecGet(that, 0));
-  VecSet(that, 1, a * VecGet(that, 1));
-  VecSet(that, 2, a * VecGet(that, 2));
+  that->_val[i] = v;
 }
 
-// Return a VecFloat equal to (that * a)
+// Set the 'i'-th value of the VecDouble to 'v' plus its current value
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat* _VecFloatGetScale(const VecFloat* const that, const float a) {
+void _VecDoubleSetAdd(VecDouble* const that, const long i, 
+  const double v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (i < 0 || i >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'i' is invalid (0<=%ld<%ld)", i, 
+      that->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  VecFloat* res = VecFloatCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, a * VecGet(that, iDim));
-  return res;
+  that->_val[i] += v;
 }
+
+// Set all values of the vector 'that' to 0
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat2D _VecFloatGetScale2D(const VecFloat2D* const that, 
-  const float a) {
+void _VecDoubleSetNull(VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3157,16 +8540,14 @@ VecFloat2D _VecFloatGetScale2D(const VecFloat2D* const that,
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat2D res = VecFloatCreateStatic2D();
-  VecSet(&res, 0, a * VecGet(that, 0));
-  VecSet(&res, 1, a * VecGet(that, 1));
-  return res;
+  memset(that->_val, 0, sizeof(double) * that->_dim);
 }
+
+// Set all values of the vector 'that' to 'v'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat3D _VecFloatGetScale3D(const VecFloat3D* const that, 
-  const float a) {
+void _VecDoubleSetAll(VecDouble* const that, const double v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3174,72 +8555,57 @@ VecFloat3D _VecFloatGetScale3D(const VecFloat3D* const that,
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D res = VecFloatCreateStatic3D();
-  VecSet(&res, 0, a * VecGet(that, 0));
-  VecSet(&res, 1, a * VecGet(that, 1));
-  VecSet(&res, 2, a * VecGet(that, 2));
-  return res;
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] = v;
 }
 
-// Rotate CCW 'that' by 'theta' radians and store the result in 'that'
+// Return the dimension of the VecDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-void _VecFloatRot2D(VecFloat2D* const that, const float theta) {
+long _VecDoubleGetDim(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 2) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==2)",
-      VecGetDim(that));
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  *that = _VecFloatGetRot2D(that, theta);
+  return that->_dim;
 }
 
-// Return a VecFloat2D equal to 'that' rotated CCW by 'theta' radians
+// Copy the values of 'tho' in 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat2D _VecFloatGetRot2D(const VecFloat2D* const that, const float theta) {
+void _VecDoubleCopy(VecDouble* const that, const VecDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 2) {
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (that->_dim != tho->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==2)",
-      VecGetDim(that));
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Declare a variable to memorize the result 
-  VecFloat2D res = VecFloatCreateStatic2D();
-  // Declare variable for optimization
-  float cosTheta = cos(theta);
-  float sinTheta = sin(theta);
-  // Calculate the rotation
-  VecSet(&res, 0, 
-    cosTheta * VecGet(that, 0) - sinTheta * VecGet(that, 1));
-  VecSet(&res, 1, 
-    sinTheta * VecGet(that, 0) + cosTheta * VecGet(that, 1));
-  // Return the result
-  return res;
+  memcpy(that->_val, tho->_val, sizeof(double) * that->_dim);
 }
 
 // Return the dot product of 'that' and 'tho'
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatDotProd(const VecFloat* const that, 
-  const VecFloat* const tho) {
+double _VecDoubleDotProd(const VecDouble* const that, 
+  const VecDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3258,19 +8624,51 @@ float _VecFloatDotProd(const VecFloat* const that,
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Declare a variable to memorize the result
-  float res = 0.0;
-  // Calculate
+  double res = 0.0;
   for (long iDim = that->_dim; iDim--;)
     res += that->_val[iDim] * tho->_val[iDim];
-  // Return the result
   return res;
 }
+
+// Return the norm of the VecDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatDotProd2D(const VecFloat2D* const that, 
-  const VecFloat2D* const tho) {
+double _VecDoubleNorm(const VecDouble* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return sqrt(_VecDoubleDotProd(that, that));
+}
+
+// Normalise the VecDouble
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecDoubleNormalise(VecDouble* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  double norm = _VecDoubleNorm(that);
+  if (norm > 0.0)
+    for (long iDim = that->_dim; iDim--;)
+      that->_val[iDim] /= norm;
+}
+
+// Return the distance between the VecDouble 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+double _VecDoubleDist(const VecDouble* const that, 
+  const VecDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3282,14 +8680,27 @@ float _VecFloatDotProd2D(const VecFloat2D* const that,
     sprintf(PBMathErr->_msg, "'tho' is null");
     PBErrCatch(PBMathErr);
   }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  return that->_val[0] * tho->_val[0] + that->_val[1] * tho->_val[1];
+  double res = 0.0;
+  for (long iDim = that->_dim; iDim--;) {
+    double d = that->_val[iDim] - tho->_val[iDim];
+    res += d * d;
+  }
+  return sqrt(res);
 }
+
+// Return true if the VecDouble 'that' is equal to 'tho', else false
 #if BUILDMODE != 0
 static inline
 #endif 
-float _VecFloatDotProd3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+bool _VecDoubleIsEqual(const VecDouble* const that, 
+  const VecDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3301,17 +8712,25 @@ float _VecFloatDotProd3D(const VecFloat3D* const that,
     sprintf(PBMathErr->_msg, "'tho' is null");
     PBErrCatch(PBMathErr);
   }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  return that->_val[0] * tho->_val[0] + that->_val[1] * tho->_val[1] +
-    that->_val[2] * tho->_val[2];
+  for (long iDim = that->_dim; iDim--;)
+    if (!ISEQUALF(that->_val[iDim], tho->_val[iDim]))
+      return false;
+  return true;
 }
 
-// Return the cross product of 'that' and 'tho'
+// Calculate (that * a + tho * b) and store the result in 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat* _VecFloatGetCrossProd(const VecFloat* const that, 
-  const VecFloat* const tho) {
+void _VecDoubleOp(VecDouble* const that, const double a, 
+  const VecDouble* const tho, const double b) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3323,33 +8742,35 @@ VecFloat* _VecFloatGetCrossProd(const VecFloat* const that,
     sprintf(PBMathErr->_msg, "'tho' is null");
     PBErrCatch(PBMathErr);
   }
-  if (that->_dim != tho->_dim || tho->_dim != 3) {
+  if (that->_dim != tho->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "invalid dimensions (%ld==%ld==3)", 
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
       that->_dim, tho->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Declare a variable to memorize the result
-  VecFloat* res = VecFloatCreate(3);
-  // Calculate
-  VecSet(res, 0,
-    VecGet(that, 1) * VecGet(tho, 2) - 
-    VecGet(that, 2) * VecGet(tho, 1));
-  VecSet(res, 1, -1.0 *
-    (VecGet(that, 0) * VecGet(tho, 2) - 
-    VecGet(that, 2) * VecGet(tho, 0)));
-  VecSet(res, 2, 
-    VecGet(that, 0) * VecGet(tho, 1) - 
-    VecGet(that, 1) * VecGet(tho, 0));
-  // Return the result
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] = a * that->_val[iDim] + b * tho->_val[iDim];
+}
+
+// Return a VecDouble equal to (that * a + tho * b)
+#if BUILDMODE != 0
+static inline
+#endif 
+VecDouble* _VecDoubleGetOp(const VecDouble* const that, const double a, 
+  const VecDouble* const tho, const double b) {
+  VecDouble* res = _VecDoubleClone(that);
+  _VecDoubleOp(res, a, tho, b);
   return res;
 }
+
+// Calculate the Hadamard product of 'that' and 'tho' and store the
+// result in 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat3D _VecFloatGetCrossProd3D(const VecFloat3D* const that, 
-  const VecFloat3D* const tho) {
+void _VecDoubleHadamardProd(VecDouble* const that, 
+  const VecDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3361,28 +8782,60 @@ VecFloat3D _VecFloatGetCrossProd3D(const VecFloat3D* const that,
     sprintf(PBMathErr->_msg, "'tho' is null");
     PBErrCatch(PBMathErr);
   }
+  if (that->_dim != tho->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%ld==%ld)", 
+      that->_dim, tho->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  VecFloat3D res = VecFloatCreateStatic3D();
-  // Calculate
-  VecSet(&res, 0,
-    VecGet(that, 1) * VecGet(tho, 2) - 
-    VecGet(that, 2) * VecGet(tho, 1));
-  VecSet(&res, 1, -1.0 *
-    (VecGet(that, 0) * VecGet(tho, 2) - 
-    VecGet(that, 2) * VecGet(tho, 0)));
-  VecSet(&res, 2, 
-    VecGet(that, 0) * VecGet(tho, 1) - 
-    VecGet(that, 1) * VecGet(tho, 0));
-  // Return the result
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] *= tho->_val[iDim];
+}
+
+// Return a VecDouble equal to the Hadamard product of 'that' and 'tho'
+#if BUILDMODE != 0
+static inline
+#endif 
+VecDouble* _VecDoubleGetHadamardProd(const VecDouble* const that, 
+  const VecDouble* const tho) {
+  VecDouble* res = _VecDoubleClone(that);
+  _VecDoubleHadamardProd(res, tho);
+  return res;
+}
+
+// Calculate (that * a) and store the result in 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecDoubleScale(VecDouble* const that, const double a) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim] *= a;
+}
+
+// Return a VecDouble equal to (that * a)
+#if BUILDMODE != 0
+static inline
+#endif 
+VecDouble* _VecDoubleGetScale(const VecDouble* const that, 
+  const double a) {
+  VecDouble* res = _VecDoubleClone(that);
+  _VecDoubleScale(res, a);
   return res;
 }
 
-// Return the conversion of VecFloat 'that' to a VecShort using round()
+// Return the max value in components of the vector 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecShort* VecFloatToShort(const VecFloat* const that) {
+double _VecDoubleGetMaxVal(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3390,17 +8843,18 @@ VecShort* VecFloatToShort(const VecFloat* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecShort* res = VecShortCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, SHORT(VecGet(that, iDim)));
-  // Return the result
+  double res = that->_val[0];
+  for (long iDim = that->_dim; --iDim;)
+    if (that->_val[iDim] > res)
+      res = that->_val[iDim];
   return res;
 }
+
+// Return the min value in components of the vector 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecShort2D VecFloatToShort2D(const VecFloat2D* const that) {
+double _VecDoubleGetMinVal(const VecDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3408,38 +8862,47 @@ VecShort2D VecFloatToShort2D(const VecFloat2D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecShort2D res = VecShortCreateStatic2D();
-  VecSet(&res, 0, SHORT(VecGet(that, 0)));
-  VecSet(&res, 1, SHORT(VecGet(that, 1)));
-  // Return the result
+  double res = that->_val[0];
+  for (long iDim = that->_dim; --iDim;)
+    if (that->_val[iDim] < res)
+      res = that->_val[iDim];
   return res;
 }
+
+// -------------- MatDouble
+
+// Create a new MatDouble of dimension 'dim' (nbCol, nbLine)
+// Values are initalized to 0.0
 #if BUILDMODE != 0
 static inline
 #endif 
-VecShort3D VecFloatToShort3D(const VecFloat3D* const that) {
+MatDouble* MatDoubleCreate(const VecShort2D* const dim) {
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (dim == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
+    sprintf(PBMathErr->_msg, "'dim' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(dim, 0) <= 0 || VecGet(dim, 1) <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "invalid 'dim' (%d,%d)", 
+      VecGet(dim, 0), VecGet(dim, 1));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecShort3D res = VecShortCreateStatic3D();
-  VecSet(&res, 0, SHORT(VecGet(that, 0)));
-  VecSet(&res, 1, SHORT(VecGet(that, 1)));
-  VecSet(&res, 2, SHORT(VecGet(that, 2)));
-  // Return the result
-  return res;
+  const long nb = (long)(VecGet(dim, 0)) * (long)(VecGet(dim, 1));
+  MatDouble* that = 
+    PBErrMalloc(PBMathErr, sizeof(MatDouble) + sizeof(double) * nb);
+  memcpy((VecShort2D*)&(that->_dim), dim, sizeof(VecShort2D));
+  memset(that->_val, 0, sizeof(double) * nb);
+  return that;
 }
 
-// Return the conversion of VecShort 'that' to a VecFloat
+// Clone the MatDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat* VecShortToFloat(const VecShort* const that) {
+MatDouble* _MatDoubleClone(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3447,17 +8910,17 @@ VecFloat* VecShortToFloat(const VecShort* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecFloat* res = VecFloatCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, (float)VecGet(that, iDim));
-  // Return the result
-  return res;
+  MatDouble* clone = MatDoubleCreate(&(that->_dim));
+  memcpy(clone->_val, that->_val, sizeof(double) * 
+    VecGet(&(that->_dim), 0) * VecGet(&(that->_dim), 1));
+  return clone;
 }
+
+// Create a new MatDouble with the values of the MatFloat 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat2D VecShortToFloat2D(const VecShort2D* const that) {
+MatDouble* MatFloatGetMatDouble(const MatFloat* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3465,17 +8928,19 @@ VecFloat2D VecShortToFloat2D(const VecShort2D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecFloat2D res = VecFloatCreateStatic2D();
-  VecSet(&res, 0, (float)VecGet(that, 0));
-  VecSet(&res, 1, (float)VecGet(that, 1));
-  // Return the result
+  MatDouble* res = MatDoubleCreate(&(that->_dim));
+  for (long i = (long)(VecGet(&(that->_dim), 0)) * 
+    (long)(VecGet(&(that->_dim), 1)); i--;)
+    res->_val[i] = that->_val[i];
   return res;
 }
+
+// Create a new MatFloat with the values of the MatDouble 'that'
+// rounded to float
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat3D VecShortToFloat3D(const VecShort3D* const that) {
+MatFloat* MatDoubleGetMatFloat(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3483,20 +8948,20 @@ VecFloat3D VecShortToFloat3D(const VecShort3D* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecFloat3D res = VecFloatCreateStatic3D();
-  VecSet(&res, 0, (float)VecGet(that, 0));
-  VecSet(&res, 1, (float)VecGet(that, 1));
-  VecSet(&res, 2, (float)VecGet(that, 2));
-  // Return the result
+  MatFloat* res = MatFloatCreate(&(that->_dim));
+  for (long i = (long)(VecGet(&(that->_dim), 0)) * 
+    (long)(VecGet(&(that->_dim), 1)); i--;)
+    res->_val[i] = (float)(that->_val[i]);
   return res;
 }
 
-// Return the conversion of VecLong 'that' to a VecFloat
+// Function which return the JSON encoding of 'that'
+// The values are written with 17 significant digits, which converts
+// back exactly to the value
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat* VecLongToFloat(const VecLong* const that) {
+JSONNode* _MatDoubleEncodeAsJSON(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3504,264 +8969,345 @@ VecFloat* VecLongToFloat(const VecLong* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Create the result
-  VecFloat* res = VecFloatCreate(that->_dim);
-  for (long iDim = that->_dim; iDim--;)
-    VecSet(res, iDim, (float)VecGet(that, iDim));
-  // Return the result
-  return res;
+  JSONNode* json = JSONCreate();
+  char val[32];
+  sprintf(val, "%d", that->_dim._val[0]);
+  JSONAddProp(json, "_nbRow", val);
+  sprintf(val, "%d", that->_dim._val[1]);
+  JSONAddProp(json, "_nbCol", val);
+  JSONAddPropDoubles(json, "_val", that->_val, 
+    (long)(that->_dim._val[0]) * (long)(that->_dim._val[1]));
+  return json;
 }
+
+// Function which decode from JSON encoding 'json' to 'that'
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat2D VecLongToFloat2D(const VecLong2D* const that) {
+bool _MatDoubleDecodeAsJSON(MatDouble** that, 
+  const JSONNode* const json) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (json == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'json' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Create the result
-  VecFloat2D res = VecFloatCreateStatic2D();
-  VecSet(&res, 0, (float)VecGet(that, 0));
-  VecSet(&res, 1, (float)VecGet(that, 1));
-  // Return the result
-  return res;
+  if (*that != NULL)
+    _MatDoubleFree(that);
+  VecShort2D dim = VecShortCreateStatic2D();
+  JSONNode* prop = JSONProperty(json, "_nbRow");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  dim._val[0] = atoi(JSONLblVal(prop));
+  prop = JSONProperty(json, "_nbCol");
+  if (prop == NULL || JSONGetNbValue(prop) != 1)
+    return false;
+  dim._val[1] = atoi(JSONLblVal(prop));
+  if (dim._val[0] <= 0 || dim._val[1] <= 0)
+    return false;
+  prop = JSONProperty(json, "_val");
+  if (prop == NULL)
+    return false;
+  *that = MatDoubleCreate(&dim);
+  if (!JSONGetPropDoubles(prop, (*that)->_val, 
+    (long)(dim._val[0]) * (long)(dim._val[1]))) {
+    _MatDoubleFree(that);
+    return false;
+  }
+  return true;
 }
+
+// Save the MatDouble to the stream
+// If 'compact' equals true it saves in compact form, else it saves in
+// readable form
+// Return true in case of success, else false
 #if BUILDMODE != 0
 static inline
 #endif 
-VecFloat3D VecLongToFloat3D(const VecLong3D* const that) {
+bool _MatDoubleSave(const MatDouble* const that, 
+  FILE* const stream, const bool compact) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Create the result
-  VecFloat3D res = VecFloatCreateStatic3D();
-  VecSet(&res, 0, (float)VecGet(that, 0));
-  VecSet(&res, 1, (float)VecGet(that, 1));
-  VecSet(&res, 2, (float)VecGet(that, 2));
-  // Return the result
-  return res;
+  JSONNode* json = _MatDoubleEncodeAsJSON(that);
+  bool ret = JSONSave(json, stream, compact);
+  JSONFree(&json);
+  return ret;
 }
 
-// Get the max value in components of the vector 'that'
-#if BUILDMODE != 0 
-static inline 
+// Load the MatDouble from the stream
+// If the MatDouble is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
 #endif 
-float _VecFloatGetMaxVal(const VecFloat* const that) {
+bool _MatDoubleLoad(MatDouble** that, FILE* const stream) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  float max = VecGet(that, 0);
-  // Search for the maximum value
-  for (long i = VecGetDim(that); i-- && i != 0;)
-    max = MAX(max, VecGet(that, i));
-  // Return the result
-  return max;
+  JSONDoc* doc = JSONDocLoad(stream);
+  if (doc == NULL)
+    return false;
+  bool ret = _MatDoubleDecodeAsJSON(that, JSONDocRoot(doc));
+  JSONDocFree(&doc);
+  return ret;
 }
 
-// Get the index of the max value in components of the vector 'that'
-#if BUILDMODE != 0 
-static inline 
+// Free the memory used by a MatDouble
+// Do nothing if arguments are invalid
+#if BUILDMODE != 0
+static inline
 #endif 
-long _VecFloatGetIMaxVal(const VecFloat* const that) {
+void _MatDoubleFree(MatDouble** that) {
+  if (that == NULL || *that == NULL)
+    return;
+  free(*that);
+  *that = NULL;
+}
+
+// Print the MatDouble on 'stream' with 'prec' digit precision
+#if BUILDMODE != 0
+static inline
+#endif 
+void MatDoublePrintln(const MatDouble* const that, FILE* const stream, 
+  const unsigned int prec) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (stream == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'stream' is null");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  long iMax = 0;
-  // Declare a variable to memorize the max value
-  float max = VecGet(that, iMax);
-  // Search for the maximum value
-  for (long i = VecGetDim(that); i-- && i != 0;) {
-    if(max < VecGet(that, i)) {
-      max = VecGet(that, i);
-      iMax = i;
+  const long nbCol = VecGet(&(that->_dim), 0);
+  const long nbRow = VecGet(&(that->_dim), 1);
+  fprintf(stream, "[");
+  for (long iRow = 0; iRow < nbRow; ++iRow) {
+    if (iRow > 0)
+      fprintf(stream, "\n ");
+    for (long iCol = 0; iCol < nbCol; ++iCol) {
+      if (iCol > 0)
+        fprintf(stream, ", ");
+      fprintf(stream, "% .*f", (int)prec, that->_val[iRow * nbCol + iCol]);
     }
   }
-  // Return the result
-  return iMax;
+  fprintf(stream, "]\n");
 }
 
-// Get the min value in components of the vector 'that'
-#if BUILDMODE != 0 
-static inline 
+// Return the value at index (col, line) of the MatDouble
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0
+static inline
 #endif 
-float _VecFloatGetMinVal(const VecFloat* const that) {
+double _MatDoubleGet(const MatDouble* const that, 
+  const VecShort2D* const index) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (index == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'index' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(index, 0) < 0 || 
+    VecGet(index, 0) >= VecGet(&(that->_dim), 0) || 
+    VecGet(index, 1) < 0 || 
+    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'index' is invalid (0,0 <= %d,%d < %d,%d)", 
+      VecGet(index, 0), VecGet(index, 1), 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  float min = VecGet(that, 0);
-  // Search for the minimum value
-  for (long i = VecGetDim(that); i-- && i != 0;)
-    min = MIN(min, VecGet(that, i));
-  // Return the result
-  return min;
+  return that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
+    VecGet(index, 0)];
 }
 
-// Get the max value (in absolute value) in components of the 
-// vector 'that'
-#if BUILDMODE != 0 
-static inline 
+// Set the value at index (col, line) of the MatDouble to 'v'
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0
+static inline
 #endif 
-float _VecFloatGetMaxValAbs(const VecFloat* const that) {
+void _MatDoubleSet(MatDouble* const that, const VecShort2D* const index, 
+  const double v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (index == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'index' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(index, 0) < 0 || 
+    VecGet(index, 0) >= VecGet(&(that->_dim), 0) || 
+    VecGet(index, 1) < 0 || 
+    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, 
+      "'index' is invalid (0,0 <= %d,%d < %d,%d)", 
+      VecGet(index, 0), VecGet(index, 1), 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  float max = fabs(VecGet(that, 0));
-  // Search for the maximum value
-  for (long i = VecGetDim(that); i-- && i != 0;)
-    max = (fabs(max) > fabs(VecGet(that, i)) ? max : VecGet(that, i));
-  // Return the result
-  return max;
+  that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
+    VecGet(index, 0)] = v;
 }
 
-// Get the min value (in absolute value) in components of the 
-// vector 'that'
-#if BUILDMODE != 0 
-static inline 
+// Copy the values of 'tho' in 'that' (must have same dimensions)
+#if BUILDMODE != 0
+static inline
 #endif 
-float _VecFloatGetMinValAbs(const VecFloat* const that) {
+void _MatDoubleCopy(MatDouble* const that, const MatDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (!VecIsEqual(&(that->_dim), &(tho->_dim))) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d,%d==%d,%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1), 
+      VecGet(&(tho->_dim), 0), VecGet(&(tho->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Declare a variable to memorize the result
-  float min = fabs(VecGet(that, 0));
-  // Search for the minimum value
-  for (long i = VecGetDim(that); i-- && i != 0;)
-    min = (fabs(min) < fabs(VecGet(that, i)) ? min : VecGet(that, i));
-  // Return the result
-  return min;
+  memcpy(that->_val, tho->_val, sizeof(double) * 
+    VecGet(&(that->_dim), 0) * VecGet(&(that->_dim), 1));
 }
 
-// Set the MatFloat to the identity matrix
-// The matrix must be a square matrix
+// Return the dimension of the MatDouble
 #if BUILDMODE != 0
 static inline
 #endif 
-void _MatFloatSetIdentity(MatFloat* const that) {
+const VecShort2D* _MatDoubleDim(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "the matrix is not square (%dx%d)",
-      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Set the values
-  VecShort2D i = VecShortCreateStatic2D();
-  do {
-    if (VecGet(&i, 0) == VecGet(&i, 1))
-      MatSet(that, &i, 1.0);
-    else
-      MatSet(that, &i, 0.0);
-  } while (VecStep(&i, &(that->_dim)));
+  return &(that->_dim);
 }
 
-// Return the addition of matrix 'that' with matrix 'tho'
-// 'that' and 'tho' must have same dimensions
-#if BUILDMODE != 0 
-static inline 
+// Return a copy of the dimension of the MatDouble
+#if BUILDMODE != 0
+static inline
+#endif 
+VecShort2D _MatDoubleGetDim(const MatDouble* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_dim;
+}
+
+// Return the number of rows of the MatDouble
+#if BUILDMODE != 0
+static inline
 #endif 
-MatFloat* _MatFloatGetAdd(MatFloat* const that, MatFloat* tho) {
+short _MatDoubleGetNbRow(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (VecIsEqual(MatDim(that), MatDim(tho)) == false) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'that' and 'tho' have different dimensions");
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Declare a variable for the result
-  MatFloat* res = MatFloatCreate(MatDim(that));
-  // Add each values
-  VecShort2D i = VecShortCreateStatic2D();
-  do {
-    MatSet(res, &i, MatGet(that, &i) + MatGet(tho, &i));
-  } while (VecStep(&i, MatDim(that)));
-  // Return the result
-  return res;
+  return that->_dim._val[1];
 }
 
-// Add matrix 'that' with matrix 'tho' and store the result in 'that'
-// 'that' and 'tho' must have same dimensions
-#if BUILDMODE != 0 
-static inline 
+// Return the number of columns of the MatDouble
+#if BUILDMODE != 0
+static inline
 #endif 
-void _MatFloatAdd(MatFloat* const that, MatFloat* tho) {
+short _MatDoubleGetNbCol(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
+#endif
+  return that->_dim._val[0];
+}
+
+// Set the MatDouble to the identity matrix
+// The matrix must be a square matrix
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatDoubleSetIdentity(MatDouble* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecIsEqual(MatDim(that), MatDim(tho)) == false) {
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'that' and 'tho' have different dimensions");
+    sprintf(PBMathErr->_msg, "'that' is not square (%dx%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Add each values
-  VecShort2D i = VecShortCreateStatic2D();
-  do {
-    MatSet(that, &i, MatGet(that, &i) + MatGet(tho, &i));
-  } while (VecStep(&i, MatDim(that)));
+  const long dim = VecGet(&(that->_dim), 0);
+  memset(that->_val, 0, sizeof(double) * dim * dim);
+  for (long i = dim; i--;)
+    that->_val[i * dim + i] = 1.0;
 }
 
-// Multiply the matrix 'that' by 'a'
-#if BUILDMODE != 0 
-static inline 
+// Return the transpose of the MatDouble
+#if BUILDMODE != 0
+static inline
 #endif 
-void _MatFloatScale(MatFloat* const that, const float a) {
+MatDouble* _MatDoubleGetTranspose(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3769,182 +9315,316 @@ void _MatFloatScale(MatFloat* const that, const float a) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Multiply each values
-  VecShort2D i = VecShortCreateStatic2D();
-  do {
-    MatSet(that, &i, MatGet(that, &i) * a);
-  } while (VecStep(&i, MatDim(that)));
+  const long nbCol = VecGet(&(that->_dim), 0);
+  const long nbRow = VecGet(&(that->_dim), 1);
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(&dim, 0, nbRow);
+  VecSet(&dim, 1, nbCol);
+  MatDouble* res = MatDoubleCreate(&dim);
+  for (long iRow = nbRow; iRow--;)
+    for (long iCol = nbCol; iCol--;)
+      res->_val[iCol * nbRow + iRow] = that->_val[iRow * nbCol + iCol];
+  return res;
 }
 
-// Copy the values of 'w' in 'that' (must have same dimensions)
+// Multiply the MatDouble 'that' by 'a'
 #if BUILDMODE != 0
 static inline
 #endif 
-void _MatFloatCopy(MatFloat* const that, const MatFloat* const tho) {
+void _MatDoubleScale(MatDouble* const that, const double a) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (tho == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'tho' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (!VecIsEqual(&(that->_dim), &(tho->_dim))) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'that' and 'tho' have different dimensions (%dx%d==%dx%d)",
-      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1), 
-      VecGet(&(tho->_dim), 0), VecGet(&(tho->_dim), 1));
-    PBErrCatch(PBMathErr);
-  }
 #endif
-  // Copy the matrix values
-  int d = VecGet(&(that->_dim), 0) * VecGet(&(that->_dim), 1);
-  memcpy(that->_val, tho->_val, d * sizeof(float));
+  for (long i = (long)(VecGet(&(that->_dim), 0)) * 
+    (long)(VecGet(&(that->_dim), 1)); i--;)
+    that->_val[i] *= a;
 }
 
-// Return the value at index 'i' (col, line) of the MatFloat
-// Index starts at 0, index in matrix = line * nbCol + col
+// Return true if 'that' is equal to 'tho', false else
 #if BUILDMODE != 0
 static inline
 #endif 
-float _MatFloatGet(const MatFloat* const that, 
-  VecShort2D* index) {
+bool _MatDoubleIsEqual(const MatDouble* const that, 
+  const MatDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (index == NULL) {
+  if (tho == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'index' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (VecGet(index, 0) < 0 || 
-    VecGet(index, 0) >= VecGet(&(that->_dim), 0) ||
-    VecGet(index, 1) < 0 || 
-    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, 
-      "'index' is invalid (0,0 <= %d,%d < %d,%d)",
-      VecGet(index, 0), VecGet(index, 1), 
-      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    sprintf(PBMathErr->_msg, "'tho' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the value
-  return that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
-    VecGet(index, 0)];
+  if (!VecIsEqual(&(that->_dim), &(tho->_dim)))
+    return false;
+  for (long i = (long)(VecGet(&(that->_dim), 0)) * 
+    (long)(VecGet(&(that->_dim), 1)); i--;)
+    if (!ISEQUALF(that->_val[i], tho->_val[i]))
+      return false;
+  return true;
 }
 
-// Set the value at index 'i' (col, line) of the MatFloat to 'v'
-// Index starts at 0, index in matrix = line * nbCol + col
+// Return the product of the MatDouble 'that' by the VecDouble 'v'
+// Number of columns of 'that' must equal dimension of 'v'
 #if BUILDMODE != 0
 static inline
 #endif 
-void _MatFloatSet(MatFloat* const that, VecShort2D* index, float v) {
+VecDouble* _MatDoubleGetProdVecDouble(const MatDouble* const that, 
+  const VecDouble* const v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (index == NULL) {
+  if (v == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'index' is null");
+    sprintf(PBMathErr->_msg, "'v' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGet(index, 0) < 0 || 
-    VecGet(index, 0) >= VecGet(&(that->_dim), 0) ||
-    VecGet(index, 1) < 0 || 
-    VecGet(index, 1) >= VecGet(&(that->_dim), 1)) {
+  if (VecGet(&(that->_dim), 0) != v->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
     sprintf(PBMathErr->_msg, 
-      "'index' is invalid (0,0 <= %d,%d < %d,%d)",
-      VecGet(index, 0), VecGet(index, 1), 
-      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+      "'v' 's dimension is invalid (%ld!=%d)", 
+      v->_dim, VecGet(&(that->_dim), 0));
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Set the value
-  that->_val[VecGet(index, 1) * VecGet(&(that->_dim), 0) + 
-    VecGet(index, 0)] = v;
+  const long nbCol = VecGet(&(that->_dim), 0);
+  const long nbRow = VecGet(&(that->_dim), 1);
+  VecDouble* res = VecDoubleCreate(nbRow);
+  for (long iRow = nbRow; iRow--;) {
+    const double* const row = that->_val + iRow * nbCol;
+    double sum = 0.0;
+    for (long iCol = 0; iCol < nbCol; ++iCol)
+      sum += row[iCol] * v->_val[iCol];
+    res->_val[iRow] = sum;
+  }
+  return res;
 }
 
-// Return the dimension of the MatFloat
+// Return the product of the MatDouble 'that' by the MatDouble 'tho'
+// Number of columns of 'that' must equal number of lines of 'tho'
 #if BUILDMODE != 0
 static inline
 #endif 
-const VecShort2D* _MatFloatDim(const MatFloat* const that) {
+MatDouble* _MatDoubleGetProdMatDouble(const MatDouble* const that, 
+  const MatDouble* const tho) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-#endif
-  // Return the dimension
-  return &(that->_dim);
+  if (tho == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'tho' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(tho->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "dimensions don't match (%d==%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(tho->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const long nbInner = VecGet(&(that->_dim), 0);
+  const long nbRow = VecGet(&(that->_dim), 1);
+  const long nbCol = VecGet(&(tho->_dim), 0);
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(&dim, 0, nbCol);
+  VecSet(&dim, 1, nbRow);
+  MatDouble* res = MatDoubleCreate(&dim);
+  // The rows of 'tho' are accumulated in the row of the result, which
+  // keeps the inner loop contiguous
+  for (long iRow = 0; iRow < nbRow; ++iRow) {
+    double* const rowRes = res->_val + iRow * nbCol;
+    for (long k = 0; k < nbInner; ++k) {
+      const double a = that->_val[iRow * nbInner + k];
+      const double* const rowTho = tho->_val + k * nbCol;
+      for (long iCol = 0; iCol < nbCol; ++iCol)
+        rowRes[iCol] += a * rowTho[iCol];
+    }
+  }
+  return res;
 }
 
-// Return a VecShort2D containing the dimension of the MatFloat
+// Return the inverse matrix of 'that', calculated with a LU
+// decomposition with partial pivoting
+// Return NULL if the matrix is singular
 #if BUILDMODE != 0
 static inline
 #endif 
-VecShort2D _MatFloatGetDim(const MatFloat* const that) {
+MatDouble* _MatDoubleGetInv(const MatDouble* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (VecGet(&(that->_dim), 0) != VecGet(&(that->_dim), 1)) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'that' is not square (%dx%d)", 
+      VecGet(&(that->_dim), 0), VecGet(&(that->_dim), 1));
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  // Return the dimension
-  return that->_dim;
+  const long dim = VecGet(&(that->_dim), 0);
+  MatDouble* lu = _MatDoubleClone(that);
+  double* const a = lu->_val;
+  long* perm = PBErrMalloc(PBMathErr, sizeof(long) * dim);
+  // Pivots smaller than this relatively to the biggest value are
+  // considered null
+  double scale = 0.0;
+  for (long i = dim * dim; i--;)
+    if (fabs(a[i]) > scale)
+      scale = fabs(a[i]);
+  scale *= DBL_EPSILON;
+  for (long i = dim; i--;)
+    perm[i] = i;
+  for (long k = 0; k < dim; ++k) {
+    // Search the pivot and swap its row with the current one
+    long iPivot = k;
+    for (long i = k + 1; i < dim; ++i)
+      if (fabs(a[i * dim + k]) > fabs(a[iPivot * dim + k]))
+        iPivot = i;
+    if (fabs(a[iPivot * dim + k]) <= scale) {
+      free(perm);
+      _MatDoubleFree(&lu);
+      return NULL;
+    }
+    if (iPivot != k) {
+      for (long j = dim; j--;) {
+        const double x = a[k * dim + j];
+        a[k * dim + j] = a[iPivot * dim + j];
+        a[iPivot * dim + j] = x;
+      }
+      const long x = perm[k];
+      perm[k] = perm[iPivot];
+      perm[iPivot] = x;
+    }
+    // Eliminate the values below the pivot
+    const double* const rowPivot = a + k * dim;
+    for (long i = k + 1; i < dim; ++i) {
+      double* const row = a + i * dim;
+      row[k] /= rowPivot[k];
+      for (long j = k + 1; j < dim; ++j)
+        row[j] -= row[k] * rowPivot[j];
+    }
+  }
+  // Solve L.U.x = P.e_j for each column of the identity
+  MatDouble* res = MatDoubleCreate(&(that->_dim));
+  double* x = PBErrMalloc(PBMathErr, sizeof(double) * dim);
+  for (long j = 0; j < dim; ++j) {
+    for (long i = 0; i < dim; ++i) {
+      double sum = (perm[i] == j ? 1.0 : 0.0);
+      for (long k = 0; k < i; ++k)
+        sum -= a[i * dim + k] * x[k];
+      x[i] = sum;
+    }
+    for (long i = dim; i--;) {
+      double sum = x[i];
+      for (long k = i + 1; k < dim; ++k)
+        sum -= a[i * dim + k] * x[k];
+      x[i] = sum / a[i * dim + i];
+    }
+    for (long i = dim; i--;)
+      res->_val[i * dim + j] = x[i];
+  }
+  free(x);
+  free(perm);
+  _MatDoubleFree(&lu);
+  return res;
 }
 
-// Return the number of rows of the MatFloat 'that'
+// -------------- VecFloatBatch
+
+// Create a new VecFloatBatch of 'nb' vectors of dimension 'dim'
+// Values are initalized to 0.0
 #if BUILDMODE != 0 
 static inline 
 #endif 
-short _MatFloatGetNbRow(const MatFloat* const that) {
+VecFloatBatch* VecFloatBatchCreate(const long nb, const long dim) {
 #if BUILDMODE == 0
-  if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
+  if (nb <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'nb' is invalid (%ld>0)", nb);
+    PBErrCatch(PBMathErr);
+  }
+  if (dim <= 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'dim' is invalid (%ld>0)", dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the nb of rows
-  return VecGet(&(that->_dim), 1);
+  VecFloatBatch* that = PBErrMalloc(PBMathErr, sizeof(VecFloatBatch));
+  that->_nb = nb;
+  that->_dim = dim;
+  that->_stride = (nb + PBMATH_BATCHALIGN - 1) / PBMATH_BATCHALIGN * 
+    PBMATH_BATCHALIGN;
+  const size_t align = sizeof(float) * PBMATH_BATCHALIGN;
+  const size_t size = sizeof(float) * that->_stride * dim;
+  that->_mem = PBErrMalloc(PBMathErr, size + align);
+  that->_val = (float*)(((uintptr_t)(that->_mem) + align - 1) & 
+    ~((uintptr_t)align - 1));
+  memset(that->_val, 0, size);
+  return that;
 }
 
-// Return the number of columns of the MatFloat 'that'
+// Create a new VecFloatBatch with the values of the vectors in the 
+// GSetVecFloat 'set', in the same order
+// The set must have at least one element and all its vectors must have
+// the same dimension
 #if BUILDMODE != 0 
 static inline 
 #endif 
-short _MatFloatGetNbCol(const MatFloat* const that) {
+VecFloatBatch* VecFloatBatchCreateFromGSet(const GSetVecFloat* const set) {
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (set == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
+    sprintf(PBMathErr->_msg, "'set' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (GSetNbElem(set) == 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'set' is empty");
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Return the nb of cols
-  return VecGet(&(that->_dim), 0);
-  
+  const long dim = VecGetDim((VecFloat*)GSetHead(set));
+  VecFloatBatch* that = VecFloatBatchCreate(GSetNbElem(set), dim);
+  const GSetElem* elem = GSetHeadElem(set);
+  for (long iVec = 0; elem != NULL; ++iVec) {
+    VecFloatBatchSetVec(that, iVec, (VecFloat*)GSetElemData(elem));
+    elem = GSetElemNext(elem);
+  }
+  return that;
 }
 
-// Return the value of the Gauss 'that' at 'x'
-#if BUILDMODE != 0
-static inline
+// Free the memory used by the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float GaussGet(const Gauss* const that, const float x) {
+void VecFloatBatchFree(VecFloatBatch** const that) {
+  if (that == NULL || *that == NULL) return;
+  free((*that)->_mem);
+  free(*that);
+  *that = NULL;
+}
+
+// Return a GSetVecFloat of new VecFloat with the values of the vectors
+// of the VecFloatBatch 'that', in the same order
+#if BUILDMODE != 0 
+static inline 
+#endif 
+GSetVecFloat VecFloatBatchGetGSet(const VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -3952,82 +9632,60 @@ float GaussGet(const Gauss* const that, const float x) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Calculate the value
-  float a = 1.0 / (that->_sigma * sqrt(2.0 * PBMATH_PI));
-  float ret = a * exp(-1.0 * fsquare(x - that->_mean) / 
-    (2.0 * fsquare(that->_sigma)));
-  // Return the value
-  return ret;
+  GSetVecFloat set = GSetVecFloatCreateStatic();
+  for (long iVec = 0; iVec < that->_nb; ++iVec)
+    GSetAppend(&set, VecFloatBatchGetVec(that, iVec));
+  return set;
 }
 
-// Return a random value (in ]0.0, 1.0[)according to the 
-// Gauss distribution 'that'
-// random() must have been called before calling this function
-#if BUILDMODE != 0
-static inline
+// Copy the values of the vectors of the VecFloatBatch 'that' into the 
+// vectors of the GSetVecFloat 'set', in the same order
+// 'set' must have as many vectors as 'that', of same dimension
+#if BUILDMODE != 0 
+static inline 
 #endif 
-float GaussRnd(Gauss* const that) {
+void VecFloatBatchCopyToGSet(const VecFloatBatch* const that, 
+  GSetVecFloat* const set) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-#endif
-  // Declare variable for calcul
-  float v1,v2,s;
-  // Calculate the value
-  do {
-    v1 = (rnd() - 0.5) * 2.0;
-    v2 = (rnd() - 0.5) * 2.0;
-    s = v1 * v1 + v2 * v2;
-  } while (s >= 1.0);
-  // Return the value
-  float ret = 0.0;
-  if (s > PBMATH_EPSILON)
-    ret = v1 * sqrt(-2.0 * log(s) / s);
-  return ret * that->_sigma + that->_mean;
-}
-
-// Return the order 1 smooth value of 'x'
-// if x < 0.0 return 0.0
-// if x > 1.0 return 1.0
-#if BUILDMODE != 0
-static inline
-#endif 
-float SmoothStep(const float x) {
-  if (x > 0.0)
-    if (x < 1.0)
-      return x * x * (3.0 - 2.0 * x);
-    else
-      return 1.0;
-  else
-    return 0.0;
-}
-
-// Return the order 2 smooth value of 'x'
-// if x < 0.0 return 0.0
-// if x > 1.0 return 1.0
-#if BUILDMODE != 0
-static inline
-#endif 
-float SmootherStep(const float x) {
-  if (x > 0.0)
-    if (x < 1.0)
-    return x * x * x * (x * (x * 6.0 - 15.0) + 10.0);
-    else
-      return 1.0;
-  else
-    return 0.0;
+  if (set == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'set' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (GSetNbElem(set) != that->_nb) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'set' has invalid size (%ld==%ld)", 
+      GSetNbElem(set), that->_nb);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  const GSetElem* elem = GSetHeadElem(set);
+  for (long iVec = 0; elem != NULL; ++iVec) {
+    VecFloat* v = (VecFloat*)GSetElemData(elem);
+#if BUILDMODE == 0
+    if (VecGetDim(v) != that->_dim) {
+      PBMathErr->_type = PBErrTypeInvalidArg;
+      sprintf(PBMathErr->_msg, "vector %ld has invalid dim (%ld==%ld)", 
+        iVec, VecGetDim(v), that->_dim);
+      PBErrCatch(PBMathErr);
+    }
+#endif
+    for (long iDim = that->_dim; iDim--;)
+      v->_val[iDim] = that->_val[iDim * that->_stride + iVec];
+    elem = GSetElemNext(elem);
+  }
 }
 
-// Solve the SysLinEq _M.x = _V
-// Return the solution vector, or null if there is no solution or the 
-// arguments are invalid
-#if BUILDMODE != 0
-static inline
+// Return the number of vectors of the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-VecFloat* SysLinEqSolve(const SysLinEq* const that) {
+long VecFloatBatchGetNb(const VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -4035,223 +9693,275 @@ VecFloat* SysLinEqSolve(const SysLinEq* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Declare a variable to memorize the solution
-  VecFloat* ret = NULL;
-  // Calculate the solution
-  ret = MatGetProdVec(that->_Minv, that->_V);
-  // Return the solution vector
-  return ret;
+  return that->_nb;
 }
 
-// Set the matrix of the SysLinEq to a copy of 'm'
-// 'm' must have same dimensions has the current matrix
-// Do nothing if arguments are invalid
-#if BUILDMODE != 0
-static inline
+// Return the dimension of the vectors of the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void SysLinEqSetM(SysLinEq* const that, const MatFloat* const m) {
+long VecFloatBatchGetDim(const VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (m == NULL) {
+#endif
+  return that->_dim;
+}
+
+// Return the 'iDim'-th component of the 'iVec'-th vector of the 
+// VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float VecFloatBatchGet(const VecFloatBatch* const that, 
+  const long iVec, const long iDim) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'m' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (!VecIsEqual(&(m->_dim), &(that->_M->_dim))) {
+  if (iVec < 0 || iVec >= that->_nb) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'m' has invalid dimension (%dx%d==%dx%d)",
-      VecGet(&(m->_dim), 0), VecGet(&(m->_dim), 1), 
-      VecGet(&(that->_M->_dim), 0), VecGet(&(that->_M->_dim), 1));
+    sprintf(PBMathErr->_msg, "'iVec' is invalid (0<=%ld<%ld)", 
+      iVec, that->_nb);
     PBErrCatch(PBMathErr);
   }
-#endif
-  // Update the matrix values
-  MatCopy(that->_M, m);
-  // Update the inverse matrix
-  MatFree(&(that->_Minv));
-  that->_Minv = MatGetInv(that->_M);
-#if BUILDMODE == 0
-  if (that->_Minv == NULL) {
-    PBMathErr->_type = PBErrTypeOther;
-    sprintf(PBMathErr->_msg, "couldn't inverse the matrix");
+  if (iDim < 0 || iDim >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iDim' is invalid (0<=%ld<%ld)", 
+      iDim, that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
+  return that->_val[iDim * that->_stride + iVec];
 }
 
-// Set the vector of the SysLinEq to a copy of 'v'
-// 'v' must have same dimensions has the current vector
-// Do nothing if arguments are invalid
-#if BUILDMODE != 0
-static inline
+// Set the 'iDim'-th component of the 'iVec'-th vector of the 
+// VecFloatBatch 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _SLESetV(SysLinEq* const that, const VecFloat* const v) {
+void VecFloatBatchSet(VecFloatBatch* const that, 
+  const long iVec, const long iDim, const float v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (v == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'v' is null");
+  if (iVec < 0 || iVec >= that->_nb) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iVec' is invalid (0<=%ld<%ld)", 
+      iVec, that->_nb);
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(v) != VecGetDim(that->_V)) {
+  if (iDim < 0 || iDim >= that->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'v' has invalid dimension (%ld==%ld)",
-      VecGetDim(v), VecGetDim(that->_V));
+    sprintf(PBMathErr->_msg, "'iDim' is invalid (0<=%ld<%ld)", 
+      iDim, that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  // Update the vector values
-  VecCopy(that->_V, v);
+  that->_val[iDim * that->_stride + iVec] = v;
 }
 
-// Return x^y when x and y are int
-// to avoid numerical imprecision from (pow(double,double)
-// From https://stackoverflow.com/questions/29787310/
-// does-pow-work-for-int-data-type-in-c
-#if BUILDMODE != 0
-static inline
+// Return the array of the 'iDim'-th components of all the vectors of 
+// the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-int powi(const int base, const int exp) {
-  // Declare a variable to memorize the result and init to 1
-  int res = 1;
-  // Loop on exponent
-  int e = exp;
-  int b = base;
-  while (e) {
-    // Do some magic trick
-    if (e & 1)
-      res *= b;
-    e /= 2;
-    b *= b;
+const float* VecFloatBatchComp(const VecFloatBatch* const that, 
+  const long iDim) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
   }
-  // Return the result
-  return res;
+  if (iDim < 0 || iDim >= that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iDim' is invalid (0<=%ld<%ld)", 
+      iDim, that->_dim);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  return that->_val + iDim * that->_stride;
 }
 
-// Rotate right-hand 'that' by 'theta' radians around 'axis' and 
-// store the result in 'that'
-// 'axis' must be normalized
-// https://en.wikipedia.org/wiki/Rotation_matrix
-#if BUILDMODE != 0
-static inline
+// Return a new VecFloat with the values of the 'iVec'-th vector of the
+// VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatRotAxis(VecFloat3D* const that, 
-  const VecFloat3D* const axis, const float theta) {
+VecFloat* VecFloatBatchGetVec(const VecFloatBatch* const that, 
+  const long iVec) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (axis == NULL) {
+  if (iVec < 0 || iVec >= that->_nb) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'iVec' is invalid (0<=%ld<%ld)", 
+      iVec, that->_nb);
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  VecFloat* v = VecFloatCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;)
+    v->_val[iDim] = that->_val[iDim * that->_stride + iVec];
+  return v;
+}
+
+// Set the values of the 'iVec'-th vector of the VecFloatBatch 'that' 
+// to the values of the VecFloat 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchSetVec(VecFloatBatch* const that, const long iVec, 
+  const VecFloat* const v) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'axis' is null");
+    sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
-      VecGetDim(that));
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(axis) != 3) {
+  if (iVec < 0 || iVec >= that->_nb) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'axis' 's dimension is invalid (%ld==3)",
-      VecGetDim(axis));
+    sprintf(PBMathErr->_msg, "'iVec' is invalid (0<=%ld<%ld)", 
+      iVec, that->_nb);
     PBErrCatch(PBMathErr);
   }
-  if (ISEQUALF(VecNorm(axis), 1.0) == false) {
+  if (VecGetDim(v) != that->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'axis' is not normalized");
+    sprintf(PBMathErr->_msg, "'v' has invalid dim (%ld==%ld)", 
+      VecGetDim(v), that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D v = _VecFloatGetRotAxis(that, axis, theta);
-  VecCopy(that, &v);
+  for (long iDim = that->_dim; iDim--;)
+    that->_val[iDim * that->_stride + iVec] = v->_val[iDim];
 }
 
-// Rotate right-hand 'that' by 'theta' radians around X and 
-// store the result in 'that'
-#if BUILDMODE != 0
-static inline
+// Calculate the euclidean distance between each vector of the 
+// VecFloatBatch 'that' and the VecFloat 'v', and store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatRotX(VecFloat3D* const that, const float theta) {
+void VecFloatBatchDist(const VecFloatBatch* const that, 
+  const VecFloat* const v, float* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 3) {
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(v) != that->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
-      VecGetDim(that));
+    sprintf(PBMathErr->_msg, "'v' has invalid dim (%ld==%ld)", 
+      VecGetDim(v), that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D v = _VecFloatGetRotX(that, theta);
-  VecCopy(that, &v);
+  memset(res, 0, sizeof(float) * that->_nb);
+  for (long iDim = 0; iDim < that->_dim; ++iDim)
+    VecFloatKernelAddSqDiff(that->_val + iDim * that->_stride, 
+      v->_val[iDim], res, that->_nb);
+  for (long iVec = that->_nb; iVec--;)
+    res[iVec] = sqrtf(res[iVec]);
 }
 
-// Rotate right-hand 'that' by 'theta' radians around Y and 
-// store the result in 'that'
-#if BUILDMODE != 0
-static inline
+// Calculate the dot product between each vector of the VecFloatBatch
+// 'that' and the VecFloat 'v', and store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatRotY(VecFloat3D* const that, const float theta) {
+void VecFloatBatchDotProd(const VecFloatBatch* const that, 
+  const VecFloat* const v, float* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 3) {
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(v) != that->_dim) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
-      VecGetDim(that));
+    sprintf(PBMathErr->_msg, "'v' has invalid dim (%ld==%ld)", 
+      VecGetDim(v), that->_dim);
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D v = _VecFloatGetRotY(that, theta);
-  VecCopy(that, &v);
+  VecFloatKernelScale(that->_val, v->_val[0], res, that->_nb);
+  for (long iDim = 1; iDim < that->_dim; ++iDim)
+    VecFloatKernelOp(res, 1.0, that->_val + iDim * that->_stride, 
+      v->_val[iDim], res, that->_nb);
 }
 
-// Rotate right-hand 'that' by 'theta' radians around Z and 
-// store the result in 'that'
-#if BUILDMODE != 0
-static inline
+// Calculate the norm of each vector of the VecFloatBatch 'that' and 
+// store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
 #endif 
-void _VecFloatRotZ(VecFloat3D* const that, const float theta) {
+void VecFloatBatchNorm(const VecFloatBatch* const that, 
+  float* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (VecGetDim(that) != 3) {
-    PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'that' 's dimension is invalid (%ld==3)",
-      VecGetDim(that));
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
     PBErrCatch(PBMathErr);
   }
 #endif
-  VecFloat3D v = _VecFloatGetRotZ(that, theta);
-  VecCopy(that, &v);
+  memset(res, 0, sizeof(float) * that->_nb);
+  for (long iDim = 0; iDim < that->_dim; ++iDim)
+    VecFloatKernelAddSqDiff(that->_val + iDim * that->_stride, 0.0, 
+      res, that->_nb);
+  for (long iVec = that->_nb; iVec--;)
+    res[iVec] = sqrtf(res[iVec]);
 }
 
-// Free memory used by the QRDecomp 'that'
+// Normalise each vector of the VecFloatBatch 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void QRDecompFreeStatic(QRDecomp* const that) {
+void VecFloatBatchNormalise(VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -4259,15 +9969,23 @@ void QRDecompFreeStatic(QRDecomp* const that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  MatFree(&(that->_Q)); 
-  MatFree(&(that->_R));
+  float* inv = PBErrMalloc(PBMathErr, sizeof(float) * that->_nb);
+  VecFloatBatchNorm(that, inv);
+  for (long iVec = that->_nb; iVec--;)
+    inv[iVec] = 1.0 / inv[iVec];
+  for (long iDim = that->_dim; iDim--;) {
+    float* const comp = that->_val + iDim * that->_stride;
+    VecFloatKernelHadamard(comp, inv, comp, that->_nb);
+  }
+  free(inv);
 }
 
-// Get the base of the Ratio 'that'
+// Return the mean of the vectors of the VecFloatBatch 'that'
+// The sums are accumulated in double precision
 #if BUILDMODE != 0 
 static inline 
 #endif 
-long RatioGetBase(const Ratio* that) {
+VecFloat* VecFloatBatchGetMean(const VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -4275,14 +9993,22 @@ long RatioGetBase(const Ratio* that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_base;
+  VecFloat* mean = VecFloatCreate(that->_dim);
+  for (long iDim = that->_dim; iDim--;) {
+    const float* const comp = that->_val + iDim * that->_stride;
+    double sum = 0.0;
+    for (long iVec = that->_nb; iVec--;)
+      sum += comp[iVec];
+    mean->_val[iDim] = sum / (double)(that->_nb);
+  }
+  return mean;
 }
 
-// Get the numerator of the Ratio 'that'
+// Center the vectors of the VecFloatBatch 'that' on their mean
 #if BUILDMODE != 0 
 static inline 
 #endif 
-unsigned int RatioGetNumerator(const Ratio* that) {
+void VecFloatBatchMeanCenter(VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -4290,14 +10016,24 @@ unsigned int RatioGetNumerator(const Ratio* that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_numerator;
+  VecFloat* mean = VecFloatBatchGetMean(that);
+  for (long iDim = that->_dim; iDim--;) {
+    float* const comp = that->_val + iDim * that->_stride;
+    const float m = mean->_val[iDim];
+    for (long iVec = that->_nb; iVec--;)
+      comp[iVec] -= m;
+  }
+  VecFree(&mean);
 }
 
-// Get the denominator of the Ratio 'that'
+// Return the covariance matrix of the vectors of the VecFloatBatch 
+// 'that' (divided by the number of vectors)
+// The products are accumulated in double precision
 #if BUILDMODE != 0 
 static inline 
 #endif 
-unsigned int  RatioGetDenominator(const Ratio* that) {
+MatFloat* VecFloatBatchGetCovarianceMatrix(
+  const VecFloatBatch* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
@@ -4305,57 +10041,184 @@ unsigned int  RatioGetDenominator(const Ratio* that) {
     PBErrCatch(PBMathErr);
   }
 #endif
-  return that->_denominator;
+  // Work on a centered copy of the components
+  VecFloatBatch* centered = VecFloatBatchCreate(that->_nb, that->_dim);
+  memcpy(centered->_val, that->_val, 
+    sizeof(float) * that->_stride * that->_dim);
+  VecFloatBatchMeanCenter(centered);
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(&dim, 0, that->_dim);
+  VecSet(&dim, 1, that->_dim);
+  MatFloat* cov = MatFloatCreate(&dim);
+  for (long iDim = 0; iDim < that->_dim; ++iDim) {
+    const float* const a = centered->_val + iDim * centered->_stride;
+    for (long jDim = iDim; jDim < that->_dim; ++jDim) {
+      const float* const b = centered->_val + jDim * centered->_stride;
+      const float c = 
+        VecFloatKernelDotDouble(a, b, that->_nb) / (double)(that->_nb);
+      cov->_val[iDim * that->_dim + jDim] = c;
+      cov->_val[jDim * that->_dim + iDim] = c;
+    }
+  }
+  VecFloatBatchFree(&centered);
+  return cov;
 }
 
-// Set the base of the Ratio 'that' to 'v'
+// Return the index of the vector of the VecFloatBatch 'that' nearest 
+// (in term of euclidean distance) to the VecFloat 'v'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void RatioSetBase(Ratio* that, long v) {
+long VecFloatBatchGetNearest(const VecFloatBatch* const that, 
+  const VecFloat* const v) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (v == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'v' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (VecGetDim(v) != that->_dim) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'v' has invalid dim (%ld==%ld)", 
+      VecGetDim(v), that->_dim);
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  that->_base = v;
+  // Compare the squared distances, no need for the square root
+  float* dist = PBErrMalloc(PBMathErr, sizeof(float) * that->_nb);
+  memset(dist, 0, sizeof(float) * that->_nb);
+  for (long iDim = 0; iDim < that->_dim; ++iDim)
+    VecFloatKernelAddSqDiff(that->_val + iDim * that->_stride, 
+      v->_val[iDim], dist, that->_nb);
+  long iNearest = 0;
+  for (long iVec = 1; iVec < that->_nb; ++iVec)
+    if (dist[iVec] < dist[iNearest])
+      iNearest = iVec;
+  free(dist);
+  return iNearest;
 }
 
-// Set the numerator of the Ratio 'that' to 'v'
+// For each vector of the VecFloatBatch 'that', store in 'res' the 
+// index of the nearest (in term of euclidean distance) vector in the
+// GSetVecFloat 'targets'
+// 'res' must be an array of at least that->_nb longs
+// Return the sum of the squared distances to the nearest targets
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void RatioSetNumerator(Ratio* that, unsigned int v) {
+double VecFloatBatchGetIdNearest(const VecFloatBatch* const that, 
+  const GSetVecFloat* const targets, long* const res) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
+  if (targets == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'targets' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (res == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'res' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (GSetNbElem(targets) == 0) {
+    PBMathErr->_type = PBErrTypeInvalidArg;
+    sprintf(PBMathErr->_msg, "'targets' is empty");
+    PBErrCatch(PBMathErr);
+  }
 #endif
-  that->_numerator = v;
+  // The squared distances to each target are calculated for all the 
+  // vectors at once, and the nearest target is updated along
+  float* dist = PBErrMalloc(PBMathErr, sizeof(float) * that->_nb);
+  float* best = PBErrMalloc(PBMathErr, sizeof(float) * that->_nb);
+  const GSetElem* elem = GSetHeadElem(targets);
+  for (long iTarget = 0; elem != NULL; ++iTarget) {
+    const VecFloat* const target = (const VecFloat*)GSetElemData(elem);
+#if BUILDMODE == 0
+    if (VecGetDim(target) != that->_dim) {
+      PBMathErr->_type = PBErrTypeInvalidArg;
+      sprintf(PBMathErr->_msg, "target %ld has invalid dim (%ld==%ld)", 
+        iTarget, VecGetDim(target), that->_dim);
+      PBErrCatch(PBMathErr);
+    }
+#endif
+    float* const acc = (iTarget == 0 ? best : dist);
+    memset(acc, 0, sizeof(float) * that->_nb);
+    for (long iDim = 0; iDim < that->_dim; ++iDim)
+      VecFloatKernelAddSqDiff(that->_val + iDim * that->_stride, 
+        target->_val[iDim], acc, that->_nb);
+    if (iTarget == 0) {
+      for (long iVec = that->_nb; iVec--;)
+        res[iVec] = 0;
+    } else {
+      for (long iVec = that->_nb; iVec--;) {
+        if (dist[iVec] < best[iVec]) {
+          best[iVec] = dist[iVec];
+          res[iVec] = iTarget;
+        }
+      }
+    }
+    elem = GSetElemNext(elem);
+  }
+  double sum = 0.0;
+  for (long iVec = that->_nb; iVec--;)
+    sum += best[iVec];
+  free(dist);
+  free(best);
+  return sum;
 }
 
-// Set the denominator of the Ratio 'that' to 'v'
+// Return a new VecFloatBatch of the projections of the vectors of the
+// VecFloatBatch 'that' on the first 'nb' vectors of the GSetVecFloat 
+// 'axes', ie the 'i'-th component of a returned vector is the dot 
+// product of the original vector with the 'i'-th axis
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void RatioSetDenominator(Ratio* that, unsigned int v) {
+VecFloatBatch* VecFloatBatchGetProj(const VecFloatBatch* const that, 
+  const GSetVecFloat* const axes, const long nb) {
 #if BUILDMODE == 0
   if (that == NULL) {
     PBMathErr->_type = PBErrTypeNullPointer;
     sprintf(PBMathErr->_msg, "'that' is null");
     PBErrCatch(PBMathErr);
   }
-  if (v == 0) {
+  if (axes == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'axes' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (nb <= 0 || nb > GSetNbElem(axes)) {
     PBMathErr->_type = PBErrTypeInvalidArg;
-    sprintf(PBMathErr->_msg, "'v' is invalid (%u > 0)", v);
+    sprintf(PBMathErr->_msg, "'nb' is invalid (0<%ld<=%ld)", 
+      nb, GSetNbElem(axes));
     PBErrCatch(PBMathErr);
   }
 #endif
-  that->_denominator = v;
+  VecFloatBatch* proj = VecFloatBatchCreate(that->_nb, nb);
+  const GSetElem* elem = GSetHeadElem(axes);
+  for (long iAxis = 0; iAxis < nb; ++iAxis) {
+    const VecFloat* const axis = (const VecFloat*)GSetElemData(elem);
+#if BUILDMODE == 0
+    if (VecGetDim(axis) != that->_dim) {
+      PBMathErr->_type = PBErrTypeInvalidArg;
+      sprintf(PBMathErr->_msg, "axis %ld has invalid dim (%ld==%ld)", 
+        iAxis, VecGetDim(axis), that->_dim);
+      PBErrCatch(PBMathErr);
+    }
+#endif
+    VecFloatBatchDotProd(that, axis, proj->_val + iAxis * proj->_stride);
+    elem = GSetElemNext(elem);
+  }
+  return proj;
 }
 
 // -------------- LeastSquareLinReg
@@ -4383,13 +10246,33 @@ void LSLRSetComp(LeastSquareLinReg* that, const MatFloat* X) {
   }
   MatFloat* transp = MatGetTranspose(that->X);
   MatFloat* A = MatGetProdMat(transp, that->X);
-  MatFloat* inv = MatGetInv(A);
-  if (inv != NULL) {
-    that->Xp = MatGetProdMat(inv, transp);
+  // A is symmetric positive definite if X has full rank, then 
+  // Xp = A^-1.X' is calculated column by column with its Cholesky 
+  // decomposition, else fall back on the inverse
+  MatFloat* L = MatGetCholesky(A);
+  if (L != NULL) {
+    const long nbComp = VecGet(&(transp->_dim), 1);
+    const long nbSample = VecGet(&(transp->_dim), 0);
+    that->Xp = MatFloatCreate(&(transp->_dim));
+    VecFloat* col = VecFloatCreate(nbComp);
+    for (long iSample = 0; iSample < nbSample; ++iSample) {
+      for (long iComp = 0; iComp < nbComp; ++iComp)
+        VecSet(col, iComp, transp->_val[iComp * nbSample + iSample]);
+      MatCholeskySolve(L, col, col);
+      for (long iComp = 0; iComp < nbComp; ++iComp)
+        that->Xp->_val[iComp * nbSample + iSample] = VecGet(col, iComp);
+    }
+    VecFree(&col);
+    MatFree(&L);
+  } else {
+    MatFloat* inv = MatGetInv(A);
+    if (inv != NULL) {
+      that->Xp = MatGetProdMat(inv, transp);
+    }
+    MatFree(&inv);
   }
   MatFree(&transp);
   MatFree(&A);
-  MatFree(&inv);
 }
 
 // Get the bias of the last computed solution of the LeastSquareLinReg 'that'
@@ -11,8 +11,16 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <float.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "pberr.h"
 #include "pbjson.h"
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(PBMATH_NOSIMD)
+#define PBMATH_SIMD_X86 1
+#include <immintrin.h>
+#endif
 
 // ================= Define ==================
 
@@ -35,6 +43,176 @@
 #define INT(a) ((int)(round(a)))
 #define rnd() (float)(rand())/(float)(RAND_MAX)
 
+// -------------- PBBin
+
+// ================= Define ==================
+
+// Binary format shared by the *SaveBin/*LoadBin functions:
+// "PBBN" magic, uint16 version, uint16 flags, 4 chars type tag, the 
+// payload and, if the PBBIN_FLAGCHECKSUM flag is set, the CRC32 of the 
+// payload as a uint32. Integers are little endian, long are stored as 
+// int64 and float as the little endian IEEE-754 binary32 bit pattern
+#define PBBIN_MAGIC "PBBN"
+#define PBBIN_VERSION 1
+#define PBBIN_FLAGCHECKSUM 1
+
+// ================= Data structure ===================
+
+// Reader/writer of the binary format on a stream
+typedef struct PBBin {
+  // Stream
+  FILE* _stream;
+  // CRC32 of the payload processed so far
+  uint32_t _crc;
+  // Flag to memorize if the payload is followed by its CRC32
+  bool _checksum;
+  // Flag to memorize if all the read/write succeeded so far
+  bool _isOk;
+} PBBin;
+
+// ================ Functions declaration ====================
+
+// Create a static PBBin reading/writing on the stream 'stream'
+#if BUILDMODE != 0
+static inline
+#endif 
+PBBin PBBinCreateStatic(FILE* const stream);
+
+// Return true if all the reads/writes of the PBBin 'that' succeeded 
+// so far, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinIsOk(const PBBin* const that);
+
+// Write the header for the type 'tag' (4 chars) with the PBBin 'that'
+// If 'checksum' equals true the payload will be followed by its CRC32
+// Return true upon success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinWriteHeader(PBBin* const that, const char* const tag, 
+  const bool checksum);
+
+// Read the header with the PBBin 'that' and check it is a supported 
+// version for the type 'tag' (4 chars)
+// Return true upon success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinReadHeader(PBBin* const that, const char* const tag);
+
+// Write the footer (CRC32 if requested in the header) with the 
+// PBBin 'that'
+// Return true if all the writes succeeded, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinWriteFooter(PBBin* const that);
+
+// Read the footer with the PBBin 'that' and check the CRC32 if 
+// requested in the header
+// Return true if all the reads succeeded and the CRC32 matches, 
+// else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool PBBinReadFooter(PBBin* const that);
+
+// Write/read 'nb' bytes 'data' with the PBBin 'that'
+// On failure of the read 'data' is set to 0
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteBytes(PBBin* const that, const void* const data, 
+  const size_t nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadBytes(PBBin* const that, void* const data, 
+  const size_t nb);
+
+// Write/read one value with the PBBin 'that'
+// On failure of the read, 0 is returned
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteU16(PBBin* const that, const uint16_t val);
+#if BUILDMODE != 0
+static inline
+#endif 
+uint16_t PBBinReadU16(PBBin* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteU32(PBBin* const that, const uint32_t val);
+#if BUILDMODE != 0
+static inline
+#endif 
+uint32_t PBBinReadU32(PBBin* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteI64(PBBin* const that, const int64_t val);
+#if BUILDMODE != 0
+static inline
+#endif 
+int64_t PBBinReadI64(PBBin* const that);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteFloat(PBBin* const that, const float val);
+#if BUILDMODE != 0
+static inline
+#endif 
+float PBBinReadFloat(PBBin* const that);
+
+// Write/read the 'nb' values of the array 'vals' with the PBBin 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteFloats(PBBin* const that, const float* const vals, 
+  const long nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadFloats(PBBin* const that, float* const vals, 
+  const long nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteShorts(PBBin* const that, const short* const vals, 
+  const long nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadShorts(PBBin* const that, short* const vals, 
+  const long nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteLongs(PBBin* const that, const long* const vals, 
+  const long nb);
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinReadLongs(PBBin* const that, long* const vals, 
+  const long nb);
+
+// Write the string 'str' (which may be null) with the PBBin 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+void PBBinWriteStr(PBBin* const that, const char* const str);
+
+// Read a string with the PBBin 'that'
+// Return a newly allocated string, or null if the string was null or 
+// the read failed
+#if BUILDMODE != 0
+static inline
+#endif 
+char* PBBinReadStr(PBBin* const that);
+
 // -------------- VecLong
 
 // ================= Data structure ===================
@@ -98,6 +276,14 @@ JSONNode* _VecLongEncodeAsJSON(const VecLong* const that);
 // Function which decode from JSON encoding 'json' to 'that'
 bool _VecLongDecodeAsJSON(VecLong** that, const JSONNode* const json);
 
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecLongEncodeAsJSONStream(const VecLong* const that, 
+  JSONWriter* const writer);
+
 // Load the VecLong from the stream
 // If the VecLong is already allocated, it is freed before loading
 // Return true in case of success, else false
@@ -110,6 +296,37 @@ bool _VecLongLoad(VecLong** that, FILE* const stream);
 bool _VecLongSave(const VecLong* const that, 
   FILE* const stream, const bool compact);
 
+// Write the binary encoding of the VecLong 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecLongEncodeAsBin(const VecLong* const that, PBBin* const bin);
+
+// Read the binary encoding of a VecLong with the PBBin 'bin' into 'that'
+// If the VecLong is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecLongDecodeAsBin(VecLong** that, PBBin* const bin);
+
+// Save the VecLong 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecLongSaveBin(const VecLong* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the VecLong 'that' from the stream 'stream' in binary format
+// If the VecLong is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecLongLoadBin(VecLong** that, FILE* const stream);
+
 // Free the memory used by a VecLong
 // Do nothing if arguments are invalid
 void _VecLongFree(VecLong** that);
@@ -487,6 +704,14 @@ JSONNode* _VecShortEncodeAsJSON(const VecShort* const that);
 // Function which decode from JSON encoding 'json' to 'that'
 bool _VecShortDecodeAsJSON(VecShort** that, const JSONNode* const json);
 
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecShortEncodeAsJSONStream(const VecShort* const that, 
+  JSONWriter* const writer);
+
 // Load the VecShort from the stream
 // If the VecShort is already allocated, it is freed before loading
 // Return true in case of success, else false
@@ -499,6 +724,37 @@ bool _VecShortLoad(VecShort** that, FILE* const stream);
 bool _VecShortSave(const VecShort* const that, 
   FILE* const stream, const bool compact);
 
+// Write the binary encoding of the VecShort 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecShortEncodeAsBin(const VecShort* const that, PBBin* const bin);
+
+// Read the binary encoding of a VecShort with the PBBin 'bin' into 'that'
+// If the VecShort is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecShortDecodeAsBin(VecShort** that, PBBin* const bin);
+
+// Save the VecShort 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecShortSaveBin(const VecShort* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the VecShort 'that' from the stream 'stream' in binary format
+// If the VecShort is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecShortLoadBin(VecShort** that, FILE* const stream);
+
 // Free the memory used by a VecShort
 // Do nothing if arguments are invalid
 void _VecShortFree(VecShort** that);
@@ -815,6 +1071,12 @@ long _VecShortGetIMaxVal(const VecShort* const that);
 
 // -------------- VecFloat
 
+// ================= Define ==================
+
+// Dimension from which the arithmetic on VecFloat uses the SSE/AVX2
+// kernels (on x86 only, define PBMATH_NOSIMD to disable them)
+#define PBMATH_SIMDMINDIM 8
+
 // ================= Data structure ===================
 
 // Vector of float values
@@ -839,6 +1101,13 @@ typedef struct VecFloat3D {
   float _val[3];
 } VecFloat3D;
 
+typedef struct VecFloat4D {
+  // Dimension
+  long _dim;
+  // Values
+  float _val[4];
+} VecFloat4D;
+
 // ================ Functions declaration ====================
 
 // Create a new VecFloat of dimension 'dim'
@@ -854,6 +1123,10 @@ VecFloat2D VecFloatCreateStatic2D();
 static inline 
 #endif 
 VecFloat3D VecFloatCreateStatic3D();
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat4D VecFloatCreateStatic4D();
 
 // Clone the VecFloat
 VecFloat* _VecFloatClone(const VecFloat* const that);
@@ -864,6 +1137,48 @@ JSONNode* _VecFloatEncodeAsJSON(const VecFloat* const that);
 // Function which decode from JSON encoding 'json' to 'that'
 bool _VecFloatDecodeAsJSON(VecFloat** that, const JSONNode* const json);
 
+// Write the JSON encoding of 'that' with the JSONWriter 'writer', as 
+// the value of the last key or an element of the current array
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatEncodeAsJSONStream(const VecFloat* const that, 
+  JSONWriter* const writer);
+
+// Function which return the JSON encoding of 'that', same as 
+// _VecFloatEncodeAsJSON but the values are written with JSONFloatToStr 
+// (shortest representation converting back exactly to the value)
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _VecFloatEncodeAsJSONFast(const VecFloat* const that);
+
+// Function which decode from JSON encoding 'json' to 'that', same as 
+// _VecFloatDecodeAsJSON but the values are read with JSONStrToFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatDecodeAsJSONFast(VecFloat** that, const JSONNode* const json);
+
+// Save the VecFloat to the stream with _VecFloatEncodeAsJSONFast
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatSaveFast(const VecFloat* const that, 
+  FILE* const stream, const bool compact);
+
+// Load the VecFloat from the stream with _VecFloatDecodeAsJSONFast, the JSON 
+// is loaded in situ with JSONDocLoad
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatLoadFast(VecFloat** that, FILE* const stream);
+
 // Load the VecFloat from the stream
 // If the VecFloat is already allocated, it is freed before loading
 // Return true in case of success, else false
@@ -876,6 +1191,37 @@ bool _VecFloatLoad(VecFloat** that, FILE* const stream);
 bool _VecFloatSave(const VecFloat* const that, 
   FILE* const stream, const bool compact);
 
+// Write the binary encoding of the VecFloat 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatEncodeAsBin(const VecFloat* const that, PBBin* const bin);
+
+// Read the binary encoding of a VecFloat with the PBBin 'bin' into 'that'
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatDecodeAsBin(VecFloat** that, PBBin* const bin);
+
+// Save the VecFloat 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatSaveBin(const VecFloat* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the VecFloat 'that' from the stream 'stream' in binary format
+// If the VecFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecFloatLoadBin(VecFloat** that, FILE* const stream);
+
 // Free the memory used by a VecFloat
 // Do nothing if arguments are invalid
 void _VecFloatFree(VecFloat** that);
@@ -902,6 +1248,10 @@ float _VecFloatGet2D(const VecFloat2D* const that, const long i);
 static inline 
 #endif 
 float _VecFloatGet3D(const VecFloat3D* const that, const long i);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGet4D(const VecFloat4D* const that, const long i);
 
 // Set the 'i'-th value of the VecFloat to 'v'
 #if BUILDMODE != 0 
@@ -916,6 +1266,10 @@ void _VecFloatSet2D(VecFloat2D* const that, const long i, const float v);
 static inline
 #endif 
 void _VecFloatSet3D(VecFloat3D* const that, const long i, const float v);
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecFloatSet4D(VecFloat4D* const that, const long i, const float v);
 
 // Set the 'i'-th value of the VecFloat to 'v' plus its current value
 #if BUILDMODE != 0 
@@ -995,6 +1349,10 @@ float _VecFloatNorm2D(const VecFloat2D* const that);
 static inline 
 #endif 
 float _VecFloatNorm3D(const VecFloat3D* const that);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatNorm4D(const VecFloat4D* const that);
 
 // Normalise the VecFloat
 #if BUILDMODE != 0 
@@ -1241,6 +1599,40 @@ VecFloat3D _VecFloatGetRotY(const VecFloat3D* const that,
 VecFloat3D _VecFloatGetRotZ(const VecFloat3D* const that, 
   const float theta);
 
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around 'axis', same as _VecFloatGetRotAxis but unrolled and 
+// inlined
+// 'axis' must be normalized
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetRotAxisFast(const VecFloat3D* const that, 
+  const VecFloat3D* const axis, const float theta);
+
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around X, same as _VecFloatGetRotX but inlined
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetRotXFast(const VecFloat3D* const that, 
+  const float theta);
+
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around Y, same as _VecFloatGetRotY but inlined
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetRotYFast(const VecFloat3D* const that, 
+  const float theta);
+
+// Return a VecFloat3D equal to 'that' rotated right-hand by 'theta' 
+// radians around Z, same as _VecFloatGetRotZ but inlined
+#if BUILDMODE != 0
+static inline
+#endif 
+VecFloat3D _VecFloatGetRotZFast(const VecFloat3D* const that, 
+  const float theta);
+
 // Return the dot product of 'that' and 'tho'
 #if BUILDMODE != 0 
 static inline 
@@ -1257,6 +1649,33 @@ static inline
 #endif 
 float _VecFloatDotProd3D(const VecFloat3D* const that, 
   const VecFloat3D* const tho);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatDotProd4D(const VecFloat4D* const that, 
+  const VecFloat4D* const tho);
+
+// Return the dot product of 'that' and 'tho', the values are stored in 
+// float but the products are accumulated in double precision
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecFloatDotProdDouble(const VecFloat* const that, 
+  const VecFloat* const tho);
+
+// Return the norm of the VecFloat, accumulated in double precision
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecFloatNormDouble(const VecFloat* const that);
+
+// Return the distance between the VecFloat 'that' and 'tho', 
+// accumulated in double precision
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecFloatDistDouble(const VecFloat* const that, 
+  const VecFloat* const tho);
 
 // Return the cross product of 'that' and 'tho'
 #if BUILDMODE != 0 
@@ -1290,273 +1709,1402 @@ static inline
 #endif 
 VecShort3D VecFloatToShort3D(const VecFloat3D* const that);
 
-// Return the conversion of VecShort 'that' to a VecFloat
-#if BUILDMODE != 0 
-static inline 
-#endif 
-VecFloat* VecShortToFloat(const VecShort* const that);
+// Return the conversion of VecShort 'that' to a VecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* VecShortToFloat(const VecShort* const that);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat2D VecShortToFloat2D(const VecShort2D* const that);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat3D VecShortToFloat3D(const VecShort3D* const that);
+
+// Return the conversion of VecLong 'that' to a VecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* VecLongToFloat(const VecLong* const that);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat2D VecLongToFloat2D(const VecLong2D* const that);
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat3D VecLongToFloat3D(const VecLong3D* const that);
+
+// Get the max value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMaxVal(const VecFloat* const that);
+
+// Get the min value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMinVal(const VecFloat* const that);
+
+// Get the max value (in absolute value) in components of the 
+// vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMaxValAbs(const VecFloat* const that);
+
+// Get the min value (in absolute value) in components of the 
+// vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _VecFloatGetMinValAbs(const VecFloat* const that);
+
+// Step the values of the vector incrementally by delta from 0
+// in the following order (for example) : 
+// (0.,0.,0.)->(0.,0.,1.)->(0.,0.,2.)->(0.,1.,0.)->(0.,1.,1.)->...
+// The upper limit for each value is given by 'bound' (val[i] <= dim[i])
+// Return false after all values of 'that' have reached their upper 
+// limit (in which case 'that''s values are all set back to 0.)
+// Return true else
+bool _VecFloatStepDelta(VecFloat* const that, 
+  const VecFloat* const bound, const VecFloat* const delta);
+
+// Step the values of the vector incrementally by delta
+// in the following order (for example) : 
+// (0.,0.,0.)->(0.,0.,1.)->(0.,0.,2.)->(0.,1.,0.)->(0.,1.,1.)->...
+// The lower limit for each value is given by 'from' (val[i] >= from[i])
+// The upper limit for each value is given by 'to' (val[i] <= to[i])
+// 'that' must be initialised to 'from' before the first call of this
+// function
+// Return false after all values of 'that' have reached their upper 
+// limit (in which case 'that''s values are all set back to from)
+// Return true else
+bool _VecFloatShiftStepDelta(VecFloat* const that, 
+  const VecFloat* const from, const VecFloat* const to, 
+  const VecFloat* const delta);
+
+// Get the index of the max value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long _VecFloatGetIMaxVal(const VecFloat* const that);
+
+// Return a set of two vectors containing the bounds of the vectors in 
+// the GSet 'that'
+// The set must have at least one element
+// The returned set is ordered as follow: (boundMin, boundMax)
+GSetVecFloat _GSetVecFloatGetBounds(const GSetVecFloat* const that);
+
+// Return true if the CPU supports AVX2 and FMA, in which case the 
+// kernels of VecFloat use their AVX2 version, false else (and always
+// false on other architectures than x86)
+#if BUILDMODE != 0 
+static inline 
+#endif 
+bool VecFloatKernelHasAVX2(void);
+
+// Add (a[i] - c)^2 to each of the 'nb' floats res[i], with the SIMD
+// kernels of VecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatKernelAddSqDiff(const float* const a, const float c, 
+  float* const res, const long nb);
+
+// -------------- VecDouble
+
+// ================= Data structure ===================
+
+// Vector of double values
+typedef struct VecDouble {
+  // Dimension
+  long _dim;
+  // Values
+  double _val[0];
+} VecDouble;
+
+// ================ Functions declaration ====================
+
+// Create a new VecDouble of dimension 'dim'
+// Values are initalized to 0.0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* VecDoubleCreate(const long dim);
+
+// Clone the VecDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* _VecDoubleClone(const VecDouble* const that);
+
+// Create a new VecDouble with the values of the VecFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* VecFloatGetVecDouble(const VecFloat* const that);
+
+// Create a new VecFloat with the values of the VecDouble 'that'
+// rounded to float
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* VecDoubleGetVecFloat(const VecDouble* const that);
+
+// Function which return the JSON encoding of 'that'
+// The values are written with 17 significant digits, which converts 
+// back exactly to the value
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _VecDoubleEncodeAsJSON(const VecDouble* const that);
+
+// Function which decode from JSON encoding 'json' to 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecDoubleDecodeAsJSON(VecDouble** that, const JSONNode* const json);
+
+// Save the VecDouble to the stream
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecDoubleSave(const VecDouble* const that, 
+  FILE* const stream, const bool compact);
+
+// Load the VecDouble from the stream
+// If the VecDouble is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _VecDoubleLoad(VecDouble** that, FILE* const stream);
+
+// Free the memory used by a VecDouble
+// Do nothing if arguments are invalid
+#if BUILDMODE != 0
+static inline
+#endif 
+void _VecDoubleFree(VecDouble** that);
+
+// Print the VecDouble on 'stream' with 'prec' digit precision
+#if BUILDMODE != 0
+static inline
+#endif 
+void VecDoublePrint(const VecDouble* const that, FILE* const stream, 
+  const unsigned int prec);
+static inline void _VecDoublePrintDef(const VecDouble* const that, 
+  FILE* const stream) {
+  VecDoublePrint(that, stream, 3);
+}
+
+// Return the 'i'-th value of the VecDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleGet(const VecDouble* const that, const long i);
+
+// Set the 'i'-th value of the VecDouble to 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleSet(VecDouble* const that, const long i, const double v);
+
+// Set the 'i'-th value of the VecDouble to 'v' plus its current value
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleSetAdd(VecDouble* const that, const long i, 
+  const double v);
+
+// Set all values of the vector 'that' to 0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleSetNull(VecDouble* const that);
+
+// Set all values of the vector 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleSetAll(VecDouble* const that, const double v);
+
+// Return the dimension of the VecDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long _VecDoubleGetDim(const VecDouble* const that);
+
+// Copy the values of 'tho' in 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleCopy(VecDouble* const that, const VecDouble* const tho);
+
+// Return the norm of the VecDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleNorm(const VecDouble* const that);
+
+// Normalise the VecDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleNormalise(VecDouble* const that);
+
+// Return the distance between the VecDouble 'that' and 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleDist(const VecDouble* const that, 
+  const VecDouble* const tho);
+
+// Return true if the VecDouble 'that' is equal to 'tho', else false
+#if BUILDMODE != 0 
+static inline 
+#endif 
+bool _VecDoubleIsEqual(const VecDouble* const that, 
+  const VecDouble* const tho);
+
+// Calculate (that * a + tho * b) and store the result in 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleOp(VecDouble* const that, const double a, 
+  const VecDouble* const tho, const double b);
+
+// Return a VecDouble equal to (that * a + tho * b)
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* _VecDoubleGetOp(const VecDouble* const that, const double a, 
+  const VecDouble* const tho, const double b);
+
+// Calculate the Hadamard product of 'that' and 'tho' and store the 
+// result in 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleHadamardProd(VecDouble* const that, 
+  const VecDouble* const tho);
+
+// Return a VecDouble equal to the Hadamard product of 'that' and 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* _VecDoubleGetHadamardProd(const VecDouble* const that, 
+  const VecDouble* const tho);
+
+// Calculate (that * a) and store the result in 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _VecDoubleScale(VecDouble* const that, const double a);
+
+// Return a VecDouble equal to (that * a)
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* _VecDoubleGetScale(const VecDouble* const that, 
+  const double a);
+
+// Return the dot product of 'that' and 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleDotProd(const VecDouble* const that, 
+  const VecDouble* const tho);
+
+// Return the max value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleGetMaxVal(const VecDouble* const that);
+
+// Return the min value in components of the vector 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _VecDoubleGetMinVal(const VecDouble* const that);
+
+// -------------- MatFloat
+
+// ================= Define ==================
+
+// Size of the blocks (in number of values along the inner and column
+// dimensions) used by the product of MatFloat to stay in cache
+#define PBMATH_MATPRODBLOCKINNER 128
+#define PBMATH_MATPRODBLOCKCOL 512
+// Number of rows of the result processed at once by a thread of the 
+// parallel product of MatFloat
+#define PBMATH_MATPRODBLOCKROW 16
+// Minimum number of multiplications from which the parallel product
+// of MatFloat actually uses several threads
+#define PBMATH_MATPRODMINPARALLEL 2000000L
+
+// ================= Data structure ===================
+
+// Vector of float values
+typedef struct MatFloat {
+  // Dimension (nbCol, nbLine)
+  const VecShort2D _dim;
+  // Values (memorized by lines)
+  float _val[0];
+} MatFloat;
+
+// Structure of the job shared by the threads of the parallel product
+// of MatFloat
+typedef struct MatFloatProdJob {
+  // Operands and result of the product
+  const MatFloat* _that;
+  const MatFloat* _tho;
+  MatFloat* _res;
+  // Number of blocks of rows of the result
+  long _nbBlock;
+  // Index of the next block to be processed
+  long _nextBlock;
+  // Mutex protecting _nextBlock
+  pthread_mutex_t _mutex;
+} MatFloatProdJob;
+
+// Simple pod to hold the result of a QR decomposition
+typedef struct QRDecomp {
+  MatFloat* _Q;
+  MatFloat* _R;
+} QRDecomp;
+
+// Simple pod to hold the result of a LU decomposition with partial 
+// pivoting, P.A = L.U
+typedef struct LUDecomp {
+  // L (unit lower triangular, below the diagonal) and U (upper 
+  // triangular) packed in one matrix
+  MatFloat* _LU;
+  // Permutation, the i-th row of P.A is the _perm[i]-th row of A
+  VecShort* _perm;
+} LUDecomp;
+
+// Static 3x3 and 4x4 matrices of float values, with the same layout 
+// as MatFloat
+typedef struct MatFloat3x3 {
+  // Dimension (nbCol, nbLine)
+  const VecShort2D _dim;
+  // Values (memorized by lines)
+  float _val[9];
+} MatFloat3x3;
+
+typedef struct MatFloat4x4 {
+  // Dimension (nbCol, nbLine)
+  const VecShort2D _dim;
+  // Values (memorized by lines)
+  float _val[16];
+} MatFloat4x4;
+
+// ================ Functions declaration ====================
+
+// Free memory used by the QRDecomp 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void QRDecompFreeStatic(QRDecomp* const that);
+
+// Free memory used by the LUDecomp 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void LUDecompFreeStatic(LUDecomp* const that);
+
+// Solve the system A.x = 'b' with the LUDecomp 'that' of A and store
+// the solution x in 'res'
+// 'res' must be different from 'b'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void LUDecompSolve(const LUDecomp* const that, const VecFloat* const b,
+  VecFloat* const res);
+
+// Create a new MatFloat of dimension 'dim' (nbCol, nbLine)
+// Values are initalized to 0.0
+MatFloat* MatFloatCreate(const VecShort2D* const dim);
+
+// Set the MatFloat to the identity matrix
+// The matrix must be a square matrix
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatSetIdentity(MatFloat* const that);
+
+// Clone the MatFloat
+MatFloat* _MatFloatClone(const MatFloat* const that);
+
+// Copy the values of 'w' in 'that' (must have same dimensions)
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatCopy(MatFloat* const that, const MatFloat* const tho);
+
+// Function which return the JSON encoding of 'that' 
+JSONNode* _MatFloatEncodeAsJSON(MatFloat* const that);
+
+// Function which decode from JSON encoding 'json' to 'that'
+bool _MatFloatDecodeAsJSON(MatFloat** that, JSONNode* json);
+
+// Function which return the JSON encoding of 'that', same as 
+// _MatFloatEncodeAsJSON but the values are written with JSONFloatToStr 
+// (shortest representation converting back exactly to the value)
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _MatFloatEncodeAsJSONFast(const MatFloat* const that);
+
+// Function which decode from JSON encoding 'json' to 'that', same as 
+// _MatFloatDecodeAsJSON but the values are read with JSONStrToFloat
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatDecodeAsJSONFast(MatFloat** that, const JSONNode* const json);
+
+// Save the MatFloat to the stream with _MatFloatEncodeAsJSONFast
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatSaveFast(const MatFloat* const that, 
+  FILE* const stream, const bool compact);
+
+// Load the MatFloat from the stream with _MatFloatDecodeAsJSONFast, the JSON 
+// is loaded in situ with JSONDocLoad
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatLoadFast(MatFloat** that, FILE* const stream);
+
+// Load the MatFloat from the stream
+// If the MatFloat is already allocated, it is freed before loading
+// Return true upon success, else false
+bool _MatFloatLoad(MatFloat** that, FILE* stream);
+
+// Save the MatFloat to the stream
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true upon success, else false
+bool _MatFloatSave(MatFloat* const that, FILE* stream, bool compact);
+
+// Write the binary encoding of the MatFloat 'that' with the PBBin 'bin'
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatFloatEncodeAsBin(const MatFloat* const that, PBBin* const bin);
+
+// Read the binary encoding of a MatFloat with the PBBin 'bin' into 'that'
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatDecodeAsBin(MatFloat** that, PBBin* const bin);
+
+// Save the MatFloat 'that' to the stream 'stream' in binary format
+// If 'checksum' equals true the CRC32 of the data is appended
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatSaveBin(const MatFloat* const that, FILE* const stream, 
+  const bool checksum);
+
+// Load the MatFloat 'that' from the stream 'stream' in binary format
+// If the MatFloat is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatFloatLoadBin(MatFloat** that, FILE* const stream);
+
+// Free the memory used by a MatFloat
+// Do nothing if arguments are invalid
+void _MatFloatFree(MatFloat** that);
+
+// Print the MatFloat on 'stream' with 'prec' digit precision
+// Do nothing if arguments are invalid
+void MatFloatPrintln(MatFloat* const that, FILE* stream, unsigned int prec);
+static inline void _MatFloatPrintlnDef(MatFloat* const that, FILE* stream) {
+  MatFloatPrintln(that, stream, 3);
+}
+
+// Return the value at index (col, line) of the MatFloat
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float _MatFloatGet(const MatFloat* const that, 
+  VecShort2D* index);
+
+// Set the value at index (col, line) of the MatFloat to 'v'
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatSet(MatFloat* const that, VecShort2D* index, float v);
+
+// Return the dimension of the MatFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+const VecShort2D* _MatFloatDim(const MatFloat* const that);
+
+// Return a VecShort2D containing the dimension of the MatFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecShort2D _MatFloatGetDim(const MatFloat* const that);
+
+// Return the number of rows of the MatFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatFloatGetNbRow(const MatFloat* const that);
+
+// Return the number of columns of the MatFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatFloatGetNbCol(const MatFloat* const that);
+
+// Return the inverse matrix of 'that'
+// The matrix must be a square matrix
+// Return NULL if the matrix is not invertible, or in some case when
+// the matrix's diagonal contains null values and the matrix's size
+// is greater than 3
+MatFloat* _MatFloatGetInv(const MatFloat* const that);
+
+// Return the product of matrix 'that' and vector 'v'
+// Number of columns of 'that' must equal dimension of 'v'
+VecFloat* _MatFloatGetProdVecFloat(
+  const MatFloat* const that, const VecFloat* v);
+
+// Return the product of vector 'v' and transpose of vector 'w'
+MatFloat* _MatFloatGetProdVecVecTransposeFloat(
+  const VecFloat* const v, 
+  const VecFloat* const w);
+
+// Return the product of matrix 'that' by matrix 'tho'
+// Number of columns of 'that' must equal number of line of 'tho'
+MatFloat* _MatFloatGetProdMatFloat(const MatFloat* const that, const MatFloat* tho);
+
+// Calculate the product of matrix 'that' and vector 'v' and store the
+// result in 'res'
+// Number of columns of 'that' must equal dimension of 'v', dimension
+// of 'res' must equal number of rows of 'that', 'res' must be 
+// different from 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdVecFloat(const MatFloat* const that, 
+  const VecFloat* const v, VecFloat* const res);
+
+// Calculate the product of matrix 'that' by matrix 'tho' and store 
+// the result in 'res'
+// Number of columns of 'that' must equal number of rows of 'tho', 
+// 'res' must have as many rows as 'that' and as many columns as 'tho',
+// and must be different from 'that' and 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdMatFloat(const MatFloat* const that, 
+  const MatFloat* const tho, MatFloat* const res);
+
+// Same as _MatFloatProdMatFloat but using 'nbThread' threads (if 
+// 'nbThread' <= 0, one per online core)
+// The rows of the result are split into blocks processed in parallel,
+// small products are processed by the calling thread only
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatProdMatFloatParallel(const MatFloat* const that, 
+  const MatFloat* const tho, MatFloat* const res, int nbThread);
+
+// Return the product of matrix 'that' and vector 'v'
+// Same as _MatFloatGetProdVecFloat but faster, see _MatFloatProdVecFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* _MatFloatGetProdVecFloatFast(const MatFloat* const that, 
+  const VecFloat* const v);
+
+// Return the product of matrix 'that' by matrix 'tho'
+// Same as _MatFloatGetProdMatFloat but faster, see _MatFloatProdMatFloat
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetProdMatFloatFast(const MatFloat* const that, 
+  const MatFloat* const tho);
+
+// Return the addition of matrix 'that' with matrix 'tho'
+// 'that' and 'tho' must have same dimensions
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetAdd(MatFloat* const that, MatFloat* tho);
+
+// Add matrix 'that' with matrix 'tho' and store the result in 'that'
+// 'that' and 'tho' must have same dimensions
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatAdd(MatFloat* const that, MatFloat* tho);
+
+// Multiply the matrix 'that' by 'a'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatScale(MatFloat* const that, const float a);
+
+// Return true if 'that' is equal to 'tho', false else
+bool _MatFloatIsEqual(MatFloat* const that, MatFloat* tho);
+
+// Calculate the Eigen values and vectors of the MatFloat 'that'
+// Return a set of VecFloat. The first VecFloat of the set contains 
+// the Eigen values, with values sorted from biggest to 
+// smallest (in absolute value). The following VecFloat are the 
+// respectiev Eigen vectors
+// 'that' must be a 2D square matrix
+// Return the identity if the QR decompostion fails
+// http://madrury.github.io/jekyll/update/statistics/2017/10/04/qr-algorithm.html
+// TODO: should be improved with the Hessenberg QR method
+// https://www.math.kth.se/na/SF2524/matber15/qrmethod.pdf
+GSetVecFloat _MatFloatGetEigenValues(const MatFloat* const that);
+
+// Calculate the QR decomposition of the MatFloat 'that' using the 
+// Householder algorithm
+// Return {NULL, NULL} if the MatFloat couldn't be decomposed
+// http://www.seas.ucla.edu/~vandenbe/133A/lectures/qr.pdf
+QRDecomp _MatFloatGetQR(const MatFloat* const that);
+
+// Calculate the LU decomposition with partial pivoting of the MatFloat
+// 'that'
+// 'that' must be a square matrix
+// Return {NULL, NULL} if the matrix is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+LUDecomp _MatFloatGetLU(const MatFloat* const that);
+
+// Calculate the Cholesky decomposition of the MatFloat 'that', i.e. 
+// the lower triangular matrix L such as L.L' = 'that'
+// 'that' must be a symmetric square matrix, only its lower triangular
+// part is used
+// Return NULL if the matrix is not positive definite
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetCholesky(const MatFloat* const that);
+
+// Solve the system A.x = 'b' with the Cholesky decomposition 'that' of
+// A and store the solution x in 'res'
+// 'res' can be 'b'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatFloatCholeskySolve(const MatFloat* const that, 
+  const VecFloat* const b, VecFloat* const res);
+
+// Return the inverse matrix of 'that'
+// Same as _MatFloatGetInv but calculated with the LU decomposition, 
+// hence it works whatever the values on the diagonal
+// Return NULL if the matrix is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* _MatFloatGetInvFast(const MatFloat* const that);
+
+// Static constructors for MatFloat3x3 and MatFloat4x4
+// Values are initalized to 0.0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 MatFloatCreateStatic3x3();
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat4x4 MatFloatCreateStatic4x4();
+
+// Return the matrix of the right-hand rotation by 'theta' radians 
+// around 'axis'
+// 'axis' must be normalized
+// Rotating several vectors with this matrix avoids to calculate the 
+// sine and cosine for each of them
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 MatFloatGetRotAxis3x3(const VecFloat3D* const axis, 
+  const float theta);
+
+// Return the product of the MatFloat3x3 'that' by the VecFloat3D 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat3D _MatFloatGetProdVecFloat3x3(const MatFloat3x3* const that, 
+  const VecFloat3D* const v);
+
+// Return the product of the MatFloat4x4 'that' by the VecFloat4D 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat4D _MatFloatGetProdVecFloat4x4(const MatFloat4x4* const that, 
+  const VecFloat4D* const v);
+
+// Return the product of the MatFloat3x3 'that' by the MatFloat3x3 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat3x3 _MatFloatGetProdMatFloat3x3(const MatFloat3x3* const that, 
+  const MatFloat3x3* const tho);
+
+// Return the product of the MatFloat4x4 'that' by the MatFloat4x4 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat4x4 _MatFloatGetProdMatFloat4x4(const MatFloat4x4* const that, 
+  const MatFloat4x4* const tho);
+
+// Calculate the transposed of the MatFloat 'that'
+MatFloat* _MatFloatGetTranspose(const MatFloat* const that);
+
+// -------------- MatDouble
+
+// ================= Data structure ===================
+
+// Matrix of double values
+typedef struct MatDouble {
+  // Dimension (nbCol, nbLine)
+  const VecShort2D _dim;
+  // Values (memorized by lines)
+  double _val[0];
+} MatDouble;
+
+// ================ Functions declaration ====================
+
+// Create a new MatDouble of dimension 'dim' (nbCol, nbLine)
+// Values are initalized to 0.0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* MatDoubleCreate(const VecShort2D* const dim);
+
+// Clone the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* _MatDoubleClone(const MatDouble* const that);
+
+// Create a new MatDouble with the values of the MatFloat 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* MatFloatGetMatDouble(const MatFloat* const that);
+
+// Create a new MatFloat with the values of the MatDouble 'that'
+// rounded to float
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* MatDoubleGetMatFloat(const MatDouble* const that);
+
+// Function which return the JSON encoding of 'that'
+// The values are written with 17 significant digits, which converts 
+// back exactly to the value
+#if BUILDMODE != 0
+static inline
+#endif 
+JSONNode* _MatDoubleEncodeAsJSON(const MatDouble* const that);
+
+// Function which decode from JSON encoding 'json' to 'that'
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatDoubleDecodeAsJSON(MatDouble** that, const JSONNode* const json);
+
+// Save the MatDouble to the stream
+// If 'compact' equals true it saves in compact form, else it saves in 
+// readable form
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatDoubleSave(const MatDouble* const that, 
+  FILE* const stream, const bool compact);
+
+// Load the MatDouble from the stream
+// If the MatDouble is already allocated, it is freed before loading
+// Return true in case of success, else false
+#if BUILDMODE != 0
+static inline
+#endif 
+bool _MatDoubleLoad(MatDouble** that, FILE* const stream);
+
+// Free the memory used by a MatDouble
+// Do nothing if arguments are invalid
+#if BUILDMODE != 0
+static inline
+#endif 
+void _MatDoubleFree(MatDouble** that);
+
+// Print the MatDouble on 'stream' with 'prec' digit precision
+#if BUILDMODE != 0
+static inline
+#endif 
+void MatDoublePrintln(const MatDouble* const that, FILE* const stream, 
+  const unsigned int prec);
+static inline void _MatDoublePrintlnDef(const MatDouble* const that, 
+  FILE* const stream) {
+  MatDoublePrintln(that, stream, 3);
+}
+
+// Return the value at index (col, line) of the MatDouble
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double _MatDoubleGet(const MatDouble* const that, 
+  const VecShort2D* const index);
+
+// Set the value at index (col, line) of the MatDouble to 'v'
+// Index starts at 0, index in matrix = line * nbCol + col
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatDoubleSet(MatDouble* const that, const VecShort2D* const index, 
+  const double v);
+
+// Copy the values of 'tho' in 'that' (must have same dimensions)
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatDoubleCopy(MatDouble* const that, const MatDouble* const tho);
+
+// Return the dimension of the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+const VecShort2D* _MatDoubleDim(const MatDouble* const that);
+
+// Return a copy of the dimension of the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecShort2D _MatDoubleGetDim(const MatDouble* const that);
+
+// Return the number of rows of the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatDoubleGetNbRow(const MatDouble* const that);
+
+// Return the number of columns of the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+short _MatDoubleGetNbCol(const MatDouble* const that);
+
+// Set the MatDouble to the identity matrix
+// The matrix must be a square matrix
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatDoubleSetIdentity(MatDouble* const that);
+
+// Return the transpose of the MatDouble
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* _MatDoubleGetTranspose(const MatDouble* const that);
+
+// Multiply the MatDouble 'that' by 'a' 
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _MatDoubleScale(MatDouble* const that, const double a);
+
+// Return true if 'that' is equal to 'tho', false else
+#if BUILDMODE != 0 
+static inline 
+#endif 
+bool _MatDoubleIsEqual(const MatDouble* const that, 
+  const MatDouble* const tho);
+
+// Return the product of the MatDouble 'that' by the VecDouble 'v'
+// Number of columns of 'that' must equal dimension of 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecDouble* _MatDoubleGetProdVecDouble(const MatDouble* const that, 
+  const VecDouble* const v);
+
+// Return the product of the MatDouble 'that' by the MatDouble 'tho'
+// Number of columns of 'that' must equal number of lines of 'tho'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* _MatDoubleGetProdMatDouble(const MatDouble* const that, 
+  const MatDouble* const tho);
+
+// Return the inverse matrix of 'that', calculated with a LU 
+// decomposition with partial pivoting
+// Return NULL if the matrix is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatDouble* _MatDoubleGetInv(const MatDouble* const that);
+
+// -------------- VecFloatBatch
+
+// ================= Define ==================
+
+// Alignment, in number of floats, of the components of a VecFloatBatch
+#define PBMATH_BATCHALIGN 8
+
+// ================= Data structure ===================
+
+// Batch of '_nb' vectors of float values of same dimension '_dim'
+// stored as a structure of arrays in one buffer: the 'iDim'-th 
+// components of all the vectors are contiguous and start at 
+// _val + iDim * _stride, so operations on all the vectors of the batch
+// run along the components with the SIMD kernels of VecFloat
+typedef struct VecFloatBatch {
+  // Number of vectors
+  long _nb;
+  // Dimension of the vectors
+  long _dim;
+  // Distance in number of floats between two components (_nb rounded 
+  // up to a multiple of PBMATH_BATCHALIGN)
+  long _stride;
+  // Values, aligned on PBMATH_BATCHALIGN floats
+  float* _val;
+  // Allocated memory
+  void* _mem;
+} VecFloatBatch;
+
+// ================ Functions declaration ====================
+
+// Create a new VecFloatBatch of 'nb' vectors of dimension 'dim'
+// Values are initalized to 0.0
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloatBatch* VecFloatBatchCreate(const long nb, const long dim);
+
+// Create a new VecFloatBatch with the values of the vectors in the 
+// GSetVecFloat 'set', in the same order
+// The set must have at least one element and all its vectors must have
+// the same dimension
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloatBatch* VecFloatBatchCreateFromGSet(const GSetVecFloat* const set);
+
+// Free the memory used by the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchFree(VecFloatBatch** const that);
+
+// Return a GSetVecFloat of new VecFloat with the values of the vectors
+// of the VecFloatBatch 'that', in the same order
+#if BUILDMODE != 0 
+static inline 
+#endif 
+GSetVecFloat VecFloatBatchGetGSet(const VecFloatBatch* const that);
+
+// Copy the values of the vectors of the VecFloatBatch 'that' into the 
+// vectors of the GSetVecFloat 'set', in the same order
+// 'set' must have as many vectors as 'that', of same dimension
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchCopyToGSet(const VecFloatBatch* const that, 
+  GSetVecFloat* const set);
+
+// Return the number of vectors of the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long VecFloatBatchGetNb(const VecFloatBatch* const that);
+
+// Return the dimension of the vectors of the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long VecFloatBatchGetDim(const VecFloatBatch* const that);
+
+// Return the 'iDim'-th component of the 'iVec'-th vector of the 
+// VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float VecFloatBatchGet(const VecFloatBatch* const that, 
+  const long iVec, const long iDim);
+
+// Set the 'iDim'-th component of the 'iVec'-th vector of the 
+// VecFloatBatch 'that' to 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchSet(VecFloatBatch* const that, 
+  const long iVec, const long iDim, const float v);
+
+// Return the array of the 'iDim'-th components of all the vectors of 
+// the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+const float* VecFloatBatchComp(const VecFloatBatch* const that, 
+  const long iDim);
+
+// Return a new VecFloat with the values of the 'iVec'-th vector of the
+// VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* VecFloatBatchGetVec(const VecFloatBatch* const that, 
+  const long iVec);
+
+// Set the values of the 'iVec'-th vector of the VecFloatBatch 'that' 
+// to the values of the VecFloat 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchSetVec(VecFloatBatch* const that, const long iVec, 
+  const VecFloat* const v);
+
+// Calculate the euclidean distance between each vector of the 
+// VecFloatBatch 'that' and the VecFloat 'v', and store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchDist(const VecFloatBatch* const that, 
+  const VecFloat* const v, float* const res);
+
+// Calculate the dot product between each vector of the VecFloatBatch
+// 'that' and the VecFloat 'v', and store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchDotProd(const VecFloatBatch* const that, 
+  const VecFloat* const v, float* const res);
+
+// Calculate the norm of each vector of the VecFloatBatch 'that' and 
+// store them in 'res'
+// 'res' must be an array of at least that->_nb floats
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchNorm(const VecFloatBatch* const that, 
+  float* const res);
+
+// Normalise each vector of the VecFloatBatch 'that'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchNormalise(VecFloatBatch* const that);
+
+// Return the mean of the vectors of the VecFloatBatch 'that'
+// The sums are accumulated in double precision
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloat* VecFloatBatchGetMean(const VecFloatBatch* const that);
+
+// Center the vectors of the VecFloatBatch 'that' on their mean
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void VecFloatBatchMeanCenter(VecFloatBatch* const that);
+
+// Return the covariance matrix of the vectors of the VecFloatBatch 
+// 'that' (divided by the number of vectors)
+// The products are accumulated in double precision
+#if BUILDMODE != 0 
+static inline 
+#endif 
+MatFloat* VecFloatBatchGetCovarianceMatrix(
+  const VecFloatBatch* const that);
+
+// Return the index of the vector of the VecFloatBatch 'that' nearest 
+// (in term of euclidean distance) to the VecFloat 'v'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+long VecFloatBatchGetNearest(const VecFloatBatch* const that, 
+  const VecFloat* const v);
+
+// For each vector of the VecFloatBatch 'that', store in 'res' the 
+// index of the nearest (in term of euclidean distance) vector in the
+// GSetVecFloat 'targets'
+// 'res' must be an array of at least that->_nb longs
+// Return the sum of the squared distances to the nearest targets
+#if BUILDMODE != 0 
+static inline 
+#endif 
+double VecFloatBatchGetIdNearest(const VecFloatBatch* const that, 
+  const GSetVecFloat* const targets, long* const res);
+
+// Return a new VecFloatBatch of the projections of the vectors of the
+// VecFloatBatch 'that' on the first 'nb' vectors of the GSetVecFloat 
+// 'axes', ie the 'i'-th component of a returned vector is the dot 
+// product of the original vector with the 'i'-th axis
+#if BUILDMODE != 0 
+static inline 
+#endif 
+VecFloatBatch* VecFloatBatchGetProj(const VecFloatBatch* const that, 
+  const GSetVecFloat* const axes, const long nb);
+
+// -------------- EigenSolver
+
+// ================= Define ==================
+
+// Maximum number of QR iterations per Eigen value of the EigenSolver
+#define PBMATH_EIGENMAXITER 30
+
+// ================= Data structure ===================
+
+// Workspace to calculate the Eigen values and vectors of square 
+// MatFloat of a given dimension, reusable from one matrix to another
+// Calculations are made in double precision
+// Symmetric matrices are reduced to tridiagonal form and solved with 
+// the implicit Wilkinson shifted QR algorithm, other matrices are 
+// reduced to Hessenberg form and solved with the Wilkinson shifted
+// QR algorithm followed by a back substitution for the Eigen vectors
+typedef struct EigenSolver {
+  // Dimension of the matrices
+  long _dim;
+  // Working matrix (tridiagonal/Schur form of the last matrix)
+  double* _mat;
+  // Accumulated transformations, then Eigen vectors (by columns)
+  double* _vec;
+  // Eigen values (real part)
+  double* _val;
+  // Eigen values (imaginary part)
+  double* _imag;
+  // Scratch values
+  double* _work;
+  // Indices of the Eigen values sorted by decreasing absolute value
+  long* _order;
+  // Number of QR iterations of the last resolution
+  long _nbIter;
+  // Flag memorizing if the last matrix was symmetric
+  bool _isSym;
+  // Flag memorizing if all the Eigen values of the last matrix are real
+  bool _isReal;
+  // Flag memorizing if the last resolution has converged
+  bool _isConverged;
+} EigenSolver;
+
+// ================ Functions declaration ====================
+
+// Create a static EigenSolver for square matrices of dimension 'dim'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecFloat2D VecShortToFloat2D(const VecShort2D* const that);
+EigenSolver EigenSolverCreateStatic(const long dim);
+
+// Free the memory used by the EigenSolver 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecFloat3D VecShortToFloat3D(const VecShort3D* const that);
+void EigenSolverFreeStatic(EigenSolver* const that);
 
-// Return the conversion of VecLong 'that' to a VecFloat
+// Calculate the Eigen values and vectors of the MatFloat 'mat' with 
+// the EigenSolver 'that'
+// 'mat' must be a square matrix of dimension that->_dim
+// Return true if all the Eigen values have been found and are real, 
+// false else
+// If the matrix has complex Eigen values, their real part is used as
+// Eigen value and the Schur vectors are used as Eigen vectors
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecFloat* VecLongToFloat(const VecLong* const that);
+bool EigenSolverSolve(EigenSolver* const that, const MatFloat* const mat);
+
+// Return the 'iVal'-th Eigen value of the last matrix solved with the
+// EigenSolver 'that', Eigen values are sorted from biggest to 
+// smallest (in absolute value)
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecFloat2D VecLongToFloat2D(const VecLong2D* const that);
+float EigenSolverGetValue(const EigenSolver* const that, 
+  const long iVal);
+
+// Copy the normalised Eigen vector of the 'iVal'-th Eigen value of the
+// last matrix solved with the EigenSolver 'that' into 'res'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecFloat3D VecLongToFloat3D(const VecLong3D* const that);
+void EigenSolverGetVector(const EigenSolver* const that, 
+  const long iVal, VecFloat* const res);
 
-// Get the max value in components of the vector 'that'
+// Return the number of QR iterations used by the last resolution with
+// the EigenSolver 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-float _VecFloatGetMaxVal(const VecFloat* const that);
+long EigenSolverGetNbIter(const EigenSolver* const that);
 
-// Get the min value in components of the vector 'that'
+// Return true if the last matrix solved with the EigenSolver 'that'
+// was symmetric
 #if BUILDMODE != 0 
 static inline 
 #endif 
-float _VecFloatGetMinVal(const VecFloat* const that);
+bool EigenSolverIsSym(const EigenSolver* const that);
 
-// Get the max value (in absolute value) in components of the 
-// vector 'that'
+// Return true if the last resolution with the EigenSolver 'that' has
+// converged
 #if BUILDMODE != 0 
 static inline 
 #endif 
-float _VecFloatGetMaxValAbs(const VecFloat* const that);
+bool EigenSolverIsConverged(const EigenSolver* const that);
 
-// Get the min value (in absolute value) in components of the 
-// vector 'that'
+// Return the residual of the last resolution of the MatFloat 'mat'  
+// with the EigenSolver 'that', i.e. the maximum over the real Eigen 
+// values 'l' and their vector 'v' of the norm of (mat.v - l.v)
 #if BUILDMODE != 0 
 static inline 
 #endif 
-float _VecFloatGetMinValAbs(const VecFloat* const that);
-
-// Step the values of the vector incrementally by delta from 0
-// in the following order (for example) : 
-// (0.,0.,0.)->(0.,0.,1.)->(0.,0.,2.)->(0.,1.,0.)->(0.,1.,1.)->...
-// The upper limit for each value is given by 'bound' (val[i] <= dim[i])
-// Return false after all values of 'that' have reached their upper 
-// limit (in which case 'that''s values are all set back to 0.)
-// Return true else
-bool _VecFloatStepDelta(VecFloat* const that, 
-  const VecFloat* const bound, const VecFloat* const delta);
-
-// Step the values of the vector incrementally by delta
-// in the following order (for example) : 
-// (0.,0.,0.)->(0.,0.,1.)->(0.,0.,2.)->(0.,1.,0.)->(0.,1.,1.)->...
-// The lower limit for each value is given by 'from' (val[i] >= from[i])
-// The upper limit for each value is given by 'to' (val[i] <= to[i])
-// 'that' must be initialised to 'from' before the first call of this
-// function
-// Return false after all values of 'that' have reached their upper 
-// limit (in which case 'that''s values are all set back to from)
-// Return true else
-bool _VecFloatShiftStepDelta(VecFloat* const that, 
-  const VecFloat* const from, const VecFloat* const to, 
-  const VecFloat* const delta);
+float EigenSolverGetResidual(const EigenSolver* const that, 
+  const MatFloat* const mat);
 
-// Get the index of the max value in components of the vector 'that'
+// Calculate the Eigen values and vectors of the MatFloat 'that'
+// Same as _MatFloatGetEigenValues but using a temporary EigenSolver, 
+// if it doesn't converge the current approximation is returned
 #if BUILDMODE != 0 
 static inline 
 #endif 
-long _VecFloatGetIMaxVal(const VecFloat* const that);
-
-// Return a set of two vectors containing the bounds of the vectors in 
-// the GSet 'that'
-// The set must have at least one element
-// The returned set is ordered as follow: (boundMin, boundMax)
-GSetVecFloat _GSetVecFloatGetBounds(const GSetVecFloat* const that);
+GSetVecFloat _MatFloatGetEigenValuesFast(const MatFloat* const that);
 
-// -------------- MatFloat
+// -------------- PBRandom
 
 // ================= Data structure ===================
 
-// Vector of float values
-typedef struct MatFloat {
-  // Dimension (nbCol, nbLine)
-  const VecShort2D _dim;
-  // Values (memorized by lines)
-  float _val[0];
-} MatFloat;
-
-// Simple pod to hold the result of a QR decomposition
-typedef struct QRDecomp {
-  MatFloat* _Q;
-  MatFloat* _R;
-} QRDecomp;
+// Pseudo random number generator (xoshiro256**, Blackman and Vigna,
+// period 2^256-1) with an explicit state, to be used instead of the
+// global state of rand()/random() when results must be reproducible
+// or the generator used by several threads (one PBRandom per thread)
+typedef struct PBRandom {
+  // State
+  uint64_t _s[4];
+  // Second value of the last pair of Gaussian values
+  float _gauss;
+  // Flag memorizing if _gauss is available
+  bool _hasGauss;
+} PBRandom;
 
 // ================ Functions declaration ====================
 
-// Free memory used by the QRDecomp 'that'
+// Create a static PBRandom initialized with the seed 'seed'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void QRDecompFreeStatic(QRDecomp* const that);
-
-// Create a new MatFloat of dimension 'dim' (nbCol, nbLine)
-// Values are initalized to 0.0
-MatFloat* MatFloatCreate(const VecShort2D* const dim);
+PBRandom PBRandomCreateStatic(const uint64_t seed);
 
-// Set the MatFloat to the identity matrix
-// The matrix must be a square matrix
+// Reset the PBRandom 'that' with the seed 'seed'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void _MatFloatSetIdentity(MatFloat* const that);
+void PBRandomSeed(PBRandom* const that, const uint64_t seed);
 
-// Clone the MatFloat
-MatFloat* _MatFloatClone(const MatFloat* const that);
-
-// Copy the values of 'w' in 'that' (must have same dimensions)
+// Advance the PBRandom 'that' by 2^128 draws
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void _MatFloatCopy(MatFloat* const that, const MatFloat* const tho);
-
-// Function which return the JSON encoding of 'that' 
-JSONNode* _MatFloatEncodeAsJSON(MatFloat* const that);
-
-// Function which decode from JSON encoding 'json' to 'that'
-bool _MatFloatDecodeAsJSON(MatFloat** that, JSONNode* json);
-
-// Load the MatFloat from the stream
-// If the MatFloat is already allocated, it is freed before loading
-// Return true upon success, else false
-bool _MatFloatLoad(MatFloat** that, FILE* stream);
-
-// Save the MatFloat to the stream
-// If 'compact' equals true it saves in compact form, else it saves in 
-// readable form
-// Return true upon success, else false
-bool _MatFloatSave(MatFloat* const that, FILE* stream, bool compact);
-
-// Free the memory used by a MatFloat
-// Do nothing if arguments are invalid
-void _MatFloatFree(MatFloat** that);
-
-// Print the MatFloat on 'stream' with 'prec' digit precision
-// Do nothing if arguments are invalid
-void MatFloatPrintln(MatFloat* const that, FILE* stream, unsigned int prec);
-static inline void _MatFloatPrintlnDef(MatFloat* const that, FILE* stream) {
-  MatFloatPrintln(that, stream, 3);
-}
+void PBRandomJump(PBRandom* const that);
 
-// Return the value at index (col, line) of the MatFloat
-// Index starts at 0, index in matrix = line * nbCol + col
+// Return a copy of the PBRandom 'that' advanced by 'iStream' * 2^128
+// draws, streams with different 'iStream' don't overlap and can be 
+// given to different threads
 #if BUILDMODE != 0 
 static inline 
 #endif 
-float _MatFloatGet(const MatFloat* const that, 
-  VecShort2D* index);
+PBRandom PBRandomGetStream(const PBRandom* const that, 
+  const int iStream);
 
-// Set the value at index (col, line) of the MatFloat to 'v'
-// Index starts at 0, index in matrix = line * nbCol + col
+// Return the next 64 random bits of the PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void _MatFloatSet(MatFloat* const that, VecShort2D* index, float v);
+uint64_t PBRandomGetU64(PBRandom* const that);
 
-// Return the dimension of the MatFloat
+// Return a random float in [0.0, 1.0[ from the PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-const VecShort2D* _MatFloatDim(const MatFloat* const that);
+float PBRandomGetFloat(PBRandom* const that);
 
-// Return a VecShort2D containing the dimension of the MatFloat
+// Return a random float in ['min', 'max'[ from the PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-VecShort2D _MatFloatGetDim(const MatFloat* const that);
+float PBRandomGetFloatRange(PBRandom* const that, const float min, 
+  const float max);
 
-// Return the number of rows of the MatFloat 'that'
+// Return a random integer in [0, 'nb'[ from the PBRandom 'that'
+// 'nb' must be greater than 0
 #if BUILDMODE != 0 
 static inline 
 #endif 
-short _MatFloatGetNbRow(const MatFloat* const that);
+long PBRandomGetLong(PBRandom* const that, const long nb);
 
-// Return the number of columns of the MatFloat 'that'
+// Return a random float with a normal distribution of mean 'mean' and
+// standard deviation 'sigma' from the PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-short _MatFloatGetNbCol(const MatFloat* const that);
-
-// Return the inverse matrix of 'that'
-// The matrix must be a square matrix
-// Return NULL if the matrix is not invertible, or in some case when
-// the matrix's diagonal contains null values and the matrix's size
-// is greater than 3
-MatFloat* _MatFloatGetInv(const MatFloat* const that);
-
-// Return the product of matrix 'that' and vector 'v'
-// Number of columns of 'that' must equal dimension of 'v'
-VecFloat* _MatFloatGetProdVecFloat(
-  const MatFloat* const that, const VecFloat* v);
+float PBRandomGetGauss(PBRandom* const that, const float mean, 
+  const float sigma);
 
-// Return the product of vector 'v' and transpose of vector 'w'
-MatFloat* _MatFloatGetProdVecVecTransposeFloat(
-  const VecFloat* const v, 
-  const VecFloat* const w);
-
-// Return the product of matrix 'that' by matrix 'tho'
-// Number of columns of 'that' must equal number of line of 'tho'
-MatFloat* _MatFloatGetProdMatFloat(const MatFloat* const that, const MatFloat* tho);
-
-// Return the addition of matrix 'that' with matrix 'tho'
-// 'that' and 'tho' must have same dimensions
+// Fill the array 'res' with 'nb' random floats in [0.0, 1.0[ from the 
+// PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-MatFloat* _MatFloatGetAdd(MatFloat* const that, MatFloat* tho);
+void PBRandomFillFloat(PBRandom* const that, float* const res, 
+  const long nb);
 
-// Add matrix 'that' with matrix 'tho' and store the result in 'that'
-// 'that' and 'tho' must have same dimensions
+// Fill the array 'res' with 'nb' random floats with a normal 
+// distribution of mean 'mean' and standard deviation 'sigma' from the
+// PBRandom 'that'
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void _MatFloatAdd(MatFloat* const that, MatFloat* tho);
+void PBRandomFillGauss(PBRandom* const that, float* const res, 
+  const long nb, const float mean, const float sigma);
 
-// Multiply the matrix 'that' by 'a'
+// Seed rand() and random() with values drawn from the PBRandom 'that'
+// For the functions of the library which still use the global 
+// generator (GenAlg, GSetShuffle, KMeansClustersSearch, ...), to make
+// their results reproducible from a PBRandom
 #if BUILDMODE != 0 
 static inline 
 #endif 
-void _MatFloatScale(MatFloat* const that, const float a);
-
-// Return true if 'that' is equal to 'tho', false else
-bool _MatFloatIsEqual(MatFloat* const that, MatFloat* tho);
-
-// Calculate the Eigen values and vectors of the MatFloat 'that'
-// Return a set of VecFloat. The first VecFloat of the set contains 
-// the Eigen values, with values sorted from biggest to 
-// smallest (in absolute value). The following VecFloat are the 
-// respectiev Eigen vectors
-// 'that' must be a 2D square matrix
-// Return the identity if the QR decompostion fails
-// http://madrury.github.io/jekyll/update/statistics/2017/10/04/qr-algorithm.html
-// TODO: should be improved with the Hessenberg QR method
-// https://www.math.kth.se/na/SF2524/matber15/qrmethod.pdf
-GSetVecFloat _MatFloatGetEigenValues(const MatFloat* const that);
+void PBRandomSeedGlobal(PBRandom* const that);
 
-// Calculate the QR decomposition of the MatFloat 'that' using the 
-// Householder algorithm
-// Return {NULL, NULL} if the MatFloat couldn't be decomposed
-// http://www.seas.ucla.edu/~vandenbe/133A/lectures/qr.pdf
-QRDecomp _MatFloatGetQR(const MatFloat* const that);
-
-// Calculate the transposed of the MatFloat 'that'
-MatFloat* _MatFloatGetTranspose(const MatFloat* const that);
+// Shuffle the GSet 'that' with the PBRandom 'rng'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+void _GSetShuffleWith(GSet* const that, PBRandom* const rng);
 
 // -------------- Gauss
 
@@ -1596,6 +3144,13 @@ static inline
 #endif 
 float GaussRnd(Gauss* const that);
 
+// Return a random value according to the Gauss 'that' drawn from the 
+// PBRandom 'rng'
+#if BUILDMODE != 0 
+static inline 
+#endif 
+float GaussRndWith(const Gauss* const that, PBRandom* const rng);
+
 // -------------- Smoother
 
 // ================= Define ==================
@@ -1657,6 +3212,16 @@ typedef struct SysLinEq {
 // Return NULL if we couldn't create the SysLinEq
 SysLinEq* _SLECreate(const MatFloat* const m, const VecFloat* const v);
 
+// Create a new SysLinEq with matrix 'm' and vector 'v'
+// Same as _SLECreate but the inverse matrix is calculated with the LU
+// decomposition of 'm'
+// Return NULL if 'm' is singular
+#if BUILDMODE != 0 
+static inline 
+#endif 
+SysLinEq* _SLECreateFast(const MatFloat* const m, 
+  const VecFloat* const v);
+
 // Free the memory used by the SysLinEq
 // Do nothing if arguments are invalid
 void SysLinEqFree(SysLinEq** that);
@@ -1875,33 +3440,48 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat*: _VecFloatClone, \
   const VecShort*: _VecShortClone, \
   const VecLong*: _VecLongClone, \
+  VecDouble*: _VecDoubleClone, \
+  const VecDouble*: _VecDoubleClone, \
   default: PBErrInvalidPolymorphism)(Vec)
 
 #define VecEncodeAsJSON(Vec) _Generic(Vec, \
-  VecFloat*: _VecFloatEncodeAsJSON, \
+  VecFloat*: _VecFloatEncodeAsJSONFast, \
   VecShort*: _VecShortEncodeAsJSON, \
   VecLong*: _VecLongEncodeAsJSON, \
-  const VecFloat*: _VecFloatEncodeAsJSON, \
+  const VecFloat*: _VecFloatEncodeAsJSONFast, \
   const VecShort*: _VecShortEncodeAsJSON, \
   const VecLong*: _VecLongEncodeAsJSON, \
+  VecDouble*: _VecDoubleEncodeAsJSON, \
+  const VecDouble*: _VecDoubleEncodeAsJSON, \
   default: PBErrInvalidPolymorphism)(Vec)
 
 #define VecDecodeAsJSON(VecRef, Json) _Generic(VecRef, \
-  VecFloat**: _VecFloatDecodeAsJSON, \
+  VecFloat**: _VecFloatDecodeAsJSONFast, \
   VecShort**: _VecShortDecodeAsJSON, \
   VecLong**: _VecLongDecodeAsJSON, \
+  VecDouble**: _VecDoubleDecodeAsJSON, \
   default: PBErrInvalidPolymorphism)(VecRef, Json)
 
+#define VecEncodeAsJSONStream(Vec, Writer) _Generic(Vec, \
+  VecFloat*: _VecFloatEncodeAsJSONStream, \
+  VecShort*: _VecShortEncodeAsJSONStream, \
+  VecLong*: _VecLongEncodeAsJSONStream, \
+  const VecFloat*: _VecFloatEncodeAsJSONStream, \
+  const VecShort*: _VecShortEncodeAsJSONStream, \
+  const VecLong*: _VecLongEncodeAsJSONStream, \
+  default: PBErrInvalidPolymorphism)(Vec, Writer)
+
 #define VecLoad(VecRef, Stream) _Generic(VecRef, \
-  VecFloat**: _VecFloatLoad, \
+  VecFloat**: _VecFloatLoadFast, \
   VecShort**: _VecShortLoad, \
   VecLong**: _VecLongLoad, \
+  VecDouble**: _VecDoubleLoad, \
   default: PBErrInvalidPolymorphism)(VecRef, Stream)
 
 #define VecSave(Vec, Stream, Compact) _Generic(Vec, \
-  VecFloat*: _VecFloatSave, \
-  VecFloat2D*: _VecFloatSave, \
-  VecFloat3D*: _VecFloatSave, \
+  VecFloat*: _VecFloatSaveFast, \
+  VecFloat2D*: _VecFloatSaveFast, \
+  VecFloat3D*: _VecFloatSaveFast, \
   VecShort*: _VecShortSave, \
   VecShort2D*: _VecShortSave, \
   VecShort3D*: _VecShortSave, \
@@ -1910,9 +3490,9 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecLong2D*: _VecLongSave, \
   VecLong3D*: _VecLongSave, \
   VecLong4D*: _VecLongSave, \
-  const VecFloat*: _VecFloatSave, \
-  const VecFloat2D*: _VecFloatSave, \
-  const VecFloat3D*: _VecFloatSave, \
+  const VecFloat*: _VecFloatSaveFast, \
+  const VecFloat2D*: _VecFloatSaveFast, \
+  const VecFloat3D*: _VecFloatSaveFast, \
   const VecShort*: _VecShortSave, \
   const VecShort2D*: _VecShortSave, \
   const VecShort3D*: _VecShortSave, \
@@ -1921,6 +3501,8 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong2D*: _VecLongSave, \
   const VecLong3D*: _VecLongSave, \
   const VecLong4D*: _VecLongSave, \
+  VecDouble*: _VecDoubleSave, \
+  const VecDouble*: _VecDoubleSave, \
   default: PBErrInvalidPolymorphism)( \
     _Generic(Vec,  \
       VecFloat2D*: (const VecFloat*)(Vec), \
@@ -1942,16 +3524,68 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
       default: Vec),  \
     Stream, Compact)
 
+#define VecLoadBin(VecRef, Stream) _Generic(VecRef, \
+  VecFloat**: _VecFloatLoadBin, \
+  VecShort**: _VecShortLoadBin, \
+  VecLong**: _VecLongLoadBin, \
+  default: PBErrInvalidPolymorphism)(VecRef, Stream)
+
+#define VecSaveBin(Vec, Stream, Checksum) _Generic(Vec, \
+  VecFloat*: _VecFloatSaveBin, \
+  VecFloat2D*: _VecFloatSaveBin, \
+  VecFloat3D*: _VecFloatSaveBin, \
+  VecShort*: _VecShortSaveBin, \
+  VecShort2D*: _VecShortSaveBin, \
+  VecShort3D*: _VecShortSaveBin, \
+  VecShort4D*: _VecShortSaveBin, \
+  VecLong*: _VecLongSaveBin, \
+  VecLong2D*: _VecLongSaveBin, \
+  VecLong3D*: _VecLongSaveBin, \
+  VecLong4D*: _VecLongSaveBin, \
+  const VecFloat*: _VecFloatSaveBin, \
+  const VecFloat2D*: _VecFloatSaveBin, \
+  const VecFloat3D*: _VecFloatSaveBin, \
+  const VecShort*: _VecShortSaveBin, \
+  const VecShort2D*: _VecShortSaveBin, \
+  const VecShort3D*: _VecShortSaveBin, \
+  const VecShort4D*: _VecShortSaveBin, \
+  const VecLong*: _VecLongSaveBin, \
+  const VecLong2D*: _VecLongSaveBin, \
+  const VecLong3D*: _VecLongSaveBin, \
+  const VecLong4D*: _VecLongSaveBin, \
+  default: PBErrInvalidPolymorphism)( \
+    _Generic(Vec,  \
+      VecFloat2D*: (const VecFloat*)(Vec), \
+      VecFloat3D*: (const VecFloat*)(Vec), \
+      VecShort2D*: (const VecShort*)(Vec), \
+      VecShort3D*: (const VecShort*)(Vec), \
+      VecShort4D*: (const VecShort*)(Vec), \
+      VecLong2D*: (const VecLong*)(Vec), \
+      VecLong3D*: (const VecLong*)(Vec), \
+      VecLong4D*: (const VecLong*)(Vec), \
+      const VecFloat2D*: (const VecFloat*)(Vec), \
+      const VecFloat3D*: (const VecFloat*)(Vec), \
+      const VecShort2D*: (const VecShort*)(Vec), \
+      const VecShort3D*: (const VecShort*)(Vec), \
+      const VecShort4D*: (const VecShort*)(Vec), \
+      const VecLong2D*: (const VecLong*)(Vec), \
+      const VecLong3D*: (const VecLong*)(Vec), \
+      const VecLong4D*: (const VecLong*)(Vec), \
+      default: Vec),  \
+    Stream, Checksum)
+
 #define VecFree(VecRef) _Generic(VecRef, \
   VecFloat**: _VecFloatFree, \
   VecShort**: _VecShortFree, \
   VecLong**: _VecLongFree, \
+  VecDouble**: _VecDoubleFree, \
   default: PBErrInvalidPolymorphism)(VecRef)
 
 #define VecPrint(Vec, Stream) _Generic(Vec, \
   VecFloat*: _VecFloatPrintDef, \
   VecFloat2D*: _VecFloatPrintDef, \
   VecFloat3D*: _VecFloatPrintDef, \
+  VecFloat4D*: _VecFloatPrintDef, \
   VecShort*: _VecShortPrint, \
   VecShort2D*: _VecShortPrint, \
   VecShort3D*: _VecShortPrint, \
@@ -1963,6 +3597,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat*: _VecFloatPrintDef, \
   const VecFloat2D*: _VecFloatPrintDef, \
   const VecFloat3D*: _VecFloatPrintDef, \
+  const VecFloat4D*: _VecFloatPrintDef, \
   const VecShort*: _VecShortPrint, \
   const VecShort2D*: _VecShortPrint, \
   const VecShort3D*: _VecShortPrint, \
@@ -1971,10 +3606,13 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong2D*: _VecLongPrint, \
   const VecLong3D*: _VecLongPrint, \
   const VecLong4D*: _VecLongPrint, \
+  VecDouble*: _VecDoublePrintDef, \
+  const VecDouble*: _VecDoublePrintDef, \
   default: PBErrInvalidPolymorphism)( \
     _Generic(Vec,  \
       VecFloat2D*: (const VecFloat*)(Vec), \
       VecFloat3D*: (const VecFloat*)(Vec), \
+      VecFloat4D*: (const VecFloat*)(Vec), \
       VecShort2D*: (const VecShort*)(Vec), \
       VecShort3D*: (const VecShort*)(Vec), \
       VecShort4D*: (const VecShort*)(Vec), \
@@ -1983,6 +3621,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
       VecLong4D*: (const VecLong*)(Vec), \
       const VecFloat2D*: (const VecFloat*)(Vec), \
       const VecFloat3D*: (const VecFloat*)(Vec), \
+      const VecFloat4D*: (const VecFloat*)(Vec), \
       const VecShort2D*: (const VecShort*)(Vec), \
       const VecShort3D*: (const VecShort*)(Vec), \
       const VecShort4D*: (const VecShort*)(Vec), \
@@ -1998,6 +3637,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecFloat*: _VecFloatGet, \
   VecFloat2D*: _VecFloatGet2D, \
   VecFloat3D*: _VecFloatGet3D, \
+  VecFloat4D*: _VecFloatGet4D, \
   VecShort*: _VecShortGet, \
   VecShort2D*: _VecShortGet2D, \
   VecShort3D*: _VecShortGet3D, \
@@ -2009,6 +3649,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat*: _VecFloatGet, \
   const VecFloat2D*: _VecFloatGet2D, \
   const VecFloat3D*: _VecFloatGet3D, \
+  const VecFloat4D*: _VecFloatGet4D, \
   const VecShort*: _VecShortGet, \
   const VecShort2D*: _VecShortGet2D, \
   const VecShort3D*: _VecShortGet3D, \
@@ -2017,12 +3658,15 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong2D*: _VecLongGet2D, \
   const VecLong3D*: _VecLongGet3D, \
   const VecLong4D*: _VecLongGet4D, \
+  VecDouble*: _VecDoubleGet, \
+  const VecDouble*: _VecDoubleGet, \
   default: PBErrInvalidPolymorphism)(Vec, Index)
 
 #define VecSet(Vec, Index, Val) _Generic(Vec, \
   VecFloat*: _VecFloatSet, \
   VecFloat2D*: _VecFloatSet2D, \
   VecFloat3D*: _VecFloatSet3D, \
+  VecFloat4D*: _VecFloatSet4D, \
   VecShort*: _VecShortSet, \
   VecShort2D*: _VecShortSet2D, \
   VecShort3D*: _VecShortSet3D, \
@@ -2031,6 +3675,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecLong2D*: _VecLongSet2D, \
   VecLong3D*: _VecLongSet3D, \
   VecLong4D*: _VecLongSet4D, \
+  VecDouble*: _VecDoubleSet, \
   default: PBErrInvalidPolymorphism)(Vec, Index, Val)
 
 #define VecSetAdd(Vec, Index, Val) _Generic(Vec, \
@@ -2045,6 +3690,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecLong2D*: _VecLongSetAdd2D, \
   VecLong3D*: _VecLongSetAdd3D, \
   VecLong4D*: _VecLongSetAdd4D, \
+  VecDouble*: _VecDoubleSetAdd, \
   default: PBErrInvalidPolymorphism)(Vec, Index, Val)
 
 #define VecSetNull(Vec) _Generic(Vec, \
@@ -2059,6 +3705,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecLong2D*: _VecLongSetNull, \
   VecLong3D*: _VecLongSetNull, \
   VecLong4D*: _VecLongSetNull, \
+  VecDouble*: _VecDoubleSetNull, \
   default: PBErrInvalidPolymorphism)( \
     _Generic(Vec,  \
       VecFloat2D*: (VecFloat*)(Vec), \
@@ -2083,6 +3730,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecLong2D*: _VecLongSetAll, \
   VecLong3D*: _VecLongSetAll, \
   VecLong4D*: _VecLongSetAll, \
+  VecDouble*: _VecDoubleSetAll, \
   default: PBErrInvalidPolymorphism)( \
     _Generic(Vec,  \
       VecFloat2D*: (VecFloat*)(Vec), \
@@ -2172,6 +3820,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     const VecLong*: _VecLongCopy, \
     const VecLong4D*: _VecLongCopy, \
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecSrc, \
+    VecDouble*: _VecDoubleCopy, \
+    const VecDouble*: _VecDoubleCopy, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)( \
     _Generic(VecDest,  \
       VecFloat2D*: (VecFloat*)(VecDest), \
@@ -2206,6 +3858,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecFloat*: _VecFloatGetDim, \
   VecFloat2D*: _VecFloatGetDim, \
   VecFloat3D*: _VecFloatGetDim, \
+  VecFloat4D*: _VecFloatGetDim, \
   VecShort*: _VecShortGetDim, \
   VecShort2D*: _VecShortGetDim, \
   VecShort3D*: _VecShortGetDim, \
@@ -2217,6 +3870,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat*: _VecFloatGetDim, \
   const VecFloat2D*: _VecFloatGetDim, \
   const VecFloat3D*: _VecFloatGetDim, \
+  const VecFloat4D*: _VecFloatGetDim, \
   const VecShort*: _VecShortGetDim, \
   const VecShort2D*: _VecShortGetDim, \
   const VecShort3D*: _VecShortGetDim, \
@@ -2225,11 +3879,14 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong2D*: _VecLongGetDim, \
   const VecLong3D*: _VecLongGetDim, \
   const VecLong4D*: _VecLongGetDim, \
+  VecDouble*: _VecDoubleGetDim, \
+  const VecDouble*: _VecDoubleGetDim, \
   default: PBErrInvalidPolymorphism)( \
     _Generic(Vec, \
       VecFloat*: (const VecFloat*)(Vec), \
       VecFloat2D*: (const VecFloat*)(Vec), \
       VecFloat3D*: (const VecFloat*)(Vec), \
+      VecFloat4D*: (const VecFloat*)(Vec), \
       VecShort*: (const VecShort*)(Vec), \
       VecShort2D*: (const VecShort*)(Vec), \
       VecShort3D*: (const VecShort*)(Vec), \
@@ -2240,6 +3897,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
       VecLong4D*: (const VecLong*)(Vec), \
       const VecFloat2D*: (const VecFloat*)(Vec), \
       const VecFloat3D*: (const VecFloat*)(Vec), \
+      const VecFloat4D*: (const VecFloat*)(Vec), \
       const VecShort2D*: (const VecShort*)(Vec), \
       const VecShort3D*: (const VecShort*)(Vec), \
       const VecShort4D*: (const VecShort*)(Vec), \
@@ -2261,15 +3919,20 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   VecFloat*: _VecFloatNorm, \
   VecFloat2D*: _VecFloatNorm2D, \
   VecFloat3D*: _VecFloatNorm3D, \
+  VecFloat4D*: _VecFloatNorm4D, \
   const VecFloat*: _VecFloatNorm, \
   const VecFloat2D*: _VecFloatNorm2D, \
   const VecFloat3D*: _VecFloatNorm3D, \
+  const VecFloat4D*: _VecFloatNorm4D, \
+  VecDouble*: _VecDoubleNorm, \
+  const VecDouble*: _VecDoubleNorm, \
   default: PBErrInvalidPolymorphism)(Vec)
 
 #define VecNormalise(Vec) _Generic(Vec, \
   VecFloat*: _VecFloatNormalise, \
   VecFloat2D*: _VecFloatNormalise2D, \
   VecFloat3D*: _VecFloatNormalise3D, \
+  VecDouble*: _VecDoubleNormalise, \
   default: PBErrInvalidPolymorphism)(Vec)
 
 #define VecDist(VecA, VecB) _Generic(VecA, \
@@ -2361,6 +4024,14 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     VecLong4D*: _VecLongHamiltonDist4D,\
     const VecLong4D*: _VecLongHamiltonDist4D,\
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleDist, \
+    const VecDouble*: _VecDoubleDist, \
+    default: PBErrInvalidPolymorphism), \
+  const VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleDist, \
+    const VecDouble*: _VecDoubleDist, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, VecB)
 
 #define VecHamiltonDist(VecA, VecB) _Generic(VecA, \
@@ -2545,6 +4216,21 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, VecB)
 
+#define VecDotProdDouble(VecA, VecB) _Generic(VecA, \
+  VecFloat*: _VecFloatDotProdDouble, \
+  const VecFloat*: _VecFloatDotProdDouble, \
+  default: PBErrInvalidPolymorphism)(VecA, VecB)
+
+#define VecNormDouble(Vec) _Generic(Vec, \
+  VecFloat*: _VecFloatNormDouble, \
+  const VecFloat*: _VecFloatNormDouble, \
+  default: PBErrInvalidPolymorphism)(Vec)
+
+#define VecDistDouble(VecA, VecB) _Generic(VecA, \
+  VecFloat*: _VecFloatDistDouble, \
+  const VecFloat*: _VecFloatDistDouble, \
+  default: PBErrInvalidPolymorphism)(VecA, VecB)
+
 #define VecIsEqual(VecA, VecB) _Generic(VecA, \
   VecFloat*: _Generic(VecB, \
     VecFloat*: _VecFloatIsEqual, \
@@ -2698,6 +4384,14 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     const VecLong*: _VecLongIsEqual,\
     const VecLong4D*: _VecLongIsEqual,\
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleIsEqual, \
+    const VecDouble*: _VecDoubleIsEqual, \
+    default: PBErrInvalidPolymorphism), \
+  const VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleIsEqual, \
+    const VecDouble*: _VecDoubleIsEqual, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)( \
     _Generic(VecA,  \
       VecFloat2D*: (const VecFloat*)(VecA), \
@@ -2781,6 +4475,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     VecLong4D*: _VecLongOp4D, \
     const VecLong4D*: _VecLongOp4D, \
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleOp, \
+    const VecDouble*: _VecDoubleOp, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, CoeffA, VecB, CoeffB)
 
 #define VecGetOp(VecA, CoeffA, VecB, CoeffB) _Generic(VecA, \
@@ -2872,6 +4570,14 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     VecLong4D*: _VecLongGetOp4D, \
     const VecLong4D*: _VecLongGetOp4D, \
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleGetOp, \
+    const VecDouble*: _VecDoubleGetOp, \
+    default: PBErrInvalidPolymorphism), \
+  const VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleGetOp, \
+    const VecDouble*: _VecDoubleGetOp, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, CoeffA, VecB, CoeffB)
 
 #define VecHadamardProd(VecA, VecB) _Generic(VecA, \
@@ -2919,6 +4625,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     VecLong4D*: _VecLongHadamardProd4D, \
     const VecLong4D*: _VecLongHadamardProd4D, \
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleHadamardProd, \
+    const VecDouble*: _VecDoubleHadamardProd, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, VecB)
 
 #define VecGetHadamardProd(VecA, VecB) _Generic(VecA, \
@@ -3010,12 +4720,21 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     VecLong4D*: _VecLongGetHadamardProd4D, \
     const VecLong4D*: _VecLongGetHadamardProd4D, \
     default: PBErrInvalidPolymorphism), \
+  VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleGetHadamardProd, \
+    const VecDouble*: _VecDoubleGetHadamardProd, \
+    default: PBErrInvalidPolymorphism), \
+  const VecDouble*: _Generic(VecB, \
+    VecDouble*: _VecDoubleGetHadamardProd, \
+    const VecDouble*: _VecDoubleGetHadamardProd, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(VecA, VecB)
 
 #define VecScale(Vec, Scale) _Generic(Vec, \
   VecFloat*: _VecFloatScale, \
   VecFloat2D*: _VecFloatScale2D, \
   VecFloat3D*: _VecFloatScale3D, \
+  VecDouble*: _VecDoubleScale, \
   default: PBErrInvalidPolymorphism)(Vec, Scale)
 
 #define VecGetScale(Vec, Scale) _Generic(Vec, \
@@ -3025,6 +4744,8 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat2D*: _VecFloatGetScale2D, \
   VecFloat3D*: _VecFloatGetScale3D, \
   const VecFloat3D*: _VecFloatGetScale3D, \
+  VecDouble*: _VecDoubleGetScale, \
+  const VecDouble*: _VecDoubleGetScale, \
   default: PBErrInvalidPolymorphism)(Vec, Scale)
 
 #define VecRot(Vec, Theta) _Generic(Vec, \
@@ -3046,10 +4767,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     (VecFloat3D*)(Axis), Theta)
 
 #define VecGetRotAxis(Vec, Axis, Theta) _Generic(Vec, \
-  VecFloat*: _VecFloatGetRotAxis, \
-  const VecFloat*: _VecFloatGetRotAxis, \
-  VecFloat3D*: _VecFloatGetRotAxis, \
-  const VecFloat3D*: _VecFloatGetRotAxis, \
+  VecFloat*: _VecFloatGetRotAxisFast, \
+  const VecFloat*: _VecFloatGetRotAxisFast, \
+  VecFloat3D*: _VecFloatGetRotAxisFast, \
+  const VecFloat3D*: _VecFloatGetRotAxisFast, \
   default: PBErrInvalidPolymorphism)((const VecFloat3D*)(Vec), \
     (const VecFloat3D*)(Axis), Theta)
 
@@ -3059,10 +4780,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   default: PBErrInvalidPolymorphism)((VecFloat3D*)(Vec), Theta)
 
 #define VecGetRotX(Vec, Theta) _Generic(Vec, \
-  VecFloat*: _VecFloatGetRotX, \
-  const VecFloat*: _VecFloatGetRotX, \
-  VecFloat3D*: _VecFloatGetRotX, \
-  const VecFloat3D*: _VecFloatGetRotX, \
+  VecFloat*: _VecFloatGetRotXFast, \
+  const VecFloat*: _VecFloatGetRotXFast, \
+  VecFloat3D*: _VecFloatGetRotXFast, \
+  const VecFloat3D*: _VecFloatGetRotXFast, \
   default: PBErrInvalidPolymorphism)((const VecFloat3D*)(Vec), Theta)
 
 #define VecRotY(Vec, Theta) _Generic(Vec, \
@@ -3071,10 +4792,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   default: PBErrInvalidPolymorphism)((VecFloat3D*)(Vec), Theta)
 
 #define VecGetRotY(Vec, Theta) _Generic(Vec, \
-  VecFloat*: _VecFloatGetRotY, \
-  const VecFloat*: _VecFloatGetRotY, \
-  VecFloat3D*: _VecFloatGetRotY, \
-  const VecFloat3D*: _VecFloatGetRotY, \
+  VecFloat*: _VecFloatGetRotYFast, \
+  const VecFloat*: _VecFloatGetRotYFast, \
+  VecFloat3D*: _VecFloatGetRotYFast, \
+  const VecFloat3D*: _VecFloatGetRotYFast, \
   default: PBErrInvalidPolymorphism)((const VecFloat3D*)(Vec), Theta)
 
 #define VecRotZ(Vec, Theta) _Generic(Vec, \
@@ -3083,10 +4804,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   default: PBErrInvalidPolymorphism)((VecFloat3D*)(Vec), Theta)
 
 #define VecGetRotZ(Vec, Theta) _Generic(Vec, \
-  VecFloat*: _VecFloatGetRotZ, \
-  const VecFloat*: _VecFloatGetRotZ, \
-  VecFloat3D*: _VecFloatGetRotZ, \
-  const VecFloat3D*: _VecFloatGetRotZ, \
+  VecFloat*: _VecFloatGetRotZFast, \
+  const VecFloat*: _VecFloatGetRotZFast, \
+  VecFloat3D*: _VecFloatGetRotZFast, \
+  const VecFloat3D*: _VecFloatGetRotZFast, \
   default: PBErrInvalidPolymorphism)((const VecFloat3D*)(Vec), Theta)
 
 #define VecDotProd(VecA, VecB) _Generic(VecA, \
@@ -3112,6 +4833,10 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat2D*: _VecFloatDotProd2D, \
   VecFloat3D*: _VecFloatDotProd3D, \
   const VecFloat3D*: _VecFloatDotProd3D, \
+  VecFloat4D*: _VecFloatDotProd4D, \
+  const VecFloat4D*: _VecFloatDotProd4D, \
+  VecDouble*: _VecDoubleDotProd, \
+  const VecDouble*: _VecDoubleDotProd, \
   default: PBErrInvalidPolymorphism) (VecA, VecB) \
 
 #define VecCrossProd(VecA, VecB) _Generic(VecA, \
@@ -3324,6 +5049,8 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong3D*: _VecLongGetMaxVal, \
   VecLong4D*: _VecLongGetMaxVal, \
   const VecLong4D*: _VecLongGetMaxVal, \
+  VecDouble*: _VecDoubleGetMaxVal, \
+  const VecDouble*: _VecDoubleGetMaxVal, \
   default: PBErrInvalidPolymorphism) (_Generic(Vec, \
     VecFloat2D*: (const VecFloat*)(Vec), \
     const VecFloat2D*: (const VecFloat*)(Vec), \
@@ -3366,6 +5093,8 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecLong3D*: _VecLongGetMinVal, \
   VecLong4D*: _VecLongGetMinVal, \
   const VecLong4D*: _VecLongGetMinVal, \
+  VecDouble*: _VecDoubleGetMinVal, \
+  const VecDouble*: _VecDoubleGetMinVal, \
   default: PBErrInvalidPolymorphism) (_Generic(Vec, \
     VecFloat2D*: (const VecFloat*)(Vec), \
     const VecFloat2D*: (const VecFloat*)(Vec), \
@@ -3568,42 +5297,65 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
 #define MatClone(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatClone, \
   const MatFloat*: _MatFloatClone, \
+  MatDouble*: _MatDoubleClone, \
+  const MatDouble*: _MatDoubleClone, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatEncodeAsJSON(Mat) _Generic(Mat, \
-  MatFloat*: _MatFloatEncodeAsJSON, \
-  const MatFloat*: _MatFloatEncodeAsJSON, \
+  MatFloat*: _MatFloatEncodeAsJSONFast, \
+  const MatFloat*: _MatFloatEncodeAsJSONFast, \
+  MatDouble*: _MatDoubleEncodeAsJSON, \
+  const MatDouble*: _MatDoubleEncodeAsJSON, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatDecodeAsJSON(MatRef, Json) _Generic(MatRef, \
-  MatFloat**: _MatFloatDecodeAsJSON, \
+  MatFloat**: _MatFloatDecodeAsJSONFast, \
+  MatDouble**: _MatDoubleDecodeAsJSON, \
   default: PBErrInvalidPolymorphism)(MatRef, Json)
 
 #define MatLoad(MatRef, Stream) _Generic(MatRef, \
-  MatFloat**: _MatFloatLoad, \
+  MatFloat**: _MatFloatLoadFast, \
+  MatDouble**: _MatDoubleLoad, \
   default: PBErrInvalidPolymorphism)(MatRef, Stream)
 
 #define MatSave(Mat, Stream, Compact) _Generic(Mat, \
-  MatFloat*: _MatFloatSave, \
-  const MatFloat*: _MatFloatSave, \
+  MatFloat*: _MatFloatSaveFast, \
+  const MatFloat*: _MatFloatSaveFast, \
+  MatDouble*: _MatDoubleSave, \
+  const MatDouble*: _MatDoubleSave, \
   default: PBErrInvalidPolymorphism)(Mat, Stream, Compact)
 
+#define MatLoadBin(MatRef, Stream) _Generic(MatRef, \
+  MatFloat**: _MatFloatLoadBin, \
+  default: PBErrInvalidPolymorphism)(MatRef, Stream)
+
+#define MatSaveBin(Mat, Stream, Checksum) _Generic(Mat, \
+  MatFloat*: _MatFloatSaveBin, \
+  const MatFloat*: _MatFloatSaveBin, \
+  default: PBErrInvalidPolymorphism)(Mat, Stream, Checksum)
+
 #define MatFree(MatRef) _Generic(MatRef, \
   MatFloat**: _MatFloatFree, \
+  MatDouble**: _MatDoubleFree, \
   default: PBErrInvalidPolymorphism)(MatRef)
 
 #define MatPrintln(Mat, Stream) _Generic(Mat, \
   MatFloat*: _MatFloatPrintlnDef, \
   const MatFloat*: _MatFloatPrintlnDef, \
+  MatDouble*: _MatDoublePrintlnDef, \
+  const MatDouble*: _MatDoublePrintlnDef, \
   default: PBErrInvalidPolymorphism)(Mat, Stream)
 
 #define MatGet(Mat, VecIndex) _Generic(Mat, \
   MatFloat*: _MatFloatGet, \
   const MatFloat*: _MatFloatGet, \
+  MatDouble*: _MatDoubleGet, \
+  const MatDouble*: _MatDoubleGet, \
   default: PBErrInvalidPolymorphism)(Mat, VecIndex)
 
 #define MatSet(Mat, VecIndex, Val) _Generic(Mat, \
   MatFloat*: _MatFloatSet, \
+  MatDouble*: _MatDoubleSet, \
   default: PBErrInvalidPolymorphism)(Mat, VecIndex, Val)
 
 #define MatCopy(MatDest, MatSrc) _Generic(MatDest, \
@@ -3611,21 +5363,29 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     MatFloat*: _MatFloatCopy, \
     const MatFloat*: _MatFloatCopy, \
     default: PBErrInvalidPolymorphism), \
+  MatDouble*: _Generic(MatSrc, \
+    MatDouble*: _MatDoubleCopy, \
+    const MatDouble*: _MatDoubleCopy, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(MatDest, MatSrc)
 
 #define MatDim(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatDim, \
   const MatFloat*: _MatFloatDim, \
+  MatDouble*: _MatDoubleDim, \
+  const MatDouble*: _MatDoubleDim, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetDim(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatGetDim, \
   const MatFloat*: _MatFloatGetDim, \
+  MatDouble*: _MatDoubleGetDim, \
+  const MatDouble*: _MatDoubleGetDim, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetEigenValues(Mat) _Generic(Mat, \
-  MatFloat*: _MatFloatGetEigenValues, \
-  const MatFloat*: _MatFloatGetEigenValues, \
+  MatFloat*: _MatFloatGetEigenValuesFast, \
+  const MatFloat*: _MatFloatGetEigenValuesFast, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetQR(Mat) _Generic(Mat, \
@@ -3634,54 +5394,150 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetInv(Mat) _Generic(Mat, \
-  MatFloat*: _MatFloatGetInv, \
-  const MatFloat*: _MatFloatGetInv, \
+  MatFloat*: _MatFloatGetInvFast, \
+  const MatFloat*: _MatFloatGetInvFast, \
+  MatDouble*: _MatDoubleGetInv, \
+  const MatDouble*: _MatDoubleGetInv, \
   default: PBErrInvalidPolymorphism)(Mat)
 
+#define MatGetLU(Mat) _Generic(Mat, \
+  MatFloat*: _MatFloatGetLU, \
+  const MatFloat*: _MatFloatGetLU, \
+  default: PBErrInvalidPolymorphism)(Mat)
+
+#define MatGetCholesky(Mat) _Generic(Mat, \
+  MatFloat*: _MatFloatGetCholesky, \
+  const MatFloat*: _MatFloatGetCholesky, \
+  default: PBErrInvalidPolymorphism)(Mat)
+
+#define MatCholeskySolve(Mat, Vec, Res) _Generic(Mat, \
+  MatFloat*: _MatFloatCholeskySolve, \
+  const MatFloat*: _MatFloatCholeskySolve, \
+  default: PBErrInvalidPolymorphism)(Mat, (const VecFloat*)(Vec), \
+    (VecFloat*)(Res))
+
 #define MatGetTranspose(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatGetTranspose, \
   const MatFloat*: _MatFloatGetTranspose, \
+  MatDouble*: _MatDoubleGetTranspose, \
+  const MatDouble*: _MatDoubleGetTranspose, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetNbRow(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatGetNbRow, \
   const MatFloat*: _MatFloatGetNbRow, \
+  MatDouble*: _MatDoubleGetNbRow, \
+  const MatDouble*: _MatDoubleGetNbRow, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetNbCol(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatGetNbCol, \
   const MatFloat*: _MatFloatGetNbCol, \
+  MatDouble*: _MatDoubleGetNbCol, \
+  const MatDouble*: _MatDoubleGetNbCol, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatGetProdMat(MatA, MatB) _Generic(MatA, \
   MatFloat*: _Generic(MatB, \
-    MatFloat*: _MatFloatGetProdMatFloat, \
-    const MatFloat*: _MatFloatGetProdMatFloat, \
+    MatFloat*: _MatFloatGetProdMatFloatFast, \
+    const MatFloat*: _MatFloatGetProdMatFloatFast, \
     default: PBErrInvalidPolymorphism), \
   const MatFloat*: _Generic(MatB, \
-    MatFloat*: _MatFloatGetProdMatFloat, \
-    const MatFloat*: _MatFloatGetProdMatFloat, \
+    MatFloat*: _MatFloatGetProdMatFloatFast, \
+    const MatFloat*: _MatFloatGetProdMatFloatFast, \
+    default: PBErrInvalidPolymorphism), \
+  MatDouble*: _Generic(MatB, \
+    MatDouble*: _MatDoubleGetProdMatDouble, \
+    const MatDouble*: _MatDoubleGetProdMatDouble, \
+    default: PBErrInvalidPolymorphism), \
+  const MatDouble*: _Generic(MatB, \
+    MatDouble*: _MatDoubleGetProdMatDouble, \
+    const MatDouble*: _MatDoubleGetProdMatDouble, \
+    default: PBErrInvalidPolymorphism), \
+  MatFloat3x3*: _Generic(MatB, \
+    MatFloat3x3*: _MatFloatGetProdMatFloat3x3, \
+    const MatFloat3x3*: _MatFloatGetProdMatFloat3x3, \
+    default: PBErrInvalidPolymorphism), \
+  const MatFloat3x3*: _Generic(MatB, \
+    MatFloat3x3*: _MatFloatGetProdMatFloat3x3, \
+    const MatFloat3x3*: _MatFloatGetProdMatFloat3x3, \
+    default: PBErrInvalidPolymorphism), \
+  MatFloat4x4*: _Generic(MatB, \
+    MatFloat4x4*: _MatFloatGetProdMatFloat4x4, \
+    const MatFloat4x4*: _MatFloatGetProdMatFloat4x4, \
+    default: PBErrInvalidPolymorphism), \
+  const MatFloat4x4*: _Generic(MatB, \
+    MatFloat4x4*: _MatFloatGetProdMatFloat4x4, \
+    const MatFloat4x4*: _MatFloatGetProdMatFloat4x4, \
     default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(MatA, MatB)
 
 #define MatGetProdVec(Mat, Vec) _Generic(Mat, \
   MatFloat*: _Generic(Vec, \
-    VecFloat*: _MatFloatGetProdVecFloat, \
-    const VecFloat*: _MatFloatGetProdVecFloat, \
-    VecFloat2D*: _MatFloatGetProdVecFloat, \
-    const VecFloat2D*: _MatFloatGetProdVecFloat, \
-    VecFloat3D*: _MatFloatGetProdVecFloat, \
-    const VecFloat3D*: _MatFloatGetProdVecFloat, \
+    VecFloat*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat*: _MatFloatGetProdVecFloatFast, \
+    VecFloat2D*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat2D*: _MatFloatGetProdVecFloatFast, \
+    VecFloat3D*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat3D*: _MatFloatGetProdVecFloatFast, \
     default: PBErrInvalidPolymorphism), \
   const MatFloat*: _Generic(Vec, \
-    VecFloat*: _MatFloatGetProdVecFloat, \
-    const VecFloat*: _MatFloatGetProdVecFloat, \
-    VecFloat2D*: _MatFloatGetProdVecFloat, \
-    const VecFloat2D*: _MatFloatGetProdVecFloat, \
-    VecFloat3D*: _MatFloatGetProdVecFloat, \
-    const VecFloat3D*: _MatFloatGetProdVecFloat, \
-    default: PBErrInvalidPolymorphism), \
-  default: PBErrInvalidPolymorphism)(Mat, (VecFloat*)(Vec))
+    VecFloat*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat*: _MatFloatGetProdVecFloatFast, \
+    VecFloat2D*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat2D*: _MatFloatGetProdVecFloatFast, \
+    VecFloat3D*: _MatFloatGetProdVecFloatFast, \
+    const VecFloat3D*: _MatFloatGetProdVecFloatFast, \
+    default: PBErrInvalidPolymorphism), \
+  MatDouble*: _Generic(Vec, \
+    VecDouble*: _MatDoubleGetProdVecDouble, \
+    const VecDouble*: _MatDoubleGetProdVecDouble, \
+    default: PBErrInvalidPolymorphism), \
+  const MatDouble*: _Generic(Vec, \
+    VecDouble*: _MatDoubleGetProdVecDouble, \
+    const VecDouble*: _MatDoubleGetProdVecDouble, \
+    default: PBErrInvalidPolymorphism), \
+  MatFloat3x3*: _Generic(Vec, \
+    VecFloat3D*: _MatFloatGetProdVecFloat3x3, \
+    const VecFloat3D*: _MatFloatGetProdVecFloat3x3, \
+    default: PBErrInvalidPolymorphism), \
+  const MatFloat3x3*: _Generic(Vec, \
+    VecFloat3D*: _MatFloatGetProdVecFloat3x3, \
+    const VecFloat3D*: _MatFloatGetProdVecFloat3x3, \
+    default: PBErrInvalidPolymorphism), \
+  MatFloat4x4*: _Generic(Vec, \
+    VecFloat4D*: _MatFloatGetProdVecFloat4x4, \
+    const VecFloat4D*: _MatFloatGetProdVecFloat4x4, \
+    default: PBErrInvalidPolymorphism), \
+  const MatFloat4x4*: _Generic(Vec, \
+    VecFloat4D*: _MatFloatGetProdVecFloat4x4, \
+    const VecFloat4D*: _MatFloatGetProdVecFloat4x4, \
+    default: PBErrInvalidPolymorphism), \
+  default: PBErrInvalidPolymorphism)(Mat, _Generic(Mat, \
+    MatFloat3x3*: (Vec), \
+    const MatFloat3x3*: (Vec), \
+    MatFloat4x4*: (Vec), \
+    const MatFloat4x4*: (Vec), \
+    default: _Generic(Vec, \
+      VecDouble*: (const VecDouble*)(Vec), \
+      const VecDouble*: (const VecDouble*)(Vec), \
+      default: (VecFloat*)(Vec))))
+
+#define MatProdVec(Mat, Vec, Res) _Generic(Mat, \
+  MatFloat*: _MatFloatProdVecFloat, \
+  const MatFloat*: _MatFloatProdVecFloat, \
+  default: PBErrInvalidPolymorphism)(Mat, (const VecFloat*)(Vec), \
+    (VecFloat*)(Res))
+
+#define MatProdMat(MatA, MatB, Res) _Generic(MatA, \
+  MatFloat*: _MatFloatProdMatFloat, \
+  const MatFloat*: _MatFloatProdMatFloat, \
+  default: PBErrInvalidPolymorphism)(MatA, MatB, Res)
+
+#define MatProdMatParallel(MatA, MatB, Res, NbThread) _Generic(MatA, \
+  MatFloat*: _MatFloatProdMatFloatParallel, \
+  const MatFloat*: _MatFloatProdMatFloatParallel, \
+  default: PBErrInvalidPolymorphism)(MatA, MatB, Res, NbThread)
 
 #define MatGetProdVecVecTranspose(VecA, VecB) _Generic(VecA, \
   VecFloat*: _Generic(VecB, \
@@ -3745,6 +5601,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
 #define MatScale(MatA, A) _Generic(MatA, \
   MatFloat*: _MatFloatScale, \
   const MatFloat*: _MatFloatScale, \
+  MatDouble*: _MatDoubleScale, \
   default: PBErrInvalidPolymorphism)(MatA, A)
 
 #define MatGetAdd(MatA, MatB) _Generic(MatA, \
@@ -3760,6 +5617,7 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
 
 #define MatSetIdentity(Mat) _Generic(Mat, \
   MatFloat*: _MatFloatSetIdentity, \
+  MatDouble*: _MatDoubleSetIdentity, \
   default: PBErrInvalidPolymorphism)(Mat)
 
 #define MatIsEqual(MatA, MatB) _Generic(MatA, \
@@ -3771,15 +5629,23 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
     MatFloat*: _MatFloatIsEqual, \
     const MatFloat*: _MatFloatIsEqual, \
     default: PBErrInvalidPolymorphism), \
+  MatDouble*: _Generic(MatB, \
+    MatDouble*: _MatDoubleIsEqual, \
+    const MatDouble*: _MatDoubleIsEqual, \
+    default: PBErrInvalidPolymorphism), \
+  const MatDouble*: _Generic(MatB, \
+    MatDouble*: _MatDoubleIsEqual, \
+    const MatDouble*: _MatDoubleIsEqual, \
+    default: PBErrInvalidPolymorphism), \
   default: PBErrInvalidPolymorphism)(MatA, MatB)
 
 #define SysLinEqCreate(Mat, Vec) _Generic(Vec, \
-  VecFloat*: _SLECreate, \
-  const VecFloat*: _SLECreate, \
-  VecFloat2D*: _SLECreate, \
-  const VecFloat2D*: _SLECreate, \
-  VecFloat3D*: _SLECreate, \
-  const VecFloat3D*: _SLECreate, \
+  VecFloat*: _SLECreateFast, \
+  const VecFloat*: _SLECreateFast, \
+  VecFloat2D*: _SLECreateFast, \
+  const VecFloat2D*: _SLECreateFast, \
+  VecFloat3D*: _SLECreateFast, \
+  const VecFloat3D*: _SLECreateFast, \
   default: PBErrInvalidPolymorphism)(Mat, (VecFloat*)(Vec))
 
 #define SysLinEqSetV(Sys, Vec) _Generic(Vec, \
@@ -3791,6 +5657,8 @@ unsigned int GetGCD(unsigned int u, unsigned int v);
   const VecFloat3D*: _SLESetV, \
   default: PBErrInvalidPolymorphism)(Sys, (VecFloat*)(Vec))
 
+#define GSetShuffleWith(Set, Rng) _GSetShuffleWith((GSet*)(Set), Rng)
+
 // ================ static inliner ====================
 
 #if BUILDMODE != 0
@@ -770,6 +770,17 @@ void _ShapoidRotOrigin(Shapoid* const that, const float theta) {
   ShapoidUpdateSysLinEqImport(that);
 }
 
+// Rotate the axes of the Shapoid 'that' of dimension 3 with the 
+// rotation matrix 'rot'
+static inline void ShapoidRotAxesMat3x3(Shapoid* const that, 
+  const MatFloat3x3* const rot) {
+  for (int iAxis = that->_dim; iAxis--;) {
+    VecFloat3D v = 
+      MatGetProdVec(rot, (const VecFloat3D*)(that->_axis[iAxis]));
+    VecCopy(that->_axis[iAxis], &v);
+  }
+}
+
 // Rotate the Shapoid of dimension 3 by 'theta' (in radians, CCW)
 // relatively to its center around 'axis'
 // 'axis' must be normalized
@@ -809,24 +820,24 @@ void _ShapoidRotAxisCenter(Shapoid* const that,
     PBErrCatch(ShapoidErr);
   }
 #endif
+  // Calculate the rotation matrix once for all the vectors
+  const MatFloat3x3 rot = MatFloatGetRotAxis3x3(axis, theta);
   // If it's a spheroid
   if (that->_type == ShapoidTypeSpheroid) {
   // Rotate each axis
-  for (int iAxis = that->_dim; iAxis--;)
-    VecRotAxis(that->_axis[iAxis], axis, theta);
+  ShapoidRotAxesMat3x3(that, &rot);
   // Else, it's not a spheroid
   } else {
     VecFloat* center = ShapoidGetCenter(that);
     // Rotate each axis
-    for (int iAxis = that->_dim; iAxis--;)
-      VecRotAxis(that->_axis[iAxis], axis, theta);
+    ShapoidRotAxesMat3x3(that, &rot);
     // Reposition the origin
-    VecFloat* v = VecGetOp(that->_pos, 1.0, center, -1.0);
-    VecRotAxis(v, axis, theta);
-    VecOp(v, 1.0, center, 1.0);
-    VecCopy(that->_pos, v);
+    VecFloat3D v = VecGetOp((const VecFloat3D*)(that->_pos), 1.0, 
+      (const VecFloat3D*)center, -1.0);
+    v = MatGetProdVec(&rot, &v);
+    VecOp(&v, 1.0, (const VecFloat3D*)center, 1.0);
+    VecCopy(that->_pos, &v);
     VecFree(&center);
-    VecFree(&v);
   }
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
@@ -865,8 +876,8 @@ void _ShapoidRotAxisStart(Shapoid* const that,
   }
 #endif
   // Rotate each axis
-  for (int iAxis = that->_dim; iAxis--;)
-    VecRotAxis(that->_axis[iAxis], axis, theta);
+  const MatFloat3x3 rot = MatFloatGetRotAxis3x3(axis, theta);
+  ShapoidRotAxesMat3x3(that, &rot);
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
 }
@@ -905,10 +916,11 @@ void _ShapoidRotAxisOrigin(Shapoid* const that,
   }
 #endif
   // Rotate each axis
-  for (int iAxis = that->_dim; iAxis--;)
-    VecRotAxis(that->_axis[iAxis], axis, theta);
+  const MatFloat3x3 rot = MatFloatGetRotAxis3x3(axis, theta);
+  ShapoidRotAxesMat3x3(that, &rot);
   // Reposition the origin
-  VecRotAxis(that->_pos, axis, theta);
+  VecFloat3D v = MatGetProdVec(&rot, (const VecFloat3D*)(that->_pos));
+  VecCopy(that->_pos, &v);
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
 }
@@ -951,12 +963,12 @@ void _ShapoidRotXCenter(Shapoid* const that, const float theta) {
     for (int iAxis = that->_dim; iAxis--;)
       VecRotX(that->_axis[iAxis], theta);
     // Reposition the origin
-    VecFloat* v = VecGetOp(that->_pos, 1.0, center, -1.0);
-    VecRotX(v, theta);
-    VecOp(v, 1.0, center, 1.0);
-    VecCopy(that->_pos, v);
+    VecFloat3D v = VecGetOp((const VecFloat3D*)(that->_pos), 1.0, 
+      (const VecFloat3D*)center, -1.0);
+    VecRotX(&v, theta);
+    VecOp(&v, 1.0, (const VecFloat3D*)center, 1.0);
+    VecCopy(that->_pos, &v);
     VecFree(&center);
-    VecFree(&v);
   }
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
@@ -1057,12 +1069,12 @@ void _ShapoidRotYCenter(Shapoid* const that, const float theta) {
     for (int iAxis = that->_dim; iAxis--;)
       VecRotY(that->_axis[iAxis], theta);
     // Reposition the origin
-    VecFloat* v = VecGetOp(that->_pos, 1.0, center, -1.0);
-    VecRotY(v, theta);
-    VecOp(v, 1.0, center, 1.0);
-    VecCopy(that->_pos, v);
+    VecFloat3D v = VecGetOp((const VecFloat3D*)(that->_pos), 1.0, 
+      (const VecFloat3D*)center, -1.0);
+    VecRotY(&v, theta);
+    VecOp(&v, 1.0, (const VecFloat3D*)center, 1.0);
+    VecCopy(that->_pos, &v);
     VecFree(&center);
-    VecFree(&v);
   }
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
@@ -1164,12 +1176,12 @@ void _ShapoidRotZCenter(Shapoid* const that, const float theta) {
     for (int iAxis = that->_dim; iAxis--;)
       VecRotZ(that->_axis[iAxis], theta);
     // Reposition the origin
-    VecFloat* v = VecGetOp(that->_pos, 1.0, center, -1.0);
-    VecRotZ(v, theta);
-    VecOp(v, 1.0, center, 1.0);
-    VecCopy(that->_pos, v);
+    VecFloat3D v = VecGetOp((const VecFloat3D*)(that->_pos), 1.0, 
+      (const VecFloat3D*)center, -1.0);
+    VecRotZ(&v, theta);
+    VecOp(&v, 1.0, (const VecFloat3D*)center, 1.0);
+    VecCopy(that->_pos, &v);
     VecFree(&center);
-    VecFree(&v);
   }
   // Update the SysLinEq
   ShapoidUpdateSysLinEqImport(that);
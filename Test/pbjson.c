@@ -0,0 +1,393 @@
+// Unit tests of the conversions between float and string of PBJSON,
+// of the validation of the unquoted values by its parsers, and of the
+// JSONDoc of arrays
+// JSONStrToFloat must give the same float as strtof, and
+// JSONFloatToStr the shortest string which strtof converts back
+// exactly
+// Run with the argument 'all' to check every float instead of a
+// sample (takes hours)
+
+#include <stdio.h>
+#include <float.h>
+#include <string.h>
+#include "pbjson.h"
+
+// Seed of the random strings, the sequence is the same on every run
+static uint64_t testSeed = 0x9E3779B97F4A7C15;
+
+// Return a pseudo random 64 bits integer
+static uint64_t TestRand(void) {
+  testSeed ^= testSeed << 13;
+  testSeed ^= testSeed >> 7;
+  testSeed ^= testSeed << 17;
+  return testSeed;
+}
+
+// Return the float with the bits 'bits'
+static float TestBitsToFloat(const uint32_t bits) {
+  float f = 0.0;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Return true if 'a' and 'b' are the same float (same bits)
+static bool TestIsSameFloat(const float a, const float b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// Check that JSONStrToFloat converts 'str' as strtof does
+// Return false if it doesn't
+static bool TestStrToFloat(const char* const str) {
+  float val = 0.0;
+  if (!JSONStrToFloat(str, &val)) {
+    printf("JSONStrToFloat rejected \"%s\"\n", str);
+    return false;
+  }
+  float ref = strtof(str, NULL);
+  if (!TestIsSameFloat(val, ref)) {
+    printf("JSONStrToFloat(\"%s\") = %a, strtof gives %a\n",
+      str, val, ref);
+    return false;
+  }
+  return true;
+}
+
+// Check that JSONFloatToStr gives for 'val' a string which converts
+// back to 'val' with strtof and JSONStrToFloat, and which has no more
+// significant digits than the shortest "%.<n>g" doing so
+// Return false if it doesn't
+static bool TestFloatToStr(const float val) {
+  char str[PBJSON_FLOATSTRLEN];
+  int len = JSONFloatToStr(val, str);
+  if (len != (int)strlen(str)) {
+    printf("JSONFloatToStr(%a) returned %d for \"%s\"\n", val, len, str);
+    return false;
+  }
+  if (isnan(val))
+    return isnan(strtof(str, NULL));
+  if (!TestIsSameFloat(strtof(str, NULL), val)) {
+    printf("JSONFloatToStr(%a) = \"%s\" doesn't convert back\n",
+      val, str);
+    return false;
+  }
+  float back = 0.0;
+  if (!JSONStrToFloat(str, &back) || !TestIsSameFloat(back, val)) {
+    printf("JSONFloatToStr(%a) = \"%s\" doesn't convert back with "
+      "JSONStrToFloat\n", val, str);
+    return false;
+  }
+  if (isinf(val) || val == 0.0)
+    return true;
+  // Count the significant digits of the result and of the shortest
+  // "%.<n>g"
+  int nbDigit = 0;
+  bool isSignif = false;
+  for (const char* ptr = str; *ptr != '\0' && *ptr != 'e'; ++ptr) {
+    if (*ptr >= '1' && *ptr <= '9') {
+      isSignif = true;
+      ++nbDigit;
+    } else if (*ptr == '0' && isSignif) {
+      const char* next = ptr;
+      while (*next == '0' || *next == '.')
+        ++next;
+      if (*next >= '1' && *next <= '9')
+        ++nbDigit;
+    }
+  }
+  int nbDigitRef = 1;
+  char ref[32];
+  for (; nbDigitRef < 9; ++nbDigitRef) {
+    sprintf(ref, "%.*g", nbDigitRef, val);
+    if (TestIsSameFloat(strtof(ref, NULL), val))
+      break;
+  }
+  if (nbDigit > nbDigitRef) {
+    printf("JSONFloatToStr(%a) = \"%s\" is not the shortest (%.*g)\n",
+      val, str, nbDigitRef, val);
+    return false;
+  }
+  return true;
+}
+
+// Raise the unit test failure for the test 'name' if 'nbFail' > 0
+static void TestCheck(const char* const name, const long nbFail,
+  const long nbTest) {
+  if (nbFail > 0) {
+    JSONErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(JSONErr->_msg, "%s failed (%ld/%ld)", name, nbFail, nbTest);
+    PBErrCatch(JSONErr);
+  }
+  printf("%s OK (%ld cases)\n", name, nbTest);
+}
+
+// Special values and the examples of past bugs
+void UnitTestJSONStrToFloatSpecial() {
+  const char* strs[] = {"0", "-0", "0.0", "1", "-1", "0.1", "1e10",
+    "1E-10", "3.4028235e38", "3.4028236e38", "1e39", "1.17549435e-38",
+    "1.4e-45", "7e-46", "1e-50", "16777216", "16777217", "16777219",
+    "0.0139460782520473", "123456789012345678901234567890",
+    "0.000000000000000000000000000001", "4.2", "-273.15",
+    "1.00000005960464477539062", "1.000000059604644775390625",
+    "1.00000005960464477539063", "inf", "-inf"};
+  const long nb = sizeof(strs) / sizeof(strs[0]);
+  long nbFail = 0;
+  for (long i = 0; i < nb; ++i)
+    if (!TestStrToFloat(strs[i]))
+      ++nbFail;
+  float val = 0.0;
+  const char* invalids[] = {"", "-", ".", "e5", "1e", "1.5x", "--1"};
+  const long nbInvalid = sizeof(invalids) / sizeof(invalids[0]);
+  for (long i = 0; i < nbInvalid; ++i)
+    if (JSONStrToFloat(invalids[i], &val)) {
+      printf("JSONStrToFloat accepted \"%s\"\n", invalids[i]);
+      ++nbFail;
+    }
+  TestCheck("UnitTestJSONStrToFloatSpecial", nbFail, nb + nbInvalid);
+}
+
+// Decimal strings lying at, or very near, the middle of two
+// consecutive floats, where a double rounding gives the wrong float
+void UnitTestJSONStrToFloatMidpoint() {
+  const long nb = 1000000;
+  long nbFail = 0;
+  char str[64];
+  for (long i = 0; i < nb; ++i) {
+    // Random positive finite float and its successor
+    uint32_t bits = (uint32_t)(TestRand() % 0x7F7FFFFF);
+    double mid =
+      0.5 * ((double)TestBitsToFloat(bits) +
+      (double)TestBitsToFloat(bits + 1));
+    // The midpoint written with more or less digits than needed
+    int nbDigit = 8 + (int)(TestRand() % 17);
+    sprintf(str, "%.*g", nbDigit, mid);
+    if (!TestStrToFloat(str))
+      ++nbFail;
+  }
+  TestCheck("UnitTestJSONStrToFloatMidpoint", nbFail, nb);
+}
+
+// Random decimal strings of 1 to 20 significant digits
+void UnitTestJSONStrToFloatRandom() {
+  const long nb = 2000000;
+  long nbFail = 0;
+  char str[64];
+  for (long i = 0; i < nb; ++i) {
+    int nbDigit = 1 + (int)(TestRand() % 20);
+    int len = 0;
+    if (TestRand() % 2)
+      str[len++] = '-';
+    int posPoint = (int)(TestRand() % (nbDigit + 1));
+    for (int iDigit = 0; iDigit < nbDigit; ++iDigit) {
+      if (iDigit == posPoint)
+        str[len++] = '.';
+      str[len++] = '0' + (char)(TestRand() % 10);
+    }
+    if (posPoint == 0 && len > 0 && str[len - 1] == '.')
+      str[len++] = '0';
+    if (TestRand() % 2)
+      len += sprintf(str + len, "e%d", (int)(TestRand() % 90) - 45);
+    str[len] = '\0';
+    if (!TestStrToFloat(str))
+      ++nbFail;
+  }
+  TestCheck("UnitTestJSONStrToFloatRandom", nbFail, nb);
+}
+
+// Round trip float -> string -> float on every float if 'isAll', else
+// on a sample of them, plus the special ones
+void UnitTestJSONFloatRoundTrip(const bool isAll) {
+  long nbFail = 0;
+  long nbTest = 0;
+  const float specials[] = {0.0, -0.0, 1.0, -1.0, 0.1, FLT_MIN,
+    -FLT_MIN, FLT_MAX, -FLT_MAX, FLT_EPSILON, 1.0e-45, 16777216.0,
+    INFINITY, -INFINITY, NAN};
+  const long nbSpecial = sizeof(specials) / sizeof(specials[0]);
+  for (long i = 0; i < nbSpecial; ++i, ++nbTest)
+    if (!TestFloatToStr(specials[i]))
+      ++nbFail;
+  // The stride is odd and not a power of 2 to sample every exponent
+  // and every pattern of low bits
+  const uint64_t stride = (isAll ? 1 : 4099);
+  for (uint64_t bits = 0; bits < 0x100000000; bits += stride) {
+    float val = TestBitsToFloat((uint32_t)bits);
+    if (isnan(val))
+      continue;
+    ++nbTest;
+    if (!TestFloatToStr(val)) {
+      ++nbFail;
+      if (nbFail > 20)
+        break;
+    }
+  }
+  TestCheck("UnitTestJSONFloatRoundTrip", nbFail, nbTest);
+}
+
+// Count the values given by the streaming parser
+static bool TestCountVal(const char* const val, void* const param) {
+  (void)val;
+  ++(*(long*)param);
+  return true;
+}
+
+// Unquoted values must be true, false, null or a number for the 
+// streaming parser and the JSONDoc
+void UnitTestJSONParseLiteral() {
+  const char* valids[] = {"{\"a\":true}", "{\"a\":false}", 
+    "{\"a\":null}", "{\"a\":0}", "{\"a\":-0.5}", "{\"a\":1e10}", 
+    "{\"a\":12.5E-3}", "{\"a\":-1E+2}", "{\"a\":inf}", 
+    "{\"a\":-nan}", "{\"a\":[1,null,\"b\"]}", "{\"a\":1 ,\"b\":2}"};
+  const long nbValid = sizeof(valids) / sizeof(valids[0]);
+  const char* invalids[] = {"{\"a\":b:c}", "{\"a\":b}", "{\"a\":True}", 
+    "{\"a\":nul}", "{\"a\":truex}", "{\"a\":01}", "{\"a\":1.}", 
+    "{\"a\":.5}", "{\"a\":+1}", "{\"a\":1e}", "{\"a\":-}", 
+    "{\"a\":0x10}", "{\"a\":[1,b]}", "{\"a\":1:2}"};
+  const long nbInvalid = sizeof(invalids) / sizeof(invalids[0]);
+  long nbFail = 0;
+  JSONSAXHandler handler = {._val = TestCountVal};
+  for (long i = 0; i < nbValid + nbInvalid; ++i) {
+    bool isValid = (i < nbValid);
+    const char* str = (isValid ? valids[i] : invalids[i - nbValid]);
+    long nbVal = 0;
+    handler._param = &nbVal;
+    JSONDoc* doc = JSONDocLoadFromStr(str);
+    if (JSONParseFromStr(str, &handler) != isValid || 
+      (doc != NULL) != isValid) {
+      printf("\"%s\" is %s but isn't parsed as such\n", str, 
+        (isValid ? "valid" : "invalid"));
+      ++nbFail;
+    }
+    JSONDocFree(&doc);
+  }
+  TestCheck("UnitTestJSONParseLiteral", nbFail, nbValid + nbInvalid);
+}
+
+// The JSONDoc of a JSON array is rooted at a node labelled "[]"
+void UnitTestJSONDocArrayRoot() {
+  long nbFail = 0;
+  long nbTest = 0;
+  // Array of values
+  JSONDoc* doc = JSONDocLoadFromStr(" [1, \"b\", null] ");
+  const JSONNode* root = (doc != NULL ? JSONDocRoot(doc) : NULL);
+  ++nbTest;
+  if (root == NULL || strcmp(JSONLabel(root), "[]") != 0 || 
+    JSONGetNbValue(root) != 3 || 
+    strcmp(JSONLabel(JSONValue(root, 0)), "1") != 0 || 
+    strcmp(JSONLabel(JSONValue(root, 1)), "b") != 0 || 
+    strcmp(JSONLabel(JSONValue(root, 2)), "null") != 0) {
+    printf("JSONDocLoadFromStr failed on an array of values\n");
+    ++nbFail;
+  }
+  JSONDocFree(&doc);
+  // Array of objects
+  doc = JSONDocLoadFromStr("[{\"x\":1},{\"x\":2,\"y\":[3]}]");
+  root = (doc != NULL ? JSONDocRoot(doc) : NULL);
+  ++nbTest;
+  if (root == NULL || strcmp(JSONLabel(root), "[]") != 0 || 
+    JSONGetNbValue(root) != 2 || JSONLabel(JSONValue(root, 1)) != NULL ||
+    strcmp(JSONLblVal(JSONProperty(JSONValue(root, 1), "x")), "2") != 0 ||
+    strcmp(JSONLblVal(JSONProperty(JSONValue(root, 1), "y")), "3") != 0) {
+    printf("JSONDocLoadFromStr failed on an array of objects\n");
+    ++nbFail;
+  }
+  JSONDocFree(&doc);
+  // Empty array, same as an empty array property
+  doc = JSONDocLoadFromStr("[]");
+  root = (doc != NULL ? JSONDocRoot(doc) : NULL);
+  ++nbTest;
+  if (root == NULL || strcmp(JSONLabel(root), "[]") != 0 || 
+    JSONGetNbValue(root) != 1 || JSONLabel(JSONValue(root, 0)) != NULL) {
+    printf("JSONDocLoadFromStr failed on an empty array\n");
+    ++nbFail;
+  }
+  JSONDocFree(&doc);
+  // The root of an object stays unlabelled
+  doc = JSONDocLoadFromStr("{\"a\":[{\"x\":1}]}");
+  root = (doc != NULL ? JSONDocRoot(doc) : NULL);
+  ++nbTest;
+  if (root == NULL || JSONLabel(root) != NULL || 
+    JSONProperty(root, "a") == NULL || 
+    strcmp(JSONLabel(JSONProperty(root, "a")), "[]a") != 0) {
+    printf("JSONDocLoadFromStr failed on an object\n");
+    ++nbFail;
+  }
+  JSONDocFree(&doc);
+  // Unsupported or invalid arrays
+  const char* invalids[] = {"[[1]]", "[1,{\"x\":1}]", "[{\"x\":1},1]", 
+    "[1,]", "[1", "]"};
+  const long nbInvalid = sizeof(invalids) / sizeof(invalids[0]);
+  for (long i = 0; i < nbInvalid; ++i, ++nbTest) {
+    doc = JSONDocLoadFromStr(invalids[i]);
+    if (doc != NULL) {
+      printf("JSONDocLoadFromStr accepted \"%s\"\n", invalids[i]);
+      ++nbFail;
+    }
+    JSONDocFree(&doc);
+  }
+  TestCheck("UnitTestJSONDocArrayRoot", nbFail, nbTest);
+}
+
+// Check the JSONIndex on an object whose properties are removed and
+// added, and the index invalidated, after its first lookup
+void UnitTestJSONIndexInvalidate() {
+  long nbFail = 0;
+  long nbTest = 0;
+  const long nbProp = 100;
+  JSONNode* obj = JSONCreate();
+  char key[32];
+  for (long iProp = 0; iProp < nbProp; ++iProp) {
+    sprintf(key, "k%ld", iProp);
+    JSONAddProp(obj, key, "1");
+  }
+  JSONIndex index = JSONIndexCreateStatic(obj);
+  ++nbTest;
+  if (JSONIndexProperty(&index, "k0") != JSONProperty(obj, "k0") ||
+    JSONIndexProperty(&index, "k0") == NULL) {
+    printf("JSONIndexProperty failed before the changes\n");
+    ++nbFail;
+  }
+  // Remove the first property and add a new one, the number of 
+  // properties is unchanged
+  JSONNode* prop = GSetPop(JSONProperties(obj));
+  // JSONFree expects an unlabelled root, free the key of the property
+  // first
+  free(JSONLabel(prop));
+  prop->_tree._data = NULL;
+  JSONFree(&prop);
+  JSONAddProp(obj, "new", "1");
+  JSONIndexInvalidate(&index);
+  ++nbTest;
+  if (JSONIndexProperty(&index, "k0") != NULL) {
+    printf("JSONIndexProperty returned a removed property\n");
+    ++nbFail;
+  }
+  ++nbTest;
+  if (JSONIndexProperty(&index, "new") == NULL ||
+    JSONIndexProperty(&index, "new") != JSONProperty(obj, "new")) {
+    printf("JSONIndexProperty missed an added property\n");
+    ++nbFail;
+  }
+  for (long iProp = 1; iProp < nbProp; ++iProp, ++nbTest) {
+    sprintf(key, "k%ld", iProp);
+    if (JSONIndexProperty(&index, key) == NULL ||
+      JSONIndexProperty(&index, key) != JSONProperty(obj, key)) {
+      printf("JSONIndexProperty failed on \"%s\"\n", key);
+      ++nbFail;
+    }
+  }
+  JSONIndexFreeStatic(&index);
+  JSONFree(&obj);
+  TestCheck("UnitTestJSONIndexInvalidate", nbFail, nbTest);
+}
+
+int main(int argc, char** argv) {
+  bool isAll = (argc > 1 && strcmp(argv[1], "all") == 0);
+  UnitTestJSONStrToFloatSpecial();
+  UnitTestJSONStrToFloatMidpoint();
+  UnitTestJSONStrToFloatRandom();
+  UnitTestJSONFloatRoundTrip(isAll);
+  UnitTestJSONParseLiteral();
+  UnitTestJSONDocArrayRoot();
+  UnitTestJSONIndexInvalidate();
+  printf("UnitTestPBJSON OK\n");
+  return 0;
+}
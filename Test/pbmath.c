@@ -0,0 +1,287 @@
+// Unit tests of the SIMD kernels of the arithmetic on VecFloat
+// The results must match the scalar loop (up to the rounding of the
+// different summation order) on every dimension, in particular the
+// ones below PBMATH_SIMDMINDIM and the ones which are not a multiple
+// of the width of the SIMD registers, and the kernels must not write
+// after the end of the result
+// The public VecFloat functions are checked on the kernels selected
+// for the CPU, and in release mode on x86 the SSE and AVX2 kernels are
+// also checked individually
+
+#include <stdio.h>
+#include "pbmath.h"
+
+// Number of floats after the end of the vectors, which must be left
+// untouched by the kernels
+#define TEST_NBSENTINEL 9
+#define TEST_SENTINEL 12345.0
+
+// Largest dimension checked
+#define TEST_MAXDIM 4097
+
+// Kernels of one implementation on vectors of the same dimension
+typedef struct TestKernels {
+  // Name of the implementation
+  const char* _name;
+  // Dot product of 'a' and 'b'
+  float (*_dot)(const VecFloat* const a, const VecFloat* const b);
+  // Squared distance between 'a' and 'b'
+  float (*_distSq)(const VecFloat* const a, const VecFloat* const b);
+  // res = ca * res + cb * b
+  void (*_op)(VecFloat* const res, const float ca,
+    const VecFloat* const b, const float cb);
+  // res = res * b
+  void (*_hadamard)(VecFloat* const res, const VecFloat* const b);
+  // res = c * res
+  void (*_scale)(VecFloat* const res, const float c);
+  // res += (a - c)^2
+  void (*_addSqDiff)(const VecFloat* const a, const float c,
+    VecFloat* const res);
+  // Dot product of 'a' and 'b' in double precision
+  double (*_dotDouble)(const VecFloat* const a, const VecFloat* const b);
+  // Squared distance between 'a' and 'b' in double precision
+  double (*_distSqDouble)(const VecFloat* const a,
+    const VecFloat* const b);
+} TestKernels;
+
+// Kernels through the public functions of VecFloat
+static float TestDotVecFloat(const VecFloat* const a,
+  const VecFloat* const b) {
+  return VecDotProd(a, b);
+}
+static float TestDistSqVecFloat(const VecFloat* const a,
+  const VecFloat* const b) {
+  return fsquare(VecDist(a, b));
+}
+static void TestOpVecFloat(VecFloat* const res, const float ca,
+  const VecFloat* const b, const float cb) {
+  VecOp(res, ca, b, cb);
+}
+static void TestHadamardVecFloat(VecFloat* const res,
+  const VecFloat* const b) {
+  VecHadamardProd(res, b);
+}
+static void TestScaleVecFloat(VecFloat* const res, const float c) {
+  VecScale(res, c);
+}
+static void TestAddSqDiffVecFloat(const VecFloat* const a,
+  const float c, VecFloat* const res) {
+  VecFloatKernelAddSqDiff(a->_val, c, res->_val, a->_dim);
+}
+static double TestDotDoubleVecFloat(const VecFloat* const a,
+  const VecFloat* const b) {
+  return VecDotProdDouble(a, b);
+}
+static double TestDistSqDoubleVecFloat(const VecFloat* const a,
+  const VecFloat* const b) {
+  double dist = VecDistDouble(a, b);
+  return dist * dist;
+}
+
+#if BUILDMODE != 0 && PBMATH_SIMD_X86
+// Kernels of the SIMD implementation 'Simd' (SSE or AVX2)
+#define TEST_KERNELS(Simd) \
+static float TestDot##Simd(const VecFloat* const a, \
+  const VecFloat* const b) { \
+  return VecFloatKernelDot##Simd(a->_val, b->_val, a->_dim); \
+} \
+static float TestDistSq##Simd(const VecFloat* const a, \
+  const VecFloat* const b) { \
+  return VecFloatKernelDistSq##Simd(a->_val, b->_val, a->_dim); \
+} \
+static void TestOp##Simd(VecFloat* const res, const float ca, \
+  const VecFloat* const b, const float cb) { \
+  VecFloatKernelOp##Simd(res->_val, ca, b->_val, cb, res->_val, \
+    res->_dim); \
+} \
+static void TestHadamard##Simd(VecFloat* const res, \
+  const VecFloat* const b) { \
+  VecFloatKernelHadamard##Simd(res->_val, b->_val, res->_val, \
+    res->_dim); \
+} \
+static void TestScale##Simd(VecFloat* const res, const float c) { \
+  VecFloatKernelScale##Simd(res->_val, c, res->_val, res->_dim); \
+} \
+static void TestAddSqDiff##Simd(const VecFloat* const a, \
+  const float c, VecFloat* const res) { \
+  VecFloatKernelAddSqDiff##Simd(a->_val, c, res->_val, a->_dim); \
+} \
+static double TestDotDouble##Simd(const VecFloat* const a, \
+  const VecFloat* const b) { \
+  return VecFloatKernelDotDouble##Simd(a->_val, b->_val, a->_dim); \
+} \
+static double TestDistSqDouble##Simd(const VecFloat* const a, \
+  const VecFloat* const b) { \
+  return VecFloatKernelDistSqDouble##Simd(a->_val, b->_val, a->_dim); \
+}
+TEST_KERNELS(SSE)
+TEST_KERNELS(AVX2)
+#endif
+
+#define TEST_KERNELS_INIT(Name) {._name = #Name, ._dot = TestDot##Name, \
+  ._distSq = TestDistSq##Name, ._op = TestOp##Name, \
+  ._hadamard = TestHadamard##Name, ._scale = TestScale##Name, \
+  ._addSqDiff = TestAddSqDiff##Name, ._dotDouble = TestDotDouble##Name, \
+  ._distSqDouble = TestDistSqDouble##Name}
+
+// Seed of the random values, the sequence is the same on every run
+static uint64_t testSeed = 0x9E3779B97F4A7C15;
+
+// Return a pseudo random float in [-1, 1]
+static float TestRand(void) {
+  testSeed ^= testSeed << 13;
+  testSeed ^= testSeed >> 7;
+  testSeed ^= testSeed << 17;
+  return (float)((double)(testSeed >> 11) / (double)(1ULL << 52) - 1.0);
+}
+
+// Return a new VecFloat of dimension 'dim' with random values,
+// followed by TEST_NBSENTINEL sentinel values
+static VecFloat* TestCreateVec(const long dim) {
+  VecFloat* v = VecFloatCreate(dim + TEST_NBSENTINEL);
+  for (long i = 0; i < dim; ++i)
+    v->_val[i] = TestRand();
+  for (long i = dim; i < dim + TEST_NBSENTINEL; ++i)
+    v->_val[i] = TEST_SENTINEL;
+  v->_dim = dim;
+  return v;
+}
+
+// Return true if the sentinel values after the VecFloat 'v' are intact
+static bool TestIsSentinelOk(const VecFloat* const v) {
+  for (long i = v->_dim; i < v->_dim + TEST_NBSENTINEL; ++i)
+    if (v->_val[i] != TEST_SENTINEL)
+      return false;
+  return true;
+}
+
+// Return true if 'val' equals 'ref' up to 'tol'
+static bool TestIsClose(const double val, const double ref,
+  const double tol) {
+  return fabs(val - ref) <= tol;
+}
+
+// Check the kernels 'kernels' on vectors of dimension 'dim'
+// Return the number of failed checks
+static long TestKernelsOnDim(const TestKernels* const kernels,
+  const long dim) {
+  long nbFail = 0;
+  VecFloat* a = TestCreateVec(dim);
+  VecFloat* b = TestCreateVec(dim);
+  VecFloat* res = TestCreateVec(dim);
+  const float ca = TestRand();
+  const float cb = TestRand();
+  // Rounding error of a sum of 'dim' floats, relative to the sum of
+  // the absolute values of the terms
+  const double tolSum = (double)(dim + 4) * FLT_EPSILON;
+  // Reductions
+  double dot = 0.0;
+  double dotAbs = 0.0;
+  double distSq = 0.0;
+  for (long i = 0; i < dim; ++i) {
+    dot += (double)(a->_val[i]) * (double)(b->_val[i]);
+    dotAbs += fabs((double)(a->_val[i]) * (double)(b->_val[i]));
+    distSq +=
+      ((double)(a->_val[i]) - (double)(b->_val[i])) *
+      ((double)(a->_val[i]) - (double)(b->_val[i]));
+  }
+  const char* failed = NULL;
+  if (!TestIsClose(kernels->_dot(a, b), dot, tolSum * dotAbs))
+    failed = "dot";
+  else if (!TestIsClose(kernels->_distSq(a, b), distSq, tolSum * distSq))
+    failed = "distSq";
+  else if (!TestIsClose(kernels->_dotDouble(a, b), dot, 1e-12 * dotAbs))
+    failed = "dotDouble";
+  else if (!TestIsClose(kernels->_distSqDouble(a, b), distSq,
+    1e-12 * distSq))
+    failed = "distSqDouble";
+  // Element wise operations, on a copy of 'a' in 'res'
+  const double tolElem = 4.0 * FLT_EPSILON;
+  for (int iOp = 0; iOp < 4 && failed == NULL; ++iOp) {
+    memcpy(res->_val, a->_val, sizeof(float) * dim);
+    if (iOp == 0)
+      kernels->_op(res, ca, b, cb);
+    else if (iOp == 1)
+      kernels->_hadamard(res, b);
+    else if (iOp == 2)
+      kernels->_scale(res, ca);
+    else
+      kernels->_addSqDiff(b, cb, res);
+    for (long i = 0; i < dim && failed == NULL; ++i) {
+      double x = a->_val[i];
+      double y = b->_val[i];
+      double ref = 0.0;
+      double mag = 0.0;
+      if (iOp == 0) {
+        ref = ca * x + cb * y;
+        mag = fabs(ca * x) + fabs(cb * y);
+      } else if (iOp == 1) {
+        ref = x * y;
+        mag = fabs(ref);
+      } else if (iOp == 2) {
+        ref = ca * x;
+        mag = fabs(ref);
+      } else {
+        ref = x + (y - cb) * (y - cb);
+        mag = fabs(x) + (y - cb) * (y - cb);
+      }
+      if (!TestIsClose(res->_val[i], ref, tolElem * mag)) {
+        const char* names[4] = {"op", "hadamard", "scale", "addSqDiff"};
+        failed = names[iOp];
+      }
+    }
+    if (failed == NULL && !TestIsSentinelOk(res))
+      failed = "write after the end";
+  }
+  if (failed != NULL || !TestIsSentinelOk(a) || !TestIsSentinelOk(b)) {
+    printf("%s kernels failed on dim %ld (%s)\n", kernels->_name, dim,
+      (failed != NULL ? failed : "write in the inputs"));
+    ++nbFail;
+  }
+  VecFree(&a);
+  VecFree(&b);
+  VecFree(&res);
+  return nbFail;
+}
+
+// Check the kernels against the scalar loop on every dimension up to
+// 129 and around the larger powers of 2 up to TEST_MAXDIM
+void UnitTestVecFloatKernels() {
+  TestKernels kernels[3] = {TEST_KERNELS_INIT(VecFloat)};
+  int nbKernels = 1;
+#if BUILDMODE != 0 && PBMATH_SIMD_X86
+  kernels[nbKernels++] = (TestKernels)TEST_KERNELS_INIT(SSE);
+  if (VecFloatKernelHasAVX2())
+    kernels[nbKernels++] = (TestKernels)TEST_KERNELS_INIT(AVX2);
+#endif
+  long nbFail = 0;
+  long nbTest = 0;
+  for (int iKernels = 0; iKernels < nbKernels; ++iKernels) {
+    for (long dim = 1; dim <= TEST_MAXDIM; ++dim) {
+      if (dim > 129) {
+        // Skip to the dimensions around the next power of 2
+        long pow = 256;
+        while (pow + 1 < dim)
+          pow *= 2;
+        if (dim < pow - 1)
+          dim = pow - 1;
+      }
+      nbFail += TestKernelsOnDim(kernels + iKernels, dim);
+      ++nbTest;
+    }
+    printf("%s kernels checked\n", kernels[iKernels]._name);
+  }
+  if (nbFail > 0) {
+    PBMathErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(PBMathErr->_msg, "UnitTestVecFloatKernels failed (%ld/%ld)",
+      nbFail, nbTest);
+    PBErrCatch(PBMathErr);
+  }
+  printf("UnitTestVecFloatKernels OK (%ld cases)\n", nbTest);
+}
+
+int main() {
+  UnitTestVecFloatKernels();
+  printf("UnitTestPBMath OK\n");
+  return 0;
+}